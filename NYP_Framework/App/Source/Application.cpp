@@ -6,7 +6,9 @@
  */
 #include "Application.h"
 
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 //Include the standard C++ headers
 #include <stdio.h>
 #include <stdlib.h>
@@ -18,13 +20,40 @@
 #endif
 
 // Include CSettings which stores information about the App
-#include "GameControl\Settings.h"
+#include "GameControl/Settings.h"
 // Include CShaderManager which manages the shaders used in this App
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CNullGLBackend, which replaces the OpenGL context in the headless mode
+#include "RenderControl/NullGLBackend.h"
 
 // Inputs
-#include "Inputs\KeyboardController.h"
-#include "Inputs\MouseController.h"
+#include "Inputs/KeyboardController.h"
+#include "Inputs/MouseController.h"
+
+// Include CJobSystem
+#include "System/JobSystem.h"
+// Include CRandomManager, which is seeded here so that a run can be repeated
+#include "System/Random.h"
+// Include CProfiler, which times the scopes of each frame
+#include "TimeControl/Profiler.h"
+// Include CRenderStats, which counts the GL calls of each frame
+#include "RenderControl/RenderStats.h"
+// Include CGPUTimer, which times the passes of each frame on the GPU
+#include "RenderControl/GPUTimer.h"
+// Include CResourceTracker, which tracks the live allocations and GL objects
+#include "System/ResourceTracker.h"
+// Include CLogger, which writes the log messages on its own thread
+#include "System/Logger.h"
+// Include CAssetArchive, which the assets are read from
+#include "System/AssetArchive.h"
+// Include CImageLoader, which uploads the textures which are decoded in the background
+#include "System/ImageLoader.h"
+// Include CPlanetPreloader, which loads the assets of the selected planet in the background
+#include "PlanetSelection/PlanetPreloader.h"
+
+// Include ImGui, to end its frame between ticks
+#include "GUI/imgui.h"
+#include "GUI/imgui_internal.h"
 
 // Sound
 #include "SoundController/SoundController.h"
@@ -48,6 +77,8 @@
 
 // Add your include files here
 
+#include <chrono>
+#include <cstring>
 #include <iostream>
 using namespace std;
 
@@ -62,7 +93,7 @@ using namespace std;
 static void error_callback(int error, const char* description)
 {
 	fputs(description, stderr);
-	_fgetchar();
+	getchar();
 }
 
 /**
@@ -76,6 +107,7 @@ static void error_callback(int error, const char* description)
 static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
 	CKeyboardController::GetInstance()->Update(key, action);
+	Application::GetInstance()->RecordInput(CInputScript::KEY, key, action);
 }
 
 /**
@@ -122,6 +154,7 @@ void MouseButtonCallbacks(GLFWwindow* window, int button, int action, int mods)
 		CMouseController::GetInstance()->UpdateMouseButtonPressed(button);
 	else
 		CMouseController::GetInstance()->UpdateMouseButtonReleased(button);
+	Application::GetInstance()->RecordInput(CInputScript::MOUSE, button, (action == GLFW_PRESS) ? 1 : 0);
 }
 
 /**
@@ -133,6 +166,7 @@ void MouseButtonCallbacks(GLFWwindow* window, int button, int action, int mods)
 void MouseScrollCallbacks(GLFWwindow* window, double xoffset, double yoffset)
 {
 	CMouseController::GetInstance()->UpdateMouseScroll(xoffset, yoffset);
+	Application::GetInstance()->RecordInput(CInputScript::SCROLL, 0, 0, xoffset, yoffset);
 }
 
 /**
@@ -142,10 +176,214 @@ Application::~Application(void)
 {
 }
 
+/**
+ @brief Read the options from the command line into CSettings. Call this before Init.
+		--headless			Run without a window, GPU or sound device, as fast as the simulation can tick
+		--ticks <count>		Quit the headless mode after this many ticks
+		--script <file>		Play back the inputs in this file. See CInputScript
+		--record <file>		Save the inputs of this run to a file which --script can play back
+		--seed <seed>		Seed the random numbers, so that a run with the same inputs is repeated exactly
+		--trace-spike <ms>	Save a trace of the recent scopes when a frame takes longer than this
+		--scenario <names>	Run these scenario benchmarks headless instead of the game, separated by commas, or "all"
+		--frames <count>	Measure this many frames in each scenario
+		--enemies <count>	Spawn this many of each enemy in the scenarios
+		--projectiles <count>	Spawn this many projectiles for each shot in the scenarios
+		--route <file>		Play the inputs in this file in each scenario, from its first measured frame
+		--report <file>		Add the results of the scenarios to this CSV file
+		--label <text>		Name this build in the report of the scenarios
+		--archive <file>	Read the assets from this archive instead of Assets.pak. See CAssetArchive
+ @param argc A const int containing the number of arguments
+ @param argv A char* array containing the arguments, starting with the name of the executable
+ @return false if an option is invalid
+ */
+bool Application::ParseCommandLine(const int argc, char* argv[])
+{
+	cSettings = CSettings::GetInstance();
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--headless") == 0)
+		{
+			cSettings->bHeadless = true;
+		}
+		else if ((strcmp(argv[i], "--ticks") == 0) && (i + 1 < argc))
+		{
+			cSettings->uiHeadlessTicks = (unsigned int)strtoul(argv[++i], NULL, 10);
+		}
+		else if ((strcmp(argv[i], "--script") == 0) && (i + 1 < argc))
+		{
+			cSettings->sInputScript = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--record") == 0) && (i + 1 < argc))
+		{
+			cSettings->sInputRecording = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--seed") == 0) && (i + 1 < argc))
+		{
+			cSettings->uiRandomSeed = (unsigned int)strtoul(argv[++i], NULL, 10);
+		}
+		else if ((strcmp(argv[i], "--trace-spike") == 0) && (i + 1 < argc))
+		{
+			cSettings->dTraceSpikeTime = strtod(argv[++i], NULL) / 1000.0;
+		}
+		else if ((strcmp(argv[i], "--scenario") == 0) && (i + 1 < argc))
+		{
+			// The scenarios are only run headless, so that their frame times do not depend on the GPU or display
+			cSettings->sScenarios = argv[++i];
+			cSettings->bHeadless = true;
+		}
+		else if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc))
+		{
+			cSettings->uiScenarioFrames = (unsigned int)strtoul(argv[++i], NULL, 10);
+		}
+		else if ((strcmp(argv[i], "--enemies") == 0) && (i + 1 < argc))
+		{
+			cSettings->uiScenarioEnemyMultiple = (unsigned int)strtoul(argv[++i], NULL, 10);
+		}
+		else if ((strcmp(argv[i], "--projectiles") == 0) && (i + 1 < argc))
+		{
+			cSettings->uiScenarioProjectileMultiple = (unsigned int)strtoul(argv[++i], NULL, 10);
+		}
+		else if ((strcmp(argv[i], "--route") == 0) && (i + 1 < argc))
+		{
+			cSettings->sScenarioRoute = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--report") == 0) && (i + 1 < argc))
+		{
+			cSettings->sScenarioReport = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--label") == 0) && (i + 1 < argc))
+		{
+			cSettings->sScenarioLabel = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--archive") == 0) && (i + 1 < argc))
+		{
+			cSettings->sAssetArchive = argv[++i];
+		}
+		else
+		{
+			cout << "Application::ParseCommandLine: Invalid option " << argv[i] << endl;
+			cout << "Options: --headless, --ticks <count>, --script <file>, --record <file>, --seed <seed>, --trace-spike <ms>, "
+				<< "--scenario <names>, --frames <count>, --enemies <count>, --projectiles <count>, --route <file>, "
+				<< "--report <file>, --label <text>, --archive <file>" << endl;
+			CScenario::PrintScenarios();
+			return false;
+		}
+	}
+	return true;
+}
+
 /**
  @brief Initialise this class instance
  */
 bool Application::Init(void)
+{
+	// Get the CSettings instance
+	cSettings = CSettings::GetInstance();
+
+	// Start the writer thread of the CLogger, before anything is logged
+	CLogger::GetInstance();
+
+	// Set the file location for the digital assets
+	// This is backup, in case filesystem cannot find the current directory
+	cSettings->logl_root = "C:/Users/tohdj/Documents/2022_2023_SEM1/DM2213 2D Game Creation/Teaching Materials/";
+
+	// Map the archive of the assets before any of them are loaded. If there is none, they are read from their files
+	CAssetArchive::GetInstance()->Open(cSettings->sAssetArchive);
+
+	if (cSettings->bHeadless)
+	{
+		// There is no window or OpenGL context, so the GL functions which GLEW loads do nothing instead
+		CNullGLBackend::Install();
+	}
+	else if (InitWindow() == false)
+	{
+		return false;
+	}
+
+	// Count the calls through the GL functions which GLEW loaded
+	CRenderStats::GetInstance()->Install();
+	// Track the GL objects which are created and deleted through the GL functions which GLEW loaded
+	CResourceTracker::GetInstance()->Install();
+	// Time the passes on the GPU, if the context has timer queries
+	CGPUTimer::GetInstance()->Init();
+
+	// Initialise the CSoundController singleton
+	if (CSoundController::GetInstance()->Init(cSettings->bHeadless) == false)
+	{
+		cout << "Failed to initialise CSoundController class instance" << endl;
+		return false;
+	}
+
+	// Add the shaders to the ShaderManager
+	CShaderManager::GetInstance()->Add("Shader2D", "Shader//Shader2D.vs", "Shader//Shader2D.fs");
+	CShaderManager::GetInstance()->Add("Shader2D_Colour", "Shader//Shader2D_Colour.vs", "Shader//Shader2D_Colour.fs");
+
+	// Set the Game Info class
+	CGameInfo::GetInstance();
+
+	// Create the CProfiler on this thread, as it only times the scopes of the thread which created it
+	CProfiler::GetInstance()->SetFrameBudget(1.0 / cSettings->dTargetFrameRate);
+	CProfiler::GetInstance()->SetTraceRecording(cSettings->bTraceRecording);
+	CProfiler::GetInstance()->SetTraceSpikeTime(cSettings->dTraceSpikeTime);
+	CProfiler::GetInstance()->SetTraceFilePrefix(cSettings->sTraceFilePrefix);
+
+	// Start the worker threads of the CJobSystem
+	if (CJobSystem::GetInstance()->Init() == false)
+	{
+		cout << "Failed to initialise CJobSystem class instance" << endl;
+		return false;
+	}
+
+	// Load the inputs to play back
+	if ((cSettings->sInputScript.empty() == false) && (cInputScript.Load(cSettings->sInputScript) == false))
+	{
+		cout << "Failed to load the input script " << cSettings->sInputScript << endl;
+		return false;
+	}
+	if (cSettings->sInputRecording.empty() == false)
+		cInputRecording.StartRecording();
+
+	// Seed the random numbers before the game states are created, as they may draw numbers when they start.
+	// The seed is printed, so that a run with a random seed can be repeated with --seed
+	CRandomManager::GetInstance()->Seed(cSettings->uiRandomSeed);
+	cout << "Random seed: " << CRandomManager::GetInstance()->GetSeed() << endl;
+
+	// Initialise the CFPSCounter instance
+	cFPSCounter = CFPSCounter::GetInstance();
+	cFPSCounter->Init();
+
+	// Create the game states
+	CGameStateManager::GetInstance()->AddGameState("IntroState", new CIntroState());
+	CGameStateManager::GetInstance()->AddGameState("MenuState", new CMenuState());
+	CGameStateManager::GetInstance()->AddGameState("PlayGameState", new CPlayGameState());
+	CGameStateManager::GetInstance()->AddGameState("PauseState", new CPauseState());
+	CGameStateManager::GetInstance()->AddGameState("InventoryState", new CInventoryState());
+	CGameStateManager::GetInstance()->AddGameState("PlanetState", new CPlanetSelectionState());
+	CGameStateManager::GetInstance()->AddGameState("ShipCombatState", new CShipCombatState());
+	CGameStateManager::GetInstance()->AddGameState("WinState", new CWinState());
+	CGameStateManager::GetInstance()->AddGameState("LoseState", new CLoseState());
+
+	if (cSettings->sScenarios.empty() == false)
+	{
+		// The scenarios start the game states which they measure
+		if (cScenario.Init(cSettings->sScenarios, cSettings->sScenarioRoute) == false)
+			return false;
+		cScenario.SetMultiples(cSettings->uiScenarioEnemyMultiple, cSettings->uiScenarioProjectileMultiple);
+		cScenario.SetNumFrames(cSettings->uiScenarioFrames);
+		return true;
+	}
+
+	// Set the active scene
+	CGameStateManager::GetInstance()->SetActiveGameState("IntroState");
+
+	return true;
+}
+
+/**
+ @brief Create the window and its OpenGL context
+ @return false if the window or context cannot be created
+ */
+bool Application::InitWindow(void)
 {
 	// glfw: initialize and configure
 	// ------------------------------
@@ -156,13 +394,6 @@ bool Application::Init(void)
 		return false;
 	}
 
-	// Get the CSettings instance
-	cSettings = CSettings::GetInstance();
-
-	// Set the file location for the digital assets
-	// This is backup, in case filesystem cannot find the current directory
-	cSettings->logl_root = "C:/Users/tohdj/Documents/2022_2023_SEM1/DM2213 2D Game Creation/Teaching Materials/";
-
 	//Set the GLFW window creation hints - these are optional
 	if (cSettings->bUse4XAntiliasing == true)
 		glfwWindowHint(GLFW_SAMPLES, 4); //Request 4x antialiasing
@@ -229,41 +460,6 @@ bool Application::Init(void)
 		return false;
 	}
 
-	// Initialise the CSoundController singleton
-	if (CSoundController::GetInstance()->Init() == false)
-	{
-		cout << "Failed to initialise CSoundController class instance" << endl;
-		return false;
-	}
-
-	// Add the shaders to the ShaderManager
-	CShaderManager::GetInstance()->Add("Shader2D", "Shader//Shader2D.vs", "Shader//Shader2D.fs");
-	CShaderManager::GetInstance()->Add("Shader2D_Colour", "Shader//Shader2D_Colour.vs", "Shader//Shader2D_Colour.fs");
-
-	// Set the Game Info class
-	CGameInfo::GetInstance();
-
-	// Initialise the CFPSCounter instance
-	cFPSCounter = CFPSCounter::GetInstance();
-	cFPSCounter->Init();
-
-	// Create the game states
-	CGameStateManager::GetInstance()->AddGameState("IntroState", new CIntroState());
-	CGameStateManager::GetInstance()->AddGameState("MenuState", new CMenuState());
-	CGameStateManager::GetInstance()->AddGameState("PlayGameState", new CPlayGameState());
-	CGameStateManager::GetInstance()->AddGameState("PauseState", new CPauseState());
-	CGameStateManager::GetInstance()->AddGameState("InventoryState", new CInventoryState());
-	CGameStateManager::GetInstance()->AddGameState("PlanetState", new CPlanetSelectionState());
-	CGameStateManager::GetInstance()->AddGameState("ShipCombatState", new CShipCombatState());
-	CGameStateManager::GetInstance()->AddGameState("WinState", new CWinState());
-	CGameStateManager::GetInstance()->AddGameState("LoseState", new CLoseState());
-
-	// Set the active scene
-	CGameStateManager::GetInstance()->SetActiveGameState("IntroState");
-
-	// initialises random by time
-	srand(static_cast<unsigned> (time(0)));
-
 	return true;
 }
 
@@ -272,64 +468,274 @@ bool Application::Init(void)
 */ 
 void Application::Run(void)
 {
-	// Start timer to calculate how long it takes to render this frame
-	cStopWatch.StartTimer();
+	if (cSettings->sScenarios.empty() == false)
+	{
+		RunScenarios();
+		return;
+	}
+	if (cSettings->bHeadless)
+	{
+		RunHeadless();
+		return;
+	}
+
+	// Start timing the first frame
+	cFramePacer.Init(cSettings->eFramePacingMode, cSettings->dTargetFrameRate, cSettings->dPacingSpinWindow);
 
 	double dElapsedTime = 0.0;
-	double dDelayTime = 0.0;
-	double dTotalFrameTime = 0.0;
+	// True if the frame to render was already simulated at the end of the previous frame
+	bool bFrameSimulated = false;
 
 	// Render loop
 	while (!glfwWindowShouldClose(cSettings->pWindow))
 	{
-		// This is to prevent the program from crashing due to long dElapsedTime
-		// Causing Physics to calculate a large jump/fall for the player
-		// locks the program at 60 fps
-		if (dElapsedTime > 0.0166666666666667)
-			dElapsedTime = 0.0166666666666667;
-
-		// Call the active Game State's Update method
-		if (CGameStateManager::GetInstance()->Update(dElapsedTime) == false)
+		// Apply the frame pacing settings, which may be changed while running
+		cFramePacer.SetMode(cSettings->eFramePacingMode);
+		cFramePacer.SetTargetFrameRate(cSettings->dTargetFrameRate);
+		cFramePacer.SetSpinWindow(cSettings->dPacingSpinWindow);
+		CProfiler::GetInstance()->SetFrameBudget(1.0 / cSettings->dTargetFrameRate);
+		if (cFramePacer.GetSwapInterval() != iSwapInterval)
 		{
-			break;
+			iSwapInterval = cFramePacer.GetSwapInterval();
+			glfwSwapInterval(iSwapInterval);
+		}
+
+		// Simulate the ticks for the time since the last frame
+		if (bFrameSimulated == false)
+		{
+			if (Simulate(dElapsedTime) == false)
+			{
+				break;
+			}
 		}
 
 		// Call the active Game State's Render method
+		CGPUTimer::GetInstance()->BeginFrame();
 		CGameStateManager::GetInstance()->Render();
+		CGPUTimer::GetInstance()->EndFrame();
 
-		// glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
-		// -------------------------------------------------------------------------------
-		glfwSwapBuffers(cSettings->pWindow);
+		if (cSettings->bPipelinedFrames)
+		{
+			// Send the draw calls to the GPU now, so that it draws this frame while the next frame is simulated
+			glFlush();
+
+			// Read the input for the next frame and simulate it, before presenting this frame.
+			// The key presses and releases are kept until a tick has seen them, see Simulate
+			glfwPollEvents();
+			UpdateInputDevices();
+			if (Simulate(dElapsedTime) == false)
+			{
+				break;
+			}
+			bFrameSimulated = true;
+
+			PROFILE_SCOPE_CATEGORY("glfwSwapBuffers", "gpu");
+			glfwSwapBuffers(cSettings->pWindow);
+		}
+		else
+		{
+			// glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
+			// -------------------------------------------------------------------------------
+			{
+				PROFILE_SCOPE_CATEGORY("glfwSwapBuffers", "gpu");
+				glfwSwapBuffers(cSettings->pWindow);
+			}
 
-		// Perform Post Update Input Devices
-		PostUpdateInputDevices();
+			// Poll events. The key presses and releases are kept until a tick has seen them, see Simulate
+			glfwPollEvents();
 
-		// Poll events
-		glfwPollEvents();
+			// Update Input Devices
+			UpdateInputDevices();
 
-		// Update Input Devices
-		UpdateInputDevices();
+			bFrameSimulated = false;
+		}
 
-		// Calculate the elapsed time since the last frame
-		dElapsedTime = cStopWatch.GetElapsedTime();
+		// Frame rate limiter. Waits for the end of this frame, and returns the elapsed time since the last frame
+		dElapsedTime = cFramePacer.EndFrame();
 
-		// Frame rate limiter. Limits each frame to a specified time in ms by sleeping.  
-		dDelayTime = cSettings->frameTime - dElapsedTime * 1000;
-		cStopWatch.WaitUntil((const long long)dDelayTime);
+		// End the frame of the profiler after the wait, so that its frame times are the real frame times
+		CProfiler::GetInstance()->EndFrame();
+		CRenderStats::GetInstance()->EndFrame();
 
 		// Update the FPS Counter
-		dTotalFrameTime = dElapsedTime + dDelayTime * 0.001;
-		cFPSCounter->Update(dTotalFrameTime);
+		cFPSCounter->Update(dElapsedTime);
 	}
 }
 
+/**
+ @brief Run the simulation without a window, as fast as it can tick. Nothing is rendered, and the inputs
+		only come from the input script
+ */
+void Application::RunHeadless(void)
+{
+	const double dTickTime = 1.0 / cSettings->uiTickRate;
+	unsigned int uiNumTicks = 0;
+
+	cout << "Application: Running headless";
+	if (cSettings->uiHeadlessTicks > 0)
+		cout << " for " << cSettings->uiHeadlessTicks << " ticks";
+	cout << endl;
+
+	// Measure the time of each tick, without waiting between them
+	cFramePacer.Init(CFramePacer::UNCAPPED, cSettings->dTargetFrameRate);
+
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	while ((cSettings->uiHeadlessTicks == 0) || (uiNumTicks < cSettings->uiHeadlessTicks))
+	{
+		// Each call runs exactly one tick, since no real time has to be caught up on
+		if (Simulate(dTickTime) == false)
+			break;
+		cFramePacer.EndFrame();
+		CProfiler::GetInstance()->EndFrame();
+		uiNumTicks++;
+	}
+	double dRunTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+	cout << "Application: Simulated " << uiNumTicks << " ticks in " << dRunTime << " s ("
+		<< ((dRunTime > 0.0) ? uiNumTicks / dRunTime : 0.0) << " ticks per second, "
+		<< ((uiNumTicks > 0) ? dRunTime * 1000.0 / uiNumTicks : 0.0) << " ms per tick)" << endl;
+	cFramePacer.PrintSelf();
+	CProfiler::GetInstance()->PrintSelf();
+	cInputScript.PrintSelf();
+	if (CImageLoader::GetInstance()->GetNumFailedTextures() > 0)
+		cout << "Application: " << CImageLoader::GetInstance()->GetNumFailedTextures()
+			<< " textures failed to load and were left transparent" << endl;
+
+	// Print the state which two runs of the same inputs and seed must end with
+	CGameInfo* cGameInfo = CGameInfo::GetInstance();
+	cout << "Final state: tick " << cSettings->uiTickCount << ", nebula size " << cGameInfo->nebulaSize
+		<< ", planet (" << cGameInfo->currentPlanetPos.x << ", " << cGameInfo->currentPlanetPos.y << ") of "
+		<< cGameInfo->planetList.size() << " planets" << endl;
+	CRandomManager::GetInstance()->PrintSelf();
+}
+
+/**
+ @brief Run the scenario benchmarks without a window. Each frame runs one tick and renders it through the null
+		OpenGL functions, so the frame times are the time the CPU spends on the game, and do not depend on the GPU
+ */
+void Application::RunScenarios(void)
+{
+	const double dTickTime = 1.0 / cSettings->uiTickRate;
+
+	// The profiler and its traces would add their own time and allocations to the frames
+	CProfiler::GetInstance()->SetEnabled(false);
+	CProfiler::GetInstance()->SetTraceRecording(false);
+
+	while (cScenario.IsFinished() == false)
+	{
+		cScenario.StartFrame();
+		if (Simulate(dTickTime) == false)
+			break;
+		CGameStateManager::GetInstance()->Render();
+		cScenario.EndFrame();
+
+		CProfiler::GetInstance()->EndFrame();
+		CRenderStats::GetInstance()->EndFrame();
+	}
+
+	cScenario.PrintSelf();
+	// Builds are told apart by the time they were built, unless they are given a label
+	std::string sLabel = cSettings->sScenarioLabel;
+	if (sLabel.empty())
+		sLabel = std::string(__DATE__) + " " + __TIME__;
+	cScenario.SaveReport(cSettings->sScenarioReport, sLabel);
+}
+
+/**
+ @brief Run the fixed ticks of the simulation which fit in the time which has passed. Every tick updates the
+		game by the same time, so the simulation does not depend on the frame rate
+ @param dFrameTime A const double containing the real time in seconds since the last call
+ @return false if the active game state wants to quit
+ */
+bool Application::Simulate(const double dFrameTime)
+{
+	PROFILE_SCOPE("Application::Simulate");
+
+	const double dTickTime = 1.0 / cSettings->uiTickRate;
+
+	// Upload the textures which were decoded since the last frame, within their part of the frame
+	CImageLoader::GetInstance()->UploadTextures(cSettings->dTextureUploadBudget);
+
+	dAccumulatedTime += dFrameTime;
+	unsigned int uiNumTicks = 0;
+	while (dAccumulatedTime >= dTickTime)
+	{
+		// Drop the time which cannot be caught up on, e.g. after loading a level, instead of
+		// running a burst of ticks which makes the next frame even slower
+		if (uiNumTicks == cSettings->uiMaxTicksPerFrame)
+		{
+			dAccumulatedTime = 0.0;
+			break;
+		}
+
+		// Each GUI starts an ImGui frame in its Update and draws it in its Render, so end the frame
+		// of an earlier tick which was not rendered before the next tick starts another one
+		ImGuiContext* pImGuiContext = ImGui::GetCurrentContext();
+		if ((pImGuiContext) && (pImGuiContext->WithinFrameScope))
+			ImGui::EndFrame();
+
+		// Play back the scripted inputs of this tick
+		cInputScript.Apply(cSettings->uiTickCount);
+
+		// Call the active Game State's Update method with the game time of the tick
+		if (CGameStateManager::GetInstance()->Update(dTickTime * cSettings->dGameTimeScale) == false)
+			return false;
+
+		// Show or hide the profiler overlay
+		if (CKeyboardController::GetInstance()->IsKeyReleased(GLFW_KEY_F3))
+			CProfiler::GetInstance()->SetOverlayVisible(CProfiler::GetInstance()->IsOverlayVisible() == false);
+		// Save a trace of the recent scopes
+		if ((CKeyboardController::GetInstance()->IsKeyReleased(GLFW_KEY_F4)) && (CProfiler::GetInstance()->IsTraceRecording()))
+			CProfiler::GetInstance()->SaveTrace();
+
+		// Key presses and releases are only seen by the first tick which runs after them. This is the only
+		// place which ends them, so those polled in frames which run no ticks are not lost
+		PostUpdateInputDevices();
+
+		dAccumulatedTime -= dTickTime;
+		cSettings->uiTickCount++;
+		uiNumTicks++;
+	}
+
+	// Render between the previous tick and the latest tick, by how far the time is into the next tick
+	cSettings->fRenderAlpha = (float)(dAccumulatedTime / dTickTime);
+	return true;
+}
+
 /**
  @brief Destroy this class instance
  */
 void Application::Destroy(void)
 {
+#ifdef _DEBUG
+	// Print how evenly the last frames were paced
+	cFramePacer.PrintSelf();
+#endif
+
+	// Save the inputs of this run, so that it can be played back
+	if (cInputRecording.IsRecording())
+		cInputRecording.Save(cSettings->sInputRecording);
+
+	// Destroy the CPlanetPreloader, which waits for the maps and sounds which are being read on the worker threads
+	CPlanetPreloader::GetInstance()->Destroy();
+
+	// Destroy the CImageLoader, which waits for the images which are being decoded on the worker threads
+	CImageLoader::GetInstance()->Destroy();
+
+	// Destroy the CJobSystem, which finishes its jobs and stops its worker threads
+	CJobSystem::GetInstance()->Destroy();
+
+	// Destroy the CProfiler
+	CProfiler::GetInstance()->Destroy();
+
 	// Destroy the CSoundController singleton
 	CSoundController::GetInstance()->Destroy();
+
+	// Destroy the CAssetArchive after the CSoundController, as its sounds may be views of the mapped archive
+	CAssetArchive::GetInstance()->Destroy();
+
+	// Destroy the CGPUTimer, which deletes its queries while the OpenGL context is still current
+	CGPUTimer::GetInstance()->Destroy();
 	
 	// Destroy the ShaderManager
 	CShaderManager::GetInstance()->Destroy();
@@ -346,13 +752,19 @@ void Application::Destroy(void)
 		cFPSCounter = NULL;
 	}
 
-	//Close OpenGL window and terminate GLFW
-	glfwDestroyWindow(cSettings->pWindow);
-	//Finalize and clean up GLFW
-	glfwTerminate();
+	if (cSettings->pWindow)
+	{
+		//Close OpenGL window and terminate GLFW
+		glfwDestroyWindow(cSettings->pWindow);
+		//Finalize and clean up GLFW
+		glfwTerminate();
+	}
 
 	// Destroy the CSettings instance
 	CSettings::GetInstance()->Destroy();
+
+	// Destroy the CLogger last, which writes the messages which were logged before it stops
+	CLogger::GetInstance()->Destroy();
 }
 
 /**
@@ -376,6 +788,8 @@ int Application::GetWindowWidth(void) const
  */
 Application::Application(void)
 	: cFPSCounter(NULL)
+	, iSwapInterval(-1)
+	, dAccumulatedTime(0.0)
 {
 }
 
@@ -388,10 +802,25 @@ void Application::UpdateInputDevices(void)
 	double dMouse_X, dMouse_Y;
 	glfwGetCursorPos( cSettings->pWindow, &dMouse_X, &dMouse_Y);
 	CMouseController::GetInstance()->UpdateMousePosition( dMouse_X, dMouse_Y);
+	RecordInput(CInputScript::CURSOR, 0, 0, dMouse_X, dMouse_Y);
+}
+
+/**
+ @brief Record an input of the window, at the tick which will see it first
+ @param eType A const CInputScript::INPUT_TYPE containing the type of the input
+ @param iCode A const int containing the key or mouse button
+ @param iAction A const int containing the GLFW action of the key or mouse button
+ @param dX A const double containing the cursor position or scroll offset in the x-axis
+ @param dY A const double containing the cursor position or scroll offset in the y-axis
+ */
+void Application::RecordInput(	const CInputScript::INPUT_TYPE eType, const int iCode, const int iAction,
+								const double dX, const double dY)
+{
+	cInputRecording.Record(cSettings->uiTickCount, eType, iCode, iAction, dX, dY);
 }
 
 /**
- @brief End updates from the input devices. This method is not used anymore
+ @brief End the key presses and releases, once a tick has seen them
  */
 void Application::PostUpdateInputDevices(void)
 {
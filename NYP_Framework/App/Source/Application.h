@@ -7,12 +7,18 @@
 #pragma once
 
 // Include SingletonTemplate
-#include "DesignPatterns\SingletonTemplate.h"
+#include "DesignPatterns/SingletonTemplate.h"
 
-#include "TimeControl\StopWatch.h"
+#include "TimeControl/FramePacer.h"
 
 // FPS Counter
-#include "TimeControl\FPSCounter.h"
+#include "TimeControl/FPSCounter.h"
+
+// Scripted inputs
+#include "Inputs/InputScript.h"
+
+// Scenario benchmarks
+#include "Scenario/Scenario.h"
 
 // Add your include files here
 
@@ -24,6 +30,8 @@ class Application : public CSingletonTemplate<Application>
 {
 	friend CSingletonTemplate<Application>;
 public:
+	// Read the options from the command line into CSettings. Call this before Init
+	bool ParseCommandLine(const int argc, char* argv[]);
 	// Initialise this class instance
 	bool Init(void);
 	// Run this class instance
@@ -35,22 +43,50 @@ public:
 	int GetWindowHeight(void) const;
 	// Get window width
 	int GetWindowWidth(void) const;
+
+	// Record an input of the window, if the inputs of this run are being saved
+	void RecordInput(	const CInputScript::INPUT_TYPE eType, const int iCode, const int iAction,
+						const double dX = 0.0, const double dY = 0.0);
 	
 protected:
-	// Declare timer for calculating time per frame
-	CStopWatch cStopWatch;
+	// Ends each frame at the right time for the frame pacing mode, and measures the time per frame
+	CFramePacer cFramePacer;
+	// The swap interval which the window is using
+	int iSwapInterval;
 
 	// The handler to the CSettings instance
 	CSettings* cSettings;
 	// The handler to the CFPSCounter instance
 	CFPSCounter* cFPSCounter;
 
+	// The real time in seconds which has passed but has not been simulated yet
+	double dAccumulatedTime;
+
+	// The inputs which are played back at their ticks
+	CInputScript cInputScript;
+	// The inputs of this run, which are saved for playing back later
+	CInputScript cInputRecording;
+	// The scenario benchmarks which are run instead of the game, if any
+	CScenario cScenario;
+
 	// Constructor
 	Application(void);
 
 	// Destructor
 	virtual ~Application(void);
 
+	// Create the window and its OpenGL context
+	bool InitWindow(void);
+
+	// Run the simulation without a window, as fast as it can tick
+	void RunHeadless(void);
+
+	// Run the scenario benchmarks without a window, and report the time, allocations and draw calls of their frames
+	void RunScenarios(void);
+
+	// Run the fixed ticks of the simulation which fit in the time which has passed
+	bool Simulate(const double dFrameTime);
+
 	// Update input devices
 	void UpdateInputDevices(void);
 	void PostUpdateInputDevices(void);
@@ -23,6 +23,7 @@ public:
 	int nebulaSize = 3;
 	glm::vec2 currentPlanetPos = glm::vec2(-1, -1);
 	std::vector<int> planetList;
+	int forcedLevel = -1; // Level which the planets load instead of a random one, so that a scenario always plays the same map. -1 picks at random
 	CInventoryManager* cInventoryManager;
 
 	void ExportIM(CInventoryManager* newIM) {
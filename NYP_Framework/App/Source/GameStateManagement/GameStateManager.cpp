@@ -1,5 +1,10 @@
 #include "GameStateManager.h"
 
+// Include CProfiler, to time the game states
+#include "TimeControl/Profiler.h"
+// Include CResourceTracker, to tag the resources of the game states and report them as the states change
+#include "System/ResourceTracker.h"
+
 #include <iostream>
 
 using namespace std;
@@ -42,6 +47,7 @@ void CGameStateManager::Destroy(void)
 	}
 	// Clear the map
 	GameStateMap.clear();
+	GameStateTagMap.clear();
 }
 
 /**
@@ -49,12 +55,16 @@ void CGameStateManager::Destroy(void)
  */
 bool CGameStateManager::Update(const double dElapsedTime)
 {
+	PROFILE_SCOPE("CGameStateManager::Update");
+
 	// Check for change of scene
 	if (nextGameState != activeGameState)
 	{
 		if (activeGameState)
 		{
 			// Scene is valid, need to call appropriate function to exit
+			PROFILE_SCOPE_CATEGORY("CGameStateBase::Destroy", "state");
+			CResourceTag cResourceTag(GameStateTagMap[activeGameState]);
 			activeGameState->Destroy();
 		}
 		//
@@ -62,13 +72,20 @@ bool CGameStateManager::Update(const double dElapsedTime)
 		prevGameState = activeGameState;
 		// Set the new active CGameState
 		activeGameState = nextGameState;
+#ifndef RESOURCE_TRACKER_DISABLED
+		// Report what the previous CGameStates left behind, before the new active CGameState creates its resources
+		CResourceTracker::GetInstance()->EnterState(GetGameStateName(activeGameState));
+#endif
 		// Init the new active CGameState
+		PROFILE_SCOPE_CATEGORY("CGameStateBase::Init", "state");
+		CResourceTag cResourceTag(GameStateTagMap[activeGameState]);
 		activeGameState->Init();
 	}
 
 	// Update the active CGameState
 	if (activeGameState)
 	{
+		CResourceTag cResourceTag(GameStateTagMap[activeGameState]);
 		//cout << "activeGameState->Update" << endl;
 		if (activeGameState->Update(dElapsedTime) == false)
 			return false;
@@ -76,6 +93,7 @@ bool CGameStateManager::Update(const double dElapsedTime)
 		{
 			if (pauseGameState)
 			{
+				CResourceTag cPauseResourceTag(GameStateTagMap[pauseGameState]);
 				//cout << "pauseGameState->Update" << endl;
 				pauseGameState->Update(dElapsedTime);
 			}
@@ -91,10 +109,18 @@ bool CGameStateManager::Update(const double dElapsedTime)
  */
 void CGameStateManager::Render(void)
 {
+	PROFILE_SCOPE("CGameStateManager::Render");
+
 	if (activeGameState)
+	{
+		CResourceTag cResourceTag(GameStateTagMap[activeGameState]);
 		activeGameState->Render();
+	}
 	if (pauseGameState)
+	{
+		CResourceTag cResourceTag(GameStateTagMap[pauseGameState]);
 		pauseGameState->Render();
+	}
 
 }
 
@@ -122,6 +148,8 @@ bool CGameStateManager::AddGameState(const std::string& _name, CGameStateBase* _
 
 	// If nothing is wrong, then add the scene to our map
 	GameStateMap[_name] = _scene;
+	// The resources which the scene creates are tagged with its name
+	GameStateTagMap[_scene] = CResourceTracker::RegisterTag(_name.c_str(), __FILE__, __LINE__);
 
 	return true;
 }
@@ -151,6 +179,7 @@ bool CGameStateManager::RemoveGameState(const std::string& _name)
 	// Delete and remove from our map
 	delete target;
 	GameStateMap.erase(_name);
+	GameStateTagMap.erase(target);
 
 	return true;
 }
@@ -171,10 +200,28 @@ bool CGameStateManager::SetActiveGameState(const std::string& _name)
 
 	// Scene exist, set the next scene pointer to that scene
 	nextGameState = GameStateMap[_name];
+	PROFILE_EVENT("SetActiveGameState", "state", _name);
 
 	return true;
 }
 
+/**
+ @brief Get the name of a CGameState
+ @param _scene A CGameStateBase* variable which is the CGameState
+ @return The name which the CGameState was added with, or an empty string if it was not added
+ */
+std::string CGameStateManager::GetGameStateName(CGameStateBase* _scene) const
+{
+	std::map<std::string, CGameStateBase*>::const_iterator it, end;
+	end = GameStateMap.end();
+	for (it = GameStateMap.begin(); it != end; ++it)
+	{
+		if (it->second == _scene)
+			return it->first;
+	}
+	return "";
+}
+
 bool CGameStateManager::CheckGameStateExist(const std::string& _name)
 {
 	return GameStateMap.count(_name) != 0;
@@ -199,7 +246,10 @@ bool CGameStateManager::SetPauseGameState(const std::string& _name)
 
 	// Scene exist, set the next scene pointer to that scene
 	pauseGameState = GameStateMap[_name];
+	PROFILE_EVENT("SetPauseGameState", "state", _name);
 	// Init the new pause CGameState
+	PROFILE_SCOPE_CATEGORY("CGameStateBase::Init", "state");
+	CResourceTag cResourceTag(GameStateTagMap[pauseGameState]);
 	pauseGameState->Init();
 
 	return true;
@@ -36,8 +36,13 @@ protected:
 	// Destructor
 	~CGameStateManager();
 
+	// Get the name of a CGameState
+	std::string GetGameStateName(CGameStateBase* _scene) const;
+
 	// The map of CGameStates
 	std::map<std::string, CGameStateBase*> GameStateMap;
+	// The tags of CResourceTracker which the resources of each CGameState are given
+	std::map<CGameStateBase*, unsigned int> GameStateTagMap;
 	// The handlers containing the active and next CGameState
 	CGameStateBase* activeGameState, *nextGameState, *prevGameState, *pauseGameState;
 };
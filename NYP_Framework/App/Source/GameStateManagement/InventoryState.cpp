@@ -14,18 +14,21 @@
 
 #include "InventoryState.h"
 
+// Include CProfiler, to draw its overlay with the GUI
+#include "TimeControl/Profiler.h"
+
 // Include CGameStateManager
 #include "GameStateManager.h"
 
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
  // Include shader
-#include "RenderControl\shader.h"
+#include "RenderControl/Shader.h"
 
 // Include CSettings
 #include "GameControl/Settings.h"
@@ -86,7 +89,7 @@ bool CInventoryState::Init(void)
 	resourceScrapMetal.fileName = "Image\\GUI\\ScrapMetal.tga";
 	resourceScrapMetal.textureID = il->LoadTextureGetID(resourceScrapMetal.fileName.c_str(), false);
 
-	resourceJungle.fileName = "Image\\GUI\\Ironwood.tga";
+	resourceJungle.fileName = "Image\\JunglePlanet\\IronwoodTreeTrunk.tga";
 	resourceJungle.textureID = il->LoadTextureGetID(resourceJungle.fileName.c_str(), false);
 
 	resourceTerrestrial.fileName = "Image\\GUI\\EnergyQuartz.tga";
@@ -1135,9 +1138,14 @@ void CInventoryState::Render(void)
 	background->Render();
 	background->PostRender();
 
+	// Draw the profiler overlay into this frame
+	CProfiler::GetInstance()->RenderOverlay();
+
 	// Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	// There is no OpenGL context to draw the GUI with in the headless mode
+	if (CSettings::GetInstance()->bHeadless == false)
+		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
 	//cout << "CInventoryState::Render()\n" << endl;
 }
@@ -20,9 +20,9 @@
  // Include IMGUI
  // Important: GLEW and GLFW must be included before IMGUI
 #ifndef IMGUI_ACTIVE
-#include "GUI\imgui.h"
-#include "GUI\backends\imgui_impl_glfw.h"
-#include "GUI\backends\imgui_impl_opengl3.h"
+#include "GUI/imgui.h"
+#include "GUI/backends/imgui_impl_glfw.h"
+#include "GUI/backends/imgui_impl_opengl3.h"
 #define IMGUI_ACTIVE
 #endif
 
@@ -14,18 +14,21 @@
 
 #include "MenuState.h"
 
+// Include CProfiler, to draw its overlay with the GUI
+#include "TimeControl/Profiler.h"
+
 // Include CGameStateManager
 #include "GameStateManager.h"
 
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
  // Include shader
-#include "RenderControl\shader.h"
+#include "RenderControl/Shader.h"
 
 // Include CSettings
 #include "GameControl/Settings.h"
@@ -80,9 +83,17 @@ bool CMenuState::Init(void)
 	//ImGui::StyleColorsClassic();
 
 	// Setup Platform/Renderer bindings
-	ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
-	const char* glsl_version = "#version 330";
-	ImGui_ImplOpenGL3_Init(glsl_version);
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		// There is no window or context in the headless mode, so the GUI runs without being drawn
+		ImGui_ImplNull_Init((float)CSettings::GetInstance()->iWindowWidth, (float)CSettings::GetInstance()->iWindowHeight);
+	}
+	else
+	{
+		ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
+		const char* glsl_version = "#version 330";
+		ImGui_ImplOpenGL3_Init(glsl_version);
+	}
 
 	// Load the images for buttons
 	CImageLoader* il = CImageLoader::GetInstance();
@@ -96,7 +107,7 @@ bool CMenuState::Init(void)
 	exitButtonData.textureID = il->LoadTextureGetID(exitButtonData.fileName.c_str(), false);
 
 	// Enable the cursor
-	if (CSettings::GetInstance()->bDisableMousePointer == true)
+	if ((CSettings::GetInstance()->bHeadless == false) && (CSettings::GetInstance()->bDisableMousePointer == true))
 		glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 
 	return true;
@@ -108,8 +119,15 @@ bool CMenuState::Init(void)
 bool CMenuState::Update(const double dElapsedTime)
 {
 	// Start the Dear ImGui frame
-	ImGui_ImplOpenGL3_NewFrame();
-	ImGui_ImplGlfw_NewFrame();
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		ImGui_ImplNull_NewFrame((float)dElapsedTime);
+	}
+	else
+	{
+		ImGui_ImplOpenGL3_NewFrame();
+		ImGui_ImplGlfw_NewFrame();
+	}
 	ImGui::NewFrame();
 
 	ImGuiWindowFlags window_flags = 0;
@@ -223,9 +241,14 @@ void CMenuState::Render(void)
 	//Render Background
 	background->Render();
 
+	// Draw the profiler overlay into this frame
+	CProfiler::GetInstance()->RenderOverlay();
+
 	// Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	// There is no OpenGL context to draw the GUI with in the headless mode
+	if (CSettings::GetInstance()->bHeadless == false)
+		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
 	//cout << "CMenuState::Render()\n" << endl;
 }
@@ -235,13 +258,16 @@ void CMenuState::Render(void)
  */
 void CMenuState::Destroy(void)
 {
-	// Disable the cursor
-	if (CSettings::GetInstance()->bDisableMousePointer == true)
-		glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
-	else
-		// Hide the cursor
-		if (CSettings::GetInstance()->bShowMousePointer == false)
-			glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+	if (CSettings::GetInstance()->bHeadless == false)
+	{
+		// Disable the cursor
+		if (CSettings::GetInstance()->bDisableMousePointer == true)
+			glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+		else
+			// Hide the cursor
+			if (CSettings::GetInstance()->bShowMousePointer == false)
+				glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+	}
 
 	// Delete the background
 	if (background)
@@ -251,8 +277,15 @@ void CMenuState::Destroy(void)
 	}
 
 	// Cleanup
-	ImGui_ImplOpenGL3_Shutdown();
-	ImGui_ImplGlfw_Shutdown();
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		ImGui_ImplNull_Shutdown();
+	}
+	else
+	{
+		ImGui_ImplOpenGL3_Shutdown();
+		ImGui_ImplGlfw_Shutdown();
+	}
 	ImGui::DestroyContext();
 
 	cout << "CMenuState::Destroy()\n" << endl;
@@ -20,12 +20,12 @@
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
  // Include shader
-#include "RenderControl\shader.h"
+#include "RenderControl/Shader.h"
 
 // Include CSettings
 #include "GameControl/Settings.h"
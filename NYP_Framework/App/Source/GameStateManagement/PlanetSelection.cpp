@@ -13,7 +13,7 @@
 // Include CGameStateManager
 #include "GameStateManager.h"
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include CKeyboardController
 #include "Inputs/KeyboardController.h"
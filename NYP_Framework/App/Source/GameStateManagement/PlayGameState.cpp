@@ -16,6 +16,8 @@
 // Include CKeyboardController
 #include "Inputs/KeyboardController.h"
 #include "GameInfo.h"
+// Include CPlanetPreloader, whose assets the planet takes, and which records the assets of the planet
+#include "../PlanetSelection/PlanetPreloader.h"
 
 #include <iostream>
 using namespace std;
@@ -50,6 +52,9 @@ bool CPlayGameState::Init(void)
 
 	std::cout << (CPlanet::TYPE(type)) << "\n";
 
+	// Record the assets which the planet loads, so that they are preloaded the next time
+	CPlanetPreloader::GetInstance()->StartRecording(type);
+
 	// Initialise the cScene2D instance
 	switch (type)
 	{
@@ -103,6 +108,10 @@ bool CPlayGameState::Init(void)
 		return false;
 		break;
 	}
+
+	// The planet has taken the assets which were preloaded for it, so the rest are discarded
+	CPlanetPreloader::GetInstance()->StopRecording();
+	CPlanetPreloader::GetInstance()->Cancel();
 	return true;
 }
 
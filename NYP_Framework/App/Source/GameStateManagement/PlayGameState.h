@@ -9,9 +9,9 @@
 
 #include "GameStateBase.h"
 
-#include "..\Scene2D\JunglePlanet.h"
-#include "..\Scene2D\\TerrestrialPlanet.h"
-#include "..\Scene2D\SnowPlanet.h"
+#include "../Scene2D/JunglePlanet.h"
+#include "../Scene2D/TerrestrialPlanet.h"
+#include "../Scene2D/SnowPlanet.h"
 #include "../App/Source/PlanetSelection/ScenePlanet.h"
 #include "../App/Source/PlanetSelection/Planet.h"
 #include "../App/Source/Scene2D/GameManager.h"
@@ -6,12 +6,15 @@
  */
 #include "GUI_ScenePlanet.h"
 
+// Include CProfiler, to draw its overlay with the GUI
+#include "TimeControl/Profiler.h"
+
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 #include "../App/Source/GameStateManagement/GameInfo.h"
 
 #include <iostream>
@@ -34,8 +37,15 @@ CGUI_ScenePlanet::CGUI_ScenePlanet(void)
 CGUI_ScenePlanet::~CGUI_ScenePlanet(void)
 {
 	// Cleanup
-	ImGui_ImplOpenGL3_Shutdown();
-	ImGui_ImplGlfw_Shutdown();
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		ImGui_ImplNull_Shutdown();
+	}
+	else
+	{
+		ImGui_ImplOpenGL3_Shutdown();
+		ImGui_ImplGlfw_Shutdown();
+	}
 	ImGui::DestroyContext();
 
 	// We won't delete this since it was created elsewhere
@@ -68,9 +78,17 @@ bool CGUI_ScenePlanet::Init(void)
 	//ImGui::StyleColorsClassic();
 
 	// Setup Platform/Renderer bindings
-	ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
-	const char* glsl_version = "#version 330";
-	ImGui_ImplOpenGL3_Init(glsl_version);
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		// There is no window or context in the headless mode, so the GUI runs without being drawn
+		ImGui_ImplNull_Init((float)CSettings::GetInstance()->iWindowWidth, (float)CSettings::GetInstance()->iWindowHeight);
+	}
+	else
+	{
+		ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
+		const char* glsl_version = "#version 330";
+		ImGui_ImplOpenGL3_Init(glsl_version);
+	}
 
 	// Define the window flags
 	window_flags = 0;
@@ -82,10 +100,11 @@ bool CGUI_ScenePlanet::Init(void)
 
 	CImageLoader* il = CImageLoader::GetInstance();
 	StartCombatButtonData.fileName = "Image\\GUI\\Button_VolDown.png";
-	StartCombatButtonData.textureID = il->LoadTextureGetID(StartCombatButtonData.fileName.c_str(), false);
+	StartCombatButtonData.textureID = il->LoadTextureAsync(StartCombatButtonData.fileName.c_str(), false);
 
 	// Show the mouse pointer
-	glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+	if (CSettings::GetInstance()->bHeadless == false)
+		glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 	isShowPanel = false;
 	StartCombat = false;
 	isButtonHover = false;
@@ -103,8 +122,15 @@ void CGUI_ScenePlanet::Update(const double dElapsedTime)
 	const float relativeScale_y = cSettings->iWindowHeight / 600.0f;
 
 	// Start the Dear ImGui frame
-	ImGui_ImplOpenGL3_NewFrame();
-	ImGui_ImplGlfw_NewFrame();
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		ImGui_ImplNull_NewFrame((float)dElapsedTime);
+	}
+	else
+	{
+		ImGui_ImplOpenGL3_NewFrame();
+		ImGui_ImplGlfw_NewFrame();
+	}
 	ImGui::NewFrame();
 
 	// prevents crash when game is minimised
@@ -209,9 +235,14 @@ void CGUI_ScenePlanet::PreRender(void)
  */
 void CGUI_ScenePlanet::Render(void)
 {
+	// Draw the profiler overlay into this frame
+	CProfiler::GetInstance()->RenderOverlay();
+
 	// Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	// There is no OpenGL context to draw the GUI with in the headless mode
+	if (CSettings::GetInstance()->bHeadless == false)
+		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 }
 
 /**
@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,7 +20,7 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "../App/Source/Scene2D/Map2D.h"
@@ -36,6 +38,8 @@ CPlanet::CPlanet(void)
 	, camera2D(NULL)
 	, animatedSprites(NULL)
 	, cSoundController(NULL)
+	, planetIcon("Image/Planet/PlanetDisable.png")
+	, isVisible(false)
 {
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
@@ -220,6 +224,7 @@ void CPlanet::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	quadMesh->Render();
@@ -7,7 +7,7 @@
 #pragma once
 
 // Include shader
-#include "RenderControl\shader.h"
+#include "RenderControl/Shader.h"
 
 // Include GLM
 #include <includes/glm.hpp>
@@ -21,7 +21,7 @@
 class CMap2D;
 
 // Include Settings
-#include "GameControl\Settings.h"
+#include "GameControl/Settings.h"
 
 // Include AnimatedSprites
 #include "Primitives/SpriteAnimation.h"
@@ -30,7 +30,7 @@ class CMap2D;
 #include "../App/Source/Scene2D/InventoryManager.h"
 
 // Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 // Include Camera
 #include "Primitives/Camera2D.h"
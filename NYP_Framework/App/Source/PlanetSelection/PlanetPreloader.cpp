@@ -0,0 +1,229 @@
+/**
+ CPlanetPreloader
+ @brief A class which loads the assets of the planet which is selected in the planet selection in the background,
+		so that landing on it waits less for them
+ */
+#include "PlanetPreloader.h"
+
+// Include CPlanet, for the types of the planets
+#include "Planet.h"
+
+// Include CImageLoader, which decodes the images and records the images which are loaded
+#include "System/ImageLoader.h"
+// Include CAssetArchive, which reads the maps and sounds into the cache and records the assets which are read
+#include "System/AssetArchive.h"
+
+// Include CLogger, to log from the game loop without waiting for the console
+#include "System/Logger.h"
+
+#include <algorithm>
+#include <iostream>
+#include <set>
+using namespace std;
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CPlanetPreloader::CPlanetPreloader(void)
+	: pPlanetAssets(NULL)
+	, pRecordingAssets(NULL)
+	, uiGeneration(0)
+{
+	const char* const szNames[] = { "snow", "jungle", "terrestrial" };
+	for (unsigned int i = 0; i < sizeof(sPlanetAssets) / sizeof(sPlanetAssets[0]); i++)
+	{
+		sPlanetAssets[i].szName = szNames[i];
+		sPlanetAssets[i].bRecorded = false;
+	}
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton.
+		The reads which have not started are skipped, and the others are waited for
+ */
+CPlanetPreloader::~CPlanetPreloader(void)
+{
+	StopRecording();
+	Cancel();
+	CJobSystem::GetInstance()->Wait(cPrefetchJobs);
+}
+
+/**
+ @brief Start loading the assets of a type of planet in the background. The images are decoded, and the maps,
+		sounds and cooked textures are read so that they are in the cache of the system, but they are not kept,
+		so their loaders still read and parse them when the planet is landed on. The assets are the ones which
+		were recorded the last time that the planet was landed on, so nothing is loaded for a planet which has
+		not been landed on yet. The assets of the planet which was loading before are discarded, unless it is
+		the same kind of planet, whose tutorial and levels load the same assets. Nothing is loaded when there
+		are no worker threads to load it
+ @param iPlanetType A const int containing the CPlanet::TYPE of the planet
+ */
+void CPlanetPreloader::Preload(const int iPlanetType)
+{
+	const SPlanetAssets* pAssets = GetPlanetAssets(iPlanetType);
+	if ((pAssets == pPlanetAssets) || (CJobSystem::GetInstance()->GetNumWorkers() == 0))
+		return;
+
+	Cancel();
+	if ((pAssets == NULL) || (pAssets->bRecorded == false))
+		return;
+
+	LOG_INFO("CPlanetPreloader: Preloading the {} planet", pAssets->szName);
+	pPlanetAssets = pAssets;
+
+	for (size_t i = 0; i < pAssets->vImages.size(); i++)
+		CImageLoader::GetInstance()->PreloadImage(pAssets->vImages[i].first.c_str(), pAssets->vImages[i].second);
+
+	// The job reads a copy of the list, as more assets may be recorded while it is running
+	const std::vector<std::string> vReads = pAssets->vReads;
+	const unsigned int uiJobGeneration = uiGeneration.load();
+	CJobSystem::GetInstance()->Schedule([this, vReads, uiJobGeneration]() { PrefetchAssets(vReads, uiJobGeneration); },
+		&cPrefetchJobs);
+}
+
+/**
+ @brief Discard the assets which were loaded, e.g. once the planet has been landed on and has taken them.
+		The images which the planet is still uploading are kept until they are uploaded
+ */
+void CPlanetPreloader::Cancel(void)
+{
+	if (pPlanetAssets == NULL)
+		return;
+
+	LOG_INFO("CPlanetPreloader: Discarding the {} planet, {} of its {} images were decoded", pPlanetAssets->szName,
+		CImageLoader::GetInstance()->GetNumDecodedPreloads(), CImageLoader::GetInstance()->GetNumPreloadedImages());
+	pPlanetAssets = NULL;
+	uiGeneration++;
+	CImageLoader::GetInstance()->CancelPreloads();
+}
+
+/**
+ @brief Check if all of the assets of the planet were loaded, or if no planet is being loaded
+ */
+bool CPlanetPreloader::IsFinished(void) const
+{
+	if (pPlanetAssets == NULL)
+		return true;
+	return (cPrefetchJobs.IsDone())
+		&& (CImageLoader::GetInstance()->GetNumDecodedPreloads() == CImageLoader::GetInstance()->GetNumPreloadedImages());
+}
+
+/**
+ @brief Record the images which CImageLoader loads, and the assets which CAssetArchive is asked to read, while
+		a type of planet is initialised, so that the assets which are preloaded for it come from its loaders.
+		Call this on the main thread before the planet is initialised
+ @param iPlanetType A const int containing the CPlanet::TYPE of the planet
+ */
+void CPlanetPreloader::StartRecording(const int iPlanetType)
+{
+	StopRecording();
+
+	pRecordingAssets = GetPlanetAssets(iPlanetType);
+	if (pRecordingAssets == NULL)
+		return;
+	CImageLoader::GetInstance()->SetLoadRecord(&vRecordedImages);
+	CAssetArchive::GetInstance()->SetReadRecord(&vRecordedReads);
+}
+
+/**
+ @brief Stop recording, and add the assets which were recorded to the assets of the planet. The image files are
+		not prefetched, as their preloads read them, and neither are the cooked textures which are not in the
+		archive. In the debug builds, the assets which were not in the list of a planet which had been landed on
+		before are logged, as they were not preloaded
+ */
+void CPlanetPreloader::StopRecording(void)
+{
+	if (pRecordingAssets == NULL)
+		return;
+	CImageLoader::GetInstance()->SetLoadRecord(NULL);
+	CAssetArchive::GetInstance()->SetReadRecord(NULL);
+
+	const size_t uiNumAssets = pRecordingAssets->vImages.size() + pRecordingAssets->vReads.size();
+
+	std::set<std::string> setImageNames;
+	for (size_t i = 0; i < vRecordedImages.size(); i++)
+	{
+		setImageNames.insert(CAssetArchive::GetAssetName(vRecordedImages[i].first));
+		if (std::find(pRecordingAssets->vImages.begin(), pRecordingAssets->vImages.end(), vRecordedImages[i])
+			!= pRecordingAssets->vImages.end())
+			continue;
+		if (pRecordingAssets->bRecorded)
+			LOG_DEBUG("CPlanetPreloader: {} was not preloaded for the {} planet", vRecordedImages[i].first, pRecordingAssets->szName);
+		pRecordingAssets->vImages.push_back(vRecordedImages[i]);
+	}
+
+	for (size_t i = 0; i < vRecordedReads.size(); i++)
+	{
+		const std::string& sRead = vRecordedReads[i];
+		const std::string sName = CAssetArchive::GetAssetName(sRead);
+		if (setImageNames.count(sName))
+			continue;
+		if ((setImageNames.count(sName.substr(0, sName.rfind('.')))) && (CAssetArchive::GetInstance()->Contains(sRead) == false))
+			continue;
+		if (std::find(pRecordingAssets->vReads.begin(), pRecordingAssets->vReads.end(), sRead) != pRecordingAssets->vReads.end())
+			continue;
+		if (pRecordingAssets->bRecorded)
+			LOG_DEBUG("CPlanetPreloader: {} was not prefetched for the {} planet", sRead, pRecordingAssets->szName);
+		pRecordingAssets->vReads.push_back(sRead);
+	}
+
+	LOG_INFO("CPlanetPreloader: Recorded {} images and {} other assets of the {} planet, {} of them new",
+		(unsigned int)pRecordingAssets->vImages.size(), (unsigned int)pRecordingAssets->vReads.size(), pRecordingAssets->szName,
+		(unsigned int)(pRecordingAssets->vImages.size() + pRecordingAssets->vReads.size() - uiNumAssets));
+	pRecordingAssets->bRecorded = true;
+	pRecordingAssets = NULL;
+	vRecordedImages.clear();
+	vRecordedReads.clear();
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CPlanetPreloader::PrintSelf(void) const
+{
+	cout << "CPlanetPreloader: ";
+	if (pPlanetAssets)
+		cout << "Preloading the " << pPlanetAssets->szName << " planet, " << CImageLoader::GetInstance()->GetNumDecodedPreloads()
+			<< " of " << CImageLoader::GetInstance()->GetNumPreloadedImages() << " images decoded" << endl;
+	else
+		cout << "No planet is being preloaded" << endl;
+}
+
+/**
+ @brief Get the assets which a type of planet loads. The tutorial and the levels of a planet load the same assets
+ @param iPlanetType A const int containing the CPlanet::TYPE of the planet
+ @return The assets, or NULL if the planet has none to load, e.g. the final planet which is fought in the ship
+ */
+CPlanetPreloader::SPlanetAssets* CPlanetPreloader::GetPlanetAssets(const int iPlanetType)
+{
+	switch (iPlanetType)
+	{
+	case CPlanet::TYPE::SNOW:
+	case CPlanet::TYPE::SNOW_TUTORIAL:
+		return &sPlanetAssets[0];
+	case CPlanet::TYPE::JUNGLE:
+	case CPlanet::TYPE::JUNGLE_TUTORIAL:
+		return &sPlanetAssets[1];
+	case CPlanet::TYPE::TERRESTRIAL:
+	case CPlanet::TYPE::TERRESTRIAL_TUTORIAL:
+		return &sPlanetAssets[2];
+	default:
+		return NULL;
+	}
+}
+
+/**
+ @brief Read the maps, sounds and cooked textures of a planet, so that they are in the cache of the system when
+		their loaders read them. This runs on the worker threads, and stops once the planet is cancelled
+ @param vReads A const std::vector<std::string>& containing the paths of the assets
+ @param uiJobGeneration A const unsigned int containing the generation which the planet was preloaded in
+ */
+void CPlanetPreloader::PrefetchAssets(const std::vector<std::string>& vReads, const unsigned int uiJobGeneration) const
+{
+	for (size_t i = 0; i < vReads.size(); i++)
+	{
+		if (uiGeneration.load() != uiJobGeneration)
+			return;
+		CAssetArchive::GetInstance()->Prefetch(vReads[i]);
+	}
+}
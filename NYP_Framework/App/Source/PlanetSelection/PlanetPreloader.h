@@ -0,0 +1,84 @@
+/**
+ CPlanetPreloader
+ @brief A class which loads the assets of the planet which is selected in the planet selection in the background,
+		so that landing on it waits less for them. The assets of a type of planet are the ones which its loaders
+		asked for the last time that it was landed on, so the first landing on it has nothing to preload.
+		The images are decoded on the worker threads. The maps and sounds are only read into the cache of the
+		system, so their loaders still read and parse them as the planet loads, without waiting for the disk.
+		When another type of planet is selected, the assets of the planet before it are discarded, and the reads
+		of them which have not started are skipped
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "DesignPatterns/SingletonTemplate.h"
+
+// Include CJobSystem, which reads the maps and sounds
+#include "System/JobSystem.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+class CPlanetPreloader : public CSingletonTemplate<CPlanetPreloader>
+{
+	friend CSingletonTemplate<CPlanetPreloader>;
+public:
+	// Start loading the assets of a type of planet, and discard those of the planet which was loading before it.
+	// Nothing is done if the planet uses the same assets as that planet
+	void Preload(const int iPlanetType);
+
+	// Discard the assets which were loaded, e.g. once the planet has been landed on and has taken them
+	void Cancel(void);
+
+	// Check if all of the assets of the planet were loaded
+	bool IsFinished(void) const;
+
+	// Record the assets which the loaders are asked for while a type of planet is initialised, until StopRecording
+	void StartRecording(const int iPlanetType);
+	// Stop recording, and keep the assets which were recorded, to preload them the next time
+	void StopRecording(void);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// The assets which a type of planet loads
+	struct SPlanetAssets
+	{
+		const char* szName;
+		// The images, and whether they are flipped
+		std::vector<std::pair<std::string, bool> > vImages;
+		// The other assets which were read, e.g. the maps, the sounds and the cooked textures in the archive
+		std::vector<std::string> vReads;
+		// Whether the planet has been landed on, so that its assets are known
+		bool bRecorded;
+	};
+
+	// The assets of the snow, jungle and terrestrial planets
+	SPlanetAssets sPlanetAssets[3];
+
+	// The assets which are being loaded, or NULL
+	const SPlanetAssets* pPlanetAssets;
+	// The assets which are being recorded, or NULL, and the loads which are recorded
+	SPlanetAssets* pRecordingAssets;
+	std::vector<std::pair<std::string, bool> > vRecordedImages;
+	std::vector<std::string> vRecordedReads;
+
+	// The jobs which read the maps and sounds
+	CJobCounter cPrefetchJobs;
+	// Counts the cancels, so that the jobs stop reading the assets of a planet which was cancelled
+	std::atomic<unsigned int> uiGeneration;
+
+	// Constructor
+	CPlanetPreloader(void);
+
+	// Destructor
+	virtual ~CPlanetPreloader(void);
+
+	// Get the assets of a type of planet, or NULL if it has none to load
+	SPlanetAssets* GetPlanetAssets(const int iPlanetType);
+
+	// Read the maps and sounds of a planet. This runs on the worker threads
+	void PrefetchAssets(const std::vector<std::string>& vReads, const unsigned int uiJobGeneration) const;
+};
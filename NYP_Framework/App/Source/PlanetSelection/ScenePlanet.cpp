@@ -9,11 +9,16 @@
 	using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
-#include "System\filesystem.h"
+#include "System/filesystem.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
 #include "ScenePlanet.h"
 #include "../App/Source/GameStateManagement/GameInfo.h"
+// Include CPlanetPreloader, to load the selected planet while the player is choosing
+#include "PlanetPreloader.h"
 
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
@@ -166,7 +171,7 @@ bool CScenePlanet::Init(void)
 					// randomiser function
 					bool isSet = false;
 					while (!isSet) {
-						int randomType = rand() % 6;
+						int randomType = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(6);
 						switch (randomType)
 						{
 						case 0:
@@ -287,7 +292,7 @@ bool CScenePlanet::Init(void)
 		std::map<std::pair<int, int>, CPlanet*>::iterator otherPlanets = planetVector.begin();
 
 		realSize = nebulaSize = CGameInfo::GetInstance()->nebulaSize;
-		nebulaSize += rand() % 5 + 3;
+		nebulaSize += CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(5) + 3;
 		std::cout << nebulaSize << "\n";
 		CGameInfo::GetInstance()->nebulaSize = nebulaSize;
 
@@ -431,6 +436,11 @@ bool CScenePlanet::Update(const double dElapsedTime)
 			x++;
 		}
 	}
+
+	// Load the assets of the selected planet in the background, so that landing on it does not wait for them.
+	// This does nothing until another type of planet is selected
+	if ((PlanetSelected) && (PlanetSelected->getVisibility()))
+		CPlanetPreloader::GetInstance()->Preload(PlanetSelected->getType());
 	
 
 	camera2D->Update(dElapsedTime);
@@ -21,7 +21,7 @@
 #include <includes/gtc/type_ptr.hpp>
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "../App/Source/Scene2D/Map2D.h"
@@ -42,7 +42,7 @@
 #include <vector>
 
 // Include Keyboard controller
-#include "Inputs\KeyboardController.h"
+#include "Inputs/KeyboardController.h"
 
 // Game Manager
 #include "../App/Source/Scene2D/GameManager.h"
@@ -51,7 +51,7 @@
 #include "Primitives/Camera2D.h"
 
 // Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 // Add your include files here
 #include <map>
@@ -0,0 +1,487 @@
+/**
+ CScenario
+ @brief A class which runs the scenario benchmarks in the headless mode. Each scenario loads a planet level or the
+		ship combat, spawns more of the enemies and projectiles if asked to, and plays the same route of inputs
+		through it. The time, allocations and draw calls of each frame are measured, and a summary of them is
+		printed and added to a report file, so that the scenarios can be compared between builds
+ */
+#include "Scenario.h"
+
+// Include CAllocationCounter, to count the allocations of each frame
+#include "System/AllocationCounter.h"
+// Include CRenderStats, to count the draw calls of each frame
+#include "RenderControl/RenderStats.h"
+// Include CKeyboardController, to release the keys of the route between scenarios
+#include "Inputs/KeyboardController.h"
+
+// Include CGameStateManager
+#include "../GameStateManagement/GameStateManager.h"
+// Include CGameInfo, which tells the game states which planet and level to load
+#include "../GameStateManagement/GameInfo.h"
+// Include CPlanet
+#include "../PlanetSelection/Planet.h"
+// Include CPlanetPreloader, to preload the planet as the planet selection does
+#include "../PlanetSelection/PlanetPreloader.h"
+// Include CProjectileSystem, to count the projectiles
+#include "../Scene2D/ProjectileSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+// The scenarios, in the order which "all" runs them
+static const CScenario::SScenarioInfo sScenarioInfos[] = {
+	{ "Jungle_Tutorial",		CPlanet::JUNGLE_TUTORIAL,		-1 },
+	{ "Jungle_01",				CPlanet::JUNGLE,				1 },
+	{ "Jungle_02",				CPlanet::JUNGLE,				2 },
+	{ "Snow_Tutorial",			CPlanet::SNOW_TUTORIAL,			-1 },
+	{ "Snow_01",				CPlanet::SNOW,					1 },
+	{ "Snow_02",				CPlanet::SNOW,					2 },
+	{ "Terrestrial_Tutorial",	CPlanet::TERRESTRIAL_TUTORIAL,	-1 },
+	{ "Terrestrial_01",			CPlanet::TERRESTRIAL,			1 },
+	{ "Terrestrial_02",			CPlanet::TERRESTRIAL,			2 },
+	{ "ShipCombat",				CPlanet::NO_TYPE,				-1 },
+};
+static const unsigned int uiNumScenarioInfos = sizeof(sScenarioInfos) / sizeof(sScenarioInfos[0]);
+
+// The columns of the report file
+static const char* szReportHeader = "label,scenario,enemy_multiple,projectile_multiple,frames,load_ms,mean_ms,p50_ms,p95_ms,p99_ms,max_ms,allocations_per_frame,draw_calls_per_frame,max_projectiles";
+
+/**
+ @brief Get a percentile of sorted frame times, by the nearest rank
+ @param vSortedTimes A const std::vector<double>& containing the frame times in ascending order
+ @param dPercentile A const double containing the percentile, from 0 to 100
+ */
+static double GetPercentile(const std::vector<double>& vSortedTimes, const double dPercentile)
+{
+	if (vSortedTimes.empty())
+		return 0.0;
+	size_t uiRank = (size_t)ceil(dPercentile / 100.0 * vSortedTimes.size());
+	if (uiRank < 1)
+		uiRank = 1;
+	if (uiRank > vSortedTimes.size())
+		uiRank = vSortedTimes.size();
+	return vSortedTimes[uiRank - 1];
+}
+
+/**
+ @brief Print the change from an earlier value as a percentage
+ @param dBefore A const double containing the earlier value
+ @param dAfter A const double containing the new value
+ */
+static std::string GetChange(const double dBefore, const double dAfter)
+{
+	ostringstream changeStream;
+	changeStream << fixed << setprecision(1);
+	if (dBefore > 0.0)
+		changeStream << showpos << (dAfter - dBefore) / dBefore * 100.0 << "%";
+	else
+		changeStream << dAfter;
+	return changeStream.str();
+}
+
+/**
+ @brief Constructor
+ */
+CScenario::CScenario(void)
+	: uiCurrentScenario(0)
+	, ePhase(ENTER_SHIP)
+	, uiPhaseFrame(0)
+	, uiNumFrames(600)
+	, uiEnemyMultiple(1)
+	, uiProjectileMultiple(1)
+	, cPlanet(NULL)
+	, uiFrameStartAllocations(0)
+	, bLoadFrame(false)
+	, dLoadTime(0.0)
+	, uiTotalAllocations(0)
+	, uiTotalDrawCalls(0)
+	, uiMaxProjectiles(0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CScenario::~CScenario(void)
+{
+	if (CGameInfo::GetInstance()->selectedPlanet == cPlanet)
+		CGameInfo::GetInstance()->selectedPlanet = NULL;
+	if (cPlanet)
+	{
+		delete cPlanet;
+		cPlanet = NULL;
+	}
+}
+
+/**
+ @brief Choose the scenarios to run, and load the route which the player plays in each of them
+ @param sNames A const std::string& containing the names of the scenarios separated by commas, or "all"
+ @param sRouteFile A const std::string& containing the file of the route. See CInputScript
+ @return false if a name is not a scenario, or the route cannot be loaded
+ */
+bool CScenario::Init(const std::string& sNames, const std::string& sRouteFile)
+{
+	vScenarios.clear();
+	vResults.clear();
+	uiCurrentScenario = 0;
+	ePhase = ENTER_SHIP;
+	uiPhaseFrame = 0;
+
+	istringstream namesStream(sNames);
+	string sName;
+	while (getline(namesStream, sName, ','))
+	{
+		if (sName == "all")
+		{
+			for (unsigned int i = 0; i < uiNumScenarioInfos; i++)
+				vScenarios.push_back(&sScenarioInfos[i]);
+			continue;
+		}
+
+		unsigned int i = 0;
+		while ((i < uiNumScenarioInfos) && (sName != sScenarioInfos[i].szName))
+			i++;
+		if (i == uiNumScenarioInfos)
+		{
+			cout << "CScenario::Init: There is no scenario named " << sName << endl;
+			PrintScenarios();
+			return false;
+		}
+		vScenarios.push_back(&sScenarioInfos[i]);
+	}
+	if (vScenarios.empty())
+	{
+		cout << "CScenario::Init: No scenarios were given" << endl;
+		return false;
+	}
+
+	if (cRoute.Load(sRouteFile) == false)
+		return false;
+
+	// The ship lands on this planet, instead of one from the planet selection
+	if (cPlanet == NULL)
+	{
+		cPlanet = new CPlanet();
+		cPlanet->SetVisibility(true);
+	}
+
+	return true;
+}
+
+/**
+ @brief Set how many of each enemy and projectile the scenarios spawn, for the report. CMap2D and
+		CProjectileSystem spawn them from the same values in CSettings
+ @param uiEnemyMultiple A const unsigned int containing the number of each enemy of the maps
+ @param uiProjectileMultiple A const unsigned int containing the number of projectiles of each shot
+ */
+void CScenario::SetMultiples(const unsigned int uiEnemyMultiple, const unsigned int uiProjectileMultiple)
+{
+	this->uiEnemyMultiple = (uiEnemyMultiple > 0) ? uiEnemyMultiple : 1;
+	this->uiProjectileMultiple = (uiProjectileMultiple > 0) ? uiProjectileMultiple : 1;
+}
+
+/**
+ @brief Set the number of frames which are measured in each scenario
+ @param uiNumFrames A const unsigned int containing the number of frames
+ */
+void CScenario::SetNumFrames(const unsigned int uiNumFrames)
+{
+	this->uiNumFrames = (uiNumFrames > 0) ? uiNumFrames : 1;
+}
+
+/**
+ @brief Check if all of the scenarios were run
+ */
+bool CScenario::IsFinished(void) const
+{
+	return uiCurrentScenario >= vScenarios.size();
+}
+
+/**
+ @brief Start a frame. This enters the next scenario when it is time to, and plays the route of the scenario
+ */
+void CScenario::StartFrame(void)
+{
+	if (IsFinished())
+		return;
+
+	switch (ePhase)
+	{
+	case ENTER_SHIP:
+		EnterScenario();
+		// The ship combat is measured from the frame after it is loaded
+		bLoadFrame = (vScenarios[uiCurrentScenario]->iPlanetType == CPlanet::NO_TYPE);
+		break;
+	case PRELOAD_PLANET:
+		bLoadFrame = false;
+		break;
+	case ENTER_PLANET:
+		CKeyboardController::GetInstance()->Reset();
+		CGameStateManager::GetInstance()->SetActiveGameState("PlayGameState");
+		bLoadFrame = true;
+		break;
+	case MEASURE:
+		cRoute.Apply(uiPhaseFrame);
+		bLoadFrame = false;
+		break;
+	default:
+		break;
+	}
+
+	uiFrameStartAllocations = CAllocationCounter::GetNumAllocations();
+	frameStartTime = std::chrono::steady_clock::now();
+}
+
+/**
+ @brief End a frame, after it has been simulated and rendered, and measure it
+ */
+void CScenario::EndFrame(void)
+{
+	double dFrameTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStartTime).count();
+	unsigned long long uiAllocations = CAllocationCounter::GetNumAllocations() - uiFrameStartAllocations;
+
+	if (IsFinished())
+		return;
+
+	if (bLoadFrame)
+	{
+		dLoadTime = dFrameTime;
+	}
+	else if (ePhase == MEASURE)
+	{
+		vFrameTimes.push_back(dFrameTime);
+		uiTotalAllocations += uiAllocations;
+		uiTotalDrawCalls += CRenderStats::GetInstance()->GetTotal(CRenderStats::DRAW_CALLS);
+		unsigned int uiNumProjectiles = CProjectileSystem::GetInstance()->GetNumProjectiles();
+		if (uiNumProjectiles > uiMaxProjectiles)
+			uiMaxProjectiles = uiNumProjectiles;
+	}
+	uiPhaseFrame++;
+
+	// Go on to the next step of the scenario
+	switch (ePhase)
+	{
+	case ENTER_SHIP:
+		ePhase = (vScenarios[uiCurrentScenario]->iPlanetType == CPlanet::NO_TYPE) ? MEASURE : PRELOAD_PLANET;
+		uiPhaseFrame = 0;
+		break;
+	case PRELOAD_PLANET:
+		if (CPlanetPreloader::GetInstance()->IsFinished())
+		{
+			ePhase = ENTER_PLANET;
+			uiPhaseFrame = 0;
+		}
+		break;
+	case ENTER_PLANET:
+		ePhase = MEASURE;
+		uiPhaseFrame = 0;
+		break;
+	case MEASURE:
+		if (uiPhaseFrame >= uiNumFrames)
+		{
+			FinishScenario();
+			uiCurrentScenario++;
+			ePhase = ENTER_SHIP;
+			uiPhaseFrame = 0;
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ @brief Print out the summary of the scenarios which were run
+ */
+void CScenario::PrintSelf(void) const
+{
+	cout << endl << "Scenarios: " << uiEnemyMultiple << " of each enemy, " << uiProjectileMultiple
+		<< " projectiles per shot. The times are in ms per frame" << endl;
+#ifdef RENDER_STATS_DISABLED
+	cout << "The draw calls are not counted in this build, as RENDER_STATS_DISABLED is defined" << endl;
+#endif
+	cout << left << setw(22) << "Scenario" << right << setw(8) << "Frames" << setw(10) << "Load"
+		<< setw(9) << "Mean" << setw(9) << "p50" << setw(9) << "p95" << setw(9) << "p99" << setw(9) << "Max"
+		<< setw(14) << "Allocs/frame" << setw(13) << "Draws/frame" << setw(13) << "Projectiles" << endl;
+	cout << fixed << setprecision(3);
+	for (unsigned int i = 0; i < vResults.size(); i++)
+	{
+		const SResult& sResult = vResults[i];
+		cout << left << setw(22) << sResult.sName << right << setw(8) << sResult.uiNumFrames
+			<< setw(10) << sResult.dLoadTime << setw(9) << sResult.dMean << setw(9) << sResult.dP50
+			<< setw(9) << sResult.dP95 << setw(9) << sResult.dP99 << setw(9) << sResult.dMax
+			<< setprecision(1) << setw(14) << sResult.dAllocationsPerFrame << setw(13) << sResult.dDrawCallsPerFrame
+			<< setw(13) << sResult.uiMaxProjectiles << setprecision(3) << endl;
+	}
+	cout.unsetf(ios::floatfield);
+	cout << setprecision(6);
+}
+
+/**
+ @brief Add the summary to a report file, after comparing it with the last run of each scenario in the file
+		which spawned the same multiples. The file is a CSV file with a row for each scenario of each run
+ @param sFilename A const std::string& containing the name of the report file
+ @param sLabel A const std::string& containing the name of this build in the report, e.g. its commit
+ @return false if the report cannot be written
+ */
+bool CScenario::SaveReport(const std::string& sFilename, const std::string& sLabel) const
+{
+	// Read the earlier runs, to compare with
+	std::vector<std::vector<std::string> > vEarlierRows;
+	ifstream reportFile(sFilename.c_str());
+	bool bHasHeader = false;
+	string sLine;
+	while (getline(reportFile, sLine))
+	{
+		if (sLine == szReportHeader)
+		{
+			bHasHeader = true;
+			continue;
+		}
+		std::vector<std::string> vColumns;
+		istringstream lineStream(sLine);
+		string sColumn;
+		while (getline(lineStream, sColumn, ','))
+			vColumns.push_back(sColumn);
+		if (vColumns.size() == 14)
+			vEarlierRows.push_back(vColumns);
+	}
+	reportFile.close();
+
+	bool bPrintedTitle = false;
+	for (unsigned int i = 0; i < vResults.size(); i++)
+	{
+		const SResult& sResult = vResults[i];
+		// Find the last run of this scenario with the same multiples
+		int iEarlier = (int)vEarlierRows.size() - 1;
+		while ((iEarlier >= 0) &&
+			((vEarlierRows[iEarlier][1] != sResult.sName) ||
+			(strtoul(vEarlierRows[iEarlier][2].c_str(), NULL, 10) != uiEnemyMultiple) ||
+			(strtoul(vEarlierRows[iEarlier][3].c_str(), NULL, 10) != uiProjectileMultiple)))
+		{
+			iEarlier--;
+		}
+		if (iEarlier < 0)
+			continue;
+
+		if (bPrintedTitle == false)
+		{
+			cout << endl << "Changes from the last runs in " << sFilename << endl;
+			cout << left << setw(22) << "Scenario" << setw(20) << "Last run" << right << setw(9) << "p50"
+				<< setw(9) << "p95" << setw(9) << "p99" << setw(9) << "Max" << setw(14) << "Allocs/frame"
+				<< setw(13) << "Draws/frame" << endl;
+			bPrintedTitle = true;
+		}
+		const std::vector<std::string>& vEarlier = vEarlierRows[iEarlier];
+		cout << left << setw(22) << sResult.sName << setw(20) << vEarlier[0] << right
+			<< setw(9) << GetChange(strtod(vEarlier[7].c_str(), NULL), sResult.dP50)
+			<< setw(9) << GetChange(strtod(vEarlier[8].c_str(), NULL), sResult.dP95)
+			<< setw(9) << GetChange(strtod(vEarlier[9].c_str(), NULL), sResult.dP99)
+			<< setw(9) << GetChange(strtod(vEarlier[10].c_str(), NULL), sResult.dMax)
+			<< setw(14) << GetChange(strtod(vEarlier[11].c_str(), NULL), sResult.dAllocationsPerFrame)
+			<< setw(13) << GetChange(strtod(vEarlier[12].c_str(), NULL), sResult.dDrawCallsPerFrame) << endl;
+	}
+
+	ofstream outputFile(sFilename.c_str(), ios::app);
+	if (outputFile.is_open() == false)
+	{
+		cout << "CScenario::SaveReport: Unable to write to " << sFilename << endl;
+		return false;
+	}
+	if (bHasHeader == false)
+		outputFile << szReportHeader << endl;
+	// A comma in the label would split it into two columns
+	string sColumnLabel = sLabel;
+	std::replace(sColumnLabel.begin(), sColumnLabel.end(), ',', ';');
+	outputFile << fixed << setprecision(4);
+	for (unsigned int i = 0; i < vResults.size(); i++)
+	{
+		const SResult& sResult = vResults[i];
+		outputFile << sColumnLabel << "," << sResult.sName << "," << uiEnemyMultiple << "," << uiProjectileMultiple
+			<< "," << sResult.uiNumFrames << "," << sResult.dLoadTime << "," << sResult.dMean
+			<< "," << sResult.dP50 << "," << sResult.dP95 << "," << sResult.dP99 << "," << sResult.dMax
+			<< "," << sResult.dAllocationsPerFrame << "," << sResult.dDrawCallsPerFrame
+			<< "," << sResult.uiMaxProjectiles << endl;
+	}
+	cout << "Saved the scenario results to " << sFilename << endl;
+	return true;
+}
+
+/**
+ @brief Print out the names of the scenarios
+ */
+void CScenario::PrintScenarios(void)
+{
+	cout << "Scenarios: all";
+	for (unsigned int i = 0; i < uiNumScenarioInfos; i++)
+		cout << ", " << sScenarioInfos[i].szName;
+	cout << endl;
+}
+
+/**
+ @brief Start the game state of the next scenario. The ship combat state is started first, as it creates the
+		ship's inventory which the planets add their resources to
+ */
+void CScenario::EnterScenario(void)
+{
+	const SScenarioInfo* pScenario = vScenarios[uiCurrentScenario];
+	cout << "CScenario: Running " << pScenario->szName << endl;
+
+	// Start measuring the scenario
+	vFrameTimes.clear();
+	vFrameTimes.reserve(uiNumFrames);
+	uiTotalAllocations = 0;
+	uiTotalDrawCalls = 0;
+	uiMaxProjectiles = 0;
+	dLoadTime = 0.0;
+	cRoute.Rewind();
+
+	// Release the keys which the route of the last scenario was holding
+	CKeyboardController::GetInstance()->Reset();
+
+	// Choose the planet and level which the ship lands on
+	cPlanet->SetType((CPlanet::TYPE)pScenario->iPlanetType);
+	CGameInfo* cGameInfo = CGameInfo::GetInstance();
+	cGameInfo->selectedPlanet = cPlanet;
+	cGameInfo->forcedLevel = pScenario->iLevel;
+	cGameInfo->PrevState = 1;
+
+	// The planet selection preloads the planet while it is selected, before the ship combat
+	CPlanetPreloader::GetInstance()->Preload(pScenario->iPlanetType);
+
+	CGameStateManager::GetInstance()->SetActiveGameState("ShipCombatState");
+}
+
+/**
+ @brief Summarise the measurements of the current scenario
+ */
+void CScenario::FinishScenario(void)
+{
+	SResult sResult;
+	sResult.sName = vScenarios[uiCurrentScenario]->szName;
+	sResult.uiNumFrames = (unsigned int)vFrameTimes.size();
+	sResult.dLoadTime = dLoadTime;
+
+	std::vector<double> vSortedTimes = vFrameTimes;
+	std::sort(vSortedTimes.begin(), vSortedTimes.end());
+	double dTotalTime = 0.0;
+	for (unsigned int i = 0; i < vSortedTimes.size(); i++)
+		dTotalTime += vSortedTimes[i];
+
+	double dNumFrames = (sResult.uiNumFrames > 0) ? (double)sResult.uiNumFrames : 1.0;
+	sResult.dMean = dTotalTime / dNumFrames;
+	sResult.dP50 = GetPercentile(vSortedTimes, 50.0);
+	sResult.dP95 = GetPercentile(vSortedTimes, 95.0);
+	sResult.dP99 = GetPercentile(vSortedTimes, 99.0);
+	sResult.dMax = vSortedTimes.empty() ? 0.0 : vSortedTimes.back();
+	sResult.dAllocationsPerFrame = uiTotalAllocations / dNumFrames;
+	sResult.dDrawCallsPerFrame = uiTotalDrawCalls / dNumFrames;
+	sResult.uiMaxProjectiles = uiMaxProjectiles;
+	vResults.push_back(sResult);
+}
@@ -0,0 +1,133 @@
+/**
+ CScenario
+ @brief A class which runs the scenario benchmarks in the headless mode. Each scenario loads a planet level or the
+		ship combat, spawns more of the enemies and projectiles if asked to, and plays the same route of inputs
+		through it. The time, allocations and draw calls of each frame are measured, and a summary of them is
+		printed and added to a report file, so that the scenarios can be compared between builds
+ */
+#pragma once
+
+// Scripted inputs
+#include "Inputs/InputScript.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+class CPlanet;
+
+class CScenario
+{
+public:
+	// A level which can be run as a scenario
+	struct SScenarioInfo
+	{
+		const char* szName;
+		// The CPlanet::TYPE which is landed on, or NO_TYPE to stay in the ship combat
+		int iPlanetType;
+		// The level of the planet, or -1 for the tutorial and the ship combat
+		int iLevel;
+	};
+
+	// The measurements of a scenario. The frame times are in milliseconds
+	struct SResult
+	{
+		std::string sName;
+		unsigned int uiNumFrames;
+		double dLoadTime;
+		double dMean;
+		double dP50;
+		double dP95;
+		double dP99;
+		double dMax;
+		double dAllocationsPerFrame;
+		double dDrawCallsPerFrame;
+		unsigned int uiMaxProjectiles;
+	};
+
+	// Constructor
+	CScenario(void);
+
+	// Destructor
+	virtual ~CScenario(void);
+
+	// Choose the scenarios to run, from their names separated by commas or "all", and load the route
+	bool Init(const std::string& sNames, const std::string& sRouteFile);
+
+	// Set how many of each enemy and projectile the scenarios spawn, for the report
+	void SetMultiples(const unsigned int uiEnemyMultiple, const unsigned int uiProjectileMultiple);
+
+	// Set the number of frames which are measured in each scenario
+	void SetNumFrames(const unsigned int uiNumFrames);
+
+	// Check if all of the scenarios were run
+	bool IsFinished(void) const;
+
+	// Start a frame. This enters the next scenario when it is time to, and plays the route
+	void StartFrame(void);
+
+	// End a frame, and measure it
+	void EndFrame(void);
+
+	// Print out the summary of the scenarios which were run
+	void PrintSelf(void) const;
+
+	// Add the summary to a report file, and compare it with the last run of each scenario in the file
+	bool SaveReport(const std::string& sFilename, const std::string& sLabel) const;
+
+	// Print out the names of the scenarios
+	static void PrintScenarios(void);
+
+protected:
+	// The steps of running a scenario
+	enum PHASE
+	{
+		ENTER_SHIP = 0,		// The ship combat state is started, which creates the ship's inventory
+		PRELOAD_PLANET,		// The ship combat runs until the planet has been preloaded, as the planet selection would
+		ENTER_PLANET,		// The ship lands on the planet of the scenario
+		MEASURE,			// The frames in the level are measured
+		NUM_PHASES
+	};
+
+	// The scenarios to run, in order
+	std::vector<const SScenarioInfo*> vScenarios;
+	// The index of the scenario which is running
+	unsigned int uiCurrentScenario;
+	// The step of the scenario which is running
+	PHASE ePhase;
+	// The number of frames of the current phase which have ended
+	unsigned int uiPhaseFrame;
+
+	// The number of frames which are measured in each scenario
+	unsigned int uiNumFrames;
+	unsigned int uiEnemyMultiple;
+	unsigned int uiProjectileMultiple;
+
+	// The route of inputs, from the first measured frame of each scenario
+	CInputScript cRoute;
+
+	// The planet which the ship lands on
+	CPlanet* cPlanet;
+
+	// The start of the current frame
+	std::chrono::steady_clock::time_point frameStartTime;
+	unsigned long long uiFrameStartAllocations;
+	// True if the frame which is ending loaded the level, so it is not one of the measured frames
+	bool bLoadFrame;
+	double dLoadTime;
+
+	// The measurements of the frames of the current scenario
+	std::vector<double> vFrameTimes;
+	unsigned long long uiTotalAllocations;
+	unsigned long long uiTotalDrawCalls;
+	unsigned int uiMaxProjectiles;
+
+	// The results of the scenarios which were run
+	std::vector<SResult> vResults;
+
+	// Start the game state of the next scenario
+	void EnterScenario(void);
+
+	// Summarise the measurements of the current scenario
+	void FinishScenario(void);
+};
@@ -7,13 +7,17 @@
 #include "Ammo2D.h"
 
 #include <iostream>
+#include <map>
+#include <string>
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
@@ -41,8 +45,6 @@ CAmmo2D::CAmmo2D()
 	hit = false; //ammo hasn't hit anything yet
 
 	active = false; //hm, maybe might not need it
-
-	Init();
 }
 
 /**
@@ -61,11 +63,13 @@ CAmmo2D::~CAmmo2D(void)
 	}
 
 	// optional: de-allocate all resources once they've outlived their purpose:
-	glDeleteVertexArrays(1, &VAO);
+	if (VAO != 0)
+		glDeleteVertexArrays(1, &VAO);
 }
 
 /**
-  @brief Initialise this instance
+  @brief Initialise this instance. This creates its VAO and sprite animation, so it is only done once for each ammo
+		 in the player's pool, and Reset is used when the ammo is fired again
   */
 bool CAmmo2D::Init(void)
 {
@@ -89,17 +93,16 @@ bool CAmmo2D::Init(void)
 	//glGenVertexArrays(1, &VAO);
 	//glBindVertexArray(VAO);
 
-	// Create the quad mesh for the ammo
+	// Create the VAO for the ammo's sprite
 	glGenVertexArrays(1, &VAO);
 	glBindVertexArray(VAO);
-	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	switch (cGUI_Scene2D->getPlanetNum())
 	{
 	case 1:
 	{
 		// Load the ammo texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/scene2d_blue_flame.png", true);
+		iTextureID = LoadTexture("Image/scene2d_blue_flame.png");
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load jungle ammo texture" << std::endl;
@@ -116,7 +119,7 @@ bool CAmmo2D::Init(void)
 	case 2:
 	{
 		// Load the ammo texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/PlayerBullet.png", true);
+		iTextureID = LoadTexture("Image/TerrestrialPlanet/PlayerBullet.png");
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load the ammo texture" << std::endl;
@@ -134,7 +137,7 @@ bool CAmmo2D::Init(void)
 	case 3:
 	{
 		// Load the ammo texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/Icedart.png", true);
+		iTextureID = LoadTexture("Image/SnowPlanet/Icedart.png");
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load snow ammo texture" << std::endl;
@@ -154,7 +157,7 @@ bool CAmmo2D::Init(void)
 	default:
 	{
 		// Load the ammo texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/scene2d_blue_flame.png", true);
+		iTextureID = LoadTexture("Image/scene2d_blue_flame.png");
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load jungle ammo texture" << std::endl;
@@ -187,6 +190,47 @@ bool CAmmo2D::Init(void)
 	return true;
 }
 
+/**
+ @brief Reset this instance so that it can be fired again. The VAO, texture and sprite animation from Init are kept
+ */
+void CAmmo2D::Reset(void)
+{
+	transform = glm::mat4(1.0f);
+	vec2Index = glm::i32vec2(-1, -1);
+	vec2OldIndex = vec2Index;
+	vec2NumMicroSteps = glm::i32vec2(0, 0);
+	vec2UVCoordinate = glm::vec2(0.0f);
+	ResetRenderPosition();
+
+	hit = false;
+	active = false;
+
+	animatedSprites->PlayAnimation("idle", -1, 1.0f);
+
+	cPhysics2D.Init();
+	cPhysics2D.SetStatus(CPhysics2D::STATUS::FALL);
+
+	runtimeColour = glm::vec4(1.0, 1.0, 1.0, 1.0);
+}
+
+/**
+ @brief Load an ammo texture. Each texture is only loaded once, as each ammo in the player's pool is initialised
+ @param filename A const char* containing the path of the texture
+ */
+unsigned int CAmmo2D::LoadTexture(const char* filename)
+{
+	static std::map<std::string, unsigned int> mapTextureIDs;
+
+	std::map<std::string, unsigned int>::iterator it = mapTextureIDs.find(filename);
+	if (it != mapTextureIDs.end())
+		return it->second;
+
+	unsigned int uiTextureID = CImageLoader::GetInstance()->LoadTextureGetID(filename, true);
+	if (uiTextureID != 0)
+		mapTextureIDs[filename] = uiTextureID;
+	return uiTextureID;
+}
+
 /**
  @brief Update this instance
  */
@@ -295,12 +339,14 @@ void CAmmo2D::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, vec2NumMicroSteps, IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS;
-	actualPos.y += vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -317,6 +363,7 @@ void CAmmo2D::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
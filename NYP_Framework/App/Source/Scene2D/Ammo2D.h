@@ -7,7 +7,7 @@
 #pragma once
 
 // Include Singleton template
-#include "DesignPatterns\SingletonTemplate.h"
+#include "DesignPatterns/SingletonTemplate.h"
 
 // Include GLEW
 #ifndef GLEW_STATIC
@@ -33,7 +33,7 @@ class CMap2D;
 #include "Physics2D.h"
 
 //Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 // Include Camera2D
 #include "Primitives/Camera2D.h"
@@ -47,6 +47,9 @@ public:
 	// Init
 	bool Init(void);
 
+	// Reset the ammo so that it can be fired again, without setting it up again
+	void Reset(void);
+
 	// Update
 	void Update(const double dElapsedTime);
 
@@ -107,9 +110,6 @@ protected:
 	// Handler to the CMap2D instance
 	CMap2D* cMap2D;
 
-	//CS: The quadMesh for drawing the tiles
-	CMesh* quadMesh;
-
 	//CS: Animated Sprite
 	CSpriteAnimation* animatedSprites;
 
@@ -136,5 +136,8 @@ protected:
 
 	// Determines whether or not to render it
 	bool active;
+
+	// Load an ammo texture, or get it if it has been loaded before
+	static unsigned int LoadTexture(const char* filename);
 };
 
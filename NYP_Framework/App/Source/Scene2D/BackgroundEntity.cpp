@@ -10,7 +10,7 @@
 #include "Primitives/MeshBuilder.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 #include <iostream>
 #include <vector>
@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,7 +20,7 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
@@ -33,11 +35,11 @@ CEnemy2D::CEnemy2D(void)
 	, cMap2D(NULL)
 	, cSettings(NULL)
 	, cPlayer2D(NULL)
-	, iFSMCounter(0)
 	, quadMesh(NULL)
 	, camera2D(NULL)
 	, animatedSprites(NULL)
 	, cSoundController(NULL)
+	, uiPathTicket(CPathRequestQueue::INVALID_TICKET)
 {
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
@@ -59,6 +61,9 @@ CEnemy2D::CEnemy2D(void)
  */
 CEnemy2D::~CEnemy2D(void)
 {
+	// Cancel any path which is still being found for this enemy
+	CancelPathRequest();
+
 	// Delete the CAnimationSprites
 	if (animatedSprites)
 	{
@@ -116,7 +121,7 @@ bool CEnemy2D::Init(void)
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the enemy2D texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/Scene2D_Ninja.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/Scene2D_Ninja.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/Scene2D_Ninja.png" << endl;
@@ -218,12 +223,14 @@ void CEnemy2D::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, vec2NumMicroSteps, IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS;
-	actualPos.y += vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -234,6 +241,7 @@ void CEnemy2D::Render(void)
 
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	// Render the animated sprite
 	glBindVertexArray(VAO);
@@ -364,6 +372,14 @@ void CEnemy2D::setAlert(bool alert)
 	alerted = alert;
 }
 
+/**
+ @brief Get the FSM of this enemy
+ */
+const CEnemyFSM& CEnemy2D::GetFSM(void) const
+{
+	return cFSM;
+}
+
 /**
  @brief Constraint the enemy2D's position within a boundary
  @param eDirection A DIRECTION enumerated data type which indicates the direction to check
@@ -793,29 +809,69 @@ void CEnemy2D::UpdatePosition(void)
 	}
 }
 
-//called whenever an ammo is needed to be shot
-CEnemyAmmo2D* CEnemy2D::FetchAmmo()
+/**
+ @brief Add the waypoints of the enemy from the map to a vector, and erase them from the map
+ @param waypointVector A vector<glm::vec2> containing the waypoints to add to
+ @param startIndex An int containing the map value of the first waypoint
+ @param numOfWaypoints An int containing the number of waypoints, whose map values follow startIndex
+ @return The waypoints
+ */
+vector<glm::vec2> CEnemy2D::ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints)
 {
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CEnemyAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+	for (int i = 0; i < numOfWaypoints; ++i)
 	{
-		CEnemyAmmo2D* ammo = (CEnemyAmmo2D*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// By default, microsteps should be zero --> reset in case a previously active ammo that was used then ste inactive was used again
-		ammo->vec2NumMicroSteps = glm::i32vec2(0, 0);
-		return ammo;
+		waypointVector.push_back(cMap2D->GetTilePosition(startIndex + i));
+		// Erase the value of the waypoint in the arrMapInfo
+		cMap2D->SetMapInfo(waypointVector[i].y, waypointVector[i].x, 0);
+	}
+
+	return waypointVector;
+}
+
+/**
+ @brief Request a path from CPathRequestQueue. The path is found in a later frame, so the enemy should
+		keep moving to its current vec2Destination until this returns true
+ @param startPos A const glm::vec2& containing the start position
+ @param targetPos A const glm::vec2& containing the target position
+ @param heuristicFunc A HeuristicFunction to estimate the remaining distance
+ @param weight An int containing the weight of the heuristic
+ @param path A vector<glm::vec2>& to store the path in
+ @return true if the path was found and stored in path, otherwise false
+ */
+bool CEnemy2D::RequestPath(const glm::vec2& startPos, const glm::vec2& targetPos, HeuristicFunction heuristicFunc, int weight, vector<glm::vec2>& path)
+{
+	CPathRequestQueue* cPathRequestQueue = CPathRequestQueue::GetInstance();
+
+	// Drop a request which was made from another tile or for another target
+	if ((uiPathTicket != CPathRequestQueue::INVALID_TICKET) &&
+		((vec2PathStart != startPos) || (vec2PathTarget != targetPos)))
+	{
+		CancelPathRequest();
 	}
 
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CEnemyAmmo2D);
+	if (uiPathTicket == CPathRequestQueue::INVALID_TICKET)
+	{
+		uiPathTicket = cPathRequestQueue->Submit(startPos, targetPos, heuristicFunc, weight);
+		vec2PathStart = startPos;
+		vec2PathTarget = targetPos;
+		return false;
 	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
 
+	if (cPathRequestQueue->GetResult(uiPathTicket, path) == false)
+		return false;
+
+	uiPathTicket = CPathRequestQueue::INVALID_TICKET;
+	return true;
+}
+
+/**
+ @brief Cancel the path request which has not been collected yet
+ */
+void CEnemy2D::CancelPathRequest(void)
+{
+	if (uiPathTicket != CPathRequestQueue::INVALID_TICKET)
+	{
+		CPathRequestQueue::GetInstance()->Cancel(uiPathTicket);
+		uiPathTicket = CPathRequestQueue::INVALID_TICKET;
+	}
 }
\ No newline at end of file
@@ -7,7 +7,7 @@
 #pragma once
 
 // Include shader
-#include "RenderControl\shader.h"
+#include "RenderControl/Shader.h"
 
 // Include GLM
 #include <includes/glm.hpp>
@@ -21,7 +21,7 @@
 class CMap2D;
 
 // Include Settings
-#include "GameControl\Settings.h"
+#include "GameControl/Settings.h"
 
 // Include AnimatedSprites
 #include "Primitives/SpriteAnimation.h"
@@ -40,13 +40,19 @@ class CMap2D;
 #include "InventoryManagerPlanet.h"
 
 // Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 // Include Camera
 #include "Primitives/Camera2D.h"
 
-//Include enemy ammo
-#include "EnemyAmmo2D.h"
+// Include CProjectileSystem
+#include "ProjectileSystem.h"
+
+// Include CPathRequestQueue
+#include "PathRequestQueue.h"
+
+// Include CEnemyFSM
+#include "EnemyFSM.h"
 
 class CEnemy2D : public CEntity2D
 {
@@ -144,6 +150,9 @@ public:
 	bool getNoisy(void); //check if need to check to put other enemies in alert state
 	void setAlert(bool alert = true); //set alert to true to get specific enemy to go into en_route state
 
+	// Get the FSM of this enemy
+	const CEnemyFSM& GetFSM(void) const;
+
 protected:
 	enum DIRECTION
 	{
@@ -154,11 +163,7 @@ protected:
 		NUM_DIRECTIONS
 	};
 
-	//vector full of enemy's fired ammo
-	std::vector<CEnemyAmmo2D*> ammoList;
 	int shootingDirection; //shoots in the direction the enemy is facing
-	//used to get a deactivated ammo to activate
-	CEnemyAmmo2D* FetchAmmo(void);
 
 	glm::vec2 i32vec2OldIndex;
 
@@ -215,11 +220,8 @@ protected:
 	// Sound Controller
 	CSoundController* cSoundController;
 
-	// FSM counter - count how many frames it has been in this FSM
-	int iFSMCounter;
-
-	// Max count in a state
-	const int iMaxFSMCounter = 60;
+	// The FSM, which keeps the current state and the time spent in it
+	CEnemyFSM cFSM;
 
 	// Constraint the enemy2D's position within a boundary
 	void Constraint(DIRECTION eDirection = LEFT);
@@ -231,7 +233,7 @@ protected:
 	bool IsMidAir(void);
 
 	// Update Jump or Fall
-	void UpdateJumpFall(const double dElapsedTime = 0.0166666666666667);
+	void UpdateJumpFall(const double dElapsedTime);
 
 	// Let enemy2D interact with the map
 	void InteractWithMap(void);
@@ -248,6 +250,19 @@ protected:
 	// Update position
 	void UpdatePosition(void);
 
+	// Add the waypoints of the enemy from the map to a vector, and erase them from the map
+	vector<glm::vec2> ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints);
+
+	// Request a path from CPathRequestQueue. Returns true and fills in path once it has been found
+	bool RequestPath(const glm::vec2& startPos, const glm::vec2& targetPos, HeuristicFunction heuristicFunc, int weight, vector<glm::vec2>& path);
+	// Cancel the path request which has not been collected yet
+	void CancelPathRequest(void);
+
+	// path request variables
+	unsigned int uiPathTicket;
+	glm::vec2 vec2PathStart;
+	glm::vec2 vec2PathTarget;
+
 	// health variables
 	int health;
 	int maxHealth;
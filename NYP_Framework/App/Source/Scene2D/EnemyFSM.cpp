@@ -0,0 +1,183 @@
+/**
+ CEnemyFSM
+ @brief A class which runs the finite state machine of an enemy from the state table of its archetype,
+		timing each state in seconds instead of frames. The state table holds how long each state lasts,
+		and the state which it times out into when the enemy does not decide that in its Update
+ */
+#include "EnemyFSM.h"
+
+// Include CSettings, for the speed of the game time
+#include "GameControl/Settings.h"
+
+#include <iostream>
+using namespace std;
+
+/**
+ @brief Constructor
+ */
+CEnemyFSM::CEnemyFSM(void)
+	: eArchetype(NUM_ARCHETYPES)
+	, pStates(NULL)
+	, uiNumStates(0)
+	, iCurrentState(0)
+	, iPreviousState(0)
+	, dTime(0.0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CEnemyFSM::~CEnemyFSM(void)
+{
+	// We won't delete the state table since it is a static table of the archetype
+	pStates = NULL;
+}
+
+/**
+ @brief Init the FSM with the state table of an archetype, and enter the initial state
+ @param eArchetype A const ARCHETYPE containing the archetype of the enemy
+ @param pStates A const SState* containing the state table, with one row for each state
+ @param uiNumStates A const unsigned int containing the number of rows in the state table
+ @param iInitialState A const int containing the state to start in
+ */
+bool CEnemyFSM::Init(const ARCHETYPE eArchetype, const SState* pStates, const unsigned int uiNumStates, const int iInitialState)
+{
+	if ((pStates == NULL) || (uiNumStates == 0) ||
+		(iInitialState < 0) || (iInitialState >= (int)uiNumStates))
+	{
+		cout << "CEnemyFSM::Init: Invalid state table." << endl;
+		return false;
+	}
+	for (unsigned int i = 0; i < uiNumStates; i++)
+	{
+		if ((pStates[i].iTimeoutState < NO_STATE) || (pStates[i].iTimeoutState >= (int)uiNumStates))
+		{
+			cout << "CEnemyFSM::Init: Invalid timeout state of " << pStates[i].szName << "." << endl;
+			return false;
+		}
+	}
+
+	this->eArchetype = eArchetype;
+	this->pStates = pStates;
+	this->uiNumStates = uiNumStates;
+	iCurrentState = iInitialState;
+	iPreviousState = iInitialState;
+	dTime = 0.0;
+
+	return true;
+}
+
+/**
+ @brief Enter a state
+ @param iState A const int containing the state to enter
+ @param bResetTime A const bool which is false if the time spent in the previous state should carry over
+ */
+void CEnemyFSM::SetState(const int iState, const bool bResetTime)
+{
+	if ((iState < 0) || (iState >= (int)uiNumStates))
+	{
+		cout << "CEnemyFSM::SetState: Invalid state " << iState << "." << endl;
+		return;
+	}
+
+	iPreviousState = iCurrentState;
+	iCurrentState = iState;
+	if (bResetTime)
+		dTime = 0.0;
+}
+
+/**
+ @brief Get the current state
+ */
+int CEnemyFSM::GetState(void) const
+{
+	return iCurrentState;
+}
+
+/**
+ @brief Get the state before the current state
+ */
+int CEnemyFSM::GetPreviousState(void) const
+{
+	return iPreviousState;
+}
+
+/**
+ @brief Get the name of the current state
+ */
+const char* CEnemyFSM::GetStateName(void) const
+{
+	if (pStates == NULL)
+		return "";
+	return pStates[iCurrentState].szName;
+}
+
+/**
+ @brief Add to the time spent in the current state. The states are timed in real seconds, like the frames
+		of the 30 FPS game which they were counted in before, so the game time is converted to real time
+ @param dElapsedTime A const double containing the seconds of game time to add
+ */
+void CEnemyFSM::AddTime(const double dElapsedTime)
+{
+	dTime += dElapsedTime / CSettings::GetInstance()->dGameTimeScale;
+}
+
+/**
+ @brief Restart the time spent in the current state
+ */
+void CEnemyFSM::ResetTime(void)
+{
+	dTime = 0.0;
+}
+
+/**
+ @brief Get the real seconds spent in the current state
+ */
+double CEnemyFSM::GetTime(void) const
+{
+	return dTime;
+}
+
+/**
+ @brief Check if the time in the current state has passed the dMaxTime in the state table
+ */
+bool CEnemyFSM::IsTimeUp(void) const
+{
+	if (pStates == NULL)
+		return false;
+	// States with a dMaxTime of 0 do not time out
+	if (pStates[iCurrentState].dMaxTime <= 0.0)
+		return false;
+	return dTime > pStates[iCurrentState].dMaxTime;
+}
+
+/**
+ @brief Enter the timeout state in the state table if the current state has timed out. The states without
+		a timeout state are left for the Update of the enemy to check with IsTimeUp
+ @return true if the current state timed out into its timeout state
+ */
+bool CEnemyFSM::CheckTimeout(void)
+{
+	if ((IsTimeUp() == false) || (pStates[iCurrentState].iTimeoutState == NO_STATE))
+		return false;
+	SetState(pStates[iCurrentState].iTimeoutState);
+	return true;
+}
+
+/**
+ @brief Get the archetype
+ */
+CEnemyFSM::ARCHETYPE CEnemyFSM::GetArchetype(void) const
+{
+	return eArchetype;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CEnemyFSM::PrintSelf(void) const
+{
+	cout << "CEnemyFSM: archetype " << eArchetype << ", state " << GetStateName()
+		<< " for " << dTime << "s, previous state " << iPreviousState << endl;
+}
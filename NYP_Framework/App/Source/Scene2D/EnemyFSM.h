@@ -0,0 +1,97 @@
+/**
+ CEnemyFSM
+ @brief A class which runs the finite state machine of an enemy from the state table of its archetype,
+		timing each state in seconds instead of frames. The state table holds how long each state lasts,
+		and the state which it times out into when the enemy does not decide that in its Update
+ */
+#pragma once
+
+class CEnemyFSM
+{
+public:
+	// The archetypes of enemies
+	enum ARCHETYPE
+	{
+		JUNGLE_VT = 0,
+		JUNGLE_SHYC,
+		JUNGLE_PATROLT,
+		JUNGLE_ITRACKER,
+		SNOW_SWB,
+		SNOW_SWW,
+		SNOW_SWBS,
+		TERRESTRIAL_DUMMY,
+		TERRESTRIAL_SENTRY,
+		TERRESTRIAL_TURRET,
+		TERRESTRIAL_VETERAN,
+		TERRESTRIAL_WORKER,
+		NUM_ARCHETYPES
+	};
+
+	// The timeout state of the states which do not time out into a fixed state
+	static const int NO_STATE = -1;
+
+	// A row in the state table of an archetype
+	struct SState
+	{
+		const char* szName;
+		// Real seconds in this state before IsTimeUp returns true, or 0 if the state does not time out
+		double dMaxTime;
+		// The state which CheckTimeout enters once this state times out, or NO_STATE
+		int iTimeoutState;
+	};
+
+	// Constructor
+	CEnemyFSM(void);
+
+	// Destructor
+	virtual ~CEnemyFSM(void);
+
+	// Init the FSM with the state table of an archetype, and enter the initial state
+	bool Init(const ARCHETYPE eArchetype, const SState* pStates, const unsigned int uiNumStates, const int iInitialState);
+
+	// Enter a state. The time in the state is restarted unless bResetTime is false
+	void SetState(const int iState, const bool bResetTime = true);
+
+	// Get the current state
+	int GetState(void) const;
+
+	// Get the state before the current state
+	int GetPreviousState(void) const;
+
+	// Get the name of the current state
+	const char* GetStateName(void) const;
+
+	// Add to the time spent in the current state
+	void AddTime(const double dElapsedTime);
+
+	// Restart the time spent in the current state
+	void ResetTime(void);
+
+	// Get the real seconds spent in the current state
+	double GetTime(void) const;
+
+	// Check if the time in the current state has passed the dMaxTime in the state table
+	bool IsTimeUp(void) const;
+
+	// Enter the timeout state of the current state if it has timed out. Returns true if the state changed
+	bool CheckTimeout(void);
+
+	// Get the archetype
+	ARCHETYPE GetArchetype(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// The archetype and its state table
+	ARCHETYPE eArchetype;
+	const SState* pStates;
+	unsigned int uiNumStates;
+
+	// The current and previous states
+	int iCurrentState;
+	int iPreviousState;
+
+	// Real seconds spent in the current state
+	double dTime;
+};
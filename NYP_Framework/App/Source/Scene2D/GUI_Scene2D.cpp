@@ -5,7 +5,11 @@
  Date: May 2021
  */
 #include "GUI_Scene2D.h"
-#include "System\ImageLoader.h"
+
+// Include CProfiler, to time the GUI and draw its overlay with the GUI
+#include "TimeControl/Profiler.h"
+
+#include "System/ImageLoader.h"
 #include "../App/Source/GameStateManagement/GameInfo.h"
 
 #include <iostream>
@@ -39,8 +43,15 @@ CGUI_Scene2D::~CGUI_Scene2D(void)
 	cInventoryManager = NULL;
 
 	// Cleanup
-	ImGui_ImplOpenGL3_Shutdown();
-	ImGui_ImplGlfw_Shutdown();
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		ImGui_ImplNull_Shutdown();
+	}
+	else
+	{
+		ImGui_ImplOpenGL3_Shutdown();
+		ImGui_ImplGlfw_Shutdown();
+	}
 	ImGui::DestroyContext();
 
 	// We won't delete this since it was created elsewhere
@@ -68,9 +79,17 @@ bool CGUI_Scene2D::Init(void)
 	//ImGui::StyleColorsClassic();
 
 	// Setup Platform/Renderer bindings
-	ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
-	const char* glsl_version = "#version 330";
-	ImGui_ImplOpenGL3_Init(glsl_version);
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		// There is no window or context in the headless mode, so the GUI runs without being drawn
+		ImGui_ImplNull_Init((float)CSettings::GetInstance()->iWindowWidth, (float)CSettings::GetInstance()->iWindowHeight);
+	}
+	else
+	{
+		ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
+		const char* glsl_version = "#version 330";
+		ImGui_ImplOpenGL3_Init(glsl_version);
+	}
 
 	// Define the window flags
 	window_flags = 0;
@@ -85,7 +104,7 @@ bool CGUI_Scene2D::Init(void)
 
 	CImageLoader* il = CImageLoader::GetInstance();
 	AcceptButtonData.fileName = "Image\\GUI\\tick.png";
-	AcceptButtonData.textureID = il->LoadTextureGetID(AcceptButtonData.fileName.c_str(), false);
+	AcceptButtonData.textureID = il->LoadTextureAsync(AcceptButtonData.fileName.c_str(), false);
 
 	// Initialise the CInventoryManagerPlanet
 	cInventoryManagerPlanet = CInventoryManagerPlanet::GetInstance();
@@ -96,9 +115,9 @@ bool CGUI_Scene2D::Init(void)
 	goOnShip = false;
 	showExitPanel = false;
 
-	PlayerBarTextureID = il->LoadTextureGetID("Image/GUI/PlayerBar.png", false);
-	BitTextureID = il->LoadTextureGetID("Image/GUI/ProgressBit.png", false);
-	ProgressBarTextureID = il->LoadTextureGetID("Image/GUI/ShipProgressBar.png", false);
+	PlayerBarTextureID = il->LoadTextureAsync("Image/GUI/PlayerBar.png", false);
+	BitTextureID = il->LoadTextureAsync("Image/GUI/ProgressBit.png", false);
+	ProgressBarTextureID = il->LoadTextureAsync("Image/GUI/ShipProgressBar.png", false);
 
 	tutorialPopupJungle = NONE;
 
@@ -110,13 +129,22 @@ bool CGUI_Scene2D::Init(void)
  */
 void CGUI_Scene2D::Update(const double dElapsedTime)
 {
+	PROFILE_SCOPE("CGUI_Scene2D::Update");
+
 	// Calculate the relative scale to our default windows width
 	const float relativeScale_x = cSettings->iWindowWidth / 800.0f;
 	const float relativeScale_y = cSettings->iWindowHeight / 600.0f;
 
 	// Start the Dear ImGui frame
-	ImGui_ImplOpenGL3_NewFrame();
-	ImGui_ImplGlfw_NewFrame();
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		ImGui_ImplNull_NewFrame((float)dElapsedTime);
+	}
+	else
+	{
+		ImGui_ImplOpenGL3_NewFrame();
+		ImGui_ImplGlfw_NewFrame();
+	}
 	ImGui::NewFrame();
 
 	// prevents crash when game is minimised
@@ -1102,9 +1130,16 @@ void CGUI_Scene2D::PreRender(void)
  */
 void CGUI_Scene2D::Render(void)
 {
+	PROFILE_SCOPE("CGUI_Scene2D::Render");
+
+	// Draw the profiler overlay into this frame
+	CProfiler::GetInstance()->RenderOverlay();
+
 	// Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	// There is no OpenGL context to draw the GUI with in the headless mode
+	if (CSettings::GetInstance()->bHeadless == false)
+		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 }
 
 /**
@@ -7,7 +7,7 @@
 #include "InventoryItem.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 #include <iostream>
 
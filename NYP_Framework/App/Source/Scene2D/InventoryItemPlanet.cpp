@@ -7,7 +7,7 @@
 #include "InventoryItemPlanet.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 #include <iostream>
 
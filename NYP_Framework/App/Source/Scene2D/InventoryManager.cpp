@@ -51,7 +51,7 @@ CInventoryItem* CInventoryManager::Add(	const std::string& _name,
 	if (Check(_name))
 	{
 		// Item name already exist here, unable to proceed
-		throw std::exception("Duplicate item name provided");
+		throw std::invalid_argument("Duplicate item name provided");
 		return NULL;
 	}
 
@@ -74,7 +74,7 @@ bool CInventoryManager::Remove(const std::string& _name)
 	if (Check(_name))
 	{
 		// Item is not available, unable to proceed
-		throw std::exception("Unknown item name provided");
+		throw std::invalid_argument("Unknown item name provided");
 		return false;
 	}
 
@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,27 +20,33 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
 // Include math.h
 #include <math.h>
 
+// The state table of JEnemy2DITracker, in real seconds. A dMaxTime of 0.0 means that the state does not time out,
+// and a timeout state of NO_STATE that the Update decides which state it times out into
+const CEnemyFSM::SState JEnemy2DITracker::sFSMStates[JEnemy2DITracker::NUM_FSM] =
+{
+	{ "TRACK", 0.0, CEnemyFSM::NO_STATE },
+	{ "SHOOT", 0.0, CEnemyFSM::NO_STATE },
+	{ "RELOAD", 2.0, CEnemyFSM::NO_STATE },
+	{ "ATTACK", 2.0, TRACK },
+	{ "RETREAT", 0.0, CEnemyFSM::NO_STATE },
+	{ "REST", 0.0, CEnemyFSM::NO_STATE }
+};
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 JEnemy2DITracker::JEnemy2DITracker(void)
-	: bIsActive(false)
-	, cMap2D(NULL)
-	, cSettings(NULL)
-	, cPlayer2D(NULL)
-	, sCurrentFSM(FSM::TRACK)
-	, iFSMCounter(0)
-	, quadMesh(NULL)
-	//, camera2D(NULL)
-	, animatedSprites(NULL)
 {
+	// Start the FSM in its initial state
+	cFSM.Init(CEnemyFSM::JUNGLE_ITRACKER, sFSMStates, NUM_FSM, TRACK);
+
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
 	// Initialise vecIndex
@@ -132,7 +140,7 @@ bool JEnemy2DITracker::Init(void)
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the enemy2D texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/IntelligentTrackerSpriteSheet.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/IntelligentTrackerSpriteSheet.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/JunglePlanet/IntelligentTrackerSpriteSheet.png" << endl;
@@ -168,14 +176,6 @@ bool JEnemy2DITracker::Init(void)
 	// If this class is initialised properly, then set the bIsActive to true
 	bIsActive = true;
 
-	//Construct 100 inactive ammo and add into ammoList
-	for (int i = 0; i < 100; ++i)
-	{
-		CJEAmmo* cEnemyAmmo2D = new CJEAmmo();
-		cEnemyAmmo2D->SetShader("Shader2D");
-		ammoList.push_back(cEnemyAmmo2D);
-	}
-
 	type = SPECIAL; 
 	shootingDirection = LEFT; //setting direction for ammo shooting
 	maxHealth = health = 75; //takes 15 hits to kill
@@ -229,22 +229,20 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 
 	// just for switching between states --> keep simple
 	//action done under interaction with player, update position, update direction, etc
-	switch (sCurrentFSM)
+	switch (cFSM.GetState())
 	{
 	case TRACK:
 		//if health too low, retreat
 		if (health < maxHealth / 5)
 		{
-			sCurrentFSM = RETREAT;
-			iFSMCounter = 0;
+			cFSM.SetState(RETREAT);
 			//cout << "Switching to Retreat State" << endl;
 			break;
 		}
 		//if within close combat attack range
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 3.5f)
 		{
-			sCurrentFSM = ATTACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ATTACK);
 			//cout << "Switching to Attack State" << endl;
 			break;
 		}
@@ -321,8 +319,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 			//only change into SHOOT state if path is clear
 			if (pathClear)
 			{
-				sCurrentFSM = SHOOT;
-				iFSMCounter = 0;
+				cFSM.SetState(SHOOT);
 				//cout << "Switching to Shooting State" << endl;
 				break;
 			}
@@ -379,8 +376,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 		//if health too low, retreat
 		if (health < maxHealth / 5)
 		{
-			sCurrentFSM = RETREAT;
-			iFSMCounter = 0;
+			cFSM.SetState(RETREAT);
 			//cout << "Switching to Retreat State" << endl;
 			break;
 		}
@@ -416,7 +412,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 					}
 					else
 					{
-						sCurrentFSM = TRACK;
+						cFSM.SetState(TRACK, false);
 						//cout << "Switching to Track State" << endl;
 						break;
 					}
@@ -444,7 +440,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 					}
 					else
 					{
-						sCurrentFSM = TRACK;
+						cFSM.SetState(TRACK, false);
 						//cout << "Switching to Track State" << endl;
 						break;
 					}
@@ -480,7 +476,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 					}
 					else
 					{
-						sCurrentFSM = TRACK;
+						cFSM.SetState(TRACK, false);
 						//cout << "Switching to Track State" << endl;
 						break;
 					}
@@ -507,7 +503,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 					}
 					else
 					{
-						sCurrentFSM = TRACK;
+						cFSM.SetState(TRACK, false);
 						//cout << "Switching to Track State" << endl;
 						break;
 					}
@@ -516,46 +512,41 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 
 			// Shoot enemy ammo!
 			//shoot ammo in accordance to the direction enemy is facing
-			CJEAmmo* ammo = FetchAmmo();
-			ammo->setActive(true);
-			ammo->setPath(vec2Index.x, vec2Index.y, shootingDirection);
+			CProjectileSystem::GetInstance()->Spawn(CProjectileSystem::JUNGLE_POISON, this, vec2Index, shootingDirection);
 			//cout << "Bam!" << shootingDirection << endl;
 
-			sCurrentFSM = RELOAD;
+			cFSM.SetState(RELOAD, false);
 			//cout << "Switching to Reload State" << endl;
 		}
 		else
 		{
-			sCurrentFSM = TRACK;
+			cFSM.SetState(TRACK, false);
 			//cout << "Switching to Track State" << endl;
 		}
 		break;
 	case RELOAD:
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.IsTimeUp())
 		{
 			//if health too low, retreat
 			if (health < maxHealth / 5)
 			{
-				sCurrentFSM = RETREAT;
-				iFSMCounter = 0;
+				cFSM.SetState(RETREAT);
 				//cout << "Switching to Retreat State" << endl;
 				break;
 			}
 			else
 			{
-				sCurrentFSM = TRACK;
-				iFSMCounter = 0;
+				cFSM.SetState(TRACK);
 				//cout << "Switching to Track State" << endl;
 			}
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case ATTACK:
 		//if health too low, retreat
 		if (health < maxHealth / 5)
 		{
-			sCurrentFSM = RETREAT;
-			iFSMCounter = 0;
+			cFSM.SetState(RETREAT);
 			//cout << "Switching to Retreat State" << endl;
 			break;
 		}
@@ -655,21 +646,18 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 		}
 		else
 		{
-			if (iFSMCounter > iMaxFSMCounter)
+			if (cFSM.CheckTimeout())
 			{
-				sCurrentFSM = TRACK;
-				iFSMCounter = 0;
 				//cout << "Switching to Track State" << endl;
 			}
-			iFSMCounter++;
+			cFSM.AddTime(dElapsedTime);
 		}
 		break;
 	case RETREAT:
 		//if enemy is within a certain dist of its destination
 		if (cPhysics2D.CalculateDistance(vec2Index, cMap2D->GetTilePosition(CMap2D::TILE_INDEX::ENEMY_WAYPOINT_RIVER_WATER)) < 1.0f)
 		{
-			sCurrentFSM = REST;
-			iFSMCounter = 0;
+			cFSM.SetState(REST);
 			//cout << "Switching to REST State" << endl;
 		}
 		else
@@ -727,8 +715,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 		if (health > maxHealth / 2 && //sufficiently healed
 			cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 3.5f) //player within range
 		{
-			sCurrentFSM = ATTACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ATTACK);
 			//cout << "Switching to ATTACK State" << endl;
 		}
 		//can leave rest state if sufficiently healed if player is around
@@ -805,8 +792,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 			//only change into SHOOT state if path is clear
 			if (pathClear)
 			{
-				sCurrentFSM = SHOOT;
-				iFSMCounter = 0;
+				cFSM.SetState(SHOOT);
 				//cout << "Switching to Shooting State" << endl;
 				break;
 			}
@@ -815,8 +801,7 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 		if (health >= maxHealth) //fully healed
 		{
 			health = maxHealth;
-			sCurrentFSM = TRACK;
-			iFSMCounter = 0;
+			cFSM.SetState(TRACK);
 			//cout << "Switching to TRACK State" << endl;
 		}
 		break;
@@ -824,21 +809,6 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 		break;
 	}
 
-	//ammo beahviour
-	for (std::vector<CJEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CJEAmmo* ammo = (CJEAmmo*)*it;
-		if (ammo->getActive())
-		{
-			cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::POISONBALL); //play enemy ammo sound if there is enemy ammo
-			ammo->Update(dElapsedTime);
-			if (ammo->LimitReached())
-			{
-				ammo->setActive(false);
-			}
-		}
-	}
-
 	UpdateDirection();
 
 	// Check if enemy is in mid-air, such as walking off a platform
@@ -864,25 +834,6 @@ void JEnemy2DITracker::Update(const double dElapsedTime)
 	vec2UVCoordinate.y = cSettings->ConvertIndexToUVSpace(cSettings->y, vec2Index.y, false, i32vec2NumMicroSteps.y*cSettings->ENEMY_MICRO_STEP_YAXIS);
 }
 
-/**
- @brief Set up the OpenGL display environment before rendering
- */
-void JEnemy2DITracker::PreRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
-
-	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	// Activate the shader
-	CShaderManager::GetInstance()->Use(sShaderName);
-}
-
 /**
  @brief Render this instance
  */
@@ -901,12 +852,14 @@ void JEnemy2DITracker::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, glm::vec2(i32vec2NumMicroSteps), IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += i32vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS;
-	actualPos.y += i32vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -920,114 +873,13 @@ void JEnemy2DITracker::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
 
 	glBindTexture(GL_TEXTURE_2D, 0);
 
-	//render enemy ammo
-	for (std::vector<CJEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CJEAmmo* ammo = (CJEAmmo*)*it;
-		if (ammo->getActive())
-		{
-			ammo->PreRender();
-			ammo->Render();
-			ammo->PostRender();
-		}
-	}
-
-}
-
-/**
- @brief PostRender Set up the OpenGL display environment after rendering.
- */
-void JEnemy2DITracker::PostRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// Disable blending
-	glDisable(GL_BLEND);
-}
-
-/**
-@brief Set the indices of the enemy2D
-@param iIndex_XAxis A const int variable which stores the index in the x-axis
-@param iIndex_YAxis A const int variable which stores the index in the y-axis
-*/
-void JEnemy2DITracker::Seti32vec2Index(const int iIndex_XAxis, const int iIndex_YAxis)
-{
-	this->vec2Index.x = iIndex_XAxis;
-	this->vec2Index.y = iIndex_YAxis;
-}
-
-/**
-@brief Set the number of microsteps of the enemy2D
-@param iNumMicroSteps_XAxis A const int variable storing the current microsteps in the X-axis
-@param iNumMicroSteps_YAxis A const int variable storing the current microsteps in the Y-axis
-*/
-void JEnemy2DITracker::Seti32vec2NumMicroSteps(const int iNumMicroSteps_XAxis, const int iNumMicroSteps_YAxis)
-{
-	this->i32vec2NumMicroSteps.x = iNumMicroSteps_XAxis;
-	this->i32vec2NumMicroSteps.y = iNumMicroSteps_YAxis;
-}
-
-/**
- @brief Set the handle to cPlayer to this class instance
- @param cPlayer2D A CPlayer2D* variable which contains the pointer to the CPlayer2D instance
- */
-void JEnemy2DITracker::SetPlayer2D(CPlayer2D* cPlayer2D)
-{
-	this->cPlayer2D = cPlayer2D;
-
-	// Update the enemy's direction
-	UpdateDirection();
-}
-
-/**
- @brief Constraint the enemy2D's position within a boundary
- @param eDirection A DIRECTION enumerated data type which indicates the direction to check
- */
-void JEnemy2DITracker::Constraint(DIRECTION eDirection)
-{
-	if (eDirection == LEFT)
-	{
-		if (vec2Index.x < 0)
-		{
-			vec2Index.x = 0;
-			i32vec2NumMicroSteps.x = 0;
-		}
-	}
-	else if (eDirection == RIGHT)
-	{
-		if (vec2Index.x >= (int)cSettings->NUM_TILES_XAXIS - 1)
-		{
-			vec2Index.x = ((int)cSettings->NUM_TILES_XAXIS) - 1;
-			i32vec2NumMicroSteps.x = 0;
-		}
-	}
-	else if (eDirection == UP)
-	{
-		if (vec2Index.y >= (int)cSettings->NUM_TILES_YAXIS - 1)
-		{
-			vec2Index.y = ((int)cSettings->NUM_TILES_YAXIS) - 1;
-			i32vec2NumMicroSteps.y = 0;
-		}
-	}
-	else if (eDirection == DOWN)
-	{
-		if (vec2Index.y < 0)
-		{
-			vec2Index.y = 0;
-			i32vec2NumMicroSteps.y = 0;
-		}
-	}
-	else
-	{
-		cout << "CStnEnemy2D::Constraint: Unknown direction." << endl;
-	}
 }
 
 /**
@@ -1336,41 +1188,6 @@ void JEnemy2DITracker::InteractWithMap(void)
 	}
 }
 
-/**
- @brief Update the enemy's direction.
- */
-void JEnemy2DITracker::UpdateDirection(void)
-{
-	// Set the destination to the player
-	vec2Destination = cPlayer2D->vec2Index;
-
-	// Calculate the direction between enemy2D and player2D
-	vec2Direction = vec2Destination - vec2Index;
-
-	// Calculate the distance between enemy2D and player2D
-	float fDistance = cPhysics2D.CalculateDistance(vec2Index, vec2Destination);
-	if (fDistance >= 0.01f)
-	{
-		// Calculate direction vector.
-		// We need to round the numbers as it is easier to work with whole numbers for movements
-		vec2Direction.x = (int)round(vec2Direction.x / fDistance);
-		vec2Direction.y = (int)round(vec2Direction.y / fDistance);
-	}
-	else
-	{
-		// Since we are not going anywhere, set this to 0.
-		vec2Direction = glm::i32vec2(0);
-	}
-}
-
-/**
- @brief Flip horizontal direction. For patrol use only
- */
-void JEnemy2DITracker::FlipHorizontalDirection(void)
-{
-	vec2Direction.x *= -1;
-}
-
 /**
 @brief Update position.
 */
@@ -1472,42 +1289,3 @@ void JEnemy2DITracker::UpdatePosition(void)
 		}
 	}
 }
-
-vector<glm::vec2> JEnemy2DITracker::ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints)
-{
-	for (int i = 0; i < numOfWaypoints; ++i)
-	{
-		waypointVector.push_back(cMap2D->GetTilePosition(startIndex + i));
-		// Erase the value of the waypoint in the arrMapInfo
-		cMap2D->SetMapInfo(waypointVector[i].y, waypointVector[i].x, 0);
-	}
-
-	return waypointVector;
-}
-
-//called whenever an ammo is needed to be shot
-CJEAmmo* JEnemy2DITracker::FetchAmmo()
-{
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CJEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CJEAmmo* ammo = (CJEAmmo*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// By default, microsteps should be zero --> reset in case a previously active ammo that was used then ste inactive was used again
-		ammo->vec2NumMicroSteps = glm::i32vec2(0, 0);
-		return ammo;
-	}
-
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CJEAmmo);
-	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
-
-}
\ No newline at end of file
@@ -7,7 +7,7 @@
 #pragma once
 
 // Include shader
-#include "RenderControl\shader.h"
+#include "RenderControl/Shader.h"
 
 // Include GLM
 #include <includes/glm.hpp>
@@ -18,13 +18,13 @@
 #include "Primitives/Entity2D.h"
 
 //Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 class CMap2D;
 
 // Include Settings
-#include "GameControl\Settings.h"
+#include "GameControl/Settings.h"
 
 // Include Physics2D
 #include "Physics2D.h"
@@ -32,10 +32,6 @@ class CMap2D;
 // Include Player2D
 #include "Player2D.h"
 
-//include ammo
-#include "EnemyAmmo2D.h"
-#include "JungleEAmmo.h"
-
 //include enemy base class
 #include "Enemy2D.h"
 
@@ -60,21 +56,9 @@ public:
 	// Update
 	void Update(const double dElapsedTime);
 
-	// PreRender
-	void PreRender(void);
-
 	// Render
 	void Render(void);
 
-	// PostRender
-	void PostRender(void);
-
-	// Set the indices of the enemy2D
-	void Seti32vec2Index(const int iIndex_XAxis, const int iIndex_YAxis);
-
-	// Set the number of microsteps of the enemy2D
-	void Seti32vec2NumMicroSteps(const int iNumMicroSteps_XAxis, const int iNumMicroSteps_YAxis);
-
 	// Set the UV coordinates of the enemy2D
 	void Setvec2UVCoordinates(const float fUVCoordinate_XAxis, const float fUVCoordinate_YAxis);
 
@@ -87,32 +71,7 @@ public:
 	// Set the UV coordinates of the enemy2D
 	glm::vec2 Getvec2UVCoordinates(void) const;
 
-	// Set the handle to cPlayer to this class instance
-	void SetPlayer2D(CPlayer2D* cPlayer2D);
-
-	// boolean flag to indicate if this enemy is active
-	bool bIsActive;
-
 protected:
-	enum DIRECTION
-	{
-		LEFT = 0,
-		RIGHT = 1,
-		UP = 2,
-		DOWN = 3,
-		NUM_DIRECTIONS
-	};
-
-	vector<glm::vec2> ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints);
-
-	////vector full of enemy's fired ammo
-	std::vector<CJEAmmo*> ammoList;
-	int shootingDirection; //shoots in the direction the enemy is facing
-	//used to get a deactivated ammo to activate
-	CJEAmmo* FetchAmmo(void);
-
-	//CS: Animated Sprite
-	CSpriteAnimation* animatedSprites;
 
 	enum FSM
 	{
@@ -129,58 +88,19 @@ protected:
 	double flickerTimerMax; //used to reset flicker counter
 	int flickerCounter; //decides colour of enemy and when to explode
 
-	glm::vec2 i32vec2OldIndex;
-
-	//CS: The quadMesh for drawing the tiles
-	CMesh* quadMesh;
-
-	// Handler to the CMap2D instance
-	CMap2D* cMap2D;
-
-	// Handler to the camera instance
-	Camera2D* camera2D;
-
-	// A transformation matrix for controlling where to render the entities
-	glm::mat4 transform;
-
-	// The vec2 variable which stores the UV coordinates to render the enemy2D
-	glm::vec2 vec2UVCoordinate;
-
-	// Settings
-	CSettings* cSettings;
-
-	// Physics
-	CPhysics2D cPhysics2D;
-
 	// waypoint path
 	vector<glm::vec2> waypoints;
 	// waypoint counter
 	int currentWaypointCounter;
 	int maxWaypointCounter;
 
-	// Current color
-	glm::vec4 runtimeColour;
-
-	// Handle to the CPlayer2D
-	CPlayer2D* cPlayer2D;
-
-	// Handler to the CSoundController
-	CSoundController* cSoundController;
-
 	// Inventory Manager
 	CInventoryManagerPlanet* cInventoryManagerPlanet;
 	// Inventory Item
 	CInventoryItemPlanet* cInventoryItemPlanet;
 
-	// Current FSM
-	FSM sCurrentFSM;
-
-	// FSM counter - count how many frames it has been in this FSM
-	int iFSMCounter;
-
-	// Max count in a state
-	const int iMaxFSMCounter = 60;
-	const int iWanderReturnMaxFSMCounter = 300;
+	// The state table of this enemy, with how long each state lasts and which state it times out into
+	static const CEnemyFSM::SState sFSMStates[NUM_FSM];
 
 	vector<glm::vec2> enemysTeleportationResidue; //a vector of locations where this enemy left behind teleportation residue
 	vector<double> enemysTResidueCooldown; //timer for how long the residue will last
@@ -192,9 +112,6 @@ protected:
 	double attackCooldownCurrent; //the cooldown that gets dt-ed away
 	const double attackCooldownMax = 2.0; //the overall cooldown duration, eg 5s
 
-	// Constraint the enemy2D's position within a boundary
-	void Constraint(DIRECTION eDirection = LEFT);
-
 	// Check if a position is possible to move into
 	bool CheckPosition(DIRECTION eDirection);
 
@@ -202,7 +119,7 @@ protected:
 	bool IsMidAir(void);
 
 	// Update Jump or Fall
-	void UpdateJumpFall(const double dElapsedTime = 0.0166666666666667);
+	void UpdateJumpFall(const double dElapsedTime);
 
 	// Let enemy2D interact with the player
 	bool InteractWithPlayer(void);
@@ -210,12 +127,6 @@ protected:
 	//let enemy2D interact with the map
 	void InteractWithMap(void);
 
-	// Update direction
-	void UpdateDirection(void);
-
-	// Flip horizontal direction. For patrol use only
-	void FlipHorizontalDirection(void);
-
 	// Update position
 	void UpdatePosition(void);
 
@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,27 +20,32 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
 // Include math.h
 #include <math.h>
 
+// The state table of JEnemy2DPatrolT, in real seconds. A dMaxTime of 0.0 means that the state does not time out,
+// and a timeout state of NO_STATE that the Update decides which state it times out into
+const CEnemyFSM::SState JEnemy2DPatrolT::sFSMStates[JEnemy2DPatrolT::NUM_FSM] =
+{
+	{ "IDLE", 2.0, CEnemyFSM::NO_STATE },
+	{ "PATROL", 0.0, CEnemyFSM::NO_STATE },
+	{ "NOISY", 0.0, CEnemyFSM::NO_STATE },
+	{ "EN_ROUTE", 10.0, CEnemyFSM::NO_STATE },
+	{ "RETURN", 0.0, CEnemyFSM::NO_STATE }
+};
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 JEnemy2DPatrolT::JEnemy2DPatrolT(void)
-	: bIsActive(false)
-	, cMap2D(NULL)
-	, cSettings(NULL)
-	, cPlayer2D(NULL)
-	, sCurrentFSM(FSM::PATROL)
-	, iFSMCounter(0)
-	, quadMesh(NULL)
-	//, camera2D(NULL)
-	, animatedSprites(NULL)
 {
+	// Start the FSM in its initial state
+	cFSM.Init(CEnemyFSM::JUNGLE_PATROLT, sFSMStates, NUM_FSM, PATROL);
+
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
 	// Initialise vecIndex
@@ -132,7 +139,7 @@ bool JEnemy2DPatrolT::Init(void)
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the enemy2D texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/PatrolTeamSpriteSheet.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/PatrolTeamSpriteSheet.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/JunglePlanet/PatrolTeamSpriteSheet.png" << endl;
@@ -168,14 +175,6 @@ bool JEnemy2DPatrolT::Init(void)
 	// If this class is initialised properly, then set the bIsActive to true
 	bIsActive = true;
 
-	//Construct 100 inactive ammo and add into ammoList
-	for (int i = 0; i < 100; ++i)
-	{
-		CJEAmmo* cEnemyAmmo2D = new CJEAmmo();
-		cEnemyAmmo2D->SetShader("Shader2D");
-		ammoList.push_back(cEnemyAmmo2D);
-	}
-
 	//no patrol team enemies in tutorial lvl
 	//for lvl 1
 	if (cMap2D->GetCurrentLevel() == 1)
@@ -260,34 +259,31 @@ void JEnemy2DPatrolT::Update(const double dElapsedTime)
 
 	// just for switching between states --> keep simple
 	//action done under interaction with player, update position, update direction, etc
-	switch (sCurrentFSM)
+	switch (cFSM.GetState())
 	{
 	case IDLE:
 		//Play the "idle" animation
 		animatedSprites->PlayAnimation("idle", -1, 1.f);
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 4.0f) //near player
 		{
-			sCurrentFSM = NOISY;
-			iFSMCounter = 0;
+			cFSM.SetState(NOISY);
 			//cout << "Switching to Noisy State" << endl;
 			break;
 		}
 		if (alerted) //if near a noisy patrol team enemy
 		{
-			sCurrentFSM = EN_ROUTE;
-			iFSMCounter = 0;
+			cFSM.SetState(EN_ROUTE);
 			//cout << "Switching to En Route State" << endl;
 			break;
 		}
-		if (iFSMCounter > iMaxFSMCounter) //been in idle for too long
+		if (cFSM.IsTimeUp()) //been in idle for too long
 		{
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
+			cFSM.SetState(PATROL);
 			//cout << "Switching to Patrol State" << endl;
 			++currentWaypointCounter; //increase the enemy's current waypoint count
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case PATROL:
 		//set way point to get to
@@ -298,22 +294,19 @@ void JEnemy2DPatrolT::Update(const double dElapsedTime)
 		}
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 4.0f) //near player
 		{
-			sCurrentFSM = NOISY;
-			iFSMCounter = 0;
+			cFSM.SetState(NOISY);
 			//cout << "Switching to Noisy State" << endl;
 			break;
 		}
 		if (alerted) //if near a noisy patrol team enemy
 		{
-			sCurrentFSM = EN_ROUTE;
-			iFSMCounter = 0;
+			cFSM.SetState(EN_ROUTE);
 			//cout << "Switching to En Route State" << endl;
 			break;
 		}
 		if (cPhysics2D.CalculateDistance(vec2Index, waypoints[currentWaypointCounter]) < 0.5f) //close to current waypoint
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(IDLE);
 			//cout << "Switching to Idle State" << endl;
 		}
 		//pathfind to waypoint
@@ -363,7 +356,7 @@ void JEnemy2DPatrolT::Update(const double dElapsedTime)
 
 			UpdatePosition();
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case NOISY:
 		noisy = true; //used to let other enemies know this enemy is in noisy mode
@@ -459,25 +452,22 @@ void JEnemy2DPatrolT::Update(const double dElapsedTime)
 		}
 		else
 		{
-			sCurrentFSM = RETURN;
-			iFSMCounter = 0;
+			cFSM.SetState(RETURN);
 			//cout << "Switching to Return State" << endl;
 			noisy = false;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case EN_ROUTE:
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 4.0f) //near player
 		{
-			sCurrentFSM = NOISY;
-			iFSMCounter = 0;
+			cFSM.SetState(NOISY);
 			//cout << "Switching to Noisy State" << endl;
 			alerted = false;
 		}
-		else if (iFSMCounter > iEnRouteMaxFSMCounter) //been in en_route for too long with no changes
+		else if (cFSM.IsTimeUp()) //been in en_route for too long with no changes
 		{
-			sCurrentFSM = RETURN;
-			iFSMCounter = 0;
+			cFSM.SetState(RETURN);
 			//cout << "Switching to Return State" << endl;
 			alerted = false;
 		}
@@ -527,28 +517,25 @@ void JEnemy2DPatrolT::Update(const double dElapsedTime)
 			// Update the Enemy2D's position for attack
 			UpdatePosition();
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case RETURN:
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 4.0f) //near player
 		{
-			sCurrentFSM = NOISY;
-			iFSMCounter = 0;
+			cFSM.SetState(NOISY);
 			//cout << "Switching to Noisy State" << endl;
 			break;
 		}
 		if (alerted) //if near a noisy patrol team enemy
 		{
-			sCurrentFSM = EN_ROUTE;
-			iFSMCounter = 0;
+			cFSM.SetState(EN_ROUTE);
 			//cout << "Switching to En Route State" << endl;
 			break;
 		}
 		//if too close to the current waypoint
 		if (cPhysics2D.CalculateDistance(vec2Index, waypoints[currentWaypointCounter]) < 0.5f)
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(IDLE);
 			//cout << "Switching to Idle State" << endl;
 		}
 		else //move back to waypoint
@@ -598,7 +585,7 @@ void JEnemy2DPatrolT::Update(const double dElapsedTime)
 
 			UpdatePosition();
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	default:
 		break;
@@ -629,25 +616,6 @@ void JEnemy2DPatrolT::Update(const double dElapsedTime)
 	vec2UVCoordinate.y = cSettings->ConvertIndexToUVSpace(cSettings->y, vec2Index.y, false, i32vec2NumMicroSteps.y*cSettings->ENEMY_MICRO_STEP_YAXIS);
 }
 
-/**
- @brief Set up the OpenGL display environment before rendering
- */
-void JEnemy2DPatrolT::PreRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
-
-	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	// Activate the shader
-	CShaderManager::GetInstance()->Use(sShaderName);
-}
-
 /**
  @brief Render this instance
  */
@@ -666,12 +634,14 @@ void JEnemy2DPatrolT::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, glm::vec2(i32vec2NumMicroSteps), IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += i32vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS;
-	actualPos.y += i32vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -685,6 +655,7 @@ void JEnemy2DPatrolT::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
@@ -692,108 +663,8 @@ void JEnemy2DPatrolT::Render(void)
 	glBindTexture(GL_TEXTURE_2D, 0);
 }
 
-/**
- @brief PostRender Set up the OpenGL display environment after rendering.
- */
-void JEnemy2DPatrolT::PostRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// Disable blending
-	glDisable(GL_BLEND);
-}
-
 //check if need to check to put other enemies in alert state
-bool JEnemy2DPatrolT::getNoisy(void)
-{
-	return noisy;
-}
-
 //set alert to true to get specific enemy to go into en_route state
-void JEnemy2DPatrolT::setAlert(bool alert)
-{
-	alerted = alert;
-}
-
-/**
-@brief Set the indices of the enemy2D
-@param iIndex_XAxis A const int variable which stores the index in the x-axis
-@param iIndex_YAxis A const int variable which stores the index in the y-axis
-*/
-void JEnemy2DPatrolT::Seti32vec2Index(const int iIndex_XAxis, const int iIndex_YAxis)
-{
-	this->vec2Index.x = iIndex_XAxis;
-	this->vec2Index.y = iIndex_YAxis;
-}
-
-/**
-@brief Set the number of microsteps of the enemy2D
-@param iNumMicroSteps_XAxis A const int variable storing the current microsteps in the X-axis
-@param iNumMicroSteps_YAxis A const int variable storing the current microsteps in the Y-axis
-*/
-void JEnemy2DPatrolT::Seti32vec2NumMicroSteps(const int iNumMicroSteps_XAxis, const int iNumMicroSteps_YAxis)
-{
-	this->i32vec2NumMicroSteps.x = iNumMicroSteps_XAxis;
-	this->i32vec2NumMicroSteps.y = iNumMicroSteps_YAxis;
-}
-
-/**
- @brief Set the handle to cPlayer to this class instance
- @param cPlayer2D A CPlayer2D* variable which contains the pointer to the CPlayer2D instance
- */
-void JEnemy2DPatrolT::SetPlayer2D(CPlayer2D* cPlayer2D)
-{
-	this->cPlayer2D = cPlayer2D;
-
-	// Update the enemy's direction
-	UpdateDirection();
-}
-
-/**
- @brief Constraint the enemy2D's position within a boundary
- @param eDirection A DIRECTION enumerated data type which indicates the direction to check
- */
-void JEnemy2DPatrolT::Constraint(DIRECTION eDirection)
-{
-	if (eDirection == LEFT)
-	{
-		if (vec2Index.x < 0)
-		{
-			vec2Index.x = 0;
-			i32vec2NumMicroSteps.x = 0;
-		}
-	}
-	else if (eDirection == RIGHT)
-	{
-		if (vec2Index.x >= (int)cSettings->NUM_TILES_XAXIS - 1)
-		{
-			vec2Index.x = ((int)cSettings->NUM_TILES_XAXIS) - 1;
-			i32vec2NumMicroSteps.x = 0;
-		}
-	}
-	else if (eDirection == UP)
-	{
-		if (vec2Index.y >= (int)cSettings->NUM_TILES_YAXIS - 1)
-		{
-			vec2Index.y = ((int)cSettings->NUM_TILES_YAXIS) - 1;
-			i32vec2NumMicroSteps.y = 0;
-		}
-	}
-	else if (eDirection == DOWN)
-	{
-		if (vec2Index.y < 0)
-		{
-			vec2Index.y = 0;
-			i32vec2NumMicroSteps.y = 0;
-		}
-	}
-	else
-	{
-		cout << "CStnEnemy2D::Constraint: Unknown direction." << endl;
-	}
-}
-
 /**
  @brief Check if a position is possible to move into
  @param eDirection A DIRECTION enumerated data type which indicates the direction to check
@@ -1086,41 +957,6 @@ void JEnemy2DPatrolT::InteractWithMap(void)
 	}
 }
 
-/**
- @brief Update the enemy's direction.
- */
-void JEnemy2DPatrolT::UpdateDirection(void)
-{
-	// Set the destination to the player
-	vec2Destination = cPlayer2D->vec2Index;
-
-	// Calculate the direction between enemy2D and player2D
-	vec2Direction = vec2Destination - vec2Index;
-
-	// Calculate the distance between enemy2D and player2D
-	float fDistance = cPhysics2D.CalculateDistance(vec2Index, vec2Destination);
-	if (fDistance >= 0.01f)
-	{
-		// Calculate direction vector.
-		// We need to round the numbers as it is easier to work with whole numbers for movements
-		vec2Direction.x = (int)round(vec2Direction.x / fDistance);
-		vec2Direction.y = (int)round(vec2Direction.y / fDistance);
-	}
-	else
-	{
-		// Since we are not going anywhere, set this to 0.
-		vec2Direction = glm::i32vec2(0);
-	}
-}
-
-/**
- @brief Flip horizontal direction. For patrol use only
- */
-void JEnemy2DPatrolT::FlipHorizontalDirection(void)
-{
-	vec2Direction.x *= -1;
-}
-
 /**
 @brief Update position.
 */
@@ -1147,17 +983,17 @@ void JEnemy2DPatrolT::UpdatePosition(void)
 		cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::ENEMY_FOOTSTEPS); //play enemy footstep sound
 
 		//set animation based on state
-		if (sCurrentFSM == PATROL || sCurrentFSM == RETURN)
+		if (cFSM.GetState() == PATROL || cFSM.GetState() == RETURN)
 		{
 			//Play the "moving left" animation
 			animatedSprites->PlayAnimation("movingL", -1, 0.5f);
 		}
-		else if (sCurrentFSM == NOISY)
+		else if (cFSM.GetState() == NOISY)
 		{
 			//Play the "noisy left" animation
 			animatedSprites->PlayAnimation("noisyL", -1, 0.75f);
 		}
-		else if (sCurrentFSM == EN_ROUTE)
+		else if (cFSM.GetState() == EN_ROUTE)
 		{
 			//Play the "en route left" animation
 			animatedSprites->PlayAnimation("enrouteL", -1, 0.5f);
@@ -1201,17 +1037,17 @@ void JEnemy2DPatrolT::UpdatePosition(void)
 		cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::ENEMY_FOOTSTEPS); //play enemy footstep sound
 
 		//set animation based on state
-		if (sCurrentFSM == PATROL || sCurrentFSM == RETURN)
+		if (cFSM.GetState() == PATROL || cFSM.GetState() == RETURN)
 		{
 			//Play the "moving right" animation
 			animatedSprites->PlayAnimation("movingR", -1, 0.5f);
 		}
-		else if (sCurrentFSM == NOISY)
+		else if (cFSM.GetState() == NOISY)
 		{
 			//Play the "noisy right" animation
 			animatedSprites->PlayAnimation("noisyR", -1, 0.75f);
 		}
-		else if (sCurrentFSM == EN_ROUTE)
+		else if (cFSM.GetState() == EN_ROUTE)
 		{
 			//Play the "en route right" animation
 			animatedSprites->PlayAnimation("enrouteR", -1, 0.5f);
@@ -1250,42 +1086,3 @@ void JEnemy2DPatrolT::UpdatePosition(void)
 		}
 	}
 }
-
-vector<glm::vec2> JEnemy2DPatrolT::ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints)
-{
-	for (int i = 0; i < numOfWaypoints; ++i)
-	{
-		waypointVector.push_back(cMap2D->GetTilePosition(startIndex + i));
-		// Erase the value of the waypoint in the arrMapInfo
-		cMap2D->SetMapInfo(waypointVector[i].y, waypointVector[i].x, 0);
-	}
-
-	return waypointVector;
-}
-
-//called whenever an ammo is needed to be shot
-CJEAmmo* JEnemy2DPatrolT::FetchAmmo()
-{
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CJEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CJEAmmo* ammo = (CJEAmmo*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// By default, microsteps should be zero --> reset in case a previously active ammo that was used then ste inactive was used again
-		ammo->vec2NumMicroSteps = glm::i32vec2(0, 0);
-		return ammo;
-	}
-
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CJEAmmo);
-	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
-
-}
\ No newline at end of file
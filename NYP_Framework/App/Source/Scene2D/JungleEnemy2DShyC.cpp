@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,27 +20,32 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
 // Include math.h
 #include <math.h>
 
+// The state table of JEnemy2DShyC, in real seconds. A dMaxTime of 0.0 means that the state does not time out,
+// and a timeout state of NO_STATE that the Update decides which state it times out into
+const CEnemyFSM::SState JEnemy2DShyC::sFSMStates[JEnemy2DShyC::NUM_FSM] =
+{
+	{ "CAMOUFLAGE", 0.0, CEnemyFSM::NO_STATE },
+	{ "AGGRO", 0.0, CEnemyFSM::NO_STATE },
+	{ "HUNKER", 5.33, CEnemyFSM::NO_STATE },
+	{ "RETURN", 0.0, CEnemyFSM::NO_STATE },
+	{ "EXPLODE", 0.0, CEnemyFSM::NO_STATE }
+};
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 JEnemy2DShyC::JEnemy2DShyC(void)
-	: bIsActive(false)
-	, cMap2D(NULL)
-	, cSettings(NULL)
-	, cPlayer2D(NULL)
-	, sCurrentFSM(FSM::CAMOUFLAGE)
-	, iFSMCounter(0)
-	, quadMesh(NULL)
-	//, camera2D(NULL)
-	, animatedSprites(NULL)
 {
+	// Start the FSM in its initial state
+	cFSM.Init(CEnemyFSM::JUNGLE_SHYC, sFSMStates, NUM_FSM, CAMOUFLAGE);
+
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
 	// Initialise vecIndex
@@ -133,7 +140,7 @@ bool JEnemy2DShyC::Init(void)
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the enemy2D texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/ShyChaserSpriteSheet.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/ShyChaserSpriteSheet.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/JunglePlanet/ShyChaserSpriteSheet.png" << endl;
@@ -166,14 +173,6 @@ bool JEnemy2DShyC::Init(void)
 	// If this class is initialised properly, then set the bIsActive to true
 	bIsActive = true;
 
-	//Construct 100 inactive ammo and add into ammoList
-	for (int i = 0; i < 100; ++i)
-	{
-		CJEAmmo* cEnemyAmmo2D = new CJEAmmo();
-		cEnemyAmmo2D->SetShader("Shader2D");
-		ammoList.push_back(cEnemyAmmo2D);
-	}
-
 	type = DEFENCE; //has hunker to reduce damage
 	shootingDirection = LEFT; //setting direction for ammo shooting
 	previousHealth = maxHealth = health = 50; //takes 10 hits to kill
@@ -215,46 +214,41 @@ void JEnemy2DShyC::Update(const double dElapsedTime)
 
 	// just for switching between states --> keep simple
 	//action done under interaction with player, update position, update direction, etc
-	switch (sCurrentFSM)
+	switch (cFSM.GetState())
 	{
 	case CAMOUFLAGE:
 		//Play the "idle" animation
 		animatedSprites->PlayAnimation("idle", -1, 2.0f);
 		if (health <= 5) //i can only take a max of 1 hit left, switch to explode mode
 		{
-			sCurrentFSM = EXPLODE;
-			iFSMCounter = 0;
+			cFSM.SetState(EXPLODE);
 			//cout << "Switching to Explode State" << endl;
 			break;
 		}
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 4.0f)
 		{
-			sCurrentFSM = AGGRO;
-			iFSMCounter = 0;
+			cFSM.SetState(AGGRO);
 			//cout << "Switching to Aggro State" << endl;
 			break;
 		}
 		if (health != previousHealth) //was just attacked
 		{
-			sCurrentFSM = HUNKER;
-			iFSMCounter = 0;
+			cFSM.SetState(HUNKER);
 			//cout << "Switching to Hunker State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case AGGRO:
 		if (health <= 5) //i can only take a max of 1 hit left, switch to explode mode
 		{
-			sCurrentFSM = EXPLODE;
-			iFSMCounter = 0;
+			cFSM.SetState(EXPLODE);
 			//cout << "Switching to Explode State" << endl;
 			break;
 		}
 		if (health <= maxHealth / 2) //hunker once health gets too low
 		{
-			sCurrentFSM = HUNKER;
-			iFSMCounter = 0;
+			cFSM.SetState(HUNKER);
 			//cout << "Switching to Hunker State" << endl;
 			break;
 		}
@@ -348,11 +342,10 @@ void JEnemy2DShyC::Update(const double dElapsedTime)
 		}
 		else
 		{
-			sCurrentFSM = RETURN;
-			iFSMCounter = 0;
+			cFSM.SetState(RETURN);
 			//cout << "Switching to Return State" << endl;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case HUNKER:
 		hunkering = true;
@@ -368,8 +361,7 @@ void JEnemy2DShyC::Update(const double dElapsedTime)
 		}
 		if (health <= 5) //i can only take a max of 1 hit left, switch to explode mode
 		{
-			sCurrentFSM = EXPLODE;
-			iFSMCounter = 0;
+			cFSM.SetState(EXPLODE);
 			//cout << "Switching to Explode State" << endl;
 			hunkering = false;
 			break;
@@ -377,44 +369,40 @@ void JEnemy2DShyC::Update(const double dElapsedTime)
 		if (health > maxHealth / 2 && //more than half health
 			cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 4.0f) //within aggro range
 		{
-			sCurrentFSM = AGGRO;
-			iFSMCounter = 0;
+			cFSM.SetState(AGGRO);
 			//cout << "Switching to Aggro State" << endl;
 			hunkering = false;
 			break;
 		}
 		//if in hunker for a certain period of time without switching out
-		if (iFSMCounter > iMaxFSMCounter) 
+		if (cFSM.IsTimeUp()) 
 		{
 			//if too close to the spawn point
 			if (cPhysics2D.CalculateDistance(vec2Index, spawnPoint) < 0.5f)
 			{
-				sCurrentFSM = CAMOUFLAGE;
+				cFSM.SetState(CAMOUFLAGE);
 				//cout << "Switching to Camouflage State" << endl;
 			}
 			else
 			{
-				sCurrentFSM = RETURN;
+				cFSM.SetState(RETURN);
 				//cout << "Switching to Return State" << endl;
 			}
-			iFSMCounter = 0;
 			hunkering = false;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case RETURN:
 		if (health <= 5) //i can only take a max of 1 hit left, switch to explode mode
 		{
-			sCurrentFSM = EXPLODE;
-			iFSMCounter = 0;
+			cFSM.SetState(EXPLODE);
 			//cout << "Switching to Explode State" << endl;
 		}
 		//if too close to the spawn point
 		else if (cPhysics2D.CalculateDistance(vec2Index, spawnPoint) < 0.5f)
 		{
-			sCurrentFSM = CAMOUFLAGE;
-			iFSMCounter = 0;
+			cFSM.SetState(CAMOUFLAGE);
 			//cout << "Switching to Camouflage State" << endl;
 		}
 		else //move back to spawnPoint
@@ -463,7 +451,7 @@ void JEnemy2DShyC::Update(const double dElapsedTime)
 
 			UpdatePosition();
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case EXPLODE:
 		//still flickering through colours
@@ -541,20 +529,6 @@ void JEnemy2DShyC::Update(const double dElapsedTime)
 		break;
 	}
 
-	//ammo beahviour
-	for (std::vector<CJEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CJEAmmo* ammo = (CJEAmmo*)*it;
-		if (ammo->getActive())
-		{
-			ammo->Update(dElapsedTime);
-			if (ammo->LimitReached())
-			{
-				ammo->setActive(false);
-			}
-		}
-	}
-
 	UpdateDirection();
 
 	// Check if enemy is in mid-air, such as walking off a platform
@@ -582,25 +556,6 @@ void JEnemy2DShyC::Update(const double dElapsedTime)
 	vec2UVCoordinate.y = cSettings->ConvertIndexToUVSpace(cSettings->y, vec2Index.y, false, i32vec2NumMicroSteps.y*cSettings->ENEMY_MICRO_STEP_YAXIS);
 }
 
-/**
- @brief Set up the OpenGL display environment before rendering
- */
-void JEnemy2DShyC::PreRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
-
-	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	// Activate the shader
-	CShaderManager::GetInstance()->Use(sShaderName);
-}
-
 /**
  @brief Render this instance
  */
@@ -619,12 +574,14 @@ void JEnemy2DShyC::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, glm::vec2(i32vec2NumMicroSteps), IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += i32vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS;
-	actualPos.y += i32vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -638,114 +595,13 @@ void JEnemy2DShyC::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
 
 	glBindTexture(GL_TEXTURE_2D, 0);
 
-	//render enemy ammo
-	for (std::vector<CJEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CJEAmmo* ammo = (CJEAmmo*)*it;
-		if (ammo->getActive())
-		{
-			ammo->PreRender();
-			ammo->Render();
-			ammo->PostRender();
-		}
-	}
-
-}
-
-/**
- @brief PostRender Set up the OpenGL display environment after rendering.
- */
-void JEnemy2DShyC::PostRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// Disable blending
-	glDisable(GL_BLEND);
-}
-
-/**
-@brief Set the indices of the enemy2D
-@param iIndex_XAxis A const int variable which stores the index in the x-axis
-@param iIndex_YAxis A const int variable which stores the index in the y-axis
-*/
-void JEnemy2DShyC::Seti32vec2Index(const int iIndex_XAxis, const int iIndex_YAxis)
-{
-	this->vec2Index.x = iIndex_XAxis;
-	this->vec2Index.y = iIndex_YAxis;
-}
-
-/**
-@brief Set the number of microsteps of the enemy2D
-@param iNumMicroSteps_XAxis A const int variable storing the current microsteps in the X-axis
-@param iNumMicroSteps_YAxis A const int variable storing the current microsteps in the Y-axis
-*/
-void JEnemy2DShyC::Seti32vec2NumMicroSteps(const int iNumMicroSteps_XAxis, const int iNumMicroSteps_YAxis)
-{
-	this->i32vec2NumMicroSteps.x = iNumMicroSteps_XAxis;
-	this->i32vec2NumMicroSteps.y = iNumMicroSteps_YAxis;
-}
-
-/**
- @brief Set the handle to cPlayer to this class instance
- @param cPlayer2D A CPlayer2D* variable which contains the pointer to the CPlayer2D instance
- */
-void JEnemy2DShyC::SetPlayer2D(CPlayer2D* cPlayer2D)
-{
-	this->cPlayer2D = cPlayer2D;
-
-	// Update the enemy's direction
-	UpdateDirection();
-}
-
-/**
- @brief Constraint the enemy2D's position within a boundary
- @param eDirection A DIRECTION enumerated data type which indicates the direction to check
- */
-void JEnemy2DShyC::Constraint(DIRECTION eDirection)
-{
-	if (eDirection == LEFT)
-	{
-		if (vec2Index.x < 0)
-		{
-			vec2Index.x = 0;
-			i32vec2NumMicroSteps.x = 0;
-		}
-	}
-	else if (eDirection == RIGHT)
-	{
-		if (vec2Index.x >= (int)cSettings->NUM_TILES_XAXIS - 1)
-		{
-			vec2Index.x = ((int)cSettings->NUM_TILES_XAXIS) - 1;
-			i32vec2NumMicroSteps.x = 0;
-		}
-	}
-	else if (eDirection == UP)
-	{
-		if (vec2Index.y >= (int)cSettings->NUM_TILES_YAXIS - 1)
-		{
-			vec2Index.y = ((int)cSettings->NUM_TILES_YAXIS) - 1;
-			i32vec2NumMicroSteps.y = 0;
-		}
-	}
-	else if (eDirection == DOWN)
-	{
-		if (vec2Index.y < 0)
-		{
-			vec2Index.y = 0;
-			i32vec2NumMicroSteps.y = 0;
-		}
-	}
-	else
-	{
-		cout << "CStnEnemy2D::Constraint: Unknown direction." << endl;
-	}
 }
 
 /**
@@ -1040,41 +896,6 @@ void JEnemy2DShyC::InteractWithMap(void)
 	}
 }
 
-/**
- @brief Update the enemy's direction.
- */
-void JEnemy2DShyC::UpdateDirection(void)
-{
-	// Set the destination to the player
-	vec2Destination = cPlayer2D->vec2Index;
-
-	// Calculate the direction between enemy2D and player2D
-	vec2Direction = vec2Destination - vec2Index;
-
-	// Calculate the distance between enemy2D and player2D
-	float fDistance = cPhysics2D.CalculateDistance(vec2Index, vec2Destination);
-	if (fDistance >= 0.01f)
-	{
-		// Calculate direction vector.
-		// We need to round the numbers as it is easier to work with whole numbers for movements
-		vec2Direction.x = (int)round(vec2Direction.x / fDistance);
-		vec2Direction.y = (int)round(vec2Direction.y / fDistance);
-	}
-	else
-	{
-		// Since we are not going anywhere, set this to 0.
-		vec2Direction = glm::i32vec2(0);
-	}
-}
-
-/**
- @brief Flip horizontal direction. For patrol use only
- */
-void JEnemy2DShyC::FlipHorizontalDirection(void)
-{
-	vec2Direction.x *= -1;
-}
-
 /**
 @brief Update position.
 */
@@ -1175,47 +996,5 @@ void JEnemy2DShyC::UpdatePosition(void)
 	}
 }
 
-vector<glm::vec2> JEnemy2DShyC::ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints)
-{
-	for (int i = 0; i < numOfWaypoints; ++i)
-	{
-		waypointVector.push_back(cMap2D->GetTilePosition(startIndex + i));
-		// Erase the value of the waypoint in the arrMapInfo
-		cMap2D->SetMapInfo(waypointVector[i].y, waypointVector[i].x, 0);
-	}
-
-	return waypointVector;
-}
-
-//called whenever an ammo is needed to be shot
-CJEAmmo* JEnemy2DShyC::FetchAmmo()
-{
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CJEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CJEAmmo* ammo = (CJEAmmo*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// By default, microsteps should be zero --> reset in case a previously active ammo that was used then ste inactive was used again
-		ammo->vec2NumMicroSteps = glm::i32vec2(0, 0);
-		return ammo;
-	}
-
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CJEAmmo);
-	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
-
-}
 
 //accessed in scene to check if damage dealt to enemy by player's ammo should be lessened or not
-bool JEnemy2DShyC::getHunkering(void)
-{
-	return hunkering;
-}
\ No newline at end of file
@@ -5,14 +5,28 @@
  Date: Mar 2020
  */
 #include "JunglePlanet.h"
+
+// Include CProfiler, to time the enemies
+#include "TimeControl/Profiler.h"
+
 #include <iostream>
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the GL calls of each pass of the scene
+#include "RenderControl/RenderStats.h"
+// Include CResourceTracker, to tag the resources which each part of the scene creates
+#include "System/ResourceTracker.h"
 #include "../App/Source/GameStateManagement/GameInfo.h"
 
-#include "System\filesystem.h"
+#include "System/filesystem.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
+
+// Include CLogger, to log from the game loop without waiting for the console
+#include "System/Logger.h"
 
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
@@ -20,6 +34,8 @@ using namespace std;
 JunglePlanet::JunglePlanet(void)
 	: cMap2D(NULL)
 	, cPlayer2D(NULL)
+	, cPathRequestQueue(NULL)
+	, cProjectileSystem(NULL)
 	, cKeyboardController(NULL)	
 	, cGUI_Scene2D(NULL)
 	, cGameManager(NULL)
@@ -59,28 +75,27 @@ JunglePlanet::~JunglePlanet(void)
 		camera2D = NULL;
 	}
 
-	for (unsigned int i = 0; i < enemyVectors.size(); i++)
+	// Destroy the enemies and resources of every level
+	for (unsigned int i = 0; i < NUM_LEVELS; i++)
 	{
-		for (unsigned int j = 0; j < enemyVectors[i].size(); ++j)
-		{
-			delete enemyVectors[i][j];
-			enemyVectors[i][j] = NULL;
-		}
-		enemyVectors[i].clear();
+		cLevelArenas[i].Reset();
 	}
 	enemyVectors.clear();
+	resourceVectors.clear();
 
+	// Destroy the path request queue after the enemies, as they cancel their tickets when deleted
+	if (cPathRequestQueue)
+	{
+		cPathRequestQueue->Destroy();
+		cPathRequestQueue = NULL;
+	}
 
-	for (unsigned int i = 0; i < resourceVectors.size(); i++)
+	// Destroy the projectile system after the enemies which shot the projectiles
+	if (cProjectileSystem)
 	{
-		for (unsigned int j = 0; j < resourceVectors[i].size(); ++j)
-		{
-			delete resourceVectors[i][j];
-			resourceVectors[i][j] = NULL;
-		}
-		resourceVectors[i].clear();
+		cProjectileSystem->Destroy();
+		cProjectileSystem = NULL;
 	}
-	resourceVectors.clear();
 
 	if (cGUI_Scene2D)
 	{
@@ -113,12 +128,15 @@ bool JunglePlanet::Init(void)
 	// Include Shader Manager
 	CShaderManager::GetInstance()->Use("Shader2D");
 
+	// Tag the resources which each part of the planet creates, until the next tag, so that their leaks can be told apart
 	//Create Background Entity
+	RESOURCE_TAG("CBackgroundEntity");
 	cBackground = new CBackgroundEntity("Image/JunglePlanet/Background.png");
 	cBackground->SetShader("Shader2D");
 	cBackground->Init();
 	
 	// Create and initialise the cMap2D
+	RESOURCE_TAG("CMap2D");
 	cMap2D = CMap2D::GetInstance();
 	// Set a shader to this class
 	cMap2D->SetShader("Shader2D");
@@ -151,6 +169,7 @@ bool JunglePlanet::Init(void)
 	}
 
 	// Create and initialise the CGUI_Scene2D
+	RESOURCE_TAG("CGUI_Scene2D");
 		//done before player as ammo needs to know the planet number and ammo is init in player
 	cGUI_Scene2D = CGUI_Scene2D::GetInstance();
 	// Initialise the instance
@@ -162,6 +181,7 @@ bool JunglePlanet::Init(void)
 	cGUI_Scene2D->setPlanetNum(1);
 
 	// Create and initialise the CPlayer2D
+	RESOURCE_TAG("CPlayer2D");
 	cPlayer2D = CPlayer2D::GetInstance();
 	// Pass shader to cPlayer2D
 	cPlayer2D->SetShader("Shader2D_Colour");
@@ -172,14 +192,16 @@ bool JunglePlanet::Init(void)
 		return false;
 	}
 
-	//clear the individual enemy vectors inside enemyVectors
-	for (int i = 0; i < enemyVectors.size(); ++i)
+	//destroy the enemies and resources of the previous run, and reuse the memory of their arenas
+	RESOURCE_TAG("Enemies and resources");
+	for (int i = 0; i < NUM_LEVELS; ++i)
 	{
-		enemyVectors[i].clear();
+		cLevelArenas[i].Reset();
 	}
 
-	//clear enemyVectors
+	//clear enemyVectors and resourceVectors
 	enemyVectors.clear();
+	resourceVectors.clear();
 
 	//cycle through the maps and find the enemies
 		//and push them into the 2d enemy vector
@@ -197,7 +219,7 @@ bool JunglePlanet::Init(void)
 
 		while (true)
 		{
-			JEnemy2DVT* cJEnemy2DVT = new JEnemy2DVT();
+			JEnemy2DVT* cJEnemy2DVT = cLevelArenas[i].Create<JEnemy2DVT>();
 			// Pass shader to cEnemy2D
 			cJEnemy2DVT->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -208,6 +230,8 @@ bool JunglePlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cJEnemy2DVT);
 				// Break out of this loop if all enemies have been loaded
 				break;
 			}
@@ -215,7 +239,7 @@ bool JunglePlanet::Init(void)
 
 		while (true)
 		{
-			JEnemy2DShyC* cJEnemy2DShyC = new JEnemy2DShyC();
+			JEnemy2DShyC* cJEnemy2DShyC = cLevelArenas[i].Create<JEnemy2DShyC>();
 			// Pass shader to cEnemy2D
 			cJEnemy2DShyC->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -226,6 +250,8 @@ bool JunglePlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cJEnemy2DShyC);
 				// Break out of this loop if all enemies have been loaded
 				break;
 			}
@@ -233,7 +259,7 @@ bool JunglePlanet::Init(void)
 
 		while (true)
 		{
-			JEnemy2DPatrolT* cJEnemy2DPatrolT = new JEnemy2DPatrolT();
+			JEnemy2DPatrolT* cJEnemy2DPatrolT = cLevelArenas[i].Create<JEnemy2DPatrolT>();
 			// Pass shader to cEnemy2D
 			cJEnemy2DPatrolT->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -244,6 +270,8 @@ bool JunglePlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cJEnemy2DPatrolT);
 				// Break out of this loop if all enemies have been loaded
 				break;
 			}
@@ -251,7 +279,7 @@ bool JunglePlanet::Init(void)
 
 		while (true)
 		{
-			JEnemy2DITracker* cJEnemy2DITracker = new JEnemy2DITracker();
+			JEnemy2DITracker* cJEnemy2DITracker = cLevelArenas[i].Create<JEnemy2DITracker>();
 			// Pass shader to cEnemy2D
 			cJEnemy2DITracker->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -262,6 +290,8 @@ bool JunglePlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cJEnemy2DITracker);
 				// Break out of this loop if all enemies have been loaded
 				break;
 			}
@@ -276,7 +306,7 @@ bool JunglePlanet::Init(void)
 			//gets pushed into the resourceVectors vector once filled 
 		while (true)
 		{
-			CResource* resource = new CResource();
+			CResource* resource = cLevelArenas[i].Create<CResource>();
 			// Pass shader to cEnemy2D
 			resource->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -286,12 +316,19 @@ bool JunglePlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(resource);
 				// Break out of this loop if all resources have been loaded
 				break;
 			}
 		}
 
 		resourceVectors.push_back(resources); //push the vector of enemies into enemyVectors
+
+#ifdef _DEBUG
+		cout << "Level " << i << " ";
+		cLevelArenas[i].PrintSelf();
+#endif
 		
 	}
 
@@ -301,8 +338,21 @@ bool JunglePlanet::Init(void)
 	cPlayer2D->ResetRespawn(); //used if set current lvl used in init doesnt reset to first map
 
 	// Initialise the Physics
+	RESOURCE_TAG("Physics and projectiles");
 	cPhysics2D.Init();
 
+	// Create and initialise the CPathRequestQueue which solves the enemies' path requests
+	cPathRequestQueue = CPathRequestQueue::GetInstance();
+	cPathRequestQueue->Init();
+
+	// Initialise the spatial grids to cover a level
+	cEnemyGrid.Init(CSettings::GetInstance()->NUM_TILES_XAXIS, CSettings::GetInstance()->NUM_TILES_YAXIS);
+	cAmmoGrid.Init(CSettings::GetInstance()->NUM_TILES_XAXIS, CSettings::GetInstance()->NUM_TILES_YAXIS);
+
+	// Create and initialise the CProjectileSystem which updates and renders the enemies' projectiles
+	cProjectileSystem = CProjectileSystem::GetInstance();
+	cProjectileSystem->Init();
+
 	// Get the handler to the CInventoryManager instance
 	cInventoryManagerPlanet = CInventoryManagerPlanet::GetInstance();
 	cInventoryItemPlanet = cInventoryManagerPlanet->GetItem("PoisonLevel");
@@ -326,6 +376,7 @@ bool JunglePlanet::Init(void)
 	camera2D->setTargetPos(cPlayer2D->vec2Index);
 
 	// Load the sounds into CSoundController
+	RESOURCE_TAG("Sounds");
 	cSoundController = CSoundController::GetInstance();
 	//common sounds
 	cSoundController->LoadSound(FileSystem::getPath("Sounds\\walk.ogg"), CSoundController::SOUND_LIST::FOOTSTEPS, true);
@@ -440,7 +491,7 @@ bool JunglePlanet::Update(const double dElapsedTime)
  
 	// click test
 	if (CMouseController::GetInstance()->IsButtonDown(CMouseController::BUTTON_TYPE::LMB)) {
-		std::cout << camera2D->getBlockSelected().x << " " << camera2D->getBlockSelected().y << "\n";
+		LOG_DEBUG_EVERY(0.25, "JunglePlanet: Selected block ({}, {})", camera2D->getBlockSelected().x, camera2D->getBlockSelected().y);
 	}
 	
 	// Call the cPlayer2D's update method before Map2D
@@ -518,11 +569,33 @@ bool JunglePlanet::Update(const double dElapsedTime)
 		}
 	}
 
+	// Solve the path requests submitted by the enemies in the last frame
+	cPathRequestQueue->Update();
+
+	// Rebuild the spatial grids of this level's enemies and the player's active ammo,
+	// so the interaction checks below only look at what is nearby
+	cEnemyGrid.Clear();
+	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
+	{
+		cEnemyGrid.Insert(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+	}
+	cAmmoGrid.Clear();
+	const std::vector<CAmmo2D*>& playerAmmoList = cPlayer2D->getAmmoList();
+	for (unsigned int i = 0; i < playerAmmoList.size(); i++)
+	{
+		if (playerAmmoList[i]->getActive())
+			cAmmoGrid.Insert(playerAmmoList[i]);
+	}
+	// Entities found by the spatial grid queries
+	std::vector<CEntity2D*> vNearbyEntities;
+
 	// Call all of the cEnemy2D's update methods before Map2D
 	// as we want to capture the updates before Map2D update
 	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
+		PROFILE_SCOPE("Enemy update");
 		enemyVectors[cMap2D->GetCurrentLevel()][i]->Update(dElapsedTime);
+		cEnemyGrid.Update(enemyVectors[cMap2D->GetCurrentLevel()][i]);
 
 		//for patrol team, aka community based enemies
 			//if it is in noisy mode (aka getNoisy is true), check all other community enemies to see if they are near this noisy enemy
@@ -530,26 +603,26 @@ bool JunglePlanet::Update(const double dElapsedTime)
 		if (enemyVectors[cMap2D->GetCurrentLevel()][i]->getType() == CEnemy2D::ENEMYTYPE::COMMUNITY &&
 			enemyVectors[cMap2D->GetCurrentLevel()][i]->getNoisy())
 		{
-			//check all other enemies
-			for (unsigned int j = 0; j < enemyVectors[cMap2D->GetCurrentLevel()].size(); j++)
+			//check all other enemies near the current enemy
+			vNearbyEntities.clear();
+			cEnemyGrid.QueryRadius(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, 6.0f, vNearbyEntities);
+			for (unsigned int j = 0; j < vNearbyEntities.size(); j++)
 			{
+				CEnemy2D* nearbyEnemy = (CEnemy2D*)vNearbyEntities[j];
 				//if is a community enemy and not the current enemy 
-				if (enemyVectors[cMap2D->GetCurrentLevel()][j]->getType() == CEnemy2D::ENEMYTYPE::COMMUNITY &&
-					enemyVectors[cMap2D->GetCurrentLevel()][j] != enemyVectors[cMap2D->GetCurrentLevel()][i])
+				if (nearbyEnemy->getType() == CEnemy2D::ENEMYTYPE::COMMUNITY &&
+					nearbyEnemy != enemyVectors[cMap2D->GetCurrentLevel()][i])
 				{
-					//if this other enemy is near the current enemy
-					if (cPhysics2D.CalculateDistance(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, 
-						enemyVectors[cMap2D->GetCurrentLevel()][j]->vec2Index) < 6.0f)
-					{
-						enemyVectors[cMap2D->GetCurrentLevel()][j]->setAlert(); //send it into en_route state
-					}
+					nearbyEnemy->setAlert(); //send it into en_route state
 				}
 			}
 		}
 
-		//player ammo collision check with enemy
-		std::vector<CAmmo2D*> ammoList = cPlayer2D->getAmmoList();
-		for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+		//player ammo collision check with enemy, only for the ammo in the tiles around this enemy
+		vNearbyEntities.clear();
+		cAmmoGrid.QueryAABB(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index - glm::vec2(1.0f),
+			enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index + glm::vec2(1.0f), vNearbyEntities);
+		for (std::vector<CEntity2D*>::iterator it = vNearbyEntities.begin(); it != vNearbyEntities.end(); ++it)
 		{
 			CAmmo2D* ammo = (CAmmo2D*)*it;
 			if (ammo->getActive())
@@ -597,10 +670,10 @@ bool JunglePlanet::Update(const double dElapsedTime)
 				if (enemyVectors[cMap2D->GetCurrentLevel()].size() > 1)
 				{
 					//40% chance to drop scrap metal, 40% chance to drop battery, 20% chance to drop ironwood
-					int resourceType = rand() % 10;
+					int resourceType = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(10);
 					if (resourceType < 4) //0 1 2 3
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -608,7 +681,7 @@ bool JunglePlanet::Update(const double dElapsedTime)
 					}
 					else if (resourceType < 8) //4 5 6 7
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -616,7 +689,7 @@ bool JunglePlanet::Update(const double dElapsedTime)
 					}
 					else //8 9 
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::IRONWOOD); //create new ironwood resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::IRONWOOD); //create new ironwood resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -627,7 +700,7 @@ bool JunglePlanet::Update(const double dElapsedTime)
 				else if (enemyVectors[cMap2D->GetCurrentLevel()].size() == 1)
 				{
 					//confirm drop an ironwood
-					CResource* res = new CResource(CResource::RESOURCE_TYPE::IRONWOOD); //create new ironwood resource
+					CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::IRONWOOD); //create new ironwood resource
 					res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 					//set resource's position where enemy's position is
 					res->SetShader("Shader2D_Colour"); //set shader
@@ -640,10 +713,10 @@ bool JunglePlanet::Update(const double dElapsedTime)
 				if (enemyVectors[cMap2D->GetCurrentLevel()].size() > 1)
 				{
 					//20% chance to drop scrap metal, 20% chance to drop battery, 10% chance to drop ironwood
-					int resourceType = rand() % 20;
+					int resourceType = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(20);
 					if (resourceType < 4) //0 1 2 3
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -651,7 +724,7 @@ bool JunglePlanet::Update(const double dElapsedTime)
 					}
 					else if (resourceType > 7 && resourceType < 12) //8 9 10 11
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -659,7 +732,7 @@ bool JunglePlanet::Update(const double dElapsedTime)
 					}
 					else if (resourceType > 16 && resourceType < 19) //17 18
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::IRONWOOD); //create new ironwood resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::IRONWOOD); //create new ironwood resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -670,7 +743,7 @@ bool JunglePlanet::Update(const double dElapsedTime)
 				else if (enemyVectors[cMap2D->GetCurrentLevel()].size() == 1)
 				{
 					//confirm drop an ironwood
-					CResource* res = new CResource(CResource::RESOURCE_TYPE::IRONWOOD); //create new ironwood resource
+					CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::IRONWOOD); //create new ironwood resource
 					res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 					//set resource's position where enemy's position is
 					res->SetShader("Shader2D_Colour"); //set shader
@@ -685,12 +758,17 @@ bool JunglePlanet::Update(const double dElapsedTime)
  				enemyVectors[cMap2D->GetCurrentLevel()][i]->Update(dElapsedTime);
 			}
 
-			delete enemyVectors[cMap2D->GetCurrentLevel()][i];
+			cEnemyGrid.Remove(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+			cProjectileSystem->RemoveByOwner(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+			cLevelArenas[cMap2D->GetCurrentLevel()].Destroy(enemyVectors[cMap2D->GetCurrentLevel()][i]);
 			enemyVectors[cMap2D->GetCurrentLevel()][i] = NULL;
 			enemyVectors[cMap2D->GetCurrentLevel()].erase(enemyVectors[cMap2D->GetCurrentLevel()].begin() + i);
 		}
 	}
 
+	// Update the projectiles shot by the enemies
+	cProjectileSystem->Update(dElapsedTime);
+
 	//update all resources
 	for (unsigned int i = 0; i < resourceVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -699,7 +777,7 @@ bool JunglePlanet::Update(const double dElapsedTime)
 		//if resource is collected
 		if (resourceVectors[cMap2D->GetCurrentLevel()][i]->getCollected())
 		{
-			delete resourceVectors[cMap2D->GetCurrentLevel()][i];
+			cLevelArenas[cMap2D->GetCurrentLevel()].Destroy(resourceVectors[cMap2D->GetCurrentLevel()][i]);
 			resourceVectors[cMap2D->GetCurrentLevel()][i] = NULL;
 			resourceVectors[cMap2D->GetCurrentLevel()].erase(resourceVectors[cMap2D->GetCurrentLevel()].begin() + i);
 		}
@@ -892,8 +970,8 @@ bool JunglePlanet::Update(const double dElapsedTime)
 	}
 
 	//play ammo sound if there is an ammo on screen
-	std::vector<CAmmo2D*> ammoList = cPlayer2D->getAmmoList();
-	for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+	const std::vector<CAmmo2D*>& ammoList = cPlayer2D->getAmmoList();
+	for (std::vector<CAmmo2D*>::const_iterator it = ammoList.begin(); it != ammoList.end(); ++it)
 	{
 		CAmmo2D* ammo = (CAmmo2D*)*it;
 		if (ammo->getActive()) //if got active ammo, set to true
@@ -996,10 +1074,12 @@ void JunglePlanet::PreRender(void)
 void JunglePlanet::Render(void)
 {
 	//Render Background
+	RENDER_STATS_PASS(BACKGROUND);
 	cBackground->PreRender();
 	cBackground->Render();
 	cBackground->PostRender();
 
+	RENDER_STATS_PASS(MAP);
 	// Calls the Map2D's PreRender()
 	cMap2D->PreRender();
 	// Calls the Map2D's Render()
@@ -1007,6 +1087,7 @@ void JunglePlanet::Render(void)
 	// Calls the Map2D's PostRender()
 	cMap2D->PostRender();
 
+	RENDER_STATS_PASS(ENEMIES);
 	// Calls the CEnemy2D's PreRender()
 	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -1018,6 +1099,13 @@ void JunglePlanet::Render(void)
 		enemyVectors[cMap2D->GetCurrentLevel()][i]->PostRender();
 	}
 
+	// Render the projectiles shot by the enemies
+	cProjectileSystem->PreRender();
+	cProjectileSystem->Render();
+	cProjectileSystem->PostRender();
+
+	// The resources are counted with the map which they lie on
+	RENDER_STATS_PASS(MAP);
 	// Calls the CResource's PreRender()
 	for (unsigned int i = 0; i < resourceVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -1029,6 +1117,7 @@ void JunglePlanet::Render(void)
 		resourceVectors[cMap2D->GetCurrentLevel()][i]->PostRender();
 	}
 
+	RENDER_STATS_PASS(PLAYER);
 	// Calls the CPlayer2D's PreRender()
 	cPlayer2D->PreRender();
 	// Calls the CPlayer2D's Render()
@@ -1036,6 +1125,7 @@ void JunglePlanet::Render(void)
 	// Calls the CPlayer2D's PostRender()
 	cPlayer2D->PostRender();
 
+	RENDER_STATS_PASS(HUD);
 	// Calls the CGUI_Scene2D's PreRender()
 	cGUI_Scene2D->PreRender();
 	// Calls the CGUI_Scene2D's Render()
@@ -1044,8 +1134,9 @@ void JunglePlanet::Render(void)
 	cGUI_Scene2D->PostRender();
 
 	//render player ammo
-	std::vector<CAmmo2D*> ammoList = cPlayer2D->getAmmoList();
-	for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+	RENDER_STATS_PASS(PLAYER);
+	const std::vector<CAmmo2D*>& ammoList = cPlayer2D->getAmmoList();
+	for (std::vector<CAmmo2D*>::const_iterator it = ammoList.begin(); it != ammoList.end(); ++it)
 	{
 		CAmmo2D* ammo = (CAmmo2D*)*it;
 		if (ammo->getActive())
@@ -1245,8 +1336,13 @@ void JunglePlanet::DecideLevel(bool tutorial)
 	{
 		//random between 2 numbers to set us Scrap metal or battery
 			//according to which number type is set to, load which texture
-		int randomState = rand() % 100;
-		if (randomState < 50)
+		int randomState = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(100);
+		int forcedLevel = CGameInfo::GetInstance()->forcedLevel;
+		if ((forcedLevel == LEVEL1) || (forcedLevel == LEVEL2))
+		{
+			cMap2D->SetCurrentLevel(forcedLevel); //level of the scenario being run
+		}
+		else if (randomState < 50)
 		{
 			cMap2D->SetCurrentLevel(LEVEL1); //level 1
 		}
@@ -19,7 +19,7 @@
 #include <includes/gtc/type_ptr.hpp>
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
@@ -37,6 +37,18 @@
 // Include CPhysics2D
 #include "Physics2D.h"
 
+// Include CPathRequestQueue
+#include "PathRequestQueue.h"
+
+// Include CSpatialGrid
+#include "SpatialGrid.h"
+
+// Include CProjectileSystem
+#include "ProjectileSystem.h"
+
+// Include CLevelArena
+#include "LevelArena.h"
+
 // Include GUI_Scene2D
 #include "GUI_Scene2D.h"
 #include "BackgroundEntity.h"
@@ -45,7 +57,7 @@
 #include <vector>
 
 // Include Keyboard controller
-#include "Inputs\KeyboardController.h"
+#include "Inputs/KeyboardController.h"
 
 // Game Manager
 #include "GameManager.h"
@@ -54,12 +66,10 @@
 #include "Primitives/Camera2D.h"
 
 // Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 //include ammo
 #include "Ammo2D.h"
-#include "EnemyAmmo2D.h"
-#include "JungleEAmmo.h"
 
 //include resources
 #include "Resource.h"
@@ -118,6 +128,16 @@ protected:
 	// Physics
 	CPhysics2D cPhysics2D;
 
+	// The handler containing the instance of CPathRequestQueue
+	CPathRequestQueue* cPathRequestQueue;
+
+	// Spatial grids of the enemies and the player's ammo in the current level
+	CSpatialGrid cEnemyGrid;
+	CSpatialGrid cAmmoGrid;
+
+	// The handler containing the instance of CProjectileSystem
+	CProjectileSystem* cProjectileSystem;
+
 	// The handler containing the instance of CGUI_Scene2D
 	CGUI_Scene2D* cGUI_Scene2D;
 	
@@ -155,6 +175,9 @@ protected:
 		NUM_LEVELS //to set the number of maps to load in for 1 scene and the number of maps to check for enemies to push in
 	};
 
+	// The enemies and resources of each level are allocated from the arena of that level
+	CLevelArena cLevelArenas[NUM_LEVELS];
+
 	enum TILE_INDEX
 	{
 		BURNABLE_BUSH = 600,
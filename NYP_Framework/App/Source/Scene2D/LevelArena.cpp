@@ -0,0 +1,193 @@
+/**
+ CLevelArena
+ @brief A class which allocates the objects of a level from large chunks of memory, and frees all of them at once
+ */
+#include "LevelArena.h"
+
+#include <iostream>
+#include <cstring>
+using namespace std;
+
+/**
+ @brief Constructor
+ @param uiChunkSize A const size_t containing the number of bytes to add when the arena grows
+ */
+CLevelArena::CLevelArena(const size_t uiChunkSize)
+	: uiCurrentChunk(0)
+	, uiOffset(0)
+	, uiChunkSize(uiChunkSize > 0 ? uiChunkSize : 1)
+	, uiBytesUsed(0)
+	, uiHighWaterMark(0)
+	, uiNumAllocations(0)
+	, uiNumLiveObjects(0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CLevelArena::~CLevelArena(void)
+{
+	Reset();
+	for (unsigned int i = 0; i < vChunks.size(); i++)
+		delete[] vChunks[i].pMemory;
+	vChunks.clear();
+}
+
+/**
+ @brief Allocate memory from the current chunk, moving on to the next chunk when it is full
+ @param uiSize A const size_t containing the number of bytes to allocate
+ @param uiAlignment A const size_t containing the alignment of the memory, which must be a power of 2
+ */
+void* CLevelArena::Allocate(const size_t uiSize, const size_t uiAlignment)
+{
+	while (true)
+	{
+		if (uiCurrentChunk < vChunks.size())
+		{
+			SChunk& chunk = vChunks[uiCurrentChunk];
+			size_t uiAddress = reinterpret_cast<size_t>(chunk.pMemory) + uiOffset;
+			size_t uiPadding = (uiAlignment - (uiAddress & (uiAlignment - 1))) & (uiAlignment - 1);
+			if (uiOffset + uiPadding + uiSize <= chunk.uiSize)
+			{
+				void* pMemory = chunk.pMemory + uiOffset + uiPadding;
+				uiOffset += uiPadding + uiSize;
+				uiBytesUsed += uiPadding + uiSize;
+				if (uiBytesUsed > uiHighWaterMark)
+					uiHighWaterMark = uiBytesUsed;
+				uiNumAllocations++;
+				return pMemory;
+			}
+
+			// The rest of this chunk is wasted until the next Reset
+			uiBytesUsed += chunk.uiSize - uiOffset;
+			uiCurrentChunk++;
+			uiOffset = 0;
+			continue;
+		}
+
+		AddChunk(uiSize + uiAlignment);
+	}
+}
+
+/**
+ @brief Destroy all objects in reverse order of creation and rewind the arena. The chunks are kept for reuse
+ */
+void CLevelArena::Reset(void)
+{
+	// Objects may refer to objects created before them, so destroy the newest first
+	for (int i = (int)vObjects.size() - 1; i >= 0; i--)
+	{
+		if (vObjects[i].pfnDestroy)
+			vObjects[i].pfnDestroy(vObjects[i].pObject);
+	}
+	vObjects.clear();
+
+#ifdef _DEBUG
+	// Poison the memory so that using an object after its level is torn down is easy to spot
+	for (unsigned int i = 0; i < vChunks.size(); i++)
+		memset(vChunks[i].pMemory, 0xDD, vChunks[i].uiSize);
+#endif
+
+	uiCurrentChunk = 0;
+	uiOffset = 0;
+	uiBytesUsed = 0;
+	uiNumAllocations = 0;
+	uiNumLiveObjects = 0;
+}
+
+/**
+ @brief Get the number of bytes handed out since the last Reset, including padding
+ */
+size_t CLevelArena::GetBytesUsed(void) const
+{
+	return uiBytesUsed;
+}
+
+/**
+ @brief Get the number of bytes held in chunks
+ */
+size_t CLevelArena::GetBytesReserved(void) const
+{
+	size_t uiBytesReserved = 0;
+	for (unsigned int i = 0; i < vChunks.size(); i++)
+		uiBytesReserved += vChunks[i].uiSize;
+	return uiBytesReserved;
+}
+
+/**
+ @brief Get the largest number of bytes which were handed out between two Resets
+ */
+size_t CLevelArena::GetHighWaterMark(void) const
+{
+	return uiHighWaterMark;
+}
+
+/**
+ @brief Get the number of allocations since the last Reset
+ */
+unsigned int CLevelArena::GetNumAllocations(void) const
+{
+	return uiNumAllocations;
+}
+
+/**
+ @brief Get the number of objects which have not been destroyed
+ */
+unsigned int CLevelArena::GetNumLiveObjects(void) const
+{
+	return uiNumLiveObjects;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CLevelArena::PrintSelf(void) const
+{
+	cout << "CLevelArena: " << uiNumLiveObjects << " live objects, " << uiNumAllocations << " allocations, "
+		<< uiBytesUsed << " / " << GetBytesReserved() << " bytes used in " << vChunks.size()
+		<< " chunks, high water mark: " << uiHighWaterMark << " bytes" << endl;
+}
+
+/**
+ @brief Add a chunk which can hold at least uiMinSize bytes
+ @param uiMinSize A const size_t containing the smallest size of the chunk
+ */
+void CLevelArena::AddChunk(const size_t uiMinSize)
+{
+	SChunk chunk;
+	chunk.uiSize = (uiMinSize > uiChunkSize) ? uiMinSize : uiChunkSize;
+	chunk.pMemory = new unsigned char[chunk.uiSize];
+#ifdef _DEBUG
+	memset(chunk.pMemory, 0xCD, chunk.uiSize);
+#endif
+	vChunks.push_back(chunk);
+}
+
+/**
+ @brief Run the destructor of an object and mark its entry as destroyed
+ @param pObject A void* of the complete object to destroy
+ */
+bool CLevelArena::DestroyEntry(void* pObject)
+{
+	// Objects which are destroyed early were usually created recently, so search from the back
+	for (int i = (int)vObjects.size() - 1; i >= 0; i--)
+	{
+		if (vObjects[i].pObject != pObject)
+			continue;
+
+		if (vObjects[i].pfnDestroy == nullptr)
+		{
+			cout << "CLevelArena::Destroy: The object has already been destroyed." << endl;
+			return false;
+		}
+
+		vObjects[i].pfnDestroy(pObject);
+		vObjects[i].pfnDestroy = nullptr;
+		uiNumLiveObjects--;
+		return true;
+	}
+
+	cout << "CLevelArena::Destroy: The object does not belong to this arena." << endl;
+	return false;
+}
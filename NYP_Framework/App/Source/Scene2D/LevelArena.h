@@ -0,0 +1,131 @@
+/**
+ CLevelArena
+ @brief A class which allocates the objects of a level from large chunks of memory, and frees all of them at once
+ */
+#pragma once
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+class CLevelArena
+{
+public:
+	// Constructor. The arena grows uiChunkSize bytes at a time
+	CLevelArena(const size_t uiChunkSize = 64 * 1024);
+
+	// Destructor
+	virtual ~CLevelArena(void);
+
+	// Allocate uiSize bytes aligned to uiAlignment. The memory is only reclaimed by Reset
+	void* Allocate(const size_t uiSize, const size_t uiAlignment);
+
+	// Construct an object in the arena. The arguments are passed to the constructor of T
+	template <typename T, typename... Args>
+	T* Create(Args&&... args)
+	{
+		void* pMemory = Allocate(sizeof(T), alignof(T));
+		T* pObject = new (pMemory) T(std::forward<Args>(args)...);
+		vObjects.push_back(SObjectEntry(pObject, &CLevelArena::DestroyObject<T>));
+		uiNumLiveObjects++;
+		return pObject;
+	}
+
+	// Destroy an object before the level ends, e.g. a dead enemy. Its memory is reclaimed by Reset.
+	// pObject may point to a base class of the type which was created
+	template <typename T>
+	bool Destroy(T* pObject)
+	{
+		if (pObject == nullptr)
+			return false;
+		return DestroyEntry(GetObjectAddress(pObject, std::is_polymorphic<T>()));
+	}
+
+	// Destroy all objects in reverse order of creation and rewind the arena. The chunks are kept for reuse
+	void Reset(void);
+
+	// Get the number of bytes handed out since the last Reset
+	size_t GetBytesUsed(void) const;
+
+	// Get the number of bytes held in chunks
+	size_t GetBytesReserved(void) const;
+
+	// Get the largest number of bytes which were handed out between two Resets
+	size_t GetHighWaterMark(void) const;
+
+	// Get the number of allocations since the last Reset
+	unsigned int GetNumAllocations(void) const;
+
+	// Get the number of objects which have not been destroyed
+	unsigned int GetNumLiveObjects(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// An object created in the arena, and the function which runs its destructor
+	struct SObjectEntry
+	{
+		void* pObject;
+		void (*pfnDestroy)(void*);
+
+		SObjectEntry(void* pObject, void (*pfnDestroy)(void*))
+			: pObject(pObject)
+			, pfnDestroy(pfnDestroy)
+		{
+		}
+	};
+
+	// A chunk of memory. Chunks are never moved, so pointers to the objects stay valid
+	struct SChunk
+	{
+		unsigned char* pMemory;
+		size_t uiSize;
+	};
+
+	// The chunks, and the chunk and offset of the next free byte
+	std::vector<SChunk> vChunks;
+	unsigned int uiCurrentChunk;
+	size_t uiOffset;
+
+	// The objects created since the last Reset. Destroyed objects have a null pfnDestroy
+	std::vector<SObjectEntry> vObjects;
+
+	size_t uiChunkSize;
+	size_t uiBytesUsed;
+	size_t uiHighWaterMark;
+	unsigned int uiNumAllocations;
+	unsigned int uiNumLiveObjects;
+
+	// Add a chunk which can hold at least uiMinSize bytes
+	void AddChunk(const size_t uiMinSize);
+
+	// Run the destructor of an object and mark its entry as destroyed
+	bool DestroyEntry(void* pObject);
+
+	// Run the destructor of an object of type T
+	template <typename T>
+	static void DestroyObject(void* pObject)
+	{
+		static_cast<T*>(pObject)->~T();
+	}
+
+	// Get the address of the complete object which pObject points into
+	template <typename T>
+	static void* GetObjectAddress(T* pObject, std::true_type)
+	{
+		return dynamic_cast<void*>(pObject);
+	}
+	template <typename T>
+	static void* GetObjectAddress(T* pObject, std::false_type)
+	{
+		return static_cast<void*>(pObject);
+	}
+
+private:
+	// An arena owns its objects, so it cannot be copied
+	CLevelArena(const CLevelArena&);
+	CLevelArena& operator=(const CLevelArena&);
+};
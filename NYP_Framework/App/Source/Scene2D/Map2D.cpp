@@ -6,13 +6,20 @@
  */
 #include "Map2D.h"
 
+// Include CProfiler, to time the rendering and path finding, and show the map loads and saves in the traces
+#include "TimeControl/Profiler.h"
+
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 
 // Include Filesystem
-#include "System\filesystem.h"
+#include "System/filesystem.h"
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
+// Include CAssetArchive, to read the maps from the archive instead of their files
+#include "System/AssetArchive.h"
 #include "Primitives/MeshBuilder.h"
 
 #include <iostream>
@@ -22,14 +29,28 @@ using namespace std;
 // For AStar PathFinding
 using namespace std::placeholders;
 
+// The values of the tiles which the enemies of the planets are spawned from, which can be copied. The other
+// enemies take their waypoints from their start position, so a copy of them would have none
+static const int iEnemySpawnTiles[] = {
+	1610, 1630,							// Jungle
+	1802, 1803, 1804,					// Terrestrial
+};
+
+// The furthest that the copies of a spawn tile are put from it, in tiles
+static const int iMaxSpawnDistance = 8;
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 CMap2D::CMap2D(void)
 	: uiCurLevel(0)
+	, uiSpawnMultiple(1)
 	, quadMesh(NULL)
 	, camera2D(NULL)
 {
+	// The scenario benchmarks spawn more enemies. This instance is destroyed with each scene, so the multiple
+	// is taken from the settings, instead of being set on each new instance
+	SetSpawnMultiple(CSettings::GetInstance()->uiScenarioEnemyMultiple);
 }
 
 /**
@@ -117,7 +138,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	}
 
 	// TO REMOVE LATER
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Ground.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Ground.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Ground.tga" << endl;
@@ -134,7 +155,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	/// </summary>
 	{
 		//poison sprout tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/PoisonSprout.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/PoisonSprout.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/PoisonSprout.tga" << endl;
@@ -146,7 +167,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(POISON_SPROUT, iTextureID));
 		}
 		//poison fog tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/PoisonFog.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/PoisonFog.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/PoisonFog.tga" << endl;
@@ -158,7 +179,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(POISON_FOG, iTextureID));
 		}
 		//poison explosion tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/PoisonExplosion.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/PoisonExplosion.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/PoisonExplosion.tga" << endl;
@@ -171,7 +192,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//river water tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/RiverWater.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/RiverWater.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/RiverWater.tga" << endl;
@@ -183,7 +204,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(RIVER_WATER, iTextureID));
 		}
 		//eney waypoint river water tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/RiverWater.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/RiverWater.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/RiverWater.tga" << endl;
@@ -196,7 +217,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//unbloomed bouncy bloom tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/BouncyBloom_Unbloomed.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/BouncyBloom_Unbloomed.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/BouncyBloom_Unbloomed.tga" << endl;
@@ -208,7 +229,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(UNBLOOMED_BOUNCY_BLOOM, iTextureID));
 		}
 		//bloomed bouncy bloom tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/BouncyBloom_Bloomed.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/BouncyBloom_Bloomed.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/BouncyBloom_Bloomed.tga" << endl;
@@ -221,7 +242,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//rock tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Rock.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Rock.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Rock.tga" << endl;
@@ -233,7 +254,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(ROCK, iTextureID));
 		}
 		//rock vine tied left tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Rock_VineTied_Left.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Rock_VineTied_Left.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Rock_VineTied_Left.tga" << endl;
@@ -245,7 +266,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(ROCK_VINE_LEFT, iTextureID));
 		}
 		//vine left corner tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Vine_Corner_Left.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Vine_Corner_Left.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Vine_Corner_Left.tga" << endl;
@@ -257,7 +278,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(VINE_CORNER_LEFT, iTextureID));
 		}
 		//vine left tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Vine_Left.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Vine_Left.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Vine_Left.tga" << endl;
@@ -269,7 +290,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(VINE_LEFT, iTextureID));
 		}
 		//rock vine tied right tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Rock_VineTied_Right.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Rock_VineTied_Right.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Rock_VineTied_Right.tga" << endl;
@@ -281,7 +302,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(ROCK_VINE_RIGHT, iTextureID));
 		}
 		//vine right corner tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Vine_Corner_Right.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Vine_Corner_Right.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Vine_Corner_Right.tga" << endl;
@@ -293,7 +314,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(VINE_CORNER_RIGHT, iTextureID));
 		}
 		//vine right tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Vine_Right.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Vine_Right.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Vine_Right.tga" << endl;
@@ -306,7 +327,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//space tile, alt tiles for moving leaves --> leaves will move onto these tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Hidden.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Hidden.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Hidden.tga" << endl;
@@ -318,7 +339,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(MOVING_LEAF_ALT, iTextureID));
 		}
 		//blank tile, used as a temp for switching alt with solid and vice versa
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Hidden.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Hidden.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Hidden.tga" << endl;
@@ -331,7 +352,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//poof tile, teleporattion residue --> to indicate something has teleported away from here
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/TeleportationResidue.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/TeleportationResidue.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/TeleportationResidue.tga" << endl;
@@ -344,7 +365,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//pressed button down
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Down_Pressed.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Down_Pressed.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Down_Pressed.tga" << endl;
@@ -356,7 +377,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(DOWN_BUTTON_PRESSED, iTextureID));
 		}
 		//pressed button up
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Up_Pressed.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Up_Pressed.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Up_Pressed.tga" << endl;
@@ -368,7 +389,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(UP_BUTTON_PRESSED, iTextureID));
 		}
 		//pressed button right
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Right_Pressed.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Right_Pressed.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Right_Pressed.tga" << endl;
@@ -380,7 +401,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(RIGHT_BUTTON_PRESSED, iTextureID));
 		}
 		//pressed button left
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Left_Pressed.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Left_Pressed.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Left_Pressed.tga" << endl;
@@ -393,7 +414,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//invisible tile for shooting pop up trigger in tutorial
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Hidden.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Hidden.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Hidden.tga" << endl;
@@ -407,7 +428,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 
 
 		//down button 1
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Down.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Down.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Down.tga" << endl;
@@ -419,7 +440,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(DOWN_BUTTON_1, iTextureID));
 		}
 		//right button 1
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Right.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Right.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Right.tga" << endl;
@@ -431,7 +452,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(RIGHT_BUTTON_1, iTextureID));
 		}
 		//left button 1
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Left.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Left.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Left.tga" << endl;
@@ -443,7 +464,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(LEFT_BUTTON_1, iTextureID));
 		}
 		//down button 2
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Down.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Down.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Down.tga" << endl;
@@ -455,7 +476,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(DOWN_BUTTON_2, iTextureID));
 		}
 		//down button 3
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Button_Down.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Button_Down.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/Button_Down.tga" << endl;
@@ -474,7 +495,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	int x;
 	{
 		//burnable bush tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/BurnableBushBlock.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/BurnableBushBlock.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/BurnableBushBlock.tga" << endl;
@@ -486,7 +507,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(BURNABLE_BUSH, iTextureID));
 		}
 		//burning burnable bush tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/BurnableBushBlock_Burning.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/BurnableBushBlock_Burning.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/BurnableBushBlock_Burning.tga" << endl;
@@ -498,7 +519,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(BURNING_BUSH, iTextureID));
 		}
 		//dissolving burnable bush tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/BurnableBushBlock_Dissolving.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/BurnableBushBlock_Dissolving.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/BurnableBushBlock_Dissolving.tga" << endl;
@@ -512,7 +533,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 
 
 		//grass ground tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/GrassBlock.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/GrassBlock.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/GrassBlock.tga" << endl;
@@ -524,7 +545,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(GRASS_GROUND, iTextureID));
 		}
 		//grass ground, top left corner tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/GrassBlock_TopLeftCorner.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/GrassBlock_TopLeftCorner.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/GrassBlock_TopLeftCorner.tga" << endl;
@@ -536,7 +557,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(GRASS_GROUND_L, iTextureID));
 		}
 		//grass ground, top right corner tile
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/GrassBlock_TopRightCorner.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/GrassBlock_TopRightCorner.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/GrassBlock_TopRightCorner.tga" << endl;
@@ -549,7 +570,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//moving leaves solid tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/MovingLeaf.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/MovingLeaf.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/MovingLeaf.tga" << endl;
@@ -561,7 +582,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(MOVING_LEAF_SOLID, iTextureID));
 		}
 		//leaves solid tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/MovingLeaf.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/MovingLeaf.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/MovingLeaf.tga" << endl;
@@ -573,7 +594,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(LEAF_SOLID, iTextureID));
 		}
 		//ironwood tree trunk tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/IronwoodTreeTrunk.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/IronwoodTreeTrunk.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/IronwoodTreeTrunk.tga" << endl;
@@ -586,7 +607,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//stone ground tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/StoneBlock.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/StoneBlock.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/StoneBlock.tga" << endl;
@@ -598,7 +619,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(STONE_GROUND, iTextureID));
 		}
 		//grassy stone ground tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/StoneBlock_Grass.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/StoneBlock_Grass.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/StoneBlock_Grass.tga" << endl;
@@ -610,7 +631,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(STONE_GROUND_GRASS, iTextureID));
 		}
 		//mossy stone ground tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/StoneBlock_Mossy.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/StoneBlock_Mossy.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/StoneBlock_Mossy.tga" << endl;
@@ -623,7 +644,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		}
 
 		//down button 1 stone ground tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/MetalBarrier.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/MetalBarrier.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/MetalBarrier.tga" << endl;
@@ -635,7 +656,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(DOWN_BUTTON_1_BLOCKS, iTextureID));
 		}
 		//right button 1 stone ground tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/MetalBarrier.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/MetalBarrier.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/MetalBarrier.tga" << endl;
@@ -647,7 +668,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(RIGHT_BUTTON_1_BLOCKS, iTextureID));
 		}
 		//left button 1 stone ground tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/MetalBarrier.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/MetalBarrier.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/MetalBarrier.tga" << endl;
@@ -659,7 +680,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(LEFT_BUTTON_1_BLOCKS, iTextureID));
 		}
 		//down button 2 stone ground tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/MetalBarrier.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/MetalBarrier.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/MetalBarrier.tga" << endl;
@@ -671,7 +692,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			MapOfTextureIDs.insert(pair<int, int>(DOWN_BUTTON_2_BLOCKS, iTextureID));
 		}
 		//down button 3 stone ground tiles
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/MetalBarrier.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/MetalBarrier.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/JunglePlanet/MetalBarrier.tga" << endl;
@@ -688,7 +709,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	/// Terrestrial Planet Interactables
 	/// </summary>
 	// Load the yellow tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Yellow.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Yellow.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Yellow.tga" << endl;
@@ -700,7 +721,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(YELLOW_TILE_HOLLOW, iTextureID));
 	}
 	// Load the red tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Red.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Red.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Red.tga" << endl;
@@ -712,7 +733,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(RED_TILE_HOLLOW, iTextureID));
 	}
 	// Load the green tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Green.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Green.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Green.tga" << endl;
@@ -724,7 +745,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GREEN_TILE_HOLLOW, iTextureID));
 	}
 	// Load the blue tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Blue.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Blue.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Blue.tga" << endl;
@@ -736,7 +757,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(BLUE_TILE_HOLLOW, iTextureID));
 	}
 	// Load the brown tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Brown_Hollow.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Brown_Hollow.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Brown_Hollow.tga" << endl;
@@ -749,7 +770,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	}
 	// Load rope textures
 	// Load post with rope coiled
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Rope_Post_Coiled.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Rope_Post_Coiled.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Rope_Post_Coiled.tga" << endl;
@@ -761,7 +782,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_POST_COILED, iTextureID));
 	}
 	// Load post with rope uncoiled left
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Rope_Post_Uncoiled_Left.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Rope_Post_Uncoiled_Left.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Rope_Post_Uncoiled_Left.tga" << endl;
@@ -773,7 +794,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_POST_UNCOILED_LEFT, iTextureID));
 	}
 	// Load rope corner left
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Rope_Corner_Left.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Rope_Corner_Left.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Rope_Corner_Left.tga" << endl;
@@ -785,7 +806,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_CORNER_LEFT, iTextureID));
 	}
 	// Load rope length left
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Rope_Length_Left.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Rope_Length_Left.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Rope_Length_Left.tga" << endl;
@@ -797,7 +818,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_LENGTH_LEFT, iTextureID));
 	}
 	// Load post with rope uncoiled right
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Rope_Post_Uncoiled_Right.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Rope_Post_Uncoiled_Right.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Rope_Post_Uncoiled_Right.tga" << endl;
@@ -809,7 +830,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_POST_UNCOILED_RIGHT, iTextureID));
 	}
 	// Load rope corner right
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Rope_Corner_Right.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Rope_Corner_Right.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Rope_Corner_Right.tga" << endl;
@@ -821,7 +842,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_CORNER_RIGHT, iTextureID));
 	}
 	// Load rope length right
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Rope_Length_Right.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Rope_Length_Right.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Rope_Length_Right.tga" << endl;
@@ -833,7 +854,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_LENGTH_RIGHT, iTextureID));
 	}
 	// Load droopy black flag
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/Flag_Black_Droopy.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/Flag_Black_Droopy.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/Flag_Black_Droopy.tga" << endl;
@@ -845,7 +866,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(BLACK_FLAG, iTextureID));
 	}
 	// Load flying red flag
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/Flag_Red_Flying.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/Flag_Red_Flying.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/Flag_Red_Flying.tga" << endl;
@@ -858,7 +879,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	}
 	
 	// Load spikes up
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Spikes_Up.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Spikes_Up.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Spikes_Up.tga" << endl;
@@ -870,7 +891,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SPIKES_UP, iTextureID));
 	}
 	// Load spikes left
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Spikes_Left.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Spikes_Left.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Spikes_Left.tga" << endl;
@@ -882,7 +903,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SPIKES_LEFT, iTextureID));
 	}
 	// Load spikes down
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Spikes_Down.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Spikes_Down.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Spikes_Down.tga" << endl;
@@ -894,7 +915,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SPIKES_DOWN, iTextureID));
 	}
 	// Load spikes right
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Spikes_Right.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Spikes_Right.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Spikes_Right.tga" << endl;
@@ -906,7 +927,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SPIKES_RIGHT, iTextureID));
 	}
 	// Load explosion
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Explosion.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Explosion.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Explosion.tga" << endl;
@@ -919,7 +940,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	}
 
 	// Load alarm box
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/AlarmBox.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/AlarmBox.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/AlarmBox.tga" << endl;
@@ -931,7 +952,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ALARM_BOX, iTextureID));
 	}
 	// Load alarm light off
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/AlarmLight_Off.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/AlarmLight_Off.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/AlarmLight_Off.tga" << endl;
@@ -943,7 +964,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ALARM_LIGHT_OFF, iTextureID));
 	}
 	// Load alarm light on
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/AlarmLight_On.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/AlarmLight_On.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/AlarmLight_On.tga" << endl;
@@ -955,7 +976,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ALARM_LIGHT_ON, iTextureID));
 	}
 	// Load up switch (off)
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Switch_Up_Off.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Switch_Up_Off.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Switch_Up_Off.tga" << endl;
@@ -967,7 +988,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SWITCH_UP_OFF, iTextureID));
 	}
 	// Load up switch (on)
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Switch_Up_On.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Switch_Up_On.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Switch_Up_On.tga" << endl;
@@ -979,7 +1000,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SWITCH_UP_ON, iTextureID));
 	}
 	// Load left switch (off)
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Switch_Left_Off.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Switch_Left_Off.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Switch_Left_Off.tga" << endl;
@@ -991,7 +1012,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SWITCH_LEFT_OFF, iTextureID));
 	}
 	// Load left switch (on)
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Switch_Left_On.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Switch_Left_On.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Switch_Left_On.tga" << endl;
@@ -1003,7 +1024,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SWITCH_LEFT_ON, iTextureID));
 	}
 	// Load right switch (off)
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Switch_Right_Off.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Switch_Right_Off.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Switch_Right_Off.tga" << endl;
@@ -1015,7 +1036,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SWITCH_RIGHT_OFF, iTextureID));
 	}
 	// Load right switch (on)
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Switch_Right_On.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Switch_Right_On.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Switch_Right_On.tga" << endl;
@@ -1027,7 +1048,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(SWITCH_RIGHT_ON, iTextureID));
 	}
 	// Load purple key
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Key_Purple.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Key_Purple.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Key_Purple.tga" << endl;
@@ -1039,7 +1060,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(KEY_PURPLE, iTextureID));
 	}
 	// Load cyan key
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Key_Cyan.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Key_Cyan.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Key_Cyan.tga" << endl;
@@ -1051,7 +1072,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(KEY_CYAN, iTextureID));
 	}
 	// Load the exit texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/Scene2D_Exit.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/Scene2D_Exit.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/Scene2D_Exit.tga" << endl;
@@ -1067,7 +1088,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	/// Snow Planet Interactables
 	/// </summary>
 	// Load the ropetop texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/ropetop.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/ropetop.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/ropetop.tga" << endl;
@@ -1079,7 +1100,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_TOP_ICE, iTextureID));
 	}
 	//Load the rope middle texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/ropemiddle.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/ropemiddle.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/ropemiddle.tga" << endl;
@@ -1091,7 +1112,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_MIDDLE_ICE, iTextureID));
 	}
 	//Load the rope bottom texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/ropebottom.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/ropebottom.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/ropebottom.tga" << endl;
@@ -1103,7 +1124,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ROPE_BOTTOM_ICE, iTextureID));
 	}
 	//Load the water texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/water.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/water.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/water.tga" << endl;
@@ -1115,7 +1136,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(WATER, iTextureID));
 	}
 	//Load the water top texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/watertop.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/watertop.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/watertop.tga" << endl;
@@ -1130,7 +1151,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	/// <summary>
 	/// Terrestrial Planet Solid Blocks
 	/// </summary>
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Ground.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Ground.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Ground.tga" << endl;
@@ -1142,7 +1163,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GROUND_TILE_SOLID, iTextureID));
 	}
 	// Load the yellow tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Yellow.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Yellow.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Yellow.tga" << endl;
@@ -1154,7 +1175,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(YELLOW_TILE_SOLID, iTextureID));
 	}
 	// Load the red tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Red.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Red.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Red.tga" << endl;
@@ -1166,7 +1187,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(RED_TILE_SOLID, iTextureID));
 	}
 	// Load the green tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Green.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Green.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Green.tga" << endl;
@@ -1178,7 +1199,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GREEN_TILE_SOLID, iTextureID));
 	}
 	// Load the blue tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Blue.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Blue.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Blue.tga" << endl;
@@ -1190,7 +1211,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(BLUE_TILE_SOLID, iTextureID));
 	}
 	// Load the brown tile texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Brown_Solid.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Brown_Solid.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Brown_Solid.tga" << endl;
@@ -1202,7 +1223,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(BROWN_TILE_SOLID, iTextureID));
 	}
 	// Load the ground wire corner bottom left texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_BotL.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_BotL.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_BotL.tga" << endl;
@@ -1214,7 +1235,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GROUND_WIRE_CORNER_BOT_L, iTextureID));
 	}
 	// Load the ground wire corner bottom right texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_BotR.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_BotR.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_BotR.tga" << endl;
@@ -1226,7 +1247,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GROUND_WIRE_CORNER_BOT_R, iTextureID));
 	}
 	// Load the ground wire corner top left texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_TopL.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_TopL.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_TopL.tga" << endl;
@@ -1238,7 +1259,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GROUND_WIRE_CORNER_TOP_L, iTextureID));
 	}
 	// Load the ground wire corner top right texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_TopR.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_TopR.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Ground_Wire_Corner_TopR.tga" << endl;
@@ -1250,7 +1271,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GROUND_WIRE_CORNER_TOP_R, iTextureID));
 	}
 	// Load the ground wire length horizontal texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Ground_Wire_Length_Hor.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Ground_Wire_Length_Hor.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Ground_Wire_Length_Hor.tga" << endl;
@@ -1262,7 +1283,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GROUND_WIRE_LENGTH_HOR, iTextureID));
 	}
 	// Load the ground wire length vertical texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Tile_Ground_Wire_Length_Ver.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Tile_Ground_Wire_Length_Ver.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Tile_Ground_Wire_Length_Ver.tga" << endl;
@@ -1274,7 +1295,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(GROUND_WIRE_LENGTH_VER, iTextureID));
 	}
 	// Load the purple locked door texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Door_Locked_Purple.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Door_Locked_Purple.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Door_Locked_Purple.tga" << endl;
@@ -1286,7 +1307,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(DOOR_LOCKED_PURPLE, iTextureID));
 	}
 	// Load the cyan locked door texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Door_Locked_Cyan.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Door_Locked_Cyan.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/Door_Locked_Cyan.tga" << endl;
@@ -1302,7 +1323,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	/// Snow Planet Solid Blocks
 	/// </summary>
 	//Load the snowtop texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/snowTop.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/snowTop.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/snowTop.tga" << endl;
@@ -1314,7 +1335,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(TOP_SNOW, iTextureID));
 	}
 	//Load the snowleft texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/snowLeft.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/snowLeft.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/snowLeft.tga" << endl;
@@ -1326,7 +1347,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(LEFT_SNOW, iTextureID));
 	}
 	//Load the snowright texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/snowRight.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/snowRight.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/snowRight.tga" << endl;
@@ -1338,7 +1359,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(RIGHT_SNOW, iTextureID));
 	}
 	//Load the snowbot texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/snowBot.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/snowBot.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/snowBot.tga" << endl;
@@ -1350,7 +1371,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(BOTTOM_SNOW, iTextureID));
 	}
 	//Load the no snow texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/snowblock.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/snowblock.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/snowblock.tga" << endl;
@@ -1362,7 +1383,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(NO_SNOW, iTextureID));
 	}
 	//Load the ice texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/ice.tga", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/ice.tga", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/ice.tga" << endl;
@@ -1374,7 +1395,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 		MapOfTextureIDs.insert(pair<int, int>(ICE, iTextureID));
 	}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/sign.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/sign.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/sign.tga" << endl;
@@ -1386,7 +1407,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNINTRO1, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/sign.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/sign.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/sign.tga" << endl;
@@ -1398,7 +1419,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNINTRO2, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/sign.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/sign.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/sign.tga" << endl;
@@ -1410,7 +1431,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNINTRO3, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/sign.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/sign.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/sign.tga" << endl;
@@ -1422,7 +1443,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNINTRO4, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/sign.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/sign.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/sign.tga" << endl;
@@ -1434,7 +1455,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNINTRO5, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/signteach.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/signteach.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/signteach.tga" << endl;
@@ -1446,7 +1467,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNTUT1, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/signteach.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/signteach.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/signteach.tga" << endl;
@@ -1458,7 +1479,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNTUT2, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/signteach.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/signteach.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/signteach.tga" << endl;
@@ -1470,7 +1491,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNTUT3, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/signteach.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/signteach.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/signteach.tga" << endl;
@@ -1482,7 +1503,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	//	MapOfTextureIDs.insert(pair<int, int>(SIGNTUT4, iTextureID));
 	//}
 	////Load the sign texture
-	//iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/signteach.tga", true);
+	//iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/signteach.tga", true);
 	//if (iTextureID == 0)
 	//{
 	//	cout << "Unable to load Image/SnowPlanet/signteach.tga" << endl;
@@ -1539,6 +1560,8 @@ void CMap2D::PreRender(void)
  */
 void CMap2D::Render(void)
 {
+	PROFILE_SCOPE("CMap2D::Render");
+
 	// get matrix's uniform location and set matrix
 	unsigned int transformLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
 	glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
@@ -1676,7 +1699,20 @@ int CMap2D::GetMapInfo(const unsigned int uiRow, const int unsigned uiCol, const
  */ 
 bool CMap2D::LoadMap(string filename, const unsigned int uiCurLevel)
 {
-	doc = rapidcsv::Document(FileSystem::getPath(filename).c_str());
+	PROFILE_SCOPE_DETAIL("CMap2D::LoadMap", "asset", filename);
+
+	// Read the map from the asset archive if it is in it, or else from its file
+	CAsset cAsset;
+	if (CAssetArchive::GetInstance()->Read(filename, cAsset))
+	{
+		CAssetStreamBuf cAssetStreamBuf(cAsset);
+		std::istream assetStream(&cAssetStreamBuf);
+		doc = rapidcsv::Document(assetStream);
+	}
+	else
+	{
+		doc = rapidcsv::Document(FileSystem::getPath(filename).c_str());
+	}
 
 	// Check if the sizes of CSV data matches the declared arrMapInfo sizes
 	if ((cSettings->NUM_TILES_XAXIS != (unsigned int)doc.GetColumnCount()) ||
@@ -1699,9 +1735,32 @@ bool CMap2D::LoadMap(string filename, const unsigned int uiCurLevel)
 		}
 	}
 
+	if (uiSpawnMultiple > 1)
+	{
+		unsigned int uiNumCopies = MultiplySpawnTiles(uiCurLevel, uiSpawnMultiple);
+		cout << "CMap2D::LoadMap: Added " << uiNumCopies << " enemies to " << filename << endl;
+	}
+
 	return true;
 }
 
+/**
+ @brief Set how many of each enemy the maps which are loaded after this spawn, e.g. to stress a scenario benchmark
+ @param uiMultiple A const unsigned int containing the number of each enemy. 1 loads the maps as they are
+ */
+void CMap2D::SetSpawnMultiple(const unsigned int uiMultiple)
+{
+	uiSpawnMultiple = (uiMultiple > 0) ? uiMultiple : 1;
+}
+
+/**
+ @brief Get how many of each enemy the maps spawn
+ */
+unsigned int CMap2D::GetSpawnMultiple(void) const
+{
+	return uiSpawnMultiple;
+}
+
 int CMap2D::GetNumRows()
 {
 	return cSettings->NUM_TILES_YAXIS;
@@ -1800,6 +1859,8 @@ bool CMap2D::ReplaceTiles(unsigned int currTextureID, unsigned int newTextureID,
  */
 bool CMap2D::SaveMap(string filename, const unsigned int uiCurLevel)
 {
+	PROFILE_SCOPE_DETAIL("CMap2D::SaveMap", "io", filename);
+
 	// Update the rapidcsv::Document from arrMapInfo
 	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
 	{
@@ -1887,6 +1948,8 @@ unsigned int CMap2D::GetCurrentLevel(void) const
 
 std::vector<glm::vec2> CMap2D::PathFind(const glm::vec2& startPos, const glm::vec2& targetPos, HeuristicFunction heuristicFunc, int weight)
 {
+	PROFILE_SCOPE("CMap2D::PathFind");
+
 	// Check if the startPos and targetPost are blocked
 	if (isBlocked(startPos.y, startPos.x) ||
 		(isBlocked(targetPos.y, targetPos.x)))
@@ -1975,6 +2038,90 @@ void CMap2D::SetDiagonalMovement(const bool bEnable)
 	m_nrOfDirections = (bEnable) ? 8 : 4;
 }
 
+bool CMap2D::GetDiagonalMovement(void) const
+{
+	return (m_nrOfDirections == 8);
+}
+
+/**
+ @brief Copy the blocked state of every tile in the current level
+ @param vBlockedGrid A std::vector<bool>& which is resized and filled in, indexed by ConvertTo1D
+ */
+void CMap2D::GetBlockedGrid(std::vector<bool>& vBlockedGrid) const
+{
+	vBlockedGrid.resize(cSettings->NUM_TILES_YAXIS * cSettings->NUM_TILES_XAXIS);
+	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
+	{
+		for (unsigned int uiCol = 0; uiCol < cSettings->NUM_TILES_XAXIS; uiCol++)
+		{
+			vBlockedGrid[uiRow * cSettings->NUM_TILES_XAXIS + uiCol] = isBlocked(uiRow, uiCol);
+		}
+	}
+}
+
+/**
+ @brief Copy the spawn tile of each enemy of a level into the empty tiles beside it, in the same row, so that
+		the enemy is created that many times. The copies are put in the nearest empty tiles on alternate sides,
+		and do not go past a solid tile, so they are in the same area as the enemy
+ @param uiLevel A const unsigned int containing the level to change
+ @param uiMultiple A const unsigned int containing the number of each enemy, including the one in the map
+ @return The number of spawn tiles which were added
+ */
+unsigned int CMap2D::MultiplySpawnTiles(const unsigned int uiLevel, const unsigned int uiMultiple)
+{
+	const int iNumRows = (int)cSettings->NUM_TILES_YAXIS;
+	const int iNumCols = (int)cSettings->NUM_TILES_XAXIS;
+
+	// Find the spawn tiles first, so that the copies are not copied again
+	std::vector<glm::i32vec2> vSpawnTiles;
+	for (int iRow = 0; iRow < iNumRows; iRow++)
+	{
+		for (int iCol = 0; iCol < iNumCols; iCol++)
+		{
+			int iValue = arrMapInfo[uiLevel][iRow][iCol].value;
+			for (unsigned int i = 0; i < sizeof(iEnemySpawnTiles) / sizeof(iEnemySpawnTiles[0]); i++)
+			{
+				if (iValue == iEnemySpawnTiles[i])
+				{
+					vSpawnTiles.push_back(glm::i32vec2(iCol, iRow));
+					break;
+				}
+			}
+		}
+	}
+
+	unsigned int uiNumCopies = 0;
+	for (unsigned int i = 0; i < vSpawnTiles.size(); i++)
+	{
+		const int iRow = vSpawnTiles[i].y;
+		const int iValue = arrMapInfo[uiLevel][iRow][vSpawnTiles[i].x].value;
+		unsigned int uiCopies = 1;
+		// Each side is searched until it reaches a solid tile or the edge of the map
+		bool bSideOpen[2] = { true, true };
+		for (int iDistance = 1; (iDistance <= iMaxSpawnDistance) && (uiCopies < uiMultiple); iDistance++)
+		{
+			for (int iSide = 0; (iSide < 2) && (uiCopies < uiMultiple); iSide++)
+			{
+				if (bSideOpen[iSide] == false)
+					continue;
+				int iCol = vSpawnTiles[i].x + ((iSide == 0) ? iDistance : -iDistance);
+				if ((iCol < 0) || (iCol >= iNumCols) || (arrMapInfo[uiLevel][iRow][iCol].value >= 600))
+				{
+					bSideOpen[iSide] = false;
+					continue;
+				}
+				if (arrMapInfo[uiLevel][iRow][iCol].value == 0)
+				{
+					arrMapInfo[uiLevel][iRow][iCol].value = iValue;
+					uiCopies++;
+					uiNumCopies++;
+				}
+			}
+		}
+	}
+	return uiNumCopies;
+}
+
 /**
  @brief Render a tile at a position based on its tile index
  @param iRow A const int variable containing the row index of the tile
@@ -1990,6 +2137,7 @@ void CMap2D::RenderTile(const unsigned int uiRow, const unsigned int uiCol)
 			(arrMapInfo[uiCurLevel][uiRow][uiCol].value > 499) )
 		{
 			glBindTexture(GL_TEXTURE_2D, MapOfTextureIDs.at(arrMapInfo[uiCurLevel][uiRow][uiCol].value));
+			RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 			glBindVertexArray(VAO);
 			//CS: Render the tile
@@ -2107,7 +2255,7 @@ bool CMap2D::ResetAStarLists(void)
 
 bool CMap2D::findTilesForShip()
 {
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipWallInt.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipWallInt.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipWallInt.png" << endl;
@@ -2118,7 +2266,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1210, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipWallExt.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipWallExt.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipWallExt.png" << endl;
@@ -2129,7 +2277,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1217, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipCorner1.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipCorner1.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipCorner1.png" << endl;
@@ -2140,7 +2288,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1211, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipCorner2.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipCorner2.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipCorner2.png" << endl;
@@ -2151,7 +2299,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1212, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipCorner3.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipCorner3.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipCorner3.png" << endl;
@@ -2162,7 +2310,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1213, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipCorner4.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipCorner4.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipCorner4.png" << endl;
@@ -2173,7 +2321,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1214, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipWallIntLeft.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipWallIntLeft.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipWallIntLeft.png" << endl;
@@ -2184,7 +2332,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1215, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/DoorClosed.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/DoorClosed.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/DoorClosed.png" << endl;
@@ -2195,7 +2343,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1216, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipWallExt.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipWallExt.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipWallExt.png" << endl;
@@ -2206,7 +2354,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1217, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipWallIntRight.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipWallIntRight.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipWallIntRight.png" << endl;
@@ -2217,7 +2365,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1218, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/floorTile.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/floorTile.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/floorTile.png" << endl;
@@ -2228,7 +2376,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(598, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/floorTile_Danger.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/floorTile_Danger.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/floorTile_Danger.png" << endl;
@@ -2239,7 +2387,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(590, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/floorTileBroke.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/floorTileBroke.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/floorTileBroke.png" << endl;
@@ -2250,7 +2398,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(597, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/StorageBox.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/StorageBox.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/StorageBox.png" << endl;
@@ -2261,7 +2409,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1219, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/ShipController.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/ShipController.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/ShipController.png" << endl;
@@ -2272,7 +2420,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1220, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/WeaponController.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/WeaponController.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/WeaponController.png" << endl;
@@ -2283,7 +2431,7 @@ bool CMap2D::findTilesForShip()
 		// Store the texture ID into MapOfTextureIDs
 		MapOfTextureIDs.insert(pair<int, int>(1221, iTextureID));
 	}
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ShipCombat/DoorOpen.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ShipCombat/DoorOpen.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/DoorOpen.png" << endl;
@@ -2295,7 +2443,7 @@ bool CMap2D::findTilesForShip()
 		MapOfTextureIDs.insert(pair<int, int>(1222, iTextureID));
 	}
 
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/GUI/alert.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/GUI/alert.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/ShipCombat/alert.png" << endl;
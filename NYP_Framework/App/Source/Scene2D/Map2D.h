@@ -7,7 +7,7 @@
 #pragma once
 
 // Include SingletonTemplate
-#include "DesignPatterns\SingletonTemplate.h"
+#include "DesignPatterns/SingletonTemplate.h"
 
 // Include GLEW
 #ifndef GLEW_STATIC
@@ -26,7 +26,7 @@
 #include <map>
 
 // Include Settings
-#include "GameControl\Settings.h"
+#include "GameControl/Settings.h"
 
 // Include Entity2D
 #include "Primitives/Entity2D.h"
@@ -257,11 +257,16 @@ public:
 	int GetMapInfo(const unsigned int uiRow, const unsigned int uiCol, const bool bInvert = true) const;
 
 	//find position by tile index
-	glm::vec2 CMap2D::GetTilePosition(const int tileIndex, const bool bInvert = true);
+	glm::vec2 GetTilePosition(const int tileIndex, const bool bInvert = true);
 
 	// Load a map
 	bool LoadMap(string filename, const unsigned int uiLevel = 0);
 
+	// Set how many of each enemy the maps which are loaded after this spawn, e.g. to stress a scenario benchmark
+	void SetSpawnMultiple(const unsigned int uiMultiple);
+	// Get how many of each enemy the maps spawn
+	unsigned int GetSpawnMultiple(void) const;
+
 	// Get the number of rows and columns in the map
 	int GetNumRows();
 	int GetNumCols();
@@ -290,6 +295,10 @@ public:
 	std::vector<glm::vec2> PathFind(const glm::vec2& startPos, const glm::vec2& targetPos, HeuristicFunction heuristicFunc, int weight = 1);
 	// Set if AStar PathFinding will consider diagonal movements
 	void SetDiagonalMovement(const bool bEnable);
+	// Get if AStar PathFinding will consider diagonal movements
+	bool GetDiagonalMovement(void) const;
+	// Copy the blocked state of every tile in the current level, indexed the same way as the AStar lists
+	void GetBlockedGrid(std::vector<bool>& vBlockedGrid) const;
 	// Print out details about this class instance in the console window
 	void PrintSelf(void) const;
 
@@ -305,6 +314,8 @@ protected:
 	unsigned int uiCurLevel;
 	// The number of levels
 	unsigned int uiNumLevels;
+	// The number of each enemy which LoadMap spawns. 1 loads the maps as they are
+	unsigned int uiSpawnMultiple;
 	
 	// The handler containing the instance of the camera
 	Camera2D* camera2D;
@@ -327,6 +338,9 @@ protected:
 	// Render a tile
 	void RenderTile(const unsigned int uiRow, const unsigned int uiCol);
 
+	// Copy the spawn tile of each enemy of a level into the empty tiles beside it
+	unsigned int MultiplySpawnTiles(const unsigned int uiLevel, const unsigned int uiMultiple);
+
 	// For A-Star PathFinding
 	// Build a path from m_cameFromList after calling PathFind()
 	std::vector<glm::vec2> BuildPath() const;
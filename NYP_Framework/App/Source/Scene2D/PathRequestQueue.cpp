@@ -0,0 +1,566 @@
+/**
+ CPathRequestQueue
+ @brief A class which queues AStar path requests from the enemies and processes them under a per-frame time budget
+ */
+#include "PathRequestQueue.h"
+
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CPathRequestQueue::CPathRequestQueue(void)
+	: cMap2D(NULL)
+	, uiNextTicket(INVALID_TICKET + 1)
+	, uiNextJobID(0)
+	, ullFrameCount(0)
+	, llBudgetMicroseconds(1000)
+	, bUseWorkerThread(false)
+	, dTotalLatencyMs(0.0)
+	, ullTotalLatencyFrames(0)
+	, bWorkerFrameReady(false)
+	, bStopWorker(false)
+{
+	m_directions = { { -1, 0 }, { 1, 0 }, { 0, 1 }, { 0, -1 },
+						{ -1, -1 }, { 1, 1 }, { -1, 1 }, { 1, -1 } };
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CPathRequestQueue::~CPathRequestQueue(void)
+{
+	// Stop the worker thread before the lists are destroyed
+	StopWorker();
+
+	Clear();
+
+	// We won't delete this since it was created elsewhere
+	cMap2D = NULL;
+}
+
+/**
+ @brief Init Initialise this instance
+ @param llBudgetMicroseconds A const long long containing the time allowed for solving paths in each frame
+ @param bUseWorkerThread A const bool which is true if the paths are to be solved on a worker thread
+ */
+bool CPathRequestQueue::Init(const long long llBudgetMicroseconds, const bool bUseWorkerThread)
+{
+	// Get the handler to the CMap2D instance
+	cMap2D = CMap2D::GetInstance();
+
+	Clear();
+
+	ullFrameCount = 0;
+	sStats = SPathQueueStats();
+	dTotalLatencyMs = 0.0;
+	ullTotalLatencyFrames = 0;
+
+	SetBudget(llBudgetMicroseconds);
+	SetUseWorkerThread(bUseWorkerThread);
+
+	return true;
+}
+
+/**
+ @brief Update the map snapshot and solve the queued requests for this frame. The map is not copied when
+		there are no requests waiting to be solved
+ */
+void CPathRequestQueue::Update(void)
+{
+	if (bUseWorkerThread)
+	{
+		// Hand a fresh snapshot to the worker and let it solve this frame's share of requests
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			ullFrameCount++;
+			if (queueJobIDs.empty())
+				return;
+			bWorkerFrameReady = true;
+		}
+		workerCondition.notify_one();
+	}
+	else
+	{
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			ullFrameCount++;
+			if (queueJobIDs.empty())
+				return;
+			TakeSnapshot();
+			std::swap(sSnapshot, sNextSnapshot);
+		}
+		ProcessJobs();
+	}
+}
+
+/**
+ @brief Submit a path request
+ @param startPos A const glm::vec2& containing the start position
+ @param targetPos A const glm::vec2& containing the target position
+ @param heuristicFunc A HeuristicFunction to estimate the remaining distance
+ @param weight An int containing the weight of the heuristic
+ @return The ticket to collect the path with
+ */
+unsigned int CPathRequestQueue::Submit(const glm::vec2& startPos, const glm::vec2& targetPos, HeuristicFunction heuristicFunc, int weight)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+
+	unsigned int uiTicket = uiNextTicket++;
+	if (uiNextTicket == INVALID_TICKET)
+		uiNextTicket++;
+	sStats.uiSubmitted++;
+
+	// Share a query which has the same start, target and heuristic and has not been solved yet
+	for (std::map<unsigned int, SPathJob>::iterator it = mapJobs.begin(); it != mapJobs.end(); ++it)
+	{
+		if ((it->second.bDone == false) &&
+			(it->second.startPos == startPos) &&
+			(it->second.targetPos == targetPos) &&
+			(IsSameHeuristic(it->second.heuristic, heuristicFunc)) &&
+			(it->second.weight == weight))
+		{
+			it->second.uiNumTickets++;
+			mapTickets[uiTicket] = it->first;
+			sStats.uiDeduplicated++;
+			return uiTicket;
+		}
+	}
+
+	// Otherwise queue up a new query
+	SPathJob sJob;
+	sJob.startPos = startPos;
+	sJob.targetPos = targetPos;
+	sJob.heuristic = heuristicFunc;
+	sJob.weight = weight;
+	sJob.uiNumTickets = 1;
+	sJob.bDone = false;
+	sJob.submitTime = Clock::now();
+	sJob.ullSubmitFrame = ullFrameCount;
+
+	unsigned int uiJobID = uiNextJobID++;
+	mapJobs[uiJobID] = sJob;
+	queueJobIDs.push_back(uiJobID);
+	mapTickets[uiTicket] = uiJobID;
+
+	return uiTicket;
+}
+
+/**
+ @brief Check if the path for a ticket has been found
+ @param uiTicket A const unsigned int containing the ticket
+ */
+bool CPathRequestQueue::IsReady(const unsigned int uiTicket)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+
+	std::map<unsigned int, unsigned int>::iterator itTicket = mapTickets.find(uiTicket);
+	if (itTicket == mapTickets.end())
+		return false;
+
+	return mapJobs[itTicket->second].bDone;
+}
+
+/**
+ @brief Collect the path for a ticket. The ticket is released once collected
+ @param uiTicket A const unsigned int containing the ticket
+ @param path A std::vector<glm::vec2>& to store the path in
+ @return true if the path was ready, otherwise false
+ */
+bool CPathRequestQueue::GetResult(const unsigned int uiTicket, std::vector<glm::vec2>& path)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+
+	std::map<unsigned int, unsigned int>::iterator itTicket = mapTickets.find(uiTicket);
+	if (itTicket == mapTickets.end())
+		return false;
+
+	SPathJob& sJob = mapJobs[itTicket->second];
+	if (sJob.bDone == false)
+		return false;
+
+	path = sJob.path;
+	ReleaseTicket(itTicket);
+	return true;
+}
+
+/**
+ @brief Cancel a ticket which is no longer needed
+ @param uiTicket A const unsigned int containing the ticket
+ */
+void CPathRequestQueue::Cancel(const unsigned int uiTicket)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+
+	std::map<unsigned int, unsigned int>::iterator itTicket = mapTickets.find(uiTicket);
+	if (itTicket == mapTickets.end())
+		return;
+
+	ReleaseTicket(itTicket);
+}
+
+/**
+ @brief Remove all requests
+ */
+void CPathRequestQueue::Clear(void)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+
+	mapJobs.clear();
+	queueJobIDs.clear();
+	mapTickets.clear();
+}
+
+/**
+ @brief Set the time allowed for solving paths in each frame
+ @param llBudgetMicroseconds A const long long containing the budget in microseconds
+ */
+void CPathRequestQueue::SetBudget(const long long llBudgetMicroseconds)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+
+	if (llBudgetMicroseconds <= 0)
+	{
+		cout << "CPathRequestQueue::SetBudget() : budget must be more than 0" << endl;
+		return;
+	}
+	this->llBudgetMicroseconds = llBudgetMicroseconds;
+}
+
+long long CPathRequestQueue::GetBudget(void) const
+{
+	return llBudgetMicroseconds;
+}
+
+/**
+ @brief Set if the paths are solved on a worker thread
+ @param bUseWorkerThread A const bool which is true to use the worker thread
+ */
+void CPathRequestQueue::SetUseWorkerThread(const bool bUseWorkerThread)
+{
+	if (this->bUseWorkerThread == bUseWorkerThread)
+		return;
+
+	if (bUseWorkerThread)
+	{
+		this->bUseWorkerThread = true;
+		StartWorker();
+	}
+	else
+	{
+		StopWorker();
+		this->bUseWorkerThread = false;
+	}
+}
+
+bool CPathRequestQueue::GetUseWorkerThread(void) const
+{
+	return bUseWorkerThread;
+}
+
+/**
+ @brief Get the statistics of this queue
+ */
+SPathQueueStats CPathRequestQueue::GetStats(void)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+
+	sStats.uiPending = (unsigned int)queueJobIDs.size();
+	return sStats;
+}
+
+/**
+ @brief Print out details about this class instance in the console
+ */
+void CPathRequestQueue::PrintSelf(void)
+{
+	SPathQueueStats sCurrentStats = GetStats();
+
+	cout << endl << "CPathRequestQueue::PrintSelf()" << endl;
+	cout << "Budget: " << llBudgetMicroseconds << "us, worker thread: " << (bUseWorkerThread ? "on" : "off") << endl;
+	cout << "Submitted: " << sCurrentStats.uiSubmitted
+		<< ", deduplicated: " << sCurrentStats.uiDeduplicated
+		<< ", completed: " << sCurrentStats.uiCompleted
+		<< ", cancelled: " << sCurrentStats.uiCancelled
+		<< ", pending: " << sCurrentStats.uiPending << endl;
+	cout << "Last frame: " << sCurrentStats.uiLastFrameSolved << " solved in "
+		<< sCurrentStats.dLastFrameMicroseconds << "us" << endl;
+	cout << "Latency: average " << sCurrentStats.dAverageLatencyMs << "ms ("
+		<< sCurrentStats.dAverageLatencyFrames << " frames), max "
+		<< sCurrentStats.dMaxLatencyMs << "ms (" << sCurrentStats.uiMaxLatencyFrames << " frames)" << endl;
+	cout << "===== CPathRequestQueue::PrintSelf() =====" << endl;
+}
+
+/**
+ @brief Copy the blocked tiles of the current level into sNextSnapshot. Called with queueMutex held
+ */
+void CPathRequestQueue::TakeSnapshot(void)
+{
+	sNextSnapshot.uiNumRows = cMap2D->GetNumRows();
+	sNextSnapshot.uiNumCols = cMap2D->GetNumCols();
+	sNextSnapshot.uiNrOfDirections = cMap2D->GetDiagonalMovement() ? 8 : 4;
+	cMap2D->GetBlockedGrid(sNextSnapshot.vBlocked);
+}
+
+/**
+ @brief Solve queued requests until the budget runs out. At least one request is solved per call
+ @return The number of queries solved
+ */
+unsigned int CPathRequestQueue::ProcessJobs(void)
+{
+	Clock::time_point startTime = Clock::now();
+	unsigned int uiNumSolved = 0;
+
+	while (true)
+	{
+		SPathJob sJob;
+		unsigned int uiJobID;
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+
+			if (queueJobIDs.empty())
+				break;
+
+			long long llElapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime).count();
+			if ((uiNumSolved > 0) && (llElapsed >= llBudgetMicroseconds))
+				break;
+
+			uiJobID = queueJobIDs.front();
+			queueJobIDs.pop_front();
+
+			std::map<unsigned int, SPathJob>::iterator itJob = mapJobs.find(uiJobID);
+			// Skip queries whose tickets were all cancelled
+			if (itJob == mapJobs.end())
+				continue;
+
+			sJob.startPos = itJob->second.startPos;
+			sJob.targetPos = itJob->second.targetPos;
+			sJob.heuristic = itJob->second.heuristic;
+			sJob.weight = itJob->second.weight;
+		}
+
+		// Solve without holding the lock so that enemies can keep submitting
+		std::vector<glm::vec2> path = Solve(sJob);
+		uiNumSolved++;
+
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+
+			std::map<unsigned int, SPathJob>::iterator itJob = mapJobs.find(uiJobID);
+			if (itJob == mapJobs.end())
+				continue;
+
+			itJob->second.path = path;
+			itJob->second.bDone = true;
+
+			// Update the latency statistics
+			double dLatencyMs = std::chrono::duration<double, std::milli>(Clock::now() - itJob->second.submitTime).count();
+			unsigned int uiLatencyFrames = (unsigned int)(ullFrameCount - itJob->second.ullSubmitFrame);
+			sStats.uiCompleted++;
+			dTotalLatencyMs += dLatencyMs;
+			ullTotalLatencyFrames += uiLatencyFrames;
+			sStats.dAverageLatencyMs = dTotalLatencyMs / sStats.uiCompleted;
+			sStats.dAverageLatencyFrames = (double)ullTotalLatencyFrames / sStats.uiCompleted;
+			sStats.dMaxLatencyMs = max(sStats.dMaxLatencyMs, dLatencyMs);
+			sStats.uiMaxLatencyFrames = max(sStats.uiMaxLatencyFrames, uiLatencyFrames);
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(queueMutex);
+	sStats.uiLastFrameSolved = uiNumSolved;
+	sStats.dLastFrameMicroseconds = std::chrono::duration<double, std::micro>(Clock::now() - startTime).count();
+
+	return uiNumSolved;
+}
+
+/**
+ @brief Find a path on sSnapshot. This follows CMap2D::PathFind and CMap2D::BuildPath
+ @param sJob A const SPathJob& containing the query
+ @return The path from the start to the target, or an empty path if there is none
+ */
+std::vector<glm::vec2> CPathRequestQueue::Solve(const SPathJob& sJob)
+{
+	std::vector<glm::vec2> path;
+
+	const unsigned int uiNumCols = sSnapshot.uiNumCols;
+	const unsigned int uiNumRows = sSnapshot.uiNumRows;
+	const glm::vec2 startPos = sJob.startPos;
+	const glm::vec2 targetPos = sJob.targetPos;
+
+	auto isValid = [&](const glm::vec2& pos) {
+		return (pos.x >= 0) && (pos.x < uiNumCols) && (pos.y >= 0) && (pos.y < uiNumRows);
+	};
+	auto convertTo1D = [&](const glm::vec2& pos) {
+		return (int)((pos.y * uiNumCols) + pos.x);
+	};
+
+	// Check if the startPos and targetPos are valid and not blocked
+	if (!isValid(startPos) || !isValid(targetPos) ||
+		sSnapshot.vBlocked[convertTo1D(startPos)] ||
+		sSnapshot.vBlocked[convertTo1D(targetPos)])
+	{
+		// Return an empty path
+		return path;
+	}
+
+	// Reset AStar lists
+	while (m_openList.size() != 0)
+		m_openList.pop();
+	m_closedList.assign(uiNumRows * uiNumCols, false);
+	m_cameFromList.assign(uiNumRows * uiNumCols, Grid());
+
+	// Add the start pos to 2 lists
+	m_cameFromList[convertTo1D(startPos)].parent = startPos;
+	m_openList.push(Grid(startPos, 0));
+
+	unsigned int fNew, gNew, hNew;
+	glm::vec2 currentPos;
+
+	while (!m_openList.empty())
+	{
+		// Get the node with the least f value
+		currentPos = m_openList.top().pos;
+
+		// If the targetPos was reached, then quit this loop
+		if (currentPos == targetPos)
+			break;
+
+		m_openList.pop();
+		m_closedList[convertTo1D(currentPos)] = true;
+
+		// Check the neighbors of the current node
+		for (unsigned int i = 0; i < sSnapshot.uiNrOfDirections; ++i)
+		{
+			const glm::vec2 neighborPos = currentPos + m_directions[i];
+			if (!isValid(neighborPos))
+				continue;
+
+			const int neighborIndex = convertTo1D(neighborPos);
+			if (sSnapshot.vBlocked[neighborIndex] || m_closedList[neighborIndex] == true)
+				continue;
+
+			gNew = m_cameFromList[convertTo1D(currentPos)].g + 1;
+			hNew = sJob.heuristic(neighborPos, targetPos, sJob.weight);
+			fNew = gNew + hNew;
+
+			if (m_cameFromList[neighborIndex].f == 0 || fNew < m_cameFromList[neighborIndex].f)
+			{
+				m_openList.push(Grid(neighborPos, fNew));
+				m_cameFromList[neighborIndex] = { neighborPos, currentPos, fNew, gNew, hNew };
+			}
+		}
+	}
+
+	// Build the path by walking back from the targetPos
+	glm::vec2 pathPos = targetPos;
+	int pathIndex = convertTo1D(pathPos);
+	while (!(m_cameFromList[pathIndex].parent == pathPos))
+	{
+		path.push_back(pathPos);
+		pathPos = m_cameFromList[pathIndex].parent;
+		pathIndex = convertTo1D(pathPos);
+	}
+
+	// If the path has only 1 entry, then it is only valid if the startPos is next to the targetPos
+	if (path.size() == 1)
+	{
+		if (abs(targetPos.y - startPos.y) + abs(targetPos.x - startPos.x) > 1)
+			path.clear();
+	}
+	else
+		std::reverse(path.begin(), path.end());
+
+	return path;
+}
+
+/**
+ @brief Check if two heuristics are the same function, e.g. heuristic::manhattan. Heuristics which are not plain
+		functions, such as lambdas, cannot be compared, so they are never the same
+ @param heuristicA A const HeuristicFunction& containing the first heuristic
+ @param heuristicB A const HeuristicFunction& containing the second heuristic
+ */
+bool CPathRequestQueue::IsSameHeuristic(const HeuristicFunction& heuristicA, const HeuristicFunction& heuristicB)
+{
+	typedef unsigned int(*HeuristicPointer)(const glm::vec2&, const glm::vec2&, int);
+
+	const HeuristicPointer* pFunctionA = heuristicA.target<HeuristicPointer>();
+	const HeuristicPointer* pFunctionB = heuristicB.target<HeuristicPointer>();
+	if ((pFunctionA == NULL) || (pFunctionB == NULL))
+		return false;
+	return *pFunctionA == *pFunctionB;
+}
+
+/**
+ @brief Release a ticket from its query, removing the query once no tickets are left. Called with queueMutex held
+ @param itTicket An iterator to the ticket in mapTickets
+ */
+void CPathRequestQueue::ReleaseTicket(std::map<unsigned int, unsigned int>::iterator itTicket)
+{
+	std::map<unsigned int, SPathJob>::iterator itJob = mapJobs.find(itTicket->second);
+	mapTickets.erase(itTicket);
+
+	if (itJob == mapJobs.end())
+		return;
+
+	itJob->second.uiNumTickets--;
+	if (itJob->second.uiNumTickets == 0)
+	{
+		// A query still in queueJobIDs is skipped by ProcessJobs once it is gone from mapJobs
+		if (itJob->second.bDone == false)
+			sStats.uiCancelled++;
+		mapJobs.erase(itJob);
+	}
+}
+
+/**
+ @brief Start the worker thread
+ */
+void CPathRequestQueue::StartWorker(void)
+{
+	if (workerThread.joinable())
+		return;
+
+	bStopWorker = false;
+	bWorkerFrameReady = false;
+	workerThread = std::thread(&CPathRequestQueue::WorkerLoop, this);
+}
+
+/**
+ @brief Stop the worker thread and wait for it to finish its current query
+ */
+void CPathRequestQueue::StopWorker(void)
+{
+	if (!workerThread.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		bStopWorker = true;
+	}
+	workerCondition.notify_one();
+	workerThread.join();
+}
+
+/**
+ @brief The loop run by the worker thread. It solves one budget's worth of requests per frame
+ */
+void CPathRequestQueue::WorkerLoop(void)
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(queueMutex);
+			workerCondition.wait(lock, [this] { return bWorkerFrameReady || bStopWorker; });
+			if (bStopWorker)
+				return;
+
+			// Pick up the latest snapshot from the main thread
+			std::swap(sSnapshot, sNextSnapshot);
+			bWorkerFrameReady = false;
+		}
+
+		ProcessJobs();
+	}
+}
@@ -0,0 +1,180 @@
+/**
+ CPathRequestQueue
+ @brief A class which queues AStar path requests from the enemies and processes them under a per-frame time budget
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "DesignPatterns/SingletonTemplate.h"
+
+// Include GLM
+#include <includes/glm.hpp>
+
+// Include Map2D for the Grid and HeuristicFunction used by AStar
+#include "Map2D.h"
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// A copy of the blocked tiles of the current level, so paths can be found away from CMap2D
+struct SPathSnapshot {
+	unsigned int uiNumRows;
+	unsigned int uiNumCols;
+	unsigned int uiNrOfDirections;
+	// Blocked flag for each tile, indexed by (row * uiNumCols + col) with row 0 at the bottom
+	std::vector<bool> vBlocked;
+
+	SPathSnapshot()
+		: uiNumRows(0), uiNumCols(0), uiNrOfDirections(4) {}
+};
+
+// Statistics about the requests going through the queue
+struct SPathQueueStats {
+	unsigned int uiSubmitted;		// Number of tickets handed out
+	unsigned int uiDeduplicated;	// Number of tickets which shared a query with an earlier ticket
+	unsigned int uiCompleted;		// Number of queries which were solved
+	unsigned int uiCancelled;		// Number of queries dropped because all their tickets were cancelled
+	unsigned int uiPending;			// Number of queries still waiting to be solved
+	unsigned int uiLastFrameSolved;	// Number of queries solved in the last frame
+	double dLastFrameMicroseconds;	// Time spent solving queries in the last frame
+	double dAverageLatencyMs;		// Average time from submission to completion
+	double dMaxLatencyMs;			// Longest time from submission to completion
+	double dAverageLatencyFrames;	// Average number of frames from submission to completion
+	unsigned int uiMaxLatencyFrames;// Largest number of frames from submission to completion
+
+	SPathQueueStats()
+		: uiSubmitted(0), uiDeduplicated(0), uiCompleted(0), uiCancelled(0), uiPending(0)
+		, uiLastFrameSolved(0), dLastFrameMicroseconds(0.0)
+		, dAverageLatencyMs(0.0), dMaxLatencyMs(0.0)
+		, dAverageLatencyFrames(0.0), uiMaxLatencyFrames(0) {}
+};
+
+class CPathRequestQueue : public CSingletonTemplate<CPathRequestQueue>
+{
+	friend CSingletonTemplate<CPathRequestQueue>;
+public:
+	// A ticket with this value is not attached to any request
+	static const unsigned int INVALID_TICKET = 0;
+
+	// Init
+	bool Init(const long long llBudgetMicroseconds = 1000, const bool bUseWorkerThread = false);
+
+	// Update the map snapshot and solve the queued requests for this frame. Nothing is done if there are none
+	void Update(void);
+
+	// Submit a path request. Returns a ticket to collect the path with
+	unsigned int Submit(const glm::vec2& startPos, const glm::vec2& targetPos, HeuristicFunction heuristicFunc, int weight = 1);
+
+	// Check if the path for a ticket has been found
+	bool IsReady(const unsigned int uiTicket);
+
+	// Collect the path for a ticket. Returns false if it is not ready yet. The ticket is released once collected
+	bool GetResult(const unsigned int uiTicket, std::vector<glm::vec2>& path);
+
+	// Cancel a ticket which is no longer needed
+	void Cancel(const unsigned int uiTicket);
+
+	// Remove all requests, e.g. when the level changes
+	void Clear(void);
+
+	// Set the time allowed for solving paths in each frame, in microseconds
+	void SetBudget(const long long llBudgetMicroseconds);
+	long long GetBudget(void) const;
+
+	// Set if the paths are solved on a worker thread
+	void SetUseWorkerThread(const bool bUseWorkerThread);
+	bool GetUseWorkerThread(void) const;
+
+	// Get the statistics of this queue
+	SPathQueueStats GetStats(void);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
+protected:
+	typedef std::chrono::high_resolution_clock Clock;
+
+	// A query to be solved. Tickets with the same start and target share a query
+	struct SPathJob {
+		glm::vec2 startPos;
+		glm::vec2 targetPos;
+		HeuristicFunction heuristic;
+		int weight;
+		// Number of tickets waiting on this query
+		unsigned int uiNumTickets;
+		bool bDone;
+		std::vector<glm::vec2> path;
+		Clock::time_point submitTime;
+		unsigned long long ullSubmitFrame;
+	};
+
+	// Handler to the CMap2D instance
+	CMap2D* cMap2D;
+
+	// The queries, keyed by an internal job ID
+	std::map<unsigned int, SPathJob> mapJobs;
+	// The job IDs in the order they are to be solved
+	std::deque<unsigned int> queueJobIDs;
+	// The job ID for each ticket
+	std::map<unsigned int, unsigned int> mapTickets;
+
+	unsigned int uiNextTicket;
+	unsigned int uiNextJobID;
+	unsigned long long ullFrameCount;
+
+	long long llBudgetMicroseconds;
+	bool bUseWorkerThread;
+
+	// The map snapshot used by the solver, and the one prepared by the main thread for the next frame
+	SPathSnapshot sSnapshot;
+	SPathSnapshot sNextSnapshot;
+
+	// AStar lists used by the solver
+	std::priority_queue<Grid> m_openList;
+	std::vector<bool> m_closedList;
+	std::vector<Grid> m_cameFromList;
+	std::vector<glm::vec2> m_directions;
+
+	// Statistics
+	SPathQueueStats sStats;
+	double dTotalLatencyMs;
+	unsigned long long ullTotalLatencyFrames;
+
+	// Worker thread
+	std::thread workerThread;
+	std::mutex queueMutex;
+	std::condition_variable workerCondition;
+	bool bWorkerFrameReady;
+	bool bStopWorker;
+
+	// Constructor
+	CPathRequestQueue(void);
+
+	// Destructor
+	virtual ~CPathRequestQueue(void);
+
+	// Copy the blocked tiles of the current level into sNextSnapshot
+	void TakeSnapshot(void);
+
+	// Solve queued requests until the budget runs out. Returns the number of queries solved
+	unsigned int ProcessJobs(void);
+
+	// Find a path on sSnapshot. This follows CMap2D::PathFind
+	std::vector<glm::vec2> Solve(const SPathJob& sJob);
+
+	// Check if two heuristics are the same function, so that their queries can be shared
+	static bool IsSameHeuristic(const HeuristicFunction& heuristicA, const HeuristicFunction& heuristicB);
+
+	// Release a ticket from its query, removing the query once no tickets are left
+	void ReleaseTicket(std::map<unsigned int, unsigned int>::iterator itTicket);
+
+	// Start and stop the worker thread
+	void StartWorker(void);
+	void StopWorker(void);
+	void WorkerLoop(void);
+};
@@ -10,10 +10,12 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
@@ -31,6 +33,7 @@ CPlayer2D::CPlayer2D(void)
 	, runtimeColour(glm::vec4(1.0f))
 	, cSoundController(NULL)
 	, camera2D()
+	, cAmmoPool(64, true)
 {
 	transform = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
 
@@ -153,13 +156,10 @@ bool CPlayer2D::Init(void)
 	cPhysics2D.SetStatus(CPhysics2D::STATUS::FALL);
 	iJumpCount = 0;
 
-	//Construct 100 inactive ammo and add into ammoList
-	for (int i = 0; i < 100; ++i)
-	{
-		CAmmo2D* cAmmo2D = new CAmmo2D();
-		cAmmo2D->SetShader("Shader2D");
-		ammoList.push_back(cAmmo2D);
-	}
+	//Destroy the ammo of the planet before this Init, as it was set up for that planet, and reserve space for 100 ammo
+	cAmmoPool.Clear();
+	ammoList.clear();
+	cAmmoPool.Prewarm(100);
 	shootingDirection = RIGHT; //by default
 
 	//CS: Init the color to white
@@ -587,9 +587,9 @@ void CPlayer2D::Update(const double dElapsedTime)
 	}
 
 	//ammo beahviour
-	for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+	for (unsigned int i = 0; i < ammoList.size();)
 	{
-		CAmmo2D* ammo = (CAmmo2D*)*it;
+		CAmmo2D* ammo = ammoList[i];
 		if (ammo->getActive())
 		{
 			ammo->Update(dElapsedTime);
@@ -598,6 +598,18 @@ void CPlayer2D::Update(const double dElapsedTime)
 				ammo->setActive(false);
 			}
 		}
+
+		//return ammo which has hit something to the pool, including ammo deactivated by the scene
+		if (!ammo->getActive())
+		{
+			cAmmoPool.Release(ammo);
+			ammoList[i] = ammoList.back();
+			ammoList.pop_back();
+		}
+		else
+		{
+			++i;
+		}
 	}
 
 	if (shootingDirection == LEFT) {
@@ -677,12 +689,14 @@ void CPlayer2D::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, vec2NumMicroSteps, IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS * camera2D->getZoom();
-	actualPos.y += vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS * camera2D->getZoom();  
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS * camera2D->getZoom();
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS * camera2D->getZoom();  
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -699,6 +713,7 @@ void CPlayer2D::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
@@ -716,7 +731,7 @@ void CPlayer2D::PostRender(void)
 }
 
 //return ammolist to the scene for pre, post and normal rendering
-std::vector<CAmmo2D*> CPlayer2D::getAmmoList(void)
+const std::vector<CAmmo2D*>& CPlayer2D::getAmmoList(void) const
 {
 	return ammoList;
 }
@@ -1409,26 +1424,18 @@ int CPlayer2D::getPlayerAttackDirection()
 //called whenever an ammo is needed ot be shot
 CAmmo2D* CPlayer2D::FetchAmmo()
 {
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+	//reuse ammo which was fired before if there is any, else set up a new one
+	CAmmo2D* ammo = cAmmoPool.AcquireReleased();
+	if (ammo == nullptr)
 	{
-		CAmmo2D* ammo = (CAmmo2D*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// microsteps set to player's microsteps
-		ammo->vec2NumMicroSteps = vec2NumMicroSteps;
-		return ammo;
-	}
-
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CAmmo2D);
+		ammo = cAmmoPool.Acquire();
+		ammo->Init();
+		ammo->SetShader("Shader2D");
 	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
-
-}
+	ammo->Reset();
+	ammo->setActive(true);
+	// microsteps set to player's microsteps
+	ammo->vec2NumMicroSteps = vec2NumMicroSteps;
+	ammoList.push_back(ammo);
+	return ammo;
+}
\ No newline at end of file
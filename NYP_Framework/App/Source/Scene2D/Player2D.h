@@ -7,7 +7,7 @@
 #pragma once
 
  // Include Singleton template
-#include "DesignPatterns\SingletonTemplate.h"
+#include "DesignPatterns/SingletonTemplate.h"
 
 // Include GLEW
 #ifndef GLEW_STATIC
@@ -27,7 +27,7 @@
 class CMap2D;
 
 // Include Keyboard controller
-#include "Inputs\KeyboardController.h"
+#include "Inputs/KeyboardController.h"
 
 // Include AnimatedSprites
 #include "Primitives/SpriteAnimation.h"
@@ -45,11 +45,14 @@ class CMap2D;
 #include "InventoryManagerPlanet.h"
 
 // Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 //include ammo for firing
 #include "Ammo2D.h"
 
+// Include ObjectPool
+#include "DesignPatterns/ObjectPool.h"
+
 // Include Camera2D
 #include "Primitives/Camera2D.h"
 
@@ -80,7 +83,7 @@ public:
 	void PostRender(void);
 
 	//return ammolist to the scene for pre, post and normal rendering
-	std::vector<CAmmo2D*> getAmmoList(void);
+	const std::vector<CAmmo2D*>& getAmmoList(void) const;
 	int getShootingDirection(); //for placing burnable blocks in jungle planet
 
 	// Attacks
@@ -206,12 +209,14 @@ protected:
 	int attackDirection;
 	double attackTimer;
 	double maxAttackTimer;
+	//the pool which player's ammo is acquired from. The ammo which is released is kept set up for reuse
+	CObjectPool<CAmmo2D> cAmmoPool;
 	//vector full of player's fired ammo
 	std::vector<CAmmo2D*> ammoList;
 	int shootingDirection; //shoots in the direction the player is facing
 	int modeOfPlayer;
 
-	//used to get a deactivated ammo to activate
+	//used to get a new ammo from the pool to activate
 	CAmmo2D* FetchAmmo(void);
 
 private:
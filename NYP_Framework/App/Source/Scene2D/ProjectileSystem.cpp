@@ -0,0 +1,876 @@
+/**
+ CProjectileSystem
+ @brief A class which simulates and renders all of the enemy projectiles, keeping their state in parallel arrays
+ */
+#include "ProjectileSystem.h"
+
+#include <iostream>
+#include <climits>
+using namespace std;
+
+// Include Shader Manager
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
+
+// Include ImageLoader
+#include "System/ImageLoader.h"
+
+// Include CJobSystem
+#include "System/JobSystem.h"
+
+// Include MeshBuilder
+#include "Primitives/MeshBuilder.h"
+
+// Include Camera
+#include "Primitives/Camera2D.h"
+
+// Include the Map2D as we will use it to check the projectiles' movements
+#include "Map2D.h"
+
+// Include Player2D
+#include "Player2D.h"
+
+// Include InventoryManagerPlanet
+#include "InventoryManagerPlanet.h"
+
+// Include SoundController
+#include "../SoundController/SoundController.h"
+
+namespace
+{
+	// The number of projectiles to reserve space for, which is more than all the enemies of a level fire at once
+	const unsigned int uiInitialCapacity = 256;
+
+	// The number of projectiles moved by each job of the CJobSystem
+	const unsigned int uiIntegrateBatchSize = 128;
+
+	// The data of each type of projectile, in the order of CProjectileSystem::PROJECTILE_TYPE.
+	// The frames are listed in the order of LEFT, RIGHT, UP, DOWN
+	const CProjectileSystem::SProjectileType sProjectileTypes[CProjectileSystem::NUM_PROJECTILE_TYPES] =
+	{
+		// JUNGLE_POISON
+		{
+			"Image/JunglePlanet/EnemyAmmoSpriteSheet.png", 4, 7,
+			{ 21, 14, 7, 0 }, { 27, 20, 13, 6 },
+			2, false,
+			610, INT_MAX, CProjectileSystem::TILE_REACTION_BURN_BUSH,
+			2, 2, 1, CSoundController::SOUND_LIST::BURNING, CSoundController::SOUND_LIST::POISONBALL,
+			0.0f, 0.0f, 0, 0,
+			0.0f
+		},
+		// SNOW_FLAME
+		{
+			"Image/SnowPlanet/scene2d_flame.png", 1, 7,
+			{ 0, 0, 0, 0 }, { 6, 6, 6, 6 },
+			2, true,
+			610, INT_MAX, CProjectileSystem::TILE_REACTION_DAMAGE_SHIELD,
+			3, 3, 0, CSoundController::SOUND_LIST::TAKE_DAMAGE, -1,
+			0.0f, 0.0f, 0, 0,
+			0.0f
+		},
+		// TERRESTRIAL_DUMMY
+		{
+			"Image/TerrestrialPlanet/TurretBullet.png", 1, 2,
+			{ 0, 0, 0, 0 }, { 0, 0, 0, 0 },
+			2, true,
+			600, 1400, CProjectileSystem::TILE_REACTION_NONE,
+			1, 1, 0, CSoundController::SOUND_LIST::TAKE_DAMAGE, -1,
+			0.0f, 0.0f, 0, 0,
+			0.0f
+		},
+		// TERRESTRIAL_SENTRY
+		{
+			"Image/TerrestrialPlanet/SentryBullet.png", 1, 2,
+			{ 0, 0, 0, 0 }, { 0, 0, 0, 0 },
+			2, true,
+			600, 1400, CProjectileSystem::TILE_REACTION_NONE,
+			5, 6, 0, CSoundController::SOUND_LIST::TAKE_DAMAGE, -1,
+			0.0f, 0.0f, 0, 0,
+			0.0f
+		},
+		// TERRESTRIAL_TURRET
+		{
+			"Image/TerrestrialPlanet/TurretBullet.png", 1, 2,
+			{ 0, 0, 0, 0 }, { 0, 0, 0, 0 },
+			2, true,
+			600, 1400, CProjectileSystem::TILE_REACTION_NONE,
+			3, 3, 0, CSoundController::SOUND_LIST::TAKE_DAMAGE, -1,
+			0.0f, 0.0f, 0, 0,
+			0.0f
+		},
+		// TERRESTRIAL_ROCKET
+		{
+			"Image/TerrestrialPlanet/VeteranRocket.png", 1, 2,
+			{ 1, 0, 0, 0 }, { 1, 0, 0, 0 },
+			2, true,
+			600, 1400, CProjectileSystem::TILE_REACTION_NONE,
+			10, 15, 0, CSoundController::SOUND_LIST::TAKE_DAMAGE, -1,
+			6.0f, 8.0f, 1, 2,
+			0.0f
+		}
+	};
+}
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CProjectileSystem::CProjectileSystem(void)
+	: VAO(0)
+	, bResourcesLoaded(false)
+	, sShaderName("Shader2D")
+	, uiCurrentLevel(0)
+	, uiMovedTick(0)
+	, uiSpawnMultiple(1)
+	, cMap2D(NULL)
+	, cPlayer2D(NULL)
+	, camera2D(NULL)
+	, cSettings(NULL)
+	, cSoundController(NULL)
+	, cInventoryManagerPlanet(NULL)
+{
+	// The scenario benchmarks spawn more projectiles. This instance is destroyed with each planet, so the
+	// multiple is taken from the settings, instead of being set on each new instance
+	SetSpawnMultiple(CSettings::GetInstance()->uiScenarioProjectileMultiple);
+
+	for (unsigned int uiType = 0; uiType < NUM_PROJECTILE_TYPES; uiType++)
+	{
+		uiTextureID[uiType] = 0;
+		for (unsigned int uiDirection = 0; uiDirection < NUM_DIRECTIONS; uiDirection++)
+			animatedSprites[uiType][uiDirection] = NULL;
+	}
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CProjectileSystem::~CProjectileSystem(void)
+{
+	Clear();
+
+	// We won't delete these since they were created elsewhere
+	cMap2D = NULL;
+	cPlayer2D = NULL;
+	camera2D = NULL;
+	cSettings = NULL;
+	cSoundController = NULL;
+	cInventoryManagerPlanet = NULL;
+
+	// Delete the CAnimationSprites
+	for (unsigned int uiType = 0; uiType < NUM_PROJECTILE_TYPES; uiType++)
+	{
+		for (unsigned int uiDirection = 0; uiDirection < NUM_DIRECTIONS; uiDirection++)
+		{
+			if (animatedSprites[uiType][uiDirection])
+			{
+				delete animatedSprites[uiType][uiDirection];
+				animatedSprites[uiType][uiDirection] = NULL;
+			}
+		}
+	}
+
+	// optional: de-allocate all resources once they've outlived their purpose:
+	if (VAO != 0)
+		glDeleteVertexArrays(1, &VAO);
+}
+
+/**
+ @brief Initialise this instance. The textures and sprites are only loaded once, so this can be called by every planet
+ */
+bool CProjectileSystem::Init(void)
+{
+	// Get the handler to the CSettings instance
+	cSettings = CSettings::GetInstance();
+
+	// Get the handler to the Camera2D instance
+	camera2D = Camera2D::GetInstance();
+
+	// Get the handler to the CSoundController instance
+	cSoundController = CSoundController::GetInstance();
+
+	// Get the handler to the CMap2D instance
+	cMap2D = CMap2D::GetInstance();
+
+	// Get the handler to the CInventoryManagerPlanet instance
+	cInventoryManagerPlanet = CInventoryManagerPlanet::GetInstance();
+
+	// Get the handler to the CPlayer2D instance
+	cPlayer2D = CPlayer2D::GetInstance();
+
+	// Remove the projectiles of the previous planet
+	Clear();
+	uiCurrentLevel = cMap2D->GetCurrentLevel();
+
+	if (!bResourcesLoaded)
+	{
+		if (!LoadResources())
+			return false;
+		bResourcesLoaded = true;
+	}
+
+	vIndex.reserve(uiInitialCapacity);
+	vMicroSteps.reserve(uiInitialCapacity);
+	vVelocity.reserve(uiInitialCapacity);
+	vStartIndex.reserve(uiInitialCapacity);
+	vLifetime.reserve(uiInitialCapacity);
+	vType.reserve(uiInitialCapacity);
+	vDirection.reserve(uiInitialCapacity);
+	vAlerted.reserve(uiInitialCapacity);
+	vHit.reserve(uiInitialCapacity);
+	vOwner.reserve(uiInitialCapacity);
+
+	return true;
+}
+
+/**
+ @brief Spawn a projectile at a tile, travelling in a direction
+ @param eType A const PROJECTILE_TYPE containing the type of projectile to spawn
+ @param cOwner A const CEntity2D* of the entity which shot the projectile
+ @param vec2SpawnIndex A const glm::vec2& containing the tile to spawn the projectile at
+ @param iDirection A const int containing the direction the projectile travels in
+ @param bAlerted A const bool which is true if the shooter is alerted
+ */
+bool CProjectileSystem::Spawn(const PROJECTILE_TYPE eType, const CEntity2D* cOwner, const glm::vec2& vec2SpawnIndex, const int iDirection, const bool bAlerted)
+{
+	if ((eType < 0) || (eType >= NUM_PROJECTILE_TYPES))
+	{
+		cout << "CProjectileSystem::Spawn: Unknown projectile type." << endl;
+		return false;
+	}
+	if ((iDirection < 0) || (iDirection >= NUM_DIRECTIONS))
+	{
+		cout << "CProjectileSystem::Spawn: Unknown direction." << endl;
+		return false;
+	}
+
+	const SProjectileType& sType = sProjectileTypes[eType];
+	glm::vec2 vec2Velocity(0.0f);
+	switch (iDirection)
+	{
+	case LEFT:
+		vec2Velocity.x = (float)-sType.iSpeed;
+		break;
+	case RIGHT:
+		vec2Velocity.x = (float)sType.iSpeed;
+		break;
+	case UP:
+		vec2Velocity.y = (float)sType.iSpeed;
+		break;
+	case DOWN:
+		vec2Velocity.y = (float)-sType.iSpeed;
+		break;
+	default:
+		break;
+	}
+
+	// Projectiles start at the tile of the shooter
+	glm::vec2 vec2TileIndex((float)(int)vec2SpawnIndex.x, (float)(int)vec2SpawnIndex.y);
+
+	// The extra copies of a multiplied shot fly with it, and hit the player with it too
+	for (unsigned int uiCopy = 0; uiCopy < uiSpawnMultiple; uiCopy++)
+	{
+		vIndex.push_back(vec2TileIndex);
+		vMicroSteps.push_back(glm::vec2(0.0f));
+		vVelocity.push_back(vec2Velocity);
+		vStartIndex.push_back(vec2TileIndex);
+		vLifetime.push_back(0.0f);
+		vType.push_back((unsigned char)eType);
+		vDirection.push_back((unsigned char)iDirection);
+		vAlerted.push_back(bAlerted ? 1 : 0);
+		vHit.push_back(0);
+		vOwner.push_back(cOwner);
+	}
+
+	return true;
+}
+
+/**
+ @brief Update all of the projectiles
+ @param dElapsedTime A const double variable contains the time since the last frame
+ */
+void CProjectileSystem::Update(const double dElapsedTime)
+{
+	// Projectiles do not follow the player into another level
+	if (cMap2D->GetCurrentLevel() != uiCurrentLevel)
+	{
+		Clear();
+		uiCurrentLevel = cMap2D->GetCurrentLevel();
+	}
+
+	unsigned int uiNumProjectiles = GetNumProjectiles();
+	if (uiNumProjectiles == 0)
+		return;
+
+	// Play the flight sound once for each type in flight, instead of once for each projectile
+	bool bTypeInFlight[NUM_PROJECTILE_TYPES] = { false };
+	for (unsigned int i = 0; i < uiNumProjectiles; i++)
+		bTypeInFlight[vType[i]] = true;
+	for (unsigned int uiType = 0; uiType < NUM_PROJECTILE_TYPES; uiType++)
+	{
+		if ((bTypeInFlight[uiType]) && (sProjectileTypes[uiType].iFlightSound >= 0))
+			cSoundController->PlaySoundByID(sProjectileTypes[uiType].iFlightSound);
+	}
+
+	// Move all the projectiles. Each projectile only touches its own elements, so batches can run on any thread
+	uiMovedTick = cSettings->uiTickCount;
+	float fElapsedTime = (float)dElapsedTime;
+	const float fStepsX = (float)(int)cSettings->NUM_STEPS_PER_TILE_XAXIS;
+	const float fStepsY = (float)(int)cSettings->NUM_STEPS_PER_TILE_YAXIS;
+	CJobSystem::GetInstance()->ParallelFor(uiNumProjectiles, uiIntegrateBatchSize,
+		[this, fElapsedTime, fStepsX, fStepsY](const unsigned int uiBegin, const unsigned int uiEnd)
+	{
+		for (unsigned int i = uiBegin; i < uiEnd; i++)
+		{
+			vMicroSteps[i] += vVelocity[i];
+			vLifetime[i] += fElapsedTime;
+
+			// Carry the micro steps over into the next tile
+			if (vMicroSteps[i].x < 0.0f)
+			{
+				vMicroSteps[i].x = fStepsX - 1.0f;
+				vIndex[i].x--;
+			}
+			else if (vMicroSteps[i].x >= fStepsX)
+			{
+				vMicroSteps[i].x = 0.0f;
+				vIndex[i].x++;
+			}
+			if (vMicroSteps[i].y < 0.0f)
+			{
+				vMicroSteps[i].y = fStepsY - 1.0f;
+				vIndex[i].y--;
+			}
+			else if (vMicroSteps[i].y > fStepsY)
+			{
+				vMicroSteps[i].y = 0.0f;
+				vIndex[i].y++;
+			}
+		}
+	});
+
+	// The map, the player and the sounds are not thread safe, so the rest of the update runs on this thread
+	// Let the projectiles interact with the map and the player
+	for (unsigned int i = 0; i < uiNumProjectiles; i++)
+	{
+		const SProjectileType& sType = sProjectileTypes[vType[i]];
+		vHit[i] = 0;
+
+		ReactWithTile(i);
+		HitPlayer(i);
+
+		// Only the projectiles which are blocked or have run out of travel or lifetime explode,
+		// so a direct hit on the player or a shield does not also blow up the tiles around it
+		bool bExplode = IsBlocked(i);
+
+		float fMaxTravel = vAlerted[i] ? sType.fAlertedMaxTravel : sType.fMaxTravel;
+		if ((fMaxTravel > 0.0f) && (glm::length(vIndex[i] - vStartIndex[i]) > fMaxTravel))
+			bExplode = true;
+
+		if ((sType.fMaxLifetime > 0.0f) && (vLifetime[i] > sType.fMaxLifetime))
+			bExplode = true;
+
+		if (bExplode)
+		{
+			vHit[i] = 1;
+			Explode(i);
+		}
+	}
+
+	// Remove the spent projectiles. Iterate backwards so the swapped in projectile has been checked already
+	for (int i = (int)uiNumProjectiles - 1; i >= 0; i--)
+	{
+		if ((vHit[i]) || (LimitReached(i)))
+			Remove(i);
+	}
+
+	// Update the sprite animations, which are shared by all projectiles of a type and direction
+	for (unsigned int uiType = 0; uiType < NUM_PROJECTILE_TYPES; uiType++)
+	{
+		for (unsigned int uiDirection = 0; uiDirection < NUM_DIRECTIONS; uiDirection++)
+		{
+			if (animatedSprites[uiType][uiDirection])
+				animatedSprites[uiType][uiDirection]->Update(dElapsedTime);
+		}
+	}
+}
+
+/**
+ @brief Set up the OpenGL display environment before rendering
+ */
+void CProjectileSystem::PreRender(void)
+{
+	// Activate blending mode
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	// Activate the shader
+	CShaderManager::GetInstance()->Use(sShaderName);
+}
+
+/**
+ @brief Render all of the projectiles. Projectiles are drawn in groups which share a texture and sprite,
+		so each texture is only bound once per frame
+ */
+void CProjectileSystem::Render(void)
+{
+	unsigned int uiNumProjectiles = GetNumProjectiles();
+	if (uiNumProjectiles == 0)
+		return;
+
+	// Group the projectiles by their type and direction
+	for (unsigned int uiBucket = 0; uiBucket < NUM_PROJECTILE_TYPES * NUM_DIRECTIONS; uiBucket++)
+		vRenderBuckets[uiBucket].clear();
+	for (unsigned int i = 0; i < uiNumProjectiles; i++)
+		vRenderBuckets[vType[i] * NUM_DIRECTIONS + vDirection[i]].push_back(i);
+
+	glBindVertexArray(VAO);
+
+	// get matrix's uniform location and set matrix
+	unsigned int transformLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
+	unsigned int colorLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "runtimeColour");
+
+	// All projectiles are drawn in their original colours
+	glm::vec4 runtimeColour = glm::vec4(1.0f);
+	glUniform4fv(colorLoc, 1, glm::value_ptr(runtimeColour));
+
+	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
+	glm::vec2 cameraPos = camera2D->getPos();
+	float fZoom = camera2D->getZoom();
+
+	// Draw each projectile back along its last move, between the previous tick and the latest tick
+	float fBlendBack = (uiMovedTick + 1 == cSettings->uiTickCount) ? 1.0f - cSettings->fRenderAlpha : 0.0f;
+
+	glActiveTexture(GL_TEXTURE0);
+	for (unsigned int uiType = 0; uiType < NUM_PROJECTILE_TYPES; uiType++)
+	{
+		const SProjectileType& sType = sProjectileTypes[uiType];
+		float fMicroStepX = sType.bUseEnemyMicroSteps ? cSettings->ENEMY_MICRO_STEP_XAXIS : cSettings->MICRO_STEP_XAXIS;
+		float fMicroStepY = sType.bUseEnemyMicroSteps ? cSettings->ENEMY_MICRO_STEP_YAXIS : cSettings->MICRO_STEP_YAXIS;
+		bool bTextureBound = false;
+
+		for (unsigned int uiDirection = 0; uiDirection < NUM_DIRECTIONS; uiDirection++)
+		{
+			const std::vector<unsigned int>& vBucket = vRenderBuckets[uiType * NUM_DIRECTIONS + uiDirection];
+			if (vBucket.empty())
+				continue;
+
+			if (!bTextureBound)
+			{
+				glBindTexture(GL_TEXTURE_2D, uiTextureID[uiType]);
+				RENDER_STATS_ADD(TEXTURE_BINDS, 1);
+				bTextureBound = true;
+			}
+
+			for (unsigned int j = 0; j < vBucket.size(); j++)
+			{
+				unsigned int i = vBucket[j];
+
+				glm::vec2 actualPos = vIndex[i] - cameraPos + offset;
+				actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * fZoom;
+				actualPos.x += (vMicroSteps[i].x - vVelocity[i].x * fBlendBack) * fMicroStepX;
+				actualPos.y += (vMicroSteps[i].y - vVelocity[i].y * fBlendBack) * fMicroStepY;
+
+				glm::mat4 transform = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
+				transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
+				transform = glm::scale(transform, glm::vec3(fZoom));
+
+				// Update the shaders with the latest transform
+				glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
+
+				//CS: Render the animated Sprite
+				animatedSprites[uiType][uiDirection]->Render();
+			}
+		}
+
+		if (bTextureBound)
+			glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	glBindVertexArray(0);
+}
+
+/**
+ @brief PostRender Set up the OpenGL display environment after rendering.
+ */
+void CProjectileSystem::PostRender(void)
+{
+	// Disable blending
+	glDisable(GL_BLEND);
+}
+
+/**
+ @brief Remove the projectiles shot by an owner, e.g. when it is deleted
+ @param cOwner A const CEntity2D* of the entity which shot the projectiles
+ */
+void CProjectileSystem::RemoveByOwner(const CEntity2D* cOwner)
+{
+	for (int i = (int)GetNumProjectiles() - 1; i >= 0; i--)
+	{
+		if (vOwner[i] == cOwner)
+			Remove(i);
+	}
+}
+
+/**
+ @brief Remove all projectiles. The arrays keep their memory for the next level
+ */
+void CProjectileSystem::Clear(void)
+{
+	vIndex.clear();
+	vMicroSteps.clear();
+	vVelocity.clear();
+	vStartIndex.clear();
+	vLifetime.clear();
+	vType.clear();
+	vDirection.clear();
+	vAlerted.clear();
+	vHit.clear();
+	vOwner.clear();
+}
+
+/**
+ @brief Get the number of projectiles in flight
+ */
+unsigned int CProjectileSystem::GetNumProjectiles(void) const
+{
+	return (unsigned int)vIndex.size();
+}
+
+/**
+ @brief Set how many projectiles each shot spawns, e.g. to stress a scenario benchmark
+ @param uiMultiple A const unsigned int containing the number of projectiles. 1 spawns the shots as the game does
+ */
+void CProjectileSystem::SetSpawnMultiple(const unsigned int uiMultiple)
+{
+	uiSpawnMultiple = (uiMultiple > 0) ? uiMultiple : 1;
+}
+
+/**
+ @brief Get how many projectiles each shot spawns
+ */
+unsigned int CProjectileSystem::GetSpawnMultiple(void) const
+{
+	return uiSpawnMultiple;
+}
+
+/**
+ @brief Get the data of a type of projectile
+ @param eType A const PROJECTILE_TYPE containing the type of projectile
+ */
+const CProjectileSystem::SProjectileType& CProjectileSystem::GetType(const PROJECTILE_TYPE eType)
+{
+	return sProjectileTypes[eType];
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CProjectileSystem::PrintSelf(void)
+{
+	unsigned int uiNumOfType[NUM_PROJECTILE_TYPES] = { 0 };
+	for (unsigned int i = 0; i < GetNumProjectiles(); i++)
+		uiNumOfType[vType[i]]++;
+
+	cout << endl << "CProjectileSystem::PrintSelf()" << endl;
+	cout << "Projectiles: " << GetNumProjectiles() << ", capacity: " << vIndex.capacity() << endl;
+	for (unsigned int uiType = 0; uiType < NUM_PROJECTILE_TYPES; uiType++)
+		cout << "Type " << uiType << ": " << uiNumOfType[uiType] << endl;
+	cout << "===== CProjectileSystem::PrintSelf() =====" << endl;
+}
+
+/**
+ @brief Load the textures and sprites of all projectile types
+ */
+bool CProjectileSystem::LoadResources(void)
+{
+	// The sprites of all projectiles are drawn with this VAO
+	glGenVertexArrays(1, &VAO);
+	glBindVertexArray(VAO);
+
+	for (unsigned int uiType = 0; uiType < NUM_PROJECTILE_TYPES; uiType++)
+	{
+		const SProjectileType& sType = sProjectileTypes[uiType];
+
+		// Load the projectile texture
+		uiTextureID[uiType] = CImageLoader::GetInstance()->LoadTextureGetID(sType.szTexturePath, true);
+		if (uiTextureID[uiType] == 0)
+		{
+			cout << "CProjectileSystem::LoadResources: Failed to load " << sType.szTexturePath << endl;
+			return false;
+		}
+
+		//CS: Create an animated sprite for each direction, which is shared by all projectiles of this type
+		for (unsigned int uiDirection = 0; uiDirection < NUM_DIRECTIONS; uiDirection++)
+		{
+			animatedSprites[uiType][uiDirection] = CMeshBuilder::GenerateSpriteAnimation(sType.uiSpriteRows, sType.uiSpriteCols,
+				cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
+			animatedSprites[uiType][uiDirection]->AddAnimation("fly", sType.iFirstFrame[uiDirection], sType.iLastFrame[uiDirection]);
+			animatedSprites[uiType][uiDirection]->PlayAnimation("fly", -1, 1.0f);
+		}
+	}
+
+	glBindVertexArray(0);
+
+	return true;
+}
+
+/**
+ @brief Get the value of a tile
+ @param iRow A const int containing the row of the tile
+ @param iCol A const int containing the column of the tile
+ @param iValue An int& which is set to the value of the tile
+ @return false if the tile is outside the map
+ */
+bool CProjectileSystem::GetTile(const int iRow, const int iCol, int& iValue) const
+{
+	if ((iRow < 0) || (iRow >= (int)cSettings->NUM_TILES_YAXIS) ||
+		(iCol < 0) || (iCol >= (int)cSettings->NUM_TILES_XAXIS))
+		return false;
+
+	iValue = cMap2D->GetMapInfo(iRow, iCol);
+	return true;
+}
+
+/**
+ @brief Check if the tile in front of a projectile stops it
+ @param uiProjectile A const unsigned int containing the index of the projectile
+ */
+bool CProjectileSystem::IsBlocked(const unsigned int uiProjectile)
+{
+	const SProjectileType& sType = sProjectileTypes[vType[uiProjectile]];
+	glm::vec2& vec2Index = vIndex[uiProjectile];
+	glm::vec2& vec2MicroSteps = vMicroSteps[uiProjectile];
+	int iRow = (int)vec2Index.y;
+	int iCol = (int)vec2Index.x;
+
+	// The tiles to check, which are the tile in front and the next tile if the projectile is between 2 tiles
+	int iRows[2] = { iRow, iRow };
+	int iCols[2] = { iCol, iCol };
+	bool bBetweenTiles = false;
+
+	switch (vDirection[uiProjectile])
+	{
+	case LEFT:
+		iRows[1] = iRow + 1;
+		bBetweenTiles = (vec2MicroSteps.y != 0.0f);
+		break;
+	case RIGHT:
+		// If the projectile is at the right edge of the map, then it is not blocked
+		if (iCol >= (int)cSettings->NUM_TILES_XAXIS - 1)
+		{
+			vec2MicroSteps.x = 0.0f;
+			return false;
+		}
+		iCols[0] = iCols[1] = iCol + 1;
+		iRows[1] = iRow + 1;
+		bBetweenTiles = (vec2MicroSteps.y != 0.0f);
+		break;
+	case UP:
+		// If the projectile is at the top row, then it is not blocked
+		if (iRow >= (int)cSettings->NUM_TILES_YAXIS - 1)
+		{
+			vec2MicroSteps.y = 0.0f;
+			return false;
+		}
+		iRows[0] = iRows[1] = iRow + 1;
+		iCols[1] = iCol + 1;
+		bBetweenTiles = (vec2MicroSteps.x != 0.0f);
+		break;
+	case DOWN:
+		iCols[1] = iCol + 1;
+		bBetweenTiles = (vec2MicroSteps.x != 0.0f);
+		break;
+	default:
+		return false;
+	}
+
+	for (int iTile = 0; iTile < (bBetweenTiles ? 2 : 1); iTile++)
+	{
+		int iValue = 0;
+		if ((GetTile(iRows[iTile], iCols[iTile], iValue)) &&
+			(iValue >= sType.iBlockedMin) && (iValue < sType.iBlockedMax))
+			return true;
+	}
+	return false;
+}
+
+/**
+ @brief Change the tile which a projectile has flown into
+ @param uiProjectile A const unsigned int containing the index of the projectile
+ */
+void CProjectileSystem::ReactWithTile(const unsigned int uiProjectile)
+{
+	const SProjectileType& sType = sProjectileTypes[vType[uiProjectile]];
+	if (sType.eTileReaction == TILE_REACTION_NONE)
+		return;
+
+	int iRow = (int)vIndex[uiProjectile].y;
+	int iCol = (int)vIndex[uiProjectile].x;
+	int iValue = 0;
+	if (!GetTile(iRow, iCol, iValue))
+		return;
+
+	bool bReacted = false;
+	if (sType.eTileReaction == TILE_REACTION_BURN_BUSH)
+	{
+		switch (iValue)
+		{
+		case CMap2D::TILE_INDEX::BURNABLE_BUSH: //burnable bush block
+			cMap2D->SetMapInfo(iRow, iCol, CMap2D::TILE_INDEX::DISSOLVING_BUSH); //turn to dissolving bush
+			bReacted = true;
+			break;
+		case CMap2D::TILE_INDEX::BURNING_BUSH: //burning bush block
+		case CMap2D::TILE_INDEX::DISSOLVING_BUSH: //dissolving bush block
+			cMap2D->SetMapInfo(iRow, iCol, 0); //turn to empty space
+			bReacted = true;
+			break;
+		default:
+			break;
+		}
+	}
+	else if (sType.eTileReaction == TILE_REACTION_DAMAGE_SHIELD)
+	{
+		if ((iValue >= 150) && (iValue <= 157))
+		{
+			// player's full shield to half shield
+			cMap2D->SetMapInfo(iRow, iCol, iValue + 10);
+			bReacted = true;
+		}
+		else if ((iValue >= 160) && (iValue <= 167))
+		{
+			// player's half shield is destroyed
+			cMap2D->SetMapInfo(iRow, iCol, 0);
+			bReacted = true;
+		}
+	}
+
+	if (bReacted)
+	{
+		vHit[uiProjectile] = 1; //destroy ammo upon collision
+		cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::BURNING); //play burning sound
+	}
+}
+
+/**
+ @brief Check if a projectile hits the player
+ @param uiProjectile A const unsigned int containing the index of the projectile
+ */
+void CProjectileSystem::HitPlayer(const unsigned int uiProjectile)
+{
+	glm::i32vec2 i32vec2PlayerPos = cPlayer2D->vec2Index;
+	const glm::vec2& vec2Index = vIndex[uiProjectile];
+
+	// Check if the projectile is within 0.5 indices of the player2D
+	if ((vec2Index.x < i32vec2PlayerPos.x - 0.5) || (vec2Index.x > i32vec2PlayerPos.x + 0.5) ||
+		(vec2Index.y < i32vec2PlayerPos.y - 0.5) || (vec2Index.y > i32vec2PlayerPos.y + 0.5))
+		return;
+
+	const SProjectileType& sType = sProjectileTypes[vType[uiProjectile]];
+
+	CInventoryItemPlanet* cInventoryItemPlanet = cInventoryManagerPlanet->GetItem("Health");
+	cInventoryItemPlanet->Remove(vAlerted[uiProjectile] ? sType.iAlertedDamage : sType.iDamage);
+
+	if (sType.iPoison > 0)
+	{
+		cInventoryItemPlanet = cInventoryManagerPlanet->GetItem("PoisonLevel");
+		//if not at max poison lvl yet
+		if (cInventoryItemPlanet->GetCount() != cInventoryItemPlanet->GetMaxCount())
+			cInventoryItemPlanet->Add(sType.iPoison);
+	}
+
+	cSoundController->PlaySoundByID(sType.iHitSound);
+
+	vHit[uiProjectile] = 1; //destroy ammo --> only hits player once
+}
+
+/**
+ @brief Blow up the tiles around a projectile
+ @param uiProjectile A const unsigned int containing the index of the projectile
+ */
+void CProjectileSystem::Explode(const unsigned int uiProjectile)
+{
+	const SProjectileType& sType = sProjectileTypes[vType[uiProjectile]];
+	int iHalfWidth = vAlerted[uiProjectile] ? sType.iAlertedExplosionHalfWidth : sType.iExplosionHalfWidth;
+	if (iHalfWidth <= 0)
+		return;
+
+	int iRow = (int)vIndex[uiProjectile].y;
+	int iCol = (int)vIndex[uiProjectile].x;
+	bool bExploded = false;
+
+	// starts from row below ammo, moves up
+	for (int row = -1; row < 2; ++row)
+	{
+		// starts from col left of ammo, moves right
+		for (int col = -iHalfWidth; col <= iHalfWidth; ++col)
+		{
+			int iValue = 0;
+			if (!GetTile(iRow + row, iCol + col, iValue))
+				continue;
+
+			// sets empty tiles to the explosion tile
+			if ((iValue < 200) || ((iValue >= 300) && (iValue < 600)))
+			{
+				cMap2D->SetMapInfo(iRow + row, iCol + col, CMap2D::TILE_INDEX::EXPLOSION);
+				bExploded = true;
+			}
+		}
+	}
+
+	if (bExploded)
+		cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::VETERAN_ROCKET_EXPLOSION); // play sound effect for the rocket explosion
+}
+
+/**
+ @brief Check if a projectile has left the map
+ @param uiProjectile A const unsigned int containing the index of the projectile
+ */
+bool CProjectileSystem::LimitReached(const unsigned int uiProjectile) const
+{
+	const glm::vec2& vec2Index = vIndex[uiProjectile];
+	switch (vDirection[uiProjectile])
+	{
+	case LEFT:
+		return (vec2Index.x < 0);
+	case RIGHT:
+		return (vec2Index.x >= (int)cSettings->NUM_TILES_XAXIS - 1);
+	case UP:
+		return (vec2Index.y >= (int)cSettings->NUM_TILES_YAXIS - 1);
+	case DOWN:
+		return (vec2Index.y < 0);
+	default:
+		return true;
+	}
+}
+
+/**
+ @brief Remove a projectile by swapping it with the last one, so the arrays stay packed
+ @param uiProjectile A const unsigned int containing the index of the projectile
+ */
+void CProjectileSystem::Remove(const unsigned int uiProjectile)
+{
+	unsigned int uiLast = GetNumProjectiles() - 1;
+	if (uiProjectile != uiLast)
+	{
+		vIndex[uiProjectile] = vIndex[uiLast];
+		vMicroSteps[uiProjectile] = vMicroSteps[uiLast];
+		vVelocity[uiProjectile] = vVelocity[uiLast];
+		vStartIndex[uiProjectile] = vStartIndex[uiLast];
+		vLifetime[uiProjectile] = vLifetime[uiLast];
+		vType[uiProjectile] = vType[uiLast];
+		vDirection[uiProjectile] = vDirection[uiLast];
+		vAlerted[uiProjectile] = vAlerted[uiLast];
+		vHit[uiProjectile] = vHit[uiLast];
+		vOwner[uiProjectile] = vOwner[uiLast];
+	}
+	vIndex.pop_back();
+	vMicroSteps.pop_back();
+	vVelocity.pop_back();
+	vStartIndex.pop_back();
+	vLifetime.pop_back();
+	vType.pop_back();
+	vDirection.pop_back();
+	vAlerted.pop_back();
+	vHit.pop_back();
+	vOwner.pop_back();
+}
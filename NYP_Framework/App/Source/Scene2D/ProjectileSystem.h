@@ -0,0 +1,230 @@
+/**
+ CProjectileSystem
+ @brief A class which simulates and renders all of the enemy projectiles, keeping their state in parallel arrays
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "DesignPatterns/SingletonTemplate.h"
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+// Include GLM
+#include <includes/glm.hpp>
+#include <includes/gtc/matrix_transform.hpp>
+#include <includes/gtc/type_ptr.hpp>
+
+// Include CEntity2D
+#include "Primitives/Entity2D.h"
+
+// Include AnimatedSprites
+#include "Primitives/SpriteAnimation.h"
+
+// Include Settings
+#include "GameControl/Settings.h"
+
+#include <vector>
+#include <string>
+
+class CMap2D;
+class CPlayer2D;
+class Camera2D;
+class CSoundController;
+class CInventoryManagerPlanet;
+
+class CProjectileSystem : public CSingletonTemplate<CProjectileSystem>
+{
+	friend CSingletonTemplate<CProjectileSystem>;
+public:
+	// The types of projectiles
+	enum PROJECTILE_TYPE
+	{
+		JUNGLE_POISON = 0,		// Poison ball shot by the jungle enemies
+		SNOW_FLAME,				// Flame shot by the snow enemies
+		TERRESTRIAL_DUMMY,		// Bullet shot by the terrestrial dummy
+		TERRESTRIAL_SENTRY,		// Bullet shot by the terrestrial sentry
+		TERRESTRIAL_TURRET,		// Bullet shot by the terrestrial turret
+		TERRESTRIAL_ROCKET,		// Rocket shot by the terrestrial veteran, which explodes
+		NUM_PROJECTILE_TYPES
+	};
+
+	// The directions a projectile can travel in. These match the enemies' DIRECTION
+	enum DIRECTION
+	{
+		LEFT = 0,
+		RIGHT = 1,
+		UP = 2,
+		DOWN = 3,
+		NUM_DIRECTIONS
+	};
+
+	// How a projectile changes the tile it flies into
+	enum TILE_REACTION
+	{
+		TILE_REACTION_NONE = 0,
+		TILE_REACTION_BURN_BUSH,		// Bushes are dissolved
+		TILE_REACTION_DAMAGE_SHIELD,	// The player's shields are damaged
+		NUM_TILE_REACTIONS
+	};
+
+	// The data which describes the behaviour of a type of projectile
+	struct SProjectileType
+	{
+		const char* szTexturePath;
+		unsigned int uiSpriteRows;
+		unsigned int uiSpriteCols;
+		// The sprite frames played while travelling in each direction
+		int iFirstFrame[NUM_DIRECTIONS];
+		int iLastFrame[NUM_DIRECTIONS];
+		// Micro steps moved in each frame
+		int iSpeed;
+		// If true, the render offset uses the enemy micro step size
+		bool bUseEnemyMicroSteps;
+		// Tiles with values in [iBlockedMin, iBlockedMax) stop the projectile
+		int iBlockedMin;
+		int iBlockedMax;
+		TILE_REACTION eTileReaction;
+		// Health removed from the player on a hit, when the shooter is calm and alerted
+		int iDamage;
+		int iAlertedDamage;
+		// Poison added to the player on a hit
+		int iPoison;
+		// Sound played when the player is hit
+		int iHitSound;
+		// Sound played while the projectile is in flight, or -1 for none
+		int iFlightSound;
+		// Tiles travelled before the projectile is spent, or 0 for no limit
+		float fMaxTravel;
+		float fAlertedMaxTravel;
+		// Tiles on either side which are blown up when the projectile is spent, or 0 for no explosion
+		int iExplosionHalfWidth;
+		int iAlertedExplosionHalfWidth;
+		// Seconds before the projectile is spent, or 0 for no limit
+		float fMaxLifetime;
+	};
+
+	// Init
+	bool Init(void);
+
+	// Spawn a projectile at a tile, travelling in a direction
+	bool Spawn(const PROJECTILE_TYPE eType, const CEntity2D* cOwner, const glm::vec2& vec2SpawnIndex, const int iDirection, const bool bAlerted = false);
+
+	// Update all of the projectiles
+	void Update(const double dElapsedTime);
+
+	// PreRender
+	void PreRender(void);
+
+	// Render all of the projectiles
+	void Render(void);
+
+	// PostRender
+	void PostRender(void);
+
+	// Remove the projectiles shot by an owner, e.g. when it is deleted
+	void RemoveByOwner(const CEntity2D* cOwner);
+
+	// Remove all projectiles
+	void Clear(void);
+
+	// Get the number of projectiles in flight
+	unsigned int GetNumProjectiles(void) const;
+
+	// Set how many projectiles each shot spawns, e.g. to stress a scenario benchmark
+	void SetSpawnMultiple(const unsigned int uiMultiple);
+	// Get how many projectiles each shot spawns
+	unsigned int GetSpawnMultiple(void) const;
+
+	// Get the data of a type of projectile
+	static const SProjectileType& GetType(const PROJECTILE_TYPE eType);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
+protected:
+	// The state of the projectiles in flight. Spent projectiles are swapped with the last one,
+	// so the first GetNumProjectiles() entries of every array are always in flight
+	std::vector<glm::vec2> vIndex;			// Tile index
+	std::vector<glm::vec2> vMicroSteps;		// Micro steps from the tile index
+	std::vector<glm::vec2> vVelocity;		// Micro steps moved in each frame
+	std::vector<glm::vec2> vStartIndex;		// Tile index which the projectile was shot from
+	std::vector<float> vLifetime;			// Seconds since the projectile was shot
+	std::vector<unsigned char> vType;		// PROJECTILE_TYPE
+	std::vector<unsigned char> vDirection;	// DIRECTION
+	std::vector<unsigned char> vAlerted;	// 1 if the shooter was alerted
+	std::vector<unsigned char> vHit;		// 1 if the projectile has hit something this frame
+	std::vector<const CEntity2D*> vOwner;	// The entity which shot the projectile
+
+	// Resources shared by all projectiles of a type
+	unsigned int uiTextureID[NUM_PROJECTILE_TYPES];
+	CSpriteAnimation* animatedSprites[NUM_PROJECTILE_TYPES][NUM_DIRECTIONS];
+	unsigned int VAO;
+	bool bResourcesLoaded;
+
+	// Projectile indices grouped by type and direction for rendering
+	std::vector<unsigned int> vRenderBuckets[NUM_PROJECTILE_TYPES * NUM_DIRECTIONS];
+
+	// Name of the shader used to render the projectiles
+	std::string sShaderName;
+
+	// The level which the projectiles in flight belong to
+	unsigned int uiCurrentLevel;
+
+	// The tick when the projectiles were last moved, so that rendering only blends back along a move which was made
+	unsigned int uiMovedTick;
+
+	// The number of projectiles which each shot spawns. 1 spawns the shots as the game does
+	unsigned int uiSpawnMultiple;
+
+	// Handler to the CMap2D instance
+	CMap2D* cMap2D;
+
+	// Handler to the CPlayer2D instance
+	CPlayer2D* cPlayer2D;
+
+	// Handler to the camera instance
+	Camera2D* camera2D;
+
+	// Handler to the CSettings instance
+	CSettings* cSettings;
+
+	// Handler to the CSoundController instance
+	CSoundController* cSoundController;
+
+	// Handler to the CInventoryManagerPlanet instance
+	CInventoryManagerPlanet* cInventoryManagerPlanet;
+
+	// Constructor
+	CProjectileSystem(void);
+
+	// Destructor
+	virtual ~CProjectileSystem(void);
+
+	// Load the textures and sprites of all projectile types
+	bool LoadResources(void);
+
+	// Get the value of a tile. Returns false if the tile is outside the map
+	bool GetTile(const int iRow, const int iCol, int& iValue) const;
+
+	// Check if the tile in front of a projectile stops it
+	bool IsBlocked(const unsigned int uiProjectile);
+
+	// Change the tile which a projectile has flown into
+	void ReactWithTile(const unsigned int uiProjectile);
+
+	// Check if a projectile hits the player
+	void HitPlayer(const unsigned int uiProjectile);
+
+	// Blow up the tiles around a projectile
+	void Explode(const unsigned int uiProjectile);
+
+	// Check if a projectile has left the map
+	bool LimitReached(const unsigned int uiProjectile) const;
+
+	// Remove a projectile by swapping it with the last one
+	void Remove(const unsigned int uiProjectile);
+};
@@ -10,10 +10,15 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
@@ -135,7 +140,7 @@ bool CResource::Init(void)
 		{
 			//random between 2 numbers to set us Scrap metal or battery
 			//according to which number type is set to, load which texture
-			int randomState = rand() % 100;
+			int randomState = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(100);
 			if (randomState < 50)
 			{
 				type = SCRAP_METAL;
@@ -243,7 +248,7 @@ bool CResource::Init(void)
 	case SCRAP_METAL:
 	{
 		// Load the scrap metal texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/ScrapMetal.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/ScrapMetal.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load scrap metal texture" << std::endl;
@@ -254,7 +259,7 @@ bool CResource::Init(void)
 	case BATTERY:
 	{
 		// Load the battery texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/Battery.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/Battery.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load battery texture" << std::endl;
@@ -265,7 +270,7 @@ bool CResource::Init(void)
 	case IRONWOOD:
 	{
 		// Load the ironwood texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Ironwood.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/IronwoodTreeTrunk.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load ironwood texture" << std::endl;
@@ -276,7 +281,7 @@ bool CResource::Init(void)
 	case ENERGY_QUARTZ:
 	{
 		// Load the energy quartz texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/EnergyQuartz.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/EnergyQuartz.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load energy quartz texture" << std::endl;
@@ -287,7 +292,7 @@ bool CResource::Init(void)
 	case ICE_CRYSTAL:
 	{
 		// Load the ice crystal texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/icecrystal.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/icecrystal.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load ice crystal texture" << std::endl;
@@ -300,7 +305,7 @@ bool CResource::Init(void)
 	case BURNABLE_BLOCKS:
 	{
 		// Load the burnable bush blocks texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/BurnableBushBlocks_Bundle.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/BurnableBushBlocks_Bundle.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load burnable blocks texture" << std::endl;
@@ -311,7 +316,7 @@ bool CResource::Init(void)
 	case VINE:
 	{
 		// Load the vine texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/JunglePlanet/Vine_Collectable.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/JunglePlanet/Vine_Collectable.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load vines texture" << std::endl;
@@ -324,7 +329,7 @@ bool CResource::Init(void)
 	case YELLOW_ORB:
 	{
 		// Load the yellow orb texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Orb_Yellow.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Orb_Yellow.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load yellow orb texture" << std::endl;
@@ -335,7 +340,7 @@ bool CResource::Init(void)
 	case RED_ORB:
 	{
 		// Load the red orb texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Orb_Red.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Orb_Red.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load red orb texture" << std::endl;
@@ -346,7 +351,7 @@ bool CResource::Init(void)
 	case GREEN_ORB:
 	{
 		// Load the green orb texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Orb_Green.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Orb_Green.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load green orb texture" << std::endl;
@@ -357,7 +362,7 @@ bool CResource::Init(void)
 	case BLUE_ORB:
 	{
 		// Load the blue orb texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Orb_Blue.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Orb_Blue.tga", true);
 		if (iTextureID == 0)
 		{
 			std::cout << "Failed to load blue orb texture" << std::endl;
@@ -368,7 +373,7 @@ bool CResource::Init(void)
 	case ANTIDOTE_PILL:
 	{
 		// Load the antidote pill texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/AntidotePill.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/AntidotePill.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/TerrestrialPlanet/AntidotePill.tga" << endl;
@@ -379,7 +384,7 @@ bool CResource::Init(void)
 	case PURPLE_KEY:
 	{
 		// Load the purple key texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Key_Purple.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Key_Purple.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/TerrestrialPlanet/Key_Purple.tga" << endl;
@@ -390,7 +395,7 @@ bool CResource::Init(void)
 	case CYAN_KEY:
 	{
 		// Load the cyan key texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/Key_Cyan.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/Key_Cyan.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/TerrestrialPlanet/Key_Cyan.tga" << endl;
@@ -403,7 +408,7 @@ bool CResource::Init(void)
 	case FUR:
 	{
 		//Load Fur texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/fur.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/fur.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/SnowPlanet/fur.tga" << endl;
@@ -413,7 +418,7 @@ bool CResource::Init(void)
 	}
 	case FUR_COAT:
 		//Load Furcoat texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/furcoat.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/furcoat.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/SnowPlanet/furcoat.tga" << endl;
@@ -423,7 +428,7 @@ bool CResource::Init(void)
 	case SHIELD:
 	{
 		//Load shield texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/shieldpowerup.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/shieldpowerup.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/SnowPlanet/shieldpowerup.tga" << endl;
@@ -434,7 +439,7 @@ bool CResource::Init(void)
 	case BERSERK:
 	{
 		//Load Berserk texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/berserkpowerup.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/berserkpowerup.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/SnowPlanet/berserkpowerup.tga" << endl;
@@ -445,7 +450,7 @@ bool CResource::Init(void)
 	case FREEZE:
 	{
 		//Load Freeze texture
-		iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/freezewaterpowerup.tga", true);
+		iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/freezewaterpowerup.tga", true);
 		if (iTextureID == 0)
 		{
 			cout << "Unable to load Image/SnowPlanet/freezewaterpowerup.tga" << endl;
@@ -551,12 +556,14 @@ void CResource::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, vec2NumMicroSteps, IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS;
-	actualPos.y += vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -573,6 +580,7 @@ void CResource::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: render the tile
 	quadMesh->Render();
@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,27 +20,36 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
 // Include math.h
 #include <math.h>
 
+// The state table of SnowEnemy2DSWBS, in real seconds. A dMaxTime of 0.0 means that the state does not time out,
+// and a timeout state of NO_STATE that the Update decides which state it times out into
+const CEnemyFSM::SState SnowEnemy2DSWBS::sFSMStates[SnowEnemy2DSWBS::NUM_FSM] =
+{
+	{ "IDLE", 2.0, PATROL },
+	{ "PATROL", 2.0, IDLE },
+	{ "ATTACK", 2.0, PATROL },
+	{ "FEAR", 0.0, CEnemyFSM::NO_STATE },
+	{ "FEARIDLE", 0.0, CEnemyFSM::NO_STATE },
+	{ "SHIELD", 0.0, CEnemyFSM::NO_STATE },
+	{ "HEAL", 2.0, CEnemyFSM::NO_STATE },
+	{ "FEARHEAL", 2.0, CEnemyFSM::NO_STATE },
+	{ "SHOOT", 2.0, IDLE }
+};
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 SnowEnemy2DSWBS::SnowEnemy2DSWBS(void)
-	: bIsActive(false)
-	, cMap2D(NULL)
-	, cSettings(NULL)
-	, cPlayer2D(NULL)
-	, sCurrentFSM(FSM::IDLE)
-	, iFSMCounter(0)
-	, quadMesh(NULL)
-	, camera2D(NULL)
-	, animatedSprites(NULL)
 {
+	// Start the FSM in its initial state
+	cFSM.Init(CEnemyFSM::SNOW_SWBS, sFSMStates, NUM_FSM, IDLE);
+
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
 	// Initialise vecIndex
@@ -131,7 +142,7 @@ bool SnowEnemy2DSWBS::Init(void)
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the enemy2D texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/SnowPlanet/wolfboss.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/SnowPlanet/wolfboss.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/SnowPlanet/wolfboss.png" << endl;
@@ -170,14 +181,6 @@ bool SnowEnemy2DSWBS::Init(void)
 	// If this class is initialised properly, then set the bIsActive to true
 	bIsActive = true;
 
-	//Construct 100 inactive ammo and add into ammoList
-	for (int i = 0; i < 100; ++i)
-	{
-		CSEAmmo* cEnemyAmmo2D = new CSEAmmo();
-		cEnemyAmmo2D->SetShader("Shader2D");
-		ammoList.push_back(cEnemyAmmo2D);
-	}
-
 	type = BOSS;
 	shootingDirection = LEFT; //setting direction for ammo shooting
 	maxHealth = health = 50; //takes 10 hits to kill
@@ -239,7 +242,7 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 	}
 	// just for switching between states --> keep simple
 	//action done under interaction with player, update position, update direction, etc
-	switch (sCurrentFSM)
+	switch (cFSM.GetState())
 	{
 	case IDLE:
 		if (attackHit) {
@@ -264,32 +267,27 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 				animatedSprites->PlayAnimation("idleL", -1, 1.0f);
 			}
 		}
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.CheckTimeout())
 		{
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
 			cout << "Switching to Patrol State" << endl;
 			break;
 		}
 		if (health <= 40 && health >35 && shieldCount > 0) {
-			sCurrentFSM = SHIELD;
-			iFSMCounter = 0;
+			cFSM.SetState(SHIELD);
 			cout << "Switching to Shield State" << endl;
 			break;
 		}
 		if (health <= 10 && health >5) {
-			sCurrentFSM = FEAR;
-			iFSMCounter = 0;
+			cFSM.SetState(FEAR);
 			cout << "Switching to Fear State" << endl;
 			break;
 		}
 		if (health <= 30 && health > 25 && healCount > 0) {
-			sCurrentFSM = HEAL;
-			iFSMCounter = 0;
+			cFSM.SetState(HEAL);
 			cout << "Switching to Heal State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case PATROL:
 		if (vec2Direction.x > 0) {
@@ -304,40 +302,33 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 		}
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 5.0f)
 		{
-			sCurrentFSM = ATTACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ATTACK);
 			cout << "Switching to Attack State" << endl;
 			break;
 		}
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 8.0f && cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) > 5.0f)
 		{
-			sCurrentFSM = SHOOT;
-			iFSMCounter = 0;
+			cFSM.SetState(SHOOT);
 			cout << "Switching to Shoot State" << endl;
 			break;
 		}
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.CheckTimeout())
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
 			cout << "Switching to Idle State" << endl;
 			break;
 		}
 		if (health <= 40 && health > 35 && shieldCount > 0) {
-			sCurrentFSM = SHIELD;
-			iFSMCounter = 0;
+			cFSM.SetState(SHIELD);
 			cout << "Switching to Shield State" << endl;
 			break;
 		}
 		if (health <= 10 && health > 5) {
-			sCurrentFSM = FEAR;
-			iFSMCounter = 0;
+			cFSM.SetState(FEAR);
 			cout << "Switching to Fear State" << endl;
 			break;
 		}
 		if (health <= 30 && health > 25 && healCount > 0) {
-			sCurrentFSM = HEAL;
-			iFSMCounter = 0;
+			cFSM.SetState(HEAL);
 			cout << "Switching to Heal State" << endl;
 			break;
 		}
@@ -378,7 +369,7 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 			// Update the Enemy2D's position for patrol
 			UpdatePosition();
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case ATTACK:
 		if (vec2Direction.x > 0) {
@@ -421,37 +412,31 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 			UpdatePosition();
 		}
 		else {
-			if (iFSMCounter > iMaxFSMCounter)
+			if (cFSM.CheckTimeout())
 			{
-				sCurrentFSM = PATROL;
-				iFSMCounter = 0;
 				cout << "Switching to Patrol State" << endl;
 				break;
 			}
-			iFSMCounter++;
+			cFSM.AddTime(dElapsedTime);
 		}
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 8.0f && cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) > 5.0f)
 		{
-			sCurrentFSM = SHOOT;
-			iFSMCounter = 0;
+			cFSM.SetState(SHOOT);
 			cout << "Switching to Shoot State" << endl;
 			break;
 		}
 		if (health <= 40 && health > 35 && shieldCount > 0) {
-			sCurrentFSM = SHIELD;
-			iFSMCounter = 0;
+			cFSM.SetState(SHIELD);
 			cout << "Switching to Shield State" << endl;
 			break;
 		}
 		if (health <= 10 && health > 5) {
-			sCurrentFSM = FEAR;
-			iFSMCounter = 0;
+			cFSM.SetState(FEAR);
 			cout << "Switching to Fear State" << endl;
 			break;
 		}
 		if (health <= 30 && health > 25 && healCount > 0) {
-			sCurrentFSM = HEAL;
-			iFSMCounter = 0;
+			cFSM.SetState(HEAL);
 			cout << "Switching to Heal State" << endl;
 			break;
 		}
@@ -471,14 +456,13 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 		shieldTimer -= dElapsedTime;
 		if (shieldTimer <= 0.f) {
 			shieldCount -= 1;
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
+			cFSM.SetState(PATROL);
 			shieldTimer = 0.f;
 			shieldActivated=false;
 			cout << "Switching to Patrol State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 
 	case FEAR:
@@ -520,12 +504,11 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 			UpdatePosition();
 		}
 		if (vec2Index == fearpathway) {
-			sCurrentFSM = FEARIDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(FEARIDLE);
 			cout << "Switching to Fear Idle State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case FEARIDLE:
 		if (vec2Direction.x > 0) {
@@ -537,12 +520,11 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 			animatedSprites->PlayAnimation("idleL", -1, 1.0f);
 		}
 		if (health <= 5 && healFearCount > 0) {
-			sCurrentFSM = FEARHEAL;
-			iFSMCounter = 0;
+			cFSM.SetState(FEARHEAL);
 			cout << "Switching to Heal Fear State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case HEAL:
 		if (vec2Direction.x > 0) {
@@ -562,12 +544,11 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 			health += 10;
 			healCount -= 1;
 		}
-		if (healCount <=0 && iFSMCounter > iMaxFSMCounter) {
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
-			cout << "ATTACK : Reset counter: " << iFSMCounter << endl;
+		if (healCount <=0 && cFSM.IsTimeUp()) {
+			cFSM.SetState(PATROL);
+			cout << "ATTACK : Reset counter: " << cFSM.GetTime() << endl;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case FEARHEAL:
 		if (vec2Direction.x > 0) {
@@ -590,12 +571,11 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 			shieldCount += 1;
 			shieldTimer = 2.0f;
 		}
-		if (healFearCount <= 0 && iFSMCounter > iMaxFSMCounter) {
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
-			cout << "ATTACK : Reset counter: " << iFSMCounter << endl;
+		if (healFearCount <= 0 && cFSM.IsTimeUp()) {
+			cFSM.SetState(PATROL);
+			cout << "ATTACK : Reset counter: " << cFSM.GetTime() << endl;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	case SHOOT:
 		if (vec2Direction.x > 0)
@@ -618,9 +598,7 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 		{
 			// Shoot enemy ammo!
 			//shoot ammo in accordance to the direction enemy is facing
-			CSEAmmo* ammo = FetchAmmo();
-			ammo->setActive(true);
-			ammo->setPath(vec2Index.x, vec2Index.y, shootingDirection);
+			CProjectileSystem::GetInstance()->Spawn(CProjectileSystem::SNOW_FLAME, this, vec2Index, shootingDirection);
 			cout << "Bam!" << shootingDirection << endl;
 
 			shootTimer = shootInterval;
@@ -632,56 +610,36 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 		UpdateDirection();
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 5.0f)
 		{
-			sCurrentFSM = ATTACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ATTACK);
 			cout << "Switching to Attack State" << endl;
 			break;
 		}
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.CheckTimeout())
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
 			cout << "Switching to Idle State" << endl;
 			break;
 		}
 		if (health <= 40 && health > 35 && shieldCount > 0) {
-			sCurrentFSM = SHIELD;
-			iFSMCounter = 0;
+			cFSM.SetState(SHIELD);
 			cout << "Switching to Shield State" << endl;
 			break;
 		}
 		if (health <= 10 && health > 5) {
-			sCurrentFSM = FEAR;
-			iFSMCounter = 0;
+			cFSM.SetState(FEAR);
 			cout << "Switching to Fear State" << endl;
 			break;
 		}
 		if (health <= 30 && health > 25 && healCount > 0) {
-			sCurrentFSM = HEAL;
-			iFSMCounter = 0;
+			cFSM.SetState(HEAL);
 			cout << "Switching to Heal State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	default:
 		break;
 	}
 
-	//ammo behaviour
-	for (std::vector<CSEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CSEAmmo* ammo = (CSEAmmo*)*it;
-		if (ammo->getActive())
-		{
-			ammo->Update(dElapsedTime);
-			if (ammo->LimitReached())
-			{
-				ammo->setActive(false);
-			}
-		}
-	}
-
 	// Update Jump or Fall
 	UpdateJumpFall(dElapsedTime);
 
@@ -698,25 +656,6 @@ void SnowEnemy2DSWBS::Update(const double dElapsedTime)
 	vec2UVCoordinate.y = cSettings->ConvertIndexToUVSpace(cSettings->y, vec2Index.y, false, i32vec2NumMicroSteps.y*cSettings->ENEMY_MICRO_STEP_YAXIS);
 }
 
-/**
- @brief Set up the OpenGL display environment before rendering
- */
-void SnowEnemy2DSWBS::PreRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
-
-	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	// Activate the shader
-	CShaderManager::GetInstance()->Use(sShaderName);
-}
-
 /**
  @brief Render this instance
  */
@@ -736,12 +675,14 @@ void SnowEnemy2DSWBS::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, glm::vec2(i32vec2NumMicroSteps), IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += i32vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS;
-	actualPos.y += i32vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -755,125 +696,13 @@ void SnowEnemy2DSWBS::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
 
 	glBindTexture(GL_TEXTURE_2D, 0);
-	////render enemy ammo
-	for (std::vector<CSEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CSEAmmo* ammo = (CSEAmmo*)*it;
-		if (ammo->getActive())
-		{
-			ammo->PreRender();
-			ammo->Render();
-			ammo->PostRender();
-		}
-	}
-
-}
-
-/**
- @brief PostRender Set up the OpenGL display environment after rendering.
- */
-void SnowEnemy2DSWBS::PostRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// Disable blending
-	glDisable(GL_BLEND);
-}
-
-/**
-@brief Set the indices of the enemy2D
-@param iIndex_XAxis A const int variable which stores the index in the x-axis
-@param iIndex_YAxis A const int variable which stores the index in the y-axis
-*/
-void SnowEnemy2DSWBS::Seti32vec2Index(const int iIndex_XAxis, const int iIndex_YAxis)
-{
-	this->vec2Index.x = iIndex_XAxis;
-	this->vec2Index.y = iIndex_YAxis;
-}
-
-/**
-@brief Set the number of microsteps of the enemy2D
-@param iNumMicroSteps_XAxis A const int variable storing the current microsteps in the X-axis
-@param iNumMicroSteps_YAxis A const int variable storing the current microsteps in the Y-axis
-*/
-void SnowEnemy2DSWBS::Seti32vec2NumMicroSteps(const int iNumMicroSteps_XAxis, const int iNumMicroSteps_YAxis)
-{
-	this->i32vec2NumMicroSteps.x = iNumMicroSteps_XAxis;
-	this->i32vec2NumMicroSteps.y = iNumMicroSteps_YAxis;
-}
-
-/**
- @brief Set the handle to cPlayer to this class instance
- @param cPlayer2D A CPlayer2D* variable which contains the pointer to the CPlayer2D instance
- */
-void SnowEnemy2DSWBS::SetPlayer2D(CPlayer2D* cPlayer2D)
-{
-	this->cPlayer2D = cPlayer2D;
-
-	// Update the enemy's direction
-	UpdateDirection();
-}
-
-bool SnowEnemy2DSWBS::getShieldActivated()
-{
-	return shieldActivated;
-}
-
-void SnowEnemy2DSWBS::setShieldActivated(bool s)
-{
-	shieldActivated = s;
-}
-
 
-
-/**
- @brief Constraint the enemy2D's position within a boundary
- @param eDirection A DIRECTION enumerated data type which indicates the direction to check
- */
-void SnowEnemy2DSWBS::Constraint(DIRECTION eDirection)
-{
-	if (eDirection == LEFT)
-	{
-		if (vec2Index.x < 0)
-		{
-			vec2Index.x = 0;
-			i32vec2NumMicroSteps.x = 0;
-		}
-	}
-	else if (eDirection == RIGHT)
-	{
-		if (vec2Index.x >= (int)cSettings->NUM_TILES_XAXIS - 1)
-		{
-			vec2Index.x = ((int)cSettings->NUM_TILES_XAXIS) - 1;
-			i32vec2NumMicroSteps.x = 0;
-		}
-	}
-	else if (eDirection == UP)
-	{
-		if (vec2Index.y >= (int)cSettings->NUM_TILES_YAXIS - 1)
-		{
-			vec2Index.y = ((int)cSettings->NUM_TILES_YAXIS) - 1;
-			i32vec2NumMicroSteps.y = 0;
-		}
-	}
-	else if (eDirection == DOWN)
-	{
-		if (vec2Index.y < 0)
-		{
-			vec2Index.y = 0;
-			i32vec2NumMicroSteps.y = 0;
-		}
-	}
-	else
-	{
-		cout << "CStnEnemy2D::Constraint: Unknown direction." << endl;
-	}
 }
 
 /**
@@ -993,22 +822,6 @@ bool SnowEnemy2DSWBS::CheckPosition(DIRECTION eDirection)
 }
 
 // Check if the enemy2D is in mid-air
-bool SnowEnemy2DSWBS::IsMidAir(void)
-{
-	// if the player is at the bottom row, then he is not in mid-air for sure
-	if (vec2Index.y == 0)
-		return false;
-
-	// Check if the tile below the player's current position is empty
-	if ((i32vec2NumMicroSteps.x == 0) &&
-		(cMap2D->GetMapInfo(vec2Index.y - 1, vec2Index.x) == 0))
-	{
-		return true;
-	}
-
-	return false;
-}
-
 // Update Jump or Fall
 void SnowEnemy2DSWBS::UpdateJumpFall(const double dElapsedTime)
 {
@@ -1134,8 +947,7 @@ bool SnowEnemy2DSWBS::InteractWithPlayer(void)
 		attackHit = true;
 		cout << "Snow Gotcha!" << endl;
 		// Since the player has been caught, then reset the FSM
-		sCurrentFSM = IDLE;
-		iFSMCounter = 0;
+		cFSM.SetState(IDLE);
 		if (cPlayer2D->getModeOfPlayer() != CPlayer2D::MODE::BERSERKSHIELD && cPlayer2D->getModeOfPlayer() != CPlayer2D::MODE::SHIELD) {
 			cInventoryItemPlanet = cInventoryManagerPlanet->GetItem("Health");
 			cInventoryItemPlanet->Remove(3);
@@ -1205,14 +1017,6 @@ void SnowEnemy2DSWBS::UpdateDirection(void)
 	}
 }
 
-/**
- @brief Flip horizontal direction. For patrol use only
- */
-void SnowEnemy2DSWBS::FlipHorizontalDirection(void)
-{
-	vec2Direction.x *= -1;
-}
-
 /**
 @brief Update position.
 */
@@ -1303,41 +1107,3 @@ void SnowEnemy2DSWBS::UpdatePosition(void)
 		}
 	}
 }
-
-//called whenever an ammo is needed to be shot
-CSEAmmo* SnowEnemy2DSWBS::FetchAmmo()
-{
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CSEAmmo*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CSEAmmo* ammo = (CSEAmmo*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// By default, microsteps should be zero --> reset in case a previously active ammo that was used then ste inactive was used again
-		ammo->vec2NumMicroSteps = glm::i32vec2(0, 0);
-		return ammo;
-	}
-
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CSEAmmo);
-	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
-
-}
-vector<glm::vec2> SnowEnemy2DSWBS::ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints)
-{
-	for (int i = 0; i < numOfWaypoints; ++i)
-	{
-		waypointVector.push_back(cMap2D->GetTilePosition(startIndex + i));
-		// Erase the value of the waypoint in the arrMapInfo
-		cMap2D->SetMapInfo(waypointVector[i].y, waypointVector[i].x, 0);
-		cout << waypointVector.size() << endl;
-	}
-	return waypointVector;
-}
\ No newline at end of file
@@ -5,13 +5,27 @@
  Date: Mar 2020
  */
 #include "SnowPlanet.h"
+
+// Include CProfiler, to time the enemies
+#include "TimeControl/Profiler.h"
+
 #include <iostream>
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the GL calls of each pass of the scene
+#include "RenderControl/RenderStats.h"
+// Include CResourceTracker, to tag the resources which each part of the scene creates
+#include "System/ResourceTracker.h"
+
+#include "System/filesystem.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
 
-#include "System\filesystem.h"
+// Include CLogger, to log from the game loop without waiting for the console
+#include "System/Logger.h"
 
 
 /**
@@ -20,6 +34,8 @@ using namespace std;
 SnowPlanet::SnowPlanet(void)
 	: cMap2D(NULL)
 	, cPlayer2D(NULL)
+	, cPathRequestQueue(NULL)
+	, cProjectileSystem(NULL)
 	, cKeyboardController(NULL)
 	, cGUI_Scene2D(NULL)
 	, cGameManager(NULL)
@@ -59,28 +75,27 @@ SnowPlanet::~SnowPlanet(void)
 		camera2D = NULL;
 	}
 
-	for (unsigned int i = 0; i < enemyVectors.size(); i++)
+	// Destroy the enemies and resources of every level
+	for (unsigned int i = 0; i < NUM_LEVELS; i++)
 	{
-		for (unsigned int j = 0; j < enemyVectors[i].size(); ++j)
-		{
-			delete enemyVectors[i][j];
-			enemyVectors[i][j] = NULL;
-		}
-		enemyVectors[i].clear();
+		cLevelArenas[i].Reset();
 	}
 	enemyVectors.clear();
+	resourceVectors.clear();
 
+	// Destroy the path request queue after the enemies, as they cancel their tickets when deleted
+	if (cPathRequestQueue)
+	{
+		cPathRequestQueue->Destroy();
+		cPathRequestQueue = NULL;
+	}
 
-	for (unsigned int i = 0; i < resourceVectors.size(); i++)
+	// Destroy the projectile system after the enemies which shot the projectiles
+	if (cProjectileSystem)
 	{
-		for (unsigned int j = 0; j < resourceVectors[i].size(); ++j)
-		{
-			delete resourceVectors[i][j];
-			resourceVectors[i][j] = NULL;
-		}
-		resourceVectors[i].clear();
+		cProjectileSystem->Destroy();
+		cProjectileSystem = NULL;
 	}
-	resourceVectors.clear();
 
 	if (cGUI_Scene2D)
 	{
@@ -105,7 +120,9 @@ SnowPlanet::~SnowPlanet(void)
 */
 bool SnowPlanet::Init(void)
 {
+	// Tag the resources which each part of the planet creates, until the next tag, so that their leaks can be told apart
 	//Create Background Entity
+	RESOURCE_TAG("CBackgroundEntity");
 	background = new CBackgroundEntity("Image/SnowPlanet/SnowBackground.png");
 	background->SetShader("Shader2D");
 	background->Init();
@@ -121,6 +138,7 @@ bool SnowPlanet::Init(void)
 	cInventoryManagerPlanet = CInventoryManagerPlanet::GetInstance();
 
 	// Create and initialise the CGUI_Scene2D
+	RESOURCE_TAG("CGUI_Scene2D");
 	cGUI_Scene2D = CGUI_Scene2D::GetInstance();
 	// Initialise the instance
 	if (cGUI_Scene2D->Init() == false)
@@ -132,6 +150,7 @@ bool SnowPlanet::Init(void)
 
 
 	// Create and initialise the cMap2D
+	RESOURCE_TAG("CMap2D");
 	cMap2D = CMap2D::GetInstance();
 	// Set a shader to this class
 	cMap2D->SetShader("Shader2D");
@@ -165,6 +184,7 @@ bool SnowPlanet::Init(void)
 	}
 
 	// Create and initialise the CPlayer2D
+	RESOURCE_TAG("CPlayer2D");
 	cPlayer2D = CPlayer2D::GetInstance();
 	// Pass shader to cPlayer2D
 	cPlayer2D->SetShader("Shader2D_Colour");
@@ -175,14 +195,16 @@ bool SnowPlanet::Init(void)
 		return false;
 	}
 
-	//clear the individual enemy vectors inside enemyVectors
-	for (int i = 0; i < enemyVectors.size(); ++i)
+	//destroy the enemies and resources of the previous run, and reuse the memory of their arenas
+	RESOURCE_TAG("Enemies and resources");
+	for (int i = 0; i < NUM_LEVELS; ++i)
 	{
-		enemyVectors[i].clear();
+		cLevelArenas[i].Reset();
 	}
 
-	//clear enemyVectors
+	//clear enemyVectors and resourceVectors
 	enemyVectors.clear();
+	resourceVectors.clear();
 
 	//cycle through the maps and find the enemies
 		//and push them into the 2d enemy vector
@@ -200,7 +222,7 @@ bool SnowPlanet::Init(void)
 
 		while (true)
 		{
-			SnowEnemy2DSWB* snowEnemy2DSWB = new SnowEnemy2DSWB();
+			SnowEnemy2DSWB* snowEnemy2DSWB = cLevelArenas[i].Create<SnowEnemy2DSWB>();
 			// Pass shader to cEnemy2D
 			snowEnemy2DSWB->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -211,13 +233,15 @@ bool SnowPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(snowEnemy2DSWB);
 				// Break out of this loop if all enemies have been loaded
 				break;
 			}
 		}
 		while (true)
 		{
-			SnowEnemy2DSWW* snowEnemy2DSWW = new SnowEnemy2DSWW();
+			SnowEnemy2DSWW* snowEnemy2DSWW = cLevelArenas[i].Create<SnowEnemy2DSWW>();
 			// Pass shader to cEnemy2D
 			snowEnemy2DSWW->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -228,13 +252,15 @@ bool SnowPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(snowEnemy2DSWW);
 				// Break out of this loop if all enemies have been loaded
 				break;
 			}
 		}
 		while (true)
 		{
-			SnowEnemy2DSWBS* snowEnemy2DSWBS = new SnowEnemy2DSWBS();
+			SnowEnemy2DSWBS* snowEnemy2DSWBS = cLevelArenas[i].Create<SnowEnemy2DSWBS>();
 			// Pass shader to cEnemy2D
 			snowEnemy2DSWBS->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -245,6 +271,8 @@ bool SnowPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(snowEnemy2DSWBS);
 				// Break out of this loop if all enemies have been loaded
 				break;
 			}
@@ -260,7 +288,7 @@ bool SnowPlanet::Init(void)
 			//gets pushed into the resourceVectors vector once filled 
 		while (true)
 		{
-			CResource* resource = new CResource();
+			CResource* resource = cLevelArenas[i].Create<CResource>();
 			// Pass shader to cEnemy2D
 			resource->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -270,6 +298,8 @@ bool SnowPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(resource);
 				// Break out of this loop if all resources have been loaded
 				break;
 			}
@@ -277,6 +307,11 @@ bool SnowPlanet::Init(void)
 
 		resourceVectors.push_back(resources); //push the vector of enemies into enemyVectors
 
+#ifdef _DEBUG
+		cout << "Level " << i << " ";
+		cLevelArenas[i].PrintSelf();
+#endif
+
 	}
 
 	cMap2D->SetCurrentLevel(0); //reset level
@@ -287,8 +322,21 @@ bool SnowPlanet::Init(void)
 
 
 	// Initialise the Physics
+	RESOURCE_TAG("Physics and projectiles");
 	cPhysics2D.Init();
 
+	// Create and initialise the CPathRequestQueue which solves the enemies' path requests
+	cPathRequestQueue = CPathRequestQueue::GetInstance();
+	cPathRequestQueue->Init();
+
+	// Initialise the spatial grids to cover a level
+	cEnemyGrid.Init(CSettings::GetInstance()->NUM_TILES_XAXIS, CSettings::GetInstance()->NUM_TILES_YAXIS);
+	cAmmoGrid.Init(CSettings::GetInstance()->NUM_TILES_XAXIS, CSettings::GetInstance()->NUM_TILES_YAXIS);
+
+	// Create and initialise the CProjectileSystem which updates and renders the enemies' projectiles
+	cProjectileSystem = CProjectileSystem::GetInstance();
+	cProjectileSystem->Init();
+
 	// Store the keyboard controller singleton instance here
 	cKeyboardController = CKeyboardController::GetInstance();
 
@@ -302,6 +350,7 @@ bool SnowPlanet::Init(void)
 	camera2D->setTargetPos(cPlayer2D->vec2Index);
 
 	// Load the sounds into CSoundController
+	RESOURCE_TAG("Sounds");
 	//common sounds
 	cSoundController = CSoundController::GetInstance();
 	cSoundController->LoadSound(FileSystem::getPath("Sounds\\jumpland.ogg"), CSoundController::SOUND_LIST::LAND, true);
@@ -521,7 +570,7 @@ bool SnowPlanet::Update(const double dElapsedTime)
 
 	// click test
 	if (CMouseController::GetInstance()->IsButtonDown(CMouseController::BUTTON_TYPE::LMB)) {
-		std::cout << camera2D->getBlockSelected().x << " " << camera2D->getBlockSelected().y << "\n";
+		LOG_DEBUG_EVERY(0.25, "SnowPlanet: Selected block ({}, {})", camera2D->getBlockSelected().x, camera2D->getBlockSelected().y);
 	}
 
 	// Call the cPlayer2D's update method before Map2D
@@ -545,16 +594,40 @@ bool SnowPlanet::Update(const double dElapsedTime)
 		CSettings::GetInstance()->MICRO_STEP_XAXIS = 0.0078125f;
 	}
 
+	// Solve the path requests submitted by the enemies in the last frame
+	cPathRequestQueue->Update();
+
+	// Rebuild the spatial grids of this level's enemies and the player's active ammo,
+	// so the interaction checks below only look at what is nearby
+	cEnemyGrid.Clear();
+	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
+	{
+		cEnemyGrid.Insert(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+	}
+	cAmmoGrid.Clear();
+	const std::vector<CAmmo2D*>& playerAmmoList = cPlayer2D->getAmmoList();
+	for (unsigned int i = 0; i < playerAmmoList.size(); i++)
+	{
+		if (playerAmmoList[i]->getActive())
+			cAmmoGrid.Insert(playerAmmoList[i]);
+	}
+	// Entities found by the spatial grid queries
+	std::vector<CEntity2D*> vNearbyEntities;
+
 	// Call all of the cEnemy2D's update methods before Map2D
 	// as we want to capture the updates before Map2D update
 	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
+		PROFILE_SCOPE("Enemy update");
 
 		enemyVectors[cMap2D->GetCurrentLevel()][i]->Update(dElapsedTime);
+		cEnemyGrid.Update(enemyVectors[cMap2D->GetCurrentLevel()][i]);
 
-		//player ammo collision check with enemy
-		std::vector<CAmmo2D*> ammoList = cPlayer2D->getAmmoList();
-		for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+		//player ammo collision check with enemy, only for the ammo in the tiles around this enemy
+		vNearbyEntities.clear();
+		cAmmoGrid.QueryAABB(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index - glm::vec2(1.0f),
+			enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index + glm::vec2(1.0f), vNearbyEntities);
+		for (std::vector<CEntity2D*>::iterator it = vNearbyEntities.begin(); it != vNearbyEntities.end(); ++it)
 		{
 			CAmmo2D* ammo = (CAmmo2D*)*it;
 			if (ammo->getActive())
@@ -591,11 +664,11 @@ bool SnowPlanet::Update(const double dElapsedTime)
 				if (enemyVectors[cMap2D->GetCurrentLevel()][i]->getType() != CEnemy2D::ENEMYTYPE::BROWN) {
 					if (enemyVectors[cMap2D->GetCurrentLevel()][i]->getType() != CEnemy2D::ENEMYTYPE::BOSS) {
 						//20% chance to drop scrap metal, 20% chance to drop battery, 10% chance to drop ice crystal
-						int resourceType = rand() % 20;
+						int resourceType = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(20);
 						std::cout << resourceType << std::endl;
 						if (resourceType < 4) //0 1 2 3
 						{
-							CResource* res = new CResource(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
+							CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
 							res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res->SetShader("Shader2D_Colour"); //set shader
@@ -603,7 +676,7 @@ bool SnowPlanet::Update(const double dElapsedTime)
 						}
 						else if (resourceType > 7 && resourceType < 12) //8 9 10 11
 						{
-							CResource* res = new CResource(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
+							CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
 							res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res->SetShader("Shader2D_Colour"); //set shader
@@ -611,7 +684,7 @@ bool SnowPlanet::Update(const double dElapsedTime)
 						}
 						else if (resourceType > 16 && resourceType < 19) //17 18
 						{
-							CResource* res = new CResource(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ironwood resource
+							CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ironwood resource
 							res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res->SetShader("Shader2D_Colour"); //set shader
@@ -620,17 +693,17 @@ bool SnowPlanet::Update(const double dElapsedTime)
 					}
 					else {
 						//20% chance to drop scrap metal, 20% chance to drop battery, 10% chance to drop ice crystal
-						int resourceType = rand() % 20;
+						int resourceType = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(20);
 						std::cout << resourceType << std::endl;
 						if (resourceType < 4) //0 1 2 3
 						{
-							CResource* res = new CResource(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
+							CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
 							res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res->SetShader("Shader2D_Colour"); //set shader
 							resourceVectors[cMap2D->GetCurrentLevel()].push_back(res); //push this new resource into the resource vector for this level
 													//confirm drop an ice crystal
-							CResource* res2 = new CResource(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new ice crystal resource
+							CResource* res2 = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new ice crystal resource
 							res2->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index + glm::vec2(0.5, 0.5), enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res2->SetShader("Shader2D_Colour"); //set shader
@@ -638,14 +711,14 @@ bool SnowPlanet::Update(const double dElapsedTime)
 						}
 						else if (resourceType > 7 && resourceType < 12) //8 9 10 11
 						{
-							CResource* res = new CResource(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
+							CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
 							res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res->SetShader("Shader2D_Colour"); //set shader
 							resourceVectors[cMap2D->GetCurrentLevel()].push_back(res); //push this new resource into the resource vector for this level
 
 													//confirm drop an ice crystal
-							CResource* res2 = new CResource(CResource::RESOURCE_TYPE::BATTERY); //create new ice crystal resource
+							CResource* res2 = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::BATTERY); //create new ice crystal resource
 							res2->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index + glm::vec2(0.5, 0.5), enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res2->SetShader("Shader2D_Colour"); //set shader
@@ -653,13 +726,13 @@ bool SnowPlanet::Update(const double dElapsedTime)
 						}
 						else if (resourceType > 16 && resourceType < 19) //17 18
 						{
-							CResource* res = new CResource(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ironwood resource
+							CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ironwood resource
 							res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res->SetShader("Shader2D_Colour"); //set shader
 							resourceVectors[cMap2D->GetCurrentLevel()].push_back(res); //push this new resource into the resource vector for this level
 													//confirm drop an ice crystal
-							CResource* res2 = new CResource(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ice crystal resource
+							CResource* res2 = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ice crystal resource
 							res2->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index + glm::vec2(0.5, 0.5), enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 							//set resource's position where enemy's position is
 							res2->SetShader("Shader2D_Colour"); //set shader
@@ -668,7 +741,7 @@ bool SnowPlanet::Update(const double dElapsedTime)
 					}
 				}
 				else {
-					CResource* res = new CResource(CResource::RESOURCE_TYPE::FUR); //create new fur resource
+					CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::FUR); //create new fur resource
 					res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 					//set resource's position where enemy's position is
 					res->SetShader("Shader2D_Colour"); //set shader
@@ -680,7 +753,7 @@ bool SnowPlanet::Update(const double dElapsedTime)
 			{
 				if (enemyVectors[cMap2D->GetCurrentLevel()][i]->getType() != CEnemy2D::ENEMYTYPE::BOSS) {
 					//confirm drop an ice crystal
-					CResource* res = new CResource(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ice crystal resource
+					CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ice crystal resource
 					res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 					//set resource's position where enemy's position is
 					res->SetShader("Shader2D_Colour"); //set shader
@@ -688,13 +761,13 @@ bool SnowPlanet::Update(const double dElapsedTime)
 				}
 				else {
 					//confirm drop an ice crystal
-					CResource* res = new CResource(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ice crystal resource
+					CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ice crystal resource
 					res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 					//set resource's position where enemy's position is
 					res->SetShader("Shader2D_Colour"); //set shader
 					resourceVectors[cMap2D->GetCurrentLevel()].push_back(res); //push this new resource into the resource vector for this level
 										//confirm drop an ice crystal
-					CResource* res2 = new CResource(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ice crystal resource
+					CResource* res2 = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::ICE_CRYSTAL); //create new ice crystal resource
 					res2->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index+glm::vec2(0.5,0.5), enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 					//set resource's position where enemy's position is
 					res2->SetShader("Shader2D_Colour"); //set shader
@@ -702,12 +775,17 @@ bool SnowPlanet::Update(const double dElapsedTime)
 				}
 			}
 
-			delete enemyVectors[cMap2D->GetCurrentLevel()][i];
+			cEnemyGrid.Remove(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+			cProjectileSystem->RemoveByOwner(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+			cLevelArenas[cMap2D->GetCurrentLevel()].Destroy(enemyVectors[cMap2D->GetCurrentLevel()][i]);
 			enemyVectors[cMap2D->GetCurrentLevel()][i] = NULL;
 			enemyVectors[cMap2D->GetCurrentLevel()].erase(enemyVectors[cMap2D->GetCurrentLevel()].begin() + i);
 		}
 	}
 
+	// Update the projectiles shot by the enemies
+	cProjectileSystem->Update(dElapsedTime);
+
 	//update all resources
 	for (unsigned int i = 0; i < resourceVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -716,7 +794,7 @@ bool SnowPlanet::Update(const double dElapsedTime)
 		//if resource is collected
 		if (resourceVectors[cMap2D->GetCurrentLevel()][i]->getCollected())
 		{
-			delete resourceVectors[cMap2D->GetCurrentLevel()][i];
+			cLevelArenas[cMap2D->GetCurrentLevel()].Destroy(resourceVectors[cMap2D->GetCurrentLevel()][i]);
 			resourceVectors[cMap2D->GetCurrentLevel()][i] = NULL;
 			resourceVectors[cMap2D->GetCurrentLevel()].erase(resourceVectors[cMap2D->GetCurrentLevel()].begin() + i);
 		}
@@ -816,9 +894,11 @@ void SnowPlanet::PreRender(void)
  */
 void SnowPlanet::Render(void)
 {
+	RENDER_STATS_PASS(BACKGROUND);
 	background->PreRender();
 	background->Render();
 	background->PostRender();
+	RENDER_STATS_PASS(MAP);
 	// Calls the Map2D's PreRender()
 	cMap2D->PreRender();
 	// Calls the Map2D's Render()
@@ -826,6 +906,7 @@ void SnowPlanet::Render(void)
 	// Calls the Map2D's PostRender()
 	cMap2D->PostRender();
 
+	RENDER_STATS_PASS(ENEMIES);
 	// Calls the CEnemy2D's PreRender()
 	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -837,6 +918,13 @@ void SnowPlanet::Render(void)
 		enemyVectors[cMap2D->GetCurrentLevel()][i]->PostRender();
 	}
 
+	// Render the projectiles shot by the enemies
+	cProjectileSystem->PreRender();
+	cProjectileSystem->Render();
+	cProjectileSystem->PostRender();
+
+	// The resources are counted with the map which they lie on
+	RENDER_STATS_PASS(MAP);
 	// Calls the CResource's PreRender()
 	for (unsigned int i = 0; i < resourceVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -848,6 +936,7 @@ void SnowPlanet::Render(void)
 		resourceVectors[cMap2D->GetCurrentLevel()][i]->PostRender();
 	}
 
+	RENDER_STATS_PASS(PLAYER);
 	// Calls the CPlayer2D's PreRender()
 	cPlayer2D->PreRender();
 	// Calls the CPlayer2D's Render()
@@ -855,6 +944,7 @@ void SnowPlanet::Render(void)
 	// Calls the CPlayer2D's PostRender()
 	cPlayer2D->PostRender();
 
+	RENDER_STATS_PASS(HUD);
 	// Calls the CGUI_Scene2D's PreRender()
 	cGUI_Scene2D->PreRender();
 	// Calls the CGUI_Scene2D's Render()
@@ -863,8 +953,9 @@ void SnowPlanet::Render(void)
 	cGUI_Scene2D->PostRender();
 
 	//render player ammo
-	std::vector<CAmmo2D*> ammoList = cPlayer2D->getAmmoList();
-	for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+	RENDER_STATS_PASS(PLAYER);
+	const std::vector<CAmmo2D*>& ammoList = cPlayer2D->getAmmoList();
+	for (std::vector<CAmmo2D*>::const_iterator it = ammoList.begin(); it != ammoList.end(); ++it)
 	{
 		CAmmo2D* ammo = (CAmmo2D*)*it;
 		if (ammo->getActive())
@@ -909,8 +1000,13 @@ void SnowPlanet::DecideLevel(bool tutorial)
 	{
 		//random between 2 numbers to set us Scrap metal or battery
 			//according to which number type is set to, load which texture
-		int randomState = rand() % 100;
-		if (randomState < 50)
+		int randomState = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(100);
+		int forcedLevel = CGameInfo::GetInstance()->forcedLevel;
+		if ((forcedLevel == LEVEL1) || (forcedLevel == LEVEL2))
+		{
+			cMap2D->SetCurrentLevel(forcedLevel); //level of the scenario being run
+		}
+		else if (randomState < 50)
 		{
 			cMap2D->SetCurrentLevel(LEVEL1); //level 1
 		}
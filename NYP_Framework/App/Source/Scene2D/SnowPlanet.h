@@ -19,7 +19,7 @@
 #include <includes/gtc/type_ptr.hpp>
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
@@ -36,6 +36,18 @@
 // Include CPhysics2D
 #include "Physics2D.h"
 
+// Include CPathRequestQueue
+#include "PathRequestQueue.h"
+
+// Include CSpatialGrid
+#include "SpatialGrid.h"
+
+// Include CProjectileSystem
+#include "ProjectileSystem.h"
+
+// Include CLevelArena
+#include "LevelArena.h"
+
 // Include GUI_Scene2D
 #include "GUI_Scene2D.h"
 
@@ -43,7 +55,7 @@
 #include <vector>
 
 // Include Keyboard controller
-#include "Inputs\KeyboardController.h"
+#include "Inputs/KeyboardController.h"
 
 // Game Manager
 #include "GameManager.h"
@@ -52,7 +64,7 @@
 #include "Primitives/Camera2D.h"
 
 // Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 #include "../Scene2D/InventoryManagerPlanet.h"
 #include "../App/Source/Scene2D/BackgroundEntity.h"
@@ -64,7 +76,6 @@
 
 //include ammo
 #include "Ammo2D.h"
-#include "EnemyAmmo2D.h"
 
 //include resources
 #include "Resource.h"
@@ -133,6 +144,16 @@ protected:
 	// Physics
 	CPhysics2D cPhysics2D;
 
+	// The handler containing the instance of CPathRequestQueue
+	CPathRequestQueue* cPathRequestQueue;
+
+	// Spatial grids of the enemies and the player's ammo in the current level
+	CSpatialGrid cEnemyGrid;
+	CSpatialGrid cAmmoGrid;
+
+	// The handler containing the instance of CProjectileSystem
+	CProjectileSystem* cProjectileSystem;
+
 	// The handler containing the instance of CGUI_Scene2D
 	CGUI_Scene2D* cGUI_Scene2D;
 
@@ -162,6 +183,9 @@ protected:
 		NUM_LEVELS //to set the number of maps to load in for 1 scene and the number of maps to check for enemies to push in
 	};
 
+	// The enemies and resources of each level are allocated from the arena of that level
+	CLevelArena cLevelArenas[NUM_LEVELS];
+
 	// zoom (just for demo)
 	// TODO: [SP3] Remove code
 	bool isZoomedIn = false;
@@ -0,0 +1,284 @@
+/**
+ CSpatialGrid
+ @brief A class which buckets entities into a uniform grid keyed by their tile index, for fast proximity queries
+ */
+#include "SpatialGrid.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+using namespace std;
+
+/**
+ @brief Constructor
+ */
+CSpatialGrid::CSpatialGrid(void)
+	: uiNumCols(0)
+	, uiNumRows(0)
+	, uiCellSize(1)
+	, uiNumCellCols(0)
+	, uiNumCellRows(0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CSpatialGrid::~CSpatialGrid(void)
+{
+	// We won't delete the entities since they were created elsewhere
+	Clear();
+}
+
+/**
+ @brief Init Initialise this instance
+ @param uiNumCols A const unsigned int containing the number of tiles in the x-axis of the level
+ @param uiNumRows A const unsigned int containing the number of tiles in the y-axis of the level
+ @param uiCellSize A const unsigned int containing the number of tiles along each side of a cell
+ */
+bool CSpatialGrid::Init(const unsigned int uiNumCols, const unsigned int uiNumRows, const unsigned int uiCellSize)
+{
+	if ((uiNumCols == 0) || (uiNumRows == 0) || (uiCellSize == 0))
+	{
+		cout << "CSpatialGrid::Init: Invalid grid size." << endl;
+		return false;
+	}
+
+	this->uiNumCols = uiNumCols;
+	this->uiNumRows = uiNumRows;
+	this->uiCellSize = uiCellSize;
+	uiNumCellCols = (uiNumCols + uiCellSize - 1) / uiCellSize;
+	uiNumCellRows = (uiNumRows + uiCellSize - 1) / uiCellSize;
+
+	vCells.clear();
+	vCells.resize(uiNumCellCols * uiNumCellRows);
+	mapEntityCells.clear();
+
+	return true;
+}
+
+/**
+ @brief Remove all entities from the grid. The cells keep their memory so the grid can be refilled each frame
+ */
+void CSpatialGrid::Clear(void)
+{
+	for (unsigned int i = 0; i < vCells.size(); i++)
+		vCells[i].clear();
+	mapEntityCells.clear();
+}
+
+/**
+ @brief Insert an entity into the cell of its vec2Index
+ @param cEntity A CEntity2D* of the entity to insert
+ */
+void CSpatialGrid::Insert(CEntity2D* cEntity)
+{
+	if ((cEntity == NULL) || (vCells.empty()))
+		return;
+
+	// An entity is only kept in one cell
+	if (mapEntityCells.find(cEntity) != mapEntityCells.end())
+	{
+		Update(cEntity);
+		return;
+	}
+
+	unsigned int uiCell = GetCellRow(cEntity->vec2Index.y) * uiNumCellCols + GetCellCol(cEntity->vec2Index.x);
+	vCells[uiCell].push_back(cEntity);
+	mapEntityCells[cEntity] = uiCell;
+}
+
+/**
+ @brief Move an entity into the cell of its current vec2Index
+ @param cEntity A CEntity2D* of the entity which has moved
+ */
+void CSpatialGrid::Update(CEntity2D* cEntity)
+{
+	if ((cEntity == NULL) || (vCells.empty()))
+		return;
+
+	std::unordered_map<CEntity2D*, unsigned int>::iterator it = mapEntityCells.find(cEntity);
+	if (it == mapEntityCells.end())
+	{
+		Insert(cEntity);
+		return;
+	}
+
+	unsigned int uiCell = GetCellRow(cEntity->vec2Index.y) * uiNumCellCols + GetCellCol(cEntity->vec2Index.x);
+	if (uiCell == it->second)
+		return;
+
+	RemoveFromCell(cEntity, it->second);
+	vCells[uiCell].push_back(cEntity);
+	it->second = uiCell;
+}
+
+/**
+ @brief Remove an entity from the grid
+ @param cEntity A CEntity2D* of the entity to remove
+ */
+void CSpatialGrid::Remove(CEntity2D* cEntity)
+{
+	std::unordered_map<CEntity2D*, unsigned int>::iterator it = mapEntityCells.find(cEntity);
+	if (it == mapEntityCells.end())
+		return;
+
+	RemoveFromCell(cEntity, it->second);
+	mapEntityCells.erase(it);
+}
+
+/**
+ @brief Get the entities in the cell which contains a tile
+ @param iCol A const int containing the column of the tile
+ @param iRow A const int containing the row of the tile
+ @return A const reference to the entities in that cell
+ */
+const std::vector<CEntity2D*>& CSpatialGrid::GetEntitiesInCell(const int iCol, const int iRow) const
+{
+	if ((vCells.empty()) ||
+		(iCol < 0) || (iCol >= (int)uiNumCols) ||
+		(iRow < 0) || (iRow >= (int)uiNumRows))
+		return vEmptyCell;
+
+	return vCells[GetCellRow((float)iRow) * uiNumCellCols + GetCellCol((float)iCol)];
+}
+
+/**
+ @brief Get the entities whose vec2Index is within a box
+ @param vec2Min A const glm::vec2& containing the lower left corner of the box, in tiles
+ @param vec2Max A const glm::vec2& containing the upper right corner of the box, in tiles
+ @param results A std::vector<CEntity2D*>& which the entities found are appended to
+ */
+void CSpatialGrid::QueryAABB(const glm::vec2& vec2Min, const glm::vec2& vec2Max, std::vector<CEntity2D*>& results) const
+{
+	if (vCells.empty())
+		return;
+
+	int iMinCellCol = GetCellCol(vec2Min.x);
+	int iMaxCellCol = GetCellCol(vec2Max.x);
+	int iMinCellRow = GetCellRow(vec2Min.y);
+	int iMaxCellRow = GetCellRow(vec2Max.y);
+
+	for (int iCellRow = iMinCellRow; iCellRow <= iMaxCellRow; iCellRow++)
+	{
+		for (int iCellCol = iMinCellCol; iCellCol <= iMaxCellCol; iCellCol++)
+		{
+			const std::vector<CEntity2D*>& vCell = vCells[iCellRow * uiNumCellCols + iCellCol];
+			for (unsigned int i = 0; i < vCell.size(); i++)
+			{
+				const glm::vec2& vec2Index = vCell[i]->vec2Index;
+				if ((vec2Index.x >= vec2Min.x) && (vec2Index.x <= vec2Max.x) &&
+					(vec2Index.y >= vec2Min.y) && (vec2Index.y <= vec2Max.y))
+					results.push_back(vCell[i]);
+			}
+		}
+	}
+}
+
+/**
+ @brief Get the entities whose vec2Index is less than fRadius tiles away from a position
+ @param vec2Centre A const glm::vec2& containing the position to search around, in tiles
+ @param fRadius A const float containing the search radius, in tiles
+ @param results A std::vector<CEntity2D*>& which the entities found are appended to
+ */
+void CSpatialGrid::QueryRadius(const glm::vec2& vec2Centre, const float fRadius, std::vector<CEntity2D*>& results) const
+{
+	if (vCells.empty())
+		return;
+
+	int iMinCellCol = GetCellCol(vec2Centre.x - fRadius);
+	int iMaxCellCol = GetCellCol(vec2Centre.x + fRadius);
+	int iMinCellRow = GetCellRow(vec2Centre.y - fRadius);
+	int iMaxCellRow = GetCellRow(vec2Centre.y + fRadius);
+	float fRadiusSquared = fRadius * fRadius;
+
+	for (int iCellRow = iMinCellRow; iCellRow <= iMaxCellRow; iCellRow++)
+	{
+		for (int iCellCol = iMinCellCol; iCellCol <= iMaxCellCol; iCellCol++)
+		{
+			const std::vector<CEntity2D*>& vCell = vCells[iCellRow * uiNumCellCols + iCellCol];
+			for (unsigned int i = 0; i < vCell.size(); i++)
+			{
+				glm::vec2 vec2Offset = vCell[i]->vec2Index - vec2Centre;
+				if (glm::dot(vec2Offset, vec2Offset) < fRadiusSquared)
+					results.push_back(vCell[i]);
+			}
+		}
+	}
+}
+
+/**
+ @brief Get the number of entities in the grid
+ */
+unsigned int CSpatialGrid::GetNumEntities(void) const
+{
+	return (unsigned int)mapEntityCells.size();
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CSpatialGrid::PrintSelf(void)
+{
+	unsigned int uiNumOccupiedCells = 0;
+	unsigned int uiLargestCell = 0;
+	for (unsigned int i = 0; i < vCells.size(); i++)
+	{
+		if (vCells[i].size() > 0)
+			uiNumOccupiedCells++;
+		if (vCells[i].size() > uiLargestCell)
+			uiLargestCell = (unsigned int)vCells[i].size();
+	}
+
+	cout << endl << "CSpatialGrid::PrintSelf()" << endl;
+	cout << "Level: " << uiNumCols << "x" << uiNumRows << " tiles, cell size: " << uiCellSize
+		<< ", cells: " << uiNumCellCols << "x" << uiNumCellRows << endl;
+	cout << "Entities: " << GetNumEntities() << ", occupied cells: " << uiNumOccupiedCells
+		<< ", largest cell: " << uiLargestCell << endl;
+	cout << "===== CSpatialGrid::PrintSelf() =====" << endl;
+}
+
+/**
+ @brief Get the cell column of a tile, clamped to the grid
+ @param fCol A const float containing the column of the tile
+ */
+int CSpatialGrid::GetCellCol(const float fCol) const
+{
+	int iCol = (int)floor(fCol);
+	if (iCol < 0)
+		iCol = 0;
+	else if (iCol >= (int)uiNumCols)
+		iCol = (int)uiNumCols - 1;
+	return iCol / (int)uiCellSize;
+}
+
+/**
+ @brief Get the cell row of a tile, clamped to the grid
+ @param fRow A const float containing the row of the tile
+ */
+int CSpatialGrid::GetCellRow(const float fRow) const
+{
+	int iRow = (int)floor(fRow);
+	if (iRow < 0)
+		iRow = 0;
+	else if (iRow >= (int)uiNumRows)
+		iRow = (int)uiNumRows - 1;
+	return iRow / (int)uiCellSize;
+}
+
+/**
+ @brief Remove an entity from a cell
+ @param cEntity A CEntity2D* of the entity to remove
+ @param uiCell A const unsigned int containing the index of the cell
+ */
+void CSpatialGrid::RemoveFromCell(CEntity2D* cEntity, const unsigned int uiCell)
+{
+	std::vector<CEntity2D*>& vCell = vCells[uiCell];
+	std::vector<CEntity2D*>::iterator it = std::find(vCell.begin(), vCell.end(), cEntity);
+	if (it != vCell.end())
+	{
+		// The order within a cell does not matter, so swap with the last entity instead of shifting
+		*it = vCell.back();
+		vCell.pop_back();
+	}
+}
@@ -0,0 +1,76 @@
+/**
+ CSpatialGrid
+ @brief A class which buckets entities into a uniform grid keyed by their tile index, for fast proximity queries
+ */
+#pragma once
+
+// Include GLM
+#include <includes/glm.hpp>
+
+// Include CEntity2D
+#include "Primitives/Entity2D.h"
+
+#include <vector>
+#include <unordered_map>
+
+class CSpatialGrid
+{
+public:
+	// Constructor
+	CSpatialGrid(void);
+
+	// Destructor
+	virtual ~CSpatialGrid(void);
+
+	// Init the grid to cover a level of uiNumCols x uiNumRows tiles, with uiCellSize tiles per cell
+	bool Init(const unsigned int uiNumCols, const unsigned int uiNumRows, const unsigned int uiCellSize = 1);
+
+	// Remove all entities from the grid
+	void Clear(void);
+
+	// Insert an entity into the cell of its vec2Index
+	void Insert(CEntity2D* cEntity);
+
+	// Move an entity into the cell of its current vec2Index. Inserts the entity if it is not in the grid yet
+	void Update(CEntity2D* cEntity);
+
+	// Remove an entity from the grid
+	void Remove(CEntity2D* cEntity);
+
+	// Get the entities in the cell which contains a tile. Entities outside the level are kept in the nearest edge cell
+	const std::vector<CEntity2D*>& GetEntitiesInCell(const int iCol, const int iRow) const;
+
+	// Get the entities whose vec2Index is within the box from vec2Min to vec2Max, inclusive
+	void QueryAABB(const glm::vec2& vec2Min, const glm::vec2& vec2Max, std::vector<CEntity2D*>& results) const;
+
+	// Get the entities whose vec2Index is less than fRadius tiles away from vec2Centre
+	void QueryRadius(const glm::vec2& vec2Centre, const float fRadius, std::vector<CEntity2D*>& results) const;
+
+	// Get the number of entities in the grid
+	unsigned int GetNumEntities(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
+protected:
+	// Size of the grid
+	unsigned int uiNumCols;
+	unsigned int uiNumRows;
+	unsigned int uiCellSize;
+	unsigned int uiNumCellCols;
+	unsigned int uiNumCellRows;
+
+	// The entities in each cell, indexed by (cellRow * uiNumCellCols + cellCol)
+	std::vector<std::vector<CEntity2D*>> vCells;
+	// The cell which each entity is in
+	std::unordered_map<CEntity2D*, unsigned int> mapEntityCells;
+	// Returned for cells which are not in the grid
+	std::vector<CEntity2D*> vEmptyCell;
+
+	// Get the cell column and row of a tile, clamped to the grid
+	int GetCellCol(const float fCol) const;
+	int GetCellRow(const float fRow) const;
+
+	// Remove an entity from a cell
+	void RemoveFromCell(CEntity2D* cEntity, const unsigned int uiCell);
+};
@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,27 +20,36 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
 // Include math.h
 #include <math.h>
 
+// The state table of TEnemy2DDummy, in real seconds. A dMaxTime of 0.0 means that the state does not time out,
+// and a timeout state of NO_STATE that the Update decides which state it times out into
+const CEnemyFSM::SState TEnemy2DDummy::sFSMStates[TEnemy2DDummy::NUM_FSM] =
+{
+	{ "HIDDEN", 0.0, CEnemyFSM::NO_STATE },
+	{ "DECLOAK", 2.0, CEnemyFSM::NO_STATE },
+	{ "TARGET", 2.0, CEnemyFSM::NO_STATE },
+	{ "ATTACK", 0.0, CEnemyFSM::NO_STATE },
+	{ "CLOAK", 2.0, HIDDEN },
+	{ "ALERT_DECLOAK", 2.0, CEnemyFSM::NO_STATE },
+	{ "ALERT_TARGET", 2.0, CEnemyFSM::NO_STATE },
+	{ "ALERT_ATTACK", 0.0, CEnemyFSM::NO_STATE },
+	{ "ALERT_STANDBY", 0.0, CEnemyFSM::NO_STATE }
+};
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 TEnemy2DDummy::TEnemy2DDummy(void)
-	: bIsActive(false)
-	, cMap2D(NULL)
-	, cSettings(NULL)
-	, cPlayer2D(NULL)
-	, sCurrentFSM(FSM::HIDDEN)
-	, iFSMCounter(0)
-	, quadMesh(NULL)
-	, camera2D(NULL)
-	, animatedSprites(NULL)
 {
+	// Start the FSM in its initial state
+	cFSM.Init(CEnemyFSM::TERRESTRIAL_DUMMY, sFSMStates, NUM_FSM, HIDDEN);
+
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
 	// Initialise vecIndex
@@ -129,7 +140,7 @@ bool TEnemy2DDummy::Init(void)
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the enemy texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/DummySpriteSheet.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/DummySpriteSheet.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/DummySpriteSheet.png" << endl;
@@ -162,14 +173,6 @@ bool TEnemy2DDummy::Init(void)
 	// If this class is initialised properly, then set the bIsActive to true
 	bIsActive = true;
 
-	//Construct 100 inactive ammo and add into ammoList
-	for (int i = 0; i < 100; ++i)
-	{
-		CTEAmmoDummy* cEnemyAmmo2D = new CTEAmmoDummy();
-		cEnemyAmmo2D->SetShader("Shader2D");
-		ammoList.push_back(cEnemyAmmo2D);
-	}
-
 	if (vec2Index == glm::vec2(24, 21))
 	{
 		type = KEYHOLDER_PURPLE; // drops a purple key upon being killed
@@ -211,7 +214,7 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 
 	// just for switching between states --> keep simple
 	//action done under interaction with player, update position, update direction, etc
-	switch (sCurrentFSM)
+	switch (cFSM.GetState())
 	{
 	case HIDDEN:
 	{
@@ -228,8 +231,7 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 
 		if (isAlarmOn)
 		{
-			sCurrentFSM = ALERT_DECLOAK;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_DECLOAK);
 			animatedSprites->Reset();
 			cout << "Switching to Alert_Decloak state" << endl;
 			break;
@@ -237,8 +239,7 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) <= 5.f)
 		{
-			sCurrentFSM = DECLOAK;
-			iFSMCounter = 0;
+			cFSM.SetState(DECLOAK);
 			animatedSprites->Reset();
 			cout << "Switching to Decloak State" << endl;
 			break;
@@ -260,15 +261,14 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 			//cout << "Play decloakL anim" << endl;
 		}
 
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.IsTimeUp())
 		{
-			sCurrentFSM = ATTACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ATTACK);
 			attackTimer = attackInterval;
 			cout << "Switching to Attack State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	}
 	case ATTACK:
@@ -292,10 +292,7 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 		{
 			// Shoot enemy ammo!
 			//shoot ammo in accordance to the direction enemy is facing
-			CTEAmmoDummy* ammo = FetchAmmo();
-			ammo->setActive(true);
-			ammo->setPath(vec2Index.x, vec2Index.y, shootingDirection);
-			ammo->setIsAlerted(false);
+			CProjectileSystem::GetInstance()->Spawn(CProjectileSystem::TERRESTRIAL_DUMMY, this, vec2Index, shootingDirection);
 			cout << "Bam!" << shootingDirection << endl;
 
 			cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::TURRET_SHOOTING); // play sound effect for the turret shooting
@@ -310,14 +307,13 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 
 		if (numFired >= attackMagSize)
 		{
-			sCurrentFSM = TARGET;
-			iFSMCounter = 0;
+			cFSM.SetState(TARGET);
 			attackTimer = 0;
 			numFired = 0;
 			cout << "Switching to Target State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	}
 	case TARGET:
@@ -335,29 +331,26 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 
 		if (isAlarmOn)
 		{
-			sCurrentFSM = ALERT_TARGET;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_TARGET);
 			cout << "Switching to Alert_Target state" << endl;
 			break;
 		}
 
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) > 7.f)
 		{
-			sCurrentFSM = CLOAK;
-			iFSMCounter = 0;
+			cFSM.SetState(CLOAK);
 			cout << "Switching to Cloak State" << endl;
 			break;
 		}
 
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.IsTimeUp())
 		{
-			sCurrentFSM = ATTACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ATTACK);
 			attackTimer = attackInterval;
 			cout << "Switching to Attack State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	}
 	case CLOAK:
@@ -375,13 +368,11 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 			//cout << "Play cloakL anim" << endl;
 		}
 
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.CheckTimeout())
 		{
-			sCurrentFSM = HIDDEN;
-			iFSMCounter = 0;
 			cout << "Switching to Hidden State" << endl;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	}
 	case ALERT_DECLOAK:
@@ -399,14 +390,13 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 			//cout << "Play decloakL anim" << endl;
 		}
 
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.IsTimeUp())
 		{
-			sCurrentFSM = ALERT_ATTACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_ATTACK);
 			attackTimer = alertAttackInterval;
 			cout << "Switching to Alert_Attack State" << endl;
 		}
-		iFSMCounter += 2;
+		cFSM.AddTime(2 * dElapsedTime);
 		break;
 	}
 	case ALERT_ATTACK:
@@ -429,10 +419,7 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 		{
 			// Shoot enemy ammo!
 			//shoot ammo in accordance to the direction enemy is facing
-			CTEAmmoDummy* ammo = FetchAmmo();
-			ammo->setActive(true);
-			ammo->setPath(vec2Index.x, vec2Index.y, shootingDirection);
-			ammo->setIsAlerted(true);
+			CProjectileSystem::GetInstance()->Spawn(CProjectileSystem::TERRESTRIAL_DUMMY, this, vec2Index, shootingDirection, true);
 			cout << "Bam!" << shootingDirection << endl;
 
 			cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::TURRET_SHOOTING); // play sound effect for the turret shooting
@@ -447,8 +434,7 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 
 		if (numFired >= alertAttackMagSize)
 		{
-			sCurrentFSM = ALERT_TARGET;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_TARGET);
 			attackTimer = 0;
 			numFired = 0;
 			cout << "Switching to Alert_Target State" << endl;
@@ -470,29 +456,26 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 
 		if (!isAlarmOn)
 		{
-			sCurrentFSM = TARGET;
-			iFSMCounter = 0;
+			cFSM.SetState(TARGET);
 			cout << "Switching to Target state" << endl;
 			break;
 		}
 
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) > 9.f)
 		{
-			sCurrentFSM = ALERT_STANDBY;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_STANDBY);
 			cout << "Switching to Alert_Standby State" << endl;
 			break;
 		}
 
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.IsTimeUp())
 		{
-			sCurrentFSM = ALERT_ATTACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_ATTACK);
 			attackTimer = alertAttackInterval;
 			cout << "Switching to Alert_Attack State" << endl;
 			break;
 		}
-		iFSMCounter += 2;
+		cFSM.AddTime(2 * dElapsedTime);
 		break;
 	}
 	case ALERT_STANDBY:
@@ -510,16 +493,14 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 
 		if (!isAlarmOn)
 		{
-			sCurrentFSM = TARGET;
-			iFSMCounter = 0;
+			cFSM.SetState(TARGET);
 			cout << "Switching to Target State" << endl;
 			break;
 		}
 
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) <= 9.f)
 		{
-			sCurrentFSM = ALERT_TARGET;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_TARGET);
 			cout << "Switching to Alert_Target State" << endl;
 			break;
 		}
@@ -529,20 +510,6 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 		break;
 	}
 
-	//ammo beahviour
-	for (std::vector<CTEAmmoDummy*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoDummy* ammo = (CTEAmmoDummy*)*it;
-		if (ammo->getActive())
-		{
-			ammo->Update(dElapsedTime);
-			if (ammo->LimitReached())
-			{
-				ammo->setActive(false);
-			}
-		}
-	}
-
 	UpdateDirection();
 
 	// Update Jump or Fall
@@ -560,25 +527,6 @@ void TEnemy2DDummy::Update(const double dElapsedTime)
 	vec2UVCoordinate.y = cSettings->ConvertIndexToUVSpace(cSettings->y, vec2Index.y, false, vec2NumMicroSteps.y*cSettings->ENEMY_MICRO_STEP_YAXIS);
 }
 
-/**
- @brief Set up the OpenGL display environment before rendering
- */
-void TEnemy2DDummy::PreRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
-
-	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	// Activate the shader
-	CShaderManager::GetInstance()->Use(sShaderName);
-}
-
 /**
  @brief Render this instance
  */
@@ -597,12 +545,14 @@ void TEnemy2DDummy::Render(void)
 	glm::vec2 offset = glm::vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, vec2NumMicroSteps, IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += vec2NumMicroSteps.x * cSettings->ENEMY_MICRO_STEP_XAXIS;
-	actualPos.y += vec2NumMicroSteps.y * cSettings->ENEMY_MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->ENEMY_MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->ENEMY_MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -615,36 +565,13 @@ void TEnemy2DDummy::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
 
 	glBindTexture(GL_TEXTURE_2D, 0);
 
-	//render enemy ammo
-	for (std::vector<CTEAmmoDummy*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoDummy* ammo = (CTEAmmoDummy*)*it;
-		if (ammo->getActive())
-		{
-			ammo->PreRender();
-			ammo->Render();
-			ammo->PostRender();
-		}
-	}
-
-}
-
-/**
- @brief PostRender Set up the OpenGL display environment after rendering.
- */
-void TEnemy2DDummy::PostRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// Disable blending
-	glDisable(GL_BLEND);
 }
 
 /**
@@ -669,18 +596,6 @@ void TEnemy2DDummy::Setvec2NumMicroSteps(const int iNumMicroSteps_XAxis, const i
 	this->vec2NumMicroSteps.y = iNumMicroSteps_YAxis;
 }
 
-/**
- @brief Set the handle to cPlayer to this class instance
- @param cPlayer2D A CPlayer2D* variable which contains the pointer to the CPlayer2D instance
- */
-void TEnemy2DDummy::SetPlayer2D(CPlayer2D* cPlayer2D)
-{
-	this->cPlayer2D = cPlayer2D;
-
-	// Update the enemy's direction
-	UpdateDirection();
-}
-
 /**
  @brief Constraint the enemy2D's position within a boundary
  @param eDirection A DIRECTION enumerated data type which indicates the direction to check
@@ -995,16 +910,6 @@ bool TEnemy2DDummy::InteractWithPlayer(void)
 }
 
 //enemy interact with map
-void TEnemy2DDummy::InteractWithMap(void)
-{
-	switch (cMap2D->GetMapInfo(vec2Index.y, vec2Index.x))
-	{
-	
-	default:
-		break;
-	}
-}
-
 /**
  @brief Update the enemy's direction.
  */
@@ -1032,14 +937,6 @@ void TEnemy2DDummy::UpdateDirection(void)
 	}
 }
 
-/**
- @brief Flip horizontal direction. For patrol use only
- */
-void TEnemy2DDummy::FlipHorizontalDirection(void)
-{
-	vec2Direction.x *= -1;
-}
-
 /**
 @brief Update position.
 */
@@ -1093,31 +990,4 @@ void TEnemy2DDummy::UpdatePosition(void)
 		// Interact with the Player
 		//InteractWithPlayer();
 	}
-}
-
-//called whenever an ammo is needed to be shot
-CTEAmmoDummy* TEnemy2DDummy::FetchAmmo()
-{
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CTEAmmoDummy*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoDummy* ammo = (CTEAmmoDummy*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// By default, microsteps should be zero --> reset in case a previously active ammo that was used then ste inactive was used again
-		ammo->vec2NumMicroSteps = glm::vec2(0, 0);
-		return ammo;
-	}
-
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CTEAmmoDummy);
-	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
-
 }
\ No newline at end of file
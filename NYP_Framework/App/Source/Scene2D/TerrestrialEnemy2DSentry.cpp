@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,27 +20,40 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
 // Include math.h
 #include <math.h>
 
+// The state table of TEnemy2DSentry, in real seconds. A dMaxTime of 0.0 means that the state does not time out,
+// and a timeout state of NO_STATE that the Update decides which state it times out into
+const CEnemyFSM::SState TEnemy2DSentry::sFSMStates[TEnemy2DSentry::NUM_FSM] =
+{
+	{ "IDLE", 3.0, PATROL },
+	{ "PATROL", 0.0, CEnemyFSM::NO_STATE },
+	{ "TRACK", 0.0, CEnemyFSM::NO_STATE },
+	{ "SHOOT", 0.0, CEnemyFSM::NO_STATE },
+	{ "WARN", 0.0, CEnemyFSM::NO_STATE },
+	{ "ALARM_TRIGGER", 0.0, CEnemyFSM::NO_STATE },
+	{ "ALERT_IDLE", 3.0, ALERT_PATROL },
+	{ "ALERT_PATROL", 0.0, CEnemyFSM::NO_STATE },
+	{ "ALERT_TRACK", 0.0, CEnemyFSM::NO_STATE },
+	{ "ALERT_SHOOT", 0.0, CEnemyFSM::NO_STATE }
+};
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 TEnemy2DSentry::TEnemy2DSentry(void)
-	: bIsActive(false)
-	, cMap2D(NULL)
-	, cSettings(NULL)
-	, cPlayer2D(NULL)
-	, sCurrentFSM(FSM::IDLE)
-	, iFSMCounter(0)
-	, quadMesh(NULL)
-	, camera2D(NULL)
-	, animatedSprites(NULL)
 {
+	// Start the FSM in its initial state
+	cFSM.Init(CEnemyFSM::TERRESTRIAL_SENTRY, sFSMStates, NUM_FSM, IDLE);
+
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
 	// Initialise vecIndex
@@ -129,7 +144,7 @@ bool TEnemy2DSentry::Init(void)
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the enemy texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/SentrySpriteSheet.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/SentrySpriteSheet.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/SentrySpriteSheet.png" << endl;
@@ -158,14 +173,6 @@ bool TEnemy2DSentry::Init(void)
 	// If this class is initialised properly, then set the bIsActive to true
 	bIsActive = true;
 
-	//Construct 100 inactive ammo and add into ammoList
-	for (int i = 0; i < 100; ++i)
-	{
-		CTEAmmoSentry* cEnemyAmmo2D = new CTEAmmoSentry();
-		cEnemyAmmo2D->SetShader("Shader2D");
-		ammoList.push_back(cEnemyAmmo2D);
-	}
-
 	type = LONG_RANGE; //has ammo
 	shootingDirection = RIGHT; //setting direction for ammo shooting
 	maxHealth = health = 700; // 100 damage per hit from player
@@ -230,14 +237,13 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 
 	// just for switching between states --> keep simple
 	//action done under interaction with player, update position, update direction, etc
-	switch (sCurrentFSM)
+	switch (cFSM.GetState())
 	{
 	case IDLE:
 	{
 		if (isAlarmOn)
 		{
-			sCurrentFSM = ALERT_IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_IDLE);
 			cout << "Switching to Alert_Idle State" << endl;
 			break;
 		}
@@ -251,34 +257,30 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 			animatedSprites->PlayAnimation("idleL", -1, 1.0f);
 		}
 
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.CheckTimeout())
 		{
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
 			cout << "Switching to Patrol State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	}
 	case PATROL:
 	{
 		if (isAlarmOn)
 		{
-			sCurrentFSM = ALERT_IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_IDLE);
 			cout << "Switching to Alert_Idle State" << endl;
 			break;
 		}
 
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 5.f)
 		{
-			int randomState = rand() % 100;
+			int randomState = CRandomManager::GetInstance()->Get(CRandomManager::AI).Next(100);
 			cout << randomState << endl;
 			if (randomState < 50)
 			{
-				sCurrentFSM = TRACK;
-				iFSMCounter = 0;
+				cFSM.SetState(TRACK);
 				cout << "Switching to Track State" << endl;
 				break;
 			}
@@ -286,16 +288,14 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 			{			
 				if (!isAlarmerActive && !isAlarmOn)
 				{	
-					sCurrentFSM = WARN;
-					iFSMCounter = 0;
+					cFSM.SetState(WARN);
 					isAlarmerActive = true;
 					cout << "Switching to Warn State" << endl;
 					break;
 				}
 				else
 				{
-					sCurrentFSM = TRACK;
-					iFSMCounter = 0;
+					cFSM.SetState(TRACK);
 					cout << "Switching to Track State" << endl;
 					break;
 				}
@@ -306,8 +306,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 			if (vec2Index == waypoints[currentWaypointCounter])
 			{
 				currentWaypointCounter++;
-				sCurrentFSM = IDLE;
-				iFSMCounter = 0;
+				cFSM.SetState(IDLE);
 				cout << "Switching to Idle State" << endl;
 			}
 
@@ -374,8 +373,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 	{
 		if (isAlarmOn)
 		{
-			sCurrentFSM = ALERT_IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_IDLE);
 			cout << "Switching to Alert_Idle State" << endl;
 			break;
 		}
@@ -432,8 +430,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 
 			if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) <= 3.f)
 			{
-				sCurrentFSM = SHOOT;
-				iFSMCounter = 0;
+				cFSM.SetState(SHOOT);
 				attackTimer = attackInterval;
 				cout << "Switching to Shoot State" << endl;
 				break;
@@ -443,8 +440,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 		}
 		else
 		{
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
+			cFSM.SetState(PATROL);
 			cout << "Switching to Patrol State" << endl;
 
 			float waypointDist = -1.f;
@@ -489,10 +485,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 		{
 			// Shoot enemy ammo!
 			//shoot ammo in accordance to the direction enemy is facing
-			CTEAmmoSentry* ammo = FetchAmmo();
-			ammo->setActive(true);
-			ammo->setPath(vec2Index.x, vec2Index.y, shootingDirection);
-			ammo->setIsAlerted(false);
+			CProjectileSystem::GetInstance()->Spawn(CProjectileSystem::TERRESTRIAL_SENTRY, this, vec2Index, shootingDirection);
 			cout << "Bam!" << shootingDirection << endl;
 
 			cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::SENTRY_SHOOTING); // play sound effect for the sentry shooting
@@ -507,8 +500,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 
 		if (numFired >= attackMagSize)
 		{
-			sCurrentFSM = TRACK;
-			iFSMCounter = 0;
+			cFSM.SetState(TRACK);
 			attackTimer = 0;
 			numFired = 0;
 			cout << "Switching to Track State" << endl;
@@ -546,39 +538,44 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 
 		//glm::vec2 targetDest = getAssignedAlarmBox();
 
-		auto path = cMap2D->PathFind(startPosition,			// start pos
-									getAssignedAlarmBox(),	// target pos
-									heuristic::euclidean,	// heuristic
-									10);					// weight
-
-		// Calculate new destination
-		bool bFirstPosition = true;
-		for (const auto& coord : path)
+		// The path is found by CPathRequestQueue in a later frame,
+		// so keep heading to the current destination until it is ready
+		vector<glm::vec2> path;
+		if (RequestPath(startPosition,			// start pos
+						getAssignedAlarmBox(),	// target pos
+						heuristic::euclidean,	// heuristic
+						10,						// weight
+						path))
 		{
-			//std::cout << coord.x << ", " << coord.y << "\n";
-			if (bFirstPosition == true)
-			{
-				// Set a destination
-				vec2Destination = coord;
-
-				// Calculate the direction between enemy2D and this destination
-				vec2Direction = vec2Destination - startPosition;
-				bFirstPosition = false;
-
-				/*cout << "startPosition: [" << startPosition.x << ", " << startPosition.y << "], vec2Destination: [" 
-					<< vec2Destination.x << ", " << vec2Destination.y << "], vec2Direction: " << vec2Direction.x <<
-					", targetDest: " << targetDest.x << ", " << targetDest.y << endl;*/
-			}
-			else
+			// Calculate new destination
+			bool bFirstPosition = true;
+			for (const auto& coord : path)
 			{
-				if ((coord - vec2Destination) == vec2Direction)
+				//std::cout << coord.x << ", " << coord.y << "\n";
+				if (bFirstPosition == true)
 				{
 					// Set a destination
 					vec2Destination = coord;
+
+					// Calculate the direction between enemy2D and this destination
+					vec2Direction = vec2Destination - startPosition;
+					bFirstPosition = false;
+
+					/*cout << "startPosition: [" << startPosition.x << ", " << startPosition.y << "], vec2Destination: [" 
+						<< vec2Destination.x << ", " << vec2Destination.y << "], vec2Direction: " << vec2Direction.x <<
+						", targetDest: " << targetDest.x << ", " << targetDest.y << endl;*/
 				}
 				else
 				{
-					break;
+					if ((coord - vec2Destination) == vec2Direction)
+					{
+						// Set a destination
+						vec2Destination = coord;
+					}
+					else
+					{
+						break;
+					}
 				}
 			}
 		}
@@ -587,9 +584,12 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 		
 		if (cMap2D->GetMapInfo(vec2Index.y, vec2Index.x) == CMap2D::TILE_INDEX::ALARM_BOX)
 		{
-			sCurrentFSM = ALARM_TRIGGER;
+			cFSM.SetState(ALARM_TRIGGER, false);
 			cout << "Switching to Alarm_Trigger State" << endl;
 
+			// The alarm box has been reached, so the path to it is no longer needed
+			CancelPathRequest();
+
 			alarmBoxDistance = -1.f;
 			setAssignedAlarmBox(glm::vec2(NULL, NULL));
 			warnTimer = maxWarnTimer;
@@ -624,7 +624,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 		{
 			isAlarmerActive = false;
 
-			sCurrentFSM = ALERT_IDLE;
+			cFSM.SetState(ALERT_IDLE, false);
 			cout << "Switching to Alert_Idle state" << endl;
 			break;
 		}
@@ -634,8 +634,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 	{
 		if (!isAlarmOn)
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(IDLE);
 			cout << "Switching to Idle State" << endl;
 			break;
 		}
@@ -649,30 +648,26 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 			animatedSprites->PlayAnimation("idleL", -1, 1.0f);
 		}
 
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.CheckTimeout())
 		{
-			sCurrentFSM = ALERT_PATROL;
-			iFSMCounter = 0;
 			cout << "Switching to Alert_Patrol State" << endl;
 			break;
 		}
-		iFSMCounter += 2;
+		cFSM.AddTime(2 * dElapsedTime);
 		break;
 	}
 	case ALERT_PATROL:
 	{
 		if (!isAlarmOn)
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(IDLE);
 			cout << "Switching to Idle State" << endl;
 			break;
 		}
 
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 7.f)
 		{
-			sCurrentFSM = ALERT_TRACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_TRACK);
 			cout << "Switching to Alert_Track State" << endl;
 			break;
 		}
@@ -681,8 +676,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 			if (vec2Index == waypoints[currentWaypointCounter])
 			{
 				currentWaypointCounter++;
-				sCurrentFSM = ALERT_IDLE;
-				iFSMCounter = 0;
+				cFSM.SetState(ALERT_IDLE);
 				cout << "Switching to Alert_Idle State" << endl;
 			}
 
@@ -749,8 +743,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 	{
 		if (!isAlarmOn)
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(IDLE);
 			cout << "Switching to Idle State" << endl;
 			break;
 		}
@@ -807,8 +800,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 
 			if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) <= 5.f)
 			{
-				sCurrentFSM = ALERT_SHOOT;
-				iFSMCounter = 0;
+				cFSM.SetState(ALERT_SHOOT);
 				attackTimer = alertAttackInterval;
 				cout << "Switching to Alert_Shoot State" << endl;
 				break;
@@ -818,8 +810,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 		}
 		else
 		{
-			sCurrentFSM = ALERT_PATROL;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_PATROL);
 			cout << "Switching to Alert_Patrol State" << endl;
 
 			float waypointDist = -1.f;
@@ -864,10 +855,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 		{
 			// Shoot enemy ammo!
 			//shoot ammo in accordance to the direction enemy is facing
-			CTEAmmoSentry* ammo = FetchAmmo();
-			ammo->setActive(true);
-			ammo->setPath(vec2Index.x, vec2Index.y, shootingDirection);
-			ammo->setIsAlerted(true);
+			CProjectileSystem::GetInstance()->Spawn(CProjectileSystem::TERRESTRIAL_SENTRY, this, vec2Index, shootingDirection, true);
 			cout << "Bam!" << shootingDirection << endl;
 
 			cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::SENTRY_SHOOTING); // play sound effect for the sentry shooting
@@ -882,8 +870,7 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 
 		if (numFired >= alertAttackMagSize)
 		{
-			sCurrentFSM = ALERT_TRACK;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_TRACK);
 			attackTimer = 0;
 			numFired = 0;
 			cout << "Switching to Alert_Track State" << endl;
@@ -895,20 +882,6 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 		break;
 	}
 
-	//ammo beahviour
-	for (std::vector<CTEAmmoSentry*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoSentry* ammo = (CTEAmmoSentry*)*it;
-		if (ammo->getActive())
-		{
-			ammo->Update(dElapsedTime);
-			if (ammo->LimitReached())
-			{
-				ammo->setActive(false);
-			}
-		}
-	}
-
 	// Update Jump or Fall
 	UpdateJumpFall(dElapsedTime);
 
@@ -921,25 +894,6 @@ void TEnemy2DSentry::Update(const double dElapsedTime)
 	vec2UVCoordinate.y = cSettings->ConvertIndexToUVSpace(cSettings->y, vec2Index.y, false, vec2NumMicroSteps.y*cSettings->ENEMY_MICRO_STEP_YAXIS);
 }
 
-/**
- @brief Set up the OpenGL display environment before rendering
- */
-void TEnemy2DSentry::PreRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
-
-	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	// Activate the shader
-	CShaderManager::GetInstance()->Use(sShaderName);
-}
-
 /**
  @brief Render this instance
  */
@@ -958,12 +912,14 @@ void TEnemy2DSentry::Render(void)
 	glm::vec2 offset = glm::vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, vec2NumMicroSteps, IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += vec2NumMicroSteps.x * cSettings->ENEMY_MICRO_STEP_XAXIS;
-	actualPos.y += vec2NumMicroSteps.y * cSettings->ENEMY_MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->ENEMY_MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->ENEMY_MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -976,36 +932,13 @@ void TEnemy2DSentry::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
 
 	glBindTexture(GL_TEXTURE_2D, 0);
 
-	//render enemy ammo
-	for (std::vector<CTEAmmoSentry*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoSentry* ammo = (CTEAmmoSentry*)*it;
-		if (ammo->getActive())
-		{
-			ammo->PreRender();
-			ammo->Render();
-			ammo->PostRender();
-		}
-	}
-
-}
-
-/**
- @brief PostRender Set up the OpenGL display environment after rendering.
- */
-void TEnemy2DSentry::PostRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// Disable blending
-	glDisable(GL_BLEND);
 }
 
 /**
@@ -1030,18 +963,6 @@ void TEnemy2DSentry::Setvec2NumMicroSteps(const int iNumMicroSteps_XAxis, const
 	this->vec2NumMicroSteps.y = iNumMicroSteps_YAxis;
 }
 
-/**
- @brief Set the handle to cPlayer to this class instance
- @param cPlayer2D A CPlayer2D* variable which contains the pointer to the CPlayer2D instance
- */
-void TEnemy2DSentry::SetPlayer2D(CPlayer2D* cPlayer2D)
-{
-	this->cPlayer2D = cPlayer2D;
-
-	// Update the enemy's direction
-	UpdateDirection();
-}
-
 /**
  @brief Constraint the enemy2D's position within a boundary
  @param eDirection A DIRECTION enumerated data type which indicates the direction to check
@@ -1398,14 +1319,6 @@ void TEnemy2DSentry::UpdateDirection(void)
 	}
 }
 
-/**
- @brief Flip horizontal direction. For patrol use only
- */
-void TEnemy2DSentry::FlipHorizontalDirection(void)
-{
-	vec2Direction.x *= -1;
-}
-
 /**
 @brief Update position.
 */
@@ -1501,43 +1414,3 @@ void TEnemy2DSentry::UpdatePosition(void)
 		}
 	}
 }
-
-vector<glm::vec2> TEnemy2DSentry::ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints)
-{
-	for (int i = 0; i < numOfWaypoints; ++i)
-	{
-		waypointVector.push_back(cMap2D->GetTilePosition(startIndex + i));
-		// Erase the value of the waypoint in the arrMapInfo
-		cMap2D->SetMapInfo(waypointVector[i].y, waypointVector[i].x, 0);
-		cout << waypointVector.size() << endl;
-	}
-
-	return waypointVector;
-}
-
-//called whenever an ammo is needed to be shot
-CTEAmmoSentry* TEnemy2DSentry::FetchAmmo()
-{
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CTEAmmoSentry*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoSentry* ammo = (CTEAmmoSentry*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// By default, microsteps should be zero --> reset in case a previously active ammo that was used then ste inactive was used again
-		ammo->vec2NumMicroSteps = glm::vec2(0, 0);
-		return ammo;
-	}
-
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CTEAmmoSentry);
-	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
-
-}
\ No newline at end of file
@@ -10,7 +10,9 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
@@ -18,27 +20,38 @@ using namespace std;
 #include <GL/glew.h>
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
 // Include math.h
 #include <math.h>
 
+// The state table of TEnemy2DVeteran, in real seconds. A dMaxTime of 0.0 means that the state does not time out,
+// and a timeout state of NO_STATE that the Update decides which state it times out into
+const CEnemyFSM::SState TEnemy2DVeteran::sFSMStates[TEnemy2DVeteran::NUM_FSM] =
+{
+	{ "IDLE", 2.5, PATROL },
+	{ "PATROL", 0.0, CEnemyFSM::NO_STATE },
+	{ "ROCKET", 0.0, CEnemyFSM::NO_STATE },
+	{ "REPOSITION", 0.0, CEnemyFSM::NO_STATE },
+	{ "RADIO", 0.0, CEnemyFSM::NO_STATE },
+	{ "ALERT_IDLE", 1.0, ALERT_PATROL },
+	{ "ALERT_PATROL", 0.0, CEnemyFSM::NO_STATE },
+	{ "ALERT_ROCKET", 0.0, CEnemyFSM::NO_STATE }
+};
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 TEnemy2DVeteran::TEnemy2DVeteran(void)
-	: bIsActive(false)
-	, cMap2D(NULL)
-	, cSettings(NULL)
-	, cPlayer2D(NULL)
-	, sCurrentFSM(FSM::IDLE)
-	, iFSMCounter(0)
-	, quadMesh(NULL)
-	, camera2D(NULL)
-	, animatedSprites(NULL)
 {
+	// Start the FSM in its initial state
+	cFSM.Init(CEnemyFSM::TERRESTRIAL_VETERAN, sFSMStates, NUM_FSM, IDLE);
+
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
 	// Initialise vecIndex
@@ -130,7 +143,7 @@ bool TEnemy2DVeteran::Init(void)
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the enemy texture
-	iTextureID = CImageLoader::GetInstance()->LoadTextureGetID("Image/TerrestrialPlanet/VeteranSpriteSheet.png", true);
+	iTextureID = CImageLoader::GetInstance()->LoadTextureAsync("Image/TerrestrialPlanet/VeteranSpriteSheet.png", true);
 	if (iTextureID == 0)
 	{
 		cout << "Unable to load Image/TerrestrialPlanet/VeteranSpriteSheet.png" << endl;
@@ -159,14 +172,6 @@ bool TEnemy2DVeteran::Init(void)
 	// If this class is initialised properly, then set the bIsActive to true
 	bIsActive = true;
 
-	//Construct 100 inactive ammo and add into ammoList
-	for (int i = 0; i < 100; ++i)
-	{
-		CTEAmmoVeteran* cEnemyAmmo2D = new CTEAmmoVeteran();
-		cEnemyAmmo2D->SetShader("Shader2D");
-		ammoList.push_back(cEnemyAmmo2D);
-	}
-
 	// sets waypoints based on the level
 	if (cMap2D->GetCurrentLevel() == 1)
 	{
@@ -253,14 +258,13 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 
 	// just for switching between states --> keep simple
 	//action done under interaction with player, update position, update direction, etc
-	switch (sCurrentFSM)
+	switch (cFSM.GetState())
 	{
 	case IDLE:
 	{
 		if (isAlarmOn)
 		{
-			sCurrentFSM = ALERT_IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_IDLE);
 			cout << "Switching to Alert_Idle State" << endl;
 			break;
 		}
@@ -274,42 +278,37 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 			animatedSprites->PlayAnimation("idleL", -1, 1.0f);
 		}
 
-		if (iFSMCounter > iMaxFSMCounter)
+		if (cFSM.CheckTimeout())
 		{
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
 			cout << "Switching to Patrol State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	}
 	case PATROL:
 	{
 		if (isAlarmOn)
 		{
-			sCurrentFSM = ALERT_IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_IDLE);
 			cout << "Switching to Alert_Idle State" << endl;
 			break;
 		}
 
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 5.f)
 		{
-			int randomState = rand() % 100;
+			int randomState = CRandomManager::GetInstance()->Get(CRandomManager::AI).Next(100);
 			cout << randomState << endl;
 			if (randomState < 50)
 			{
-				sCurrentFSM = ROCKET;
-				iFSMCounter = 0;
+				cFSM.SetState(ROCKET);
 				attackTimer = attackInterval;
 				cout << "Switching to Rocket State" << endl;
 				break;
 			}
 			else
 			{			
-				sCurrentFSM = REPOSITION;
-				iFSMCounter = 0;
+				cFSM.SetState(REPOSITION);
 				cout << "Switching to Reposition State" << endl;
 				break;
 			}
@@ -319,8 +318,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 			if (vec2Index == waypoints[currentWaypointCounter])
 			{
 				currentWaypointCounter++;
-				sCurrentFSM = IDLE;
-				iFSMCounter = 0;
+				cFSM.SetState(IDLE);
 				cout << "Switching to Idle State" << endl;
 			}
 
@@ -402,11 +400,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 		{
 			// Shoot enemy ammo!
 			//shoot ammo in accordance to the direction enemy is facing
-			CTEAmmoVeteran* ammo = FetchAmmo();
-			ammo->setActive(true);
-			ammo->setPath(vec2Index.x, vec2Index.y, shootingDirection);
-			ammo->setIsAlerted(false);
-			ammo->setStartingIndex(vec2Index);
+			CProjectileSystem::GetInstance()->Spawn(CProjectileSystem::TERRESTRIAL_ROCKET, this, vec2Index, shootingDirection);
 			cout << "Bam!" << shootingDirection << endl;
 
 			cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::VETERAN_ROCKET_LAUNCH); // play sound effect for the veteran shooting
@@ -421,8 +415,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 
 		if (numFired > attackMagSize)
 		{
-			sCurrentFSM = PATROL;
-			iFSMCounter = 0;
+			cFSM.SetState(PATROL);
 			attackTimer = 0;
 			numFired = 0;
 			cout << "Switching to Patrol State" << endl;
@@ -504,7 +497,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 		}
 		else
 		{
-			sCurrentFSM = ROCKET;
+			cFSM.SetState(ROCKET, false);
 			cout << "Switching to Rocket State" << endl;
 			attackTimer = attackInterval;
 
@@ -516,7 +509,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 
 		if (vec2Index == targetRepositionWaypoint)
 		{
-			sCurrentFSM = RADIO;
+			cFSM.SetState(RADIO, false);
 			cout << "Switching to Radio State" << endl;
 
 			repositionWaypointDistance = -1.f;
@@ -555,7 +548,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 		{
 			isAlarmerActive = false;
 
-			sCurrentFSM = ALERT_IDLE;
+			cFSM.SetState(ALERT_IDLE, false);
 			cout << "Switching to Alert_Idle state" << endl;
 
 			cSoundController->StopSoundByID(CSoundController::SOUND_LIST::VETERAN_RADIO); // stpp sound effect for the veteran radio
@@ -568,8 +561,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 	{
 		if (!isAlarmOn)
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(IDLE);
 			cout << "Switching to Idle State" << endl;
 			break;
 		}
@@ -583,30 +575,26 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 			animatedSprites->PlayAnimation("idleL", -1, 1.0f);
 		}
 
-		if (iFSMCounter > iMaxAlertFSMCounter)
+		if (cFSM.CheckTimeout())
 		{
-			sCurrentFSM = ALERT_PATROL;
-			iFSMCounter = 0;
 			cout << "Switching to Alert_Patrol State" << endl;
 			break;
 		}
-		iFSMCounter++;
+		cFSM.AddTime(dElapsedTime);
 		break;
 	}
 	case ALERT_PATROL:
 	{
 		if (!isAlarmOn)
 		{
-			sCurrentFSM = IDLE;
-			iFSMCounter = 0;
+			cFSM.SetState(IDLE);
 			cout << "Switching to Idle State" << endl;
 			break;
 		}
 
 		if (cPhysics2D.CalculateDistance(vec2Index, cPlayer2D->vec2Index) < 7.f)
 		{
-			sCurrentFSM = ALERT_ROCKET;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_ROCKET);
 			attackTimer = alertAttackInterval;
 			cout << "Switching to Alert_Rocket State" << endl;
 			break;
@@ -616,8 +604,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 			if (vec2Index == waypoints[currentWaypointCounter])
 			{
 				currentWaypointCounter++;
-				sCurrentFSM = ALERT_IDLE;
-				iFSMCounter = 0;
+				cFSM.SetState(ALERT_IDLE);
 				cout << "Switching to Alert_Idle State" << endl;
 			}
 
@@ -699,11 +686,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 		{
 			// Shoot enemy ammo!
 			//shoot ammo in accordance to the direction enemy is facing
-			CTEAmmoVeteran* ammo = FetchAmmo();
-			ammo->setActive(true);
-			ammo->setPath(vec2Index.x, vec2Index.y, shootingDirection);
-			ammo->setIsAlerted(true);
-			ammo->setStartingIndex(vec2Index);
+			CProjectileSystem::GetInstance()->Spawn(CProjectileSystem::TERRESTRIAL_ROCKET, this, vec2Index, shootingDirection, true);
 			cout << "Bam!" << shootingDirection << endl;
 
 			cSoundController->PlaySoundByID(CSoundController::SOUND_LIST::VETERAN_ROCKET_LAUNCH); // play sound effect for the veteran shooting
@@ -718,8 +701,7 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 
 		if (numFired > alertAttackMagSize)
 		{
-			sCurrentFSM = ALERT_PATROL;
-			iFSMCounter = 0;
+			cFSM.SetState(ALERT_PATROL);
 			attackTimer = 0;
 			numFired = 0;
 			cout << "Switching to Alert_Patrol State" << endl;
@@ -734,20 +716,6 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 		break;
 	}
 
-	//ammo beahviour
-	for (std::vector<CTEAmmoVeteran*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoVeteran* ammo = (CTEAmmoVeteran*)*it;
-		if (ammo->getActive())
-		{
-			ammo->Update(dElapsedTime);
-			if (ammo->LimitReached())
-			{
-				ammo->setActive(false);
-			}
-		}
-	}
-
 	// Update Jump or Fall
 	UpdateJumpFall(dElapsedTime);
 
@@ -760,25 +728,6 @@ void TEnemy2DVeteran::Update(const double dElapsedTime)
 	vec2UVCoordinate.y = cSettings->ConvertIndexToUVSpace(cSettings->y, vec2Index.y, false, vec2NumMicroSteps.y*cSettings->ENEMY_MICRO_STEP_YAXIS);
 }
 
-/**
- @brief Set up the OpenGL display environment before rendering
- */
-void TEnemy2DVeteran::PreRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
-
-	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	// Activate the shader
-	CShaderManager::GetInstance()->Use(sShaderName);
-}
-
 /**
  @brief Render this instance
  */
@@ -797,12 +746,14 @@ void TEnemy2DVeteran::Render(void)
 	glm::vec2 offset = glm::vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, vec2NumMicroSteps, IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += vec2NumMicroSteps.x * cSettings->ENEMY_MICRO_STEP_XAXIS;
-	actualPos.y += vec2NumMicroSteps.y * cSettings->ENEMY_MICRO_STEP_YAXIS;
+	actualPos.x += MicroSteps.x * cSettings->ENEMY_MICRO_STEP_XAXIS;
+	actualPos.y += MicroSteps.y * cSettings->ENEMY_MICRO_STEP_YAXIS;
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -815,36 +766,13 @@ void TEnemy2DVeteran::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
 
 	glBindTexture(GL_TEXTURE_2D, 0);
 
-	//render enemy ammo
-	for (std::vector<CTEAmmoVeteran*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoVeteran* ammo = (CTEAmmoVeteran*)*it;
-		if (ammo->getActive())
-		{
-			ammo->PreRender();
-			ammo->Render();
-			ammo->PostRender();
-		}
-	}
-
-}
-
-/**
- @brief PostRender Set up the OpenGL display environment after rendering.
- */
-void TEnemy2DVeteran::PostRender(void)
-{
-	if (!bIsActive)
-		return;
-
-	// Disable blending
-	glDisable(GL_BLEND);
 }
 
 /**
@@ -869,18 +797,6 @@ void TEnemy2DVeteran::Setvec2NumMicroSteps(const int iNumMicroSteps_XAxis, const
 	this->vec2NumMicroSteps.y = iNumMicroSteps_YAxis;
 }
 
-/**
- @brief Set the handle to cPlayer to this class instance
- @param cPlayer2D A CPlayer2D* variable which contains the pointer to the CPlayer2D instance
- */
-void TEnemy2DVeteran::SetPlayer2D(CPlayer2D* cPlayer2D)
-{
-	this->cPlayer2D = cPlayer2D;
-
-	// Update the enemy's direction
-	UpdateDirection();
-}
-
 /**
  @brief Constraint the enemy2D's position within a boundary
  @param eDirection A DIRECTION enumerated data type which indicates the direction to check
@@ -1196,15 +1112,6 @@ bool TEnemy2DVeteran::InteractWithPlayer(void)
 }
 
 //enemy interact with map
-void TEnemy2DVeteran::InteractWithMap(void)
-{
-	switch (cMap2D->GetMapInfo(vec2Index.y, vec2Index.x))
-	{
-	default:
-		break;
-	}
-}
-
 /**
  @brief Update the enemy's direction.
  */
@@ -1232,14 +1139,6 @@ void TEnemy2DVeteran::UpdateDirection(void)
 	}
 }
 
-/**
- @brief Flip horizontal direction. For patrol use only
- */
-void TEnemy2DVeteran::FlipHorizontalDirection(void)
-{
-	vec2Direction.x *= -1;
-}
-
 /**
 @brief Update position.
 */
@@ -1335,43 +1234,3 @@ void TEnemy2DVeteran::UpdatePosition(void)
 		}
 	}
 }
-
-vector<glm::vec2> TEnemy2DVeteran::ConstructWaypointVector(vector<glm::vec2> waypointVector, int startIndex, int numOfWaypoints)
-{
-	for (int i = 0; i < numOfWaypoints; ++i)
-	{
-		waypointVector.push_back(cMap2D->GetTilePosition(startIndex + i));
-		// Erase the value of the waypoint in the arrMapInfo
-		cMap2D->SetMapInfo(waypointVector[i].y, waypointVector[i].x, 0);
-		cout << waypointVector.size() << endl;
-	}
-
-	return waypointVector;
-}
-
-//called whenever an ammo is needed to be shot
-CTEAmmoVeteran* TEnemy2DVeteran::FetchAmmo()
-{
-	//Exercise 3a: Fetch a game object from m_goList and return it
-	for (std::vector<CTEAmmoVeteran*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
-	{
-		CTEAmmoVeteran* ammo = (CTEAmmoVeteran*)*it;
-		if (ammo->getActive()) {
-			continue;
-		}
-		ammo->setActive(true);
-		// By default, microsteps should be zero --> reset in case a previously active ammo that was used then ste inactive was used again
-		ammo->vec2NumMicroSteps = glm::vec2(0, 0);
-		return ammo;
-	}
-
-	//whenever ammoList runs out of ammo, create 10 ammo to use
-	//Get Size before adding 10
-	int prevSize = ammoList.size();
-	for (int i = 0; i < 10; ++i) {
-		ammoList.push_back(new CTEAmmoVeteran);
-	}
-	ammoList.at(prevSize)->setActive(true);
-	return ammoList.at(prevSize);
-
-}
\ No newline at end of file
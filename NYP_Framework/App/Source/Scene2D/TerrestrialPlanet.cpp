@@ -5,13 +5,27 @@
  Date: Mar 2020
  */
 #include "TerrestrialPlanet.h"
+
+// Include CProfiler, to time the enemies
+#include "TimeControl/Profiler.h"
+
 #include <iostream>
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the GL calls of each pass of the scene
+#include "RenderControl/RenderStats.h"
+// Include CResourceTracker, to tag the resources which each part of the scene creates
+#include "System/ResourceTracker.h"
+
+#include "System/filesystem.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
 
-#include "System\filesystem.h"
+// Include CLogger, to log from the game loop without waiting for the console
+#include "System/Logger.h"
 
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
@@ -19,6 +33,8 @@ using namespace std;
 TerrestrialPlanet::TerrestrialPlanet(void)
 	: cMap2D(NULL)
 	, cPlayer2D(NULL)
+	, cPathRequestQueue(NULL)
+	, cProjectileSystem(NULL)
 	, cKeyboardController(NULL)
 	, cGUI_Scene2D(NULL)
 	, cGameManager(NULL)
@@ -58,27 +74,27 @@ TerrestrialPlanet::~TerrestrialPlanet(void)
 		camera2D = NULL;
 	}
 
-	for (unsigned int i = 0; i < enemyVectors.size(); i++)
+	// Destroy the enemies and resources of every level
+	for (unsigned int i = 0; i < NUM_LEVELS; i++)
 	{
-		for (unsigned int j = 0; j < enemyVectors[i].size(); ++j)
-		{
-			delete enemyVectors[i][j];
-			enemyVectors[i][j] = NULL;
-		}
-		enemyVectors[i].clear();
+		cLevelArenas[i].Reset();
 	}
 	enemyVectors.clear();
+	resourceVectors.clear();
 
-	for (unsigned int i = 0; i < resourceVectors.size(); i++)
+	// Destroy the path request queue after the enemies, as they cancel their tickets when deleted
+	if (cPathRequestQueue)
 	{
-		for (unsigned int j = 0; j < resourceVectors[i].size(); ++j)
-		{
-			delete resourceVectors[i][j];
-			resourceVectors[i][j] = NULL;
-		}
-		resourceVectors[i].clear();
+		cPathRequestQueue->Destroy();
+		cPathRequestQueue = NULL;
+	}
+
+	// Destroy the projectile system after the enemies which shot the projectiles
+	if (cProjectileSystem)
+	{
+		cProjectileSystem->Destroy();
+		cProjectileSystem = NULL;
 	}
-	resourceVectors.clear();
 
 	if (cGUI_Scene2D)
 	{
@@ -111,12 +127,15 @@ bool TerrestrialPlanet::Init(void)
 	// Include Shader Manager
 	CShaderManager::GetInstance()->Use("Shader2D");
 
+	// Tag the resources which each part of the planet creates, until the next tag, so that their leaks can be told apart
 	// Create Background Entity
+	RESOURCE_TAG("CBackgroundEntity");
 	cBackground = new CBackgroundEntity("Image/TerrestrialPlanet/Background.png");
 	cBackground->SetShader("Shader2D");
 	cBackground->Init();
 
 	// Create and initialise the cMap2D
+	RESOURCE_TAG("CMap2D");
 	cMap2D = CMap2D::GetInstance();
 	// Set a shader to this class
 	cMap2D->SetShader("Shader2D");
@@ -149,6 +168,7 @@ bool TerrestrialPlanet::Init(void)
 	}
 
 	// Create and initialise the CGUI_Scene2D
+	RESOURCE_TAG("CGUI_Scene2D");
 	cGUI_Scene2D = CGUI_Scene2D::GetInstance();
 	// Initialise the instance
 	if (cGUI_Scene2D->Init() == false)
@@ -159,6 +179,7 @@ bool TerrestrialPlanet::Init(void)
 	cGUI_Scene2D->setPlanetNum(2);
 
 	// Create and initialise the CPlayer2D
+	RESOURCE_TAG("CPlayer2D");
 	cPlayer2D = CPlayer2D::GetInstance();
 	// Pass shader to cPlayer2D
 	cPlayer2D->SetShader("Shader2D_Colour");
@@ -169,14 +190,16 @@ bool TerrestrialPlanet::Init(void)
 		return false;
 	}
 
-	//clear the individual enemy vectors inside enemyVectors
-	for (int i = 0; i < enemyVectors.size(); ++i)
+	//destroy the enemies and resources of the previous run, and reuse the memory of their arenas
+	RESOURCE_TAG("Enemies and resources");
+	for (int i = 0; i < NUM_LEVELS; ++i)
 	{
-		enemyVectors[i].clear();
+		cLevelArenas[i].Reset();
 	}
 
-	//clear enemyVectors
+	//clear enemyVectors and resourceVectors
 	enemyVectors.clear();
+	resourceVectors.clear();
 
 	//cycle through the maps and find the enemies
 		//and push them into the 2d enemy vector
@@ -194,7 +217,7 @@ bool TerrestrialPlanet::Init(void)
 
 		while (true)
 		{
-			TEnemy2DSentry* cTEnemy2DSentry = new TEnemy2DSentry();
+			TEnemy2DSentry* cTEnemy2DSentry = cLevelArenas[i].Create<TEnemy2DSentry>();
 			// Pass shader to cEnemy2D
 			cTEnemy2DSentry->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -205,6 +228,8 @@ bool TerrestrialPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cTEnemy2DSentry);
 				// Break out of this loop if all sentries have been loaded
 				break;
 			}
@@ -212,7 +237,7 @@ bool TerrestrialPlanet::Init(void)
 
 		while (true)
 		{
-			TEnemy2DVeteran* cTEnemy2DVeteran = new TEnemy2DVeteran();
+			TEnemy2DVeteran* cTEnemy2DVeteran = cLevelArenas[i].Create<TEnemy2DVeteran>();
 			// Pass shader to cEnemy2D
 			cTEnemy2DVeteran->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -223,6 +248,8 @@ bool TerrestrialPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cTEnemy2DVeteran);
 				// Break out of this loop if all sentries have been loaded
 				break;
 			}
@@ -230,7 +257,7 @@ bool TerrestrialPlanet::Init(void)
 
 		while (true)
 		{
-			TEnemy2DTurret* cTEnemy2DTurret = new TEnemy2DTurret();
+			TEnemy2DTurret* cTEnemy2DTurret = cLevelArenas[i].Create<TEnemy2DTurret>();
 			// Pass shader to cEnemy2D
 			cTEnemy2DTurret->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -241,6 +268,8 @@ bool TerrestrialPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cTEnemy2DTurret);
 				// Break out of this loop if all turrets have been loaded
 				break;
 			}
@@ -248,7 +277,7 @@ bool TerrestrialPlanet::Init(void)
 
 		while (true)
 		{
-			TEnemy2DDummy* cTEnemy2DDummy = new TEnemy2DDummy();
+			TEnemy2DDummy* cTEnemy2DDummy = cLevelArenas[i].Create<TEnemy2DDummy>();
 			// Pass shader to cEnemy2D
 			cTEnemy2DDummy->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -259,6 +288,8 @@ bool TerrestrialPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cTEnemy2DDummy);
 				// Break out of this loop if all turrets have been loaded
 				break;
 			}
@@ -266,7 +297,7 @@ bool TerrestrialPlanet::Init(void)
 
 		while (true)
 		{
-			TEnemy2DWorker* cTEnemy2DWorker = new TEnemy2DWorker();
+			TEnemy2DWorker* cTEnemy2DWorker = cLevelArenas[i].Create<TEnemy2DWorker>();
 			// Pass shader to cEnemy2D
 			cTEnemy2DWorker->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -277,6 +308,8 @@ bool TerrestrialPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(cTEnemy2DWorker);
 				// Break out of this loop if all sentries have been loaded
 				break;
 			}
@@ -292,7 +325,7 @@ bool TerrestrialPlanet::Init(void)
 			//gets pushed into the resourceVectors vector once filled 
 		while (true)
 		{
-			CResource* resource = new CResource();
+			CResource* resource = cLevelArenas[i].Create<CResource>();
 			// Pass shader to cEnemy2D
 			resource->SetShader("Shader2D_Colour");
 			// Initialise the instance
@@ -302,6 +335,8 @@ bool TerrestrialPlanet::Init(void)
 			}
 			else
 			{
+				// Destroy the instance which was not needed
+				cLevelArenas[i].Destroy(resource);
 				// Break out of this loop if all resources have been loaded
 				break;
 			}
@@ -309,6 +344,11 @@ bool TerrestrialPlanet::Init(void)
 
 		resourceVectors.push_back(resources); //push the vector of enemies into enemyVectors
 
+#ifdef _DEBUG
+		cout << "Level " << i << " ";
+		cLevelArenas[i].PrintSelf();
+#endif
+
 	}
 
 	cMap2D->SetCurrentLevel(0); //reset level
@@ -320,8 +360,21 @@ bool TerrestrialPlanet::Init(void)
 	alarmBoxVector = cMap2D->FindAllTiles(250);
 
 	// Initialise the Physics
+	RESOURCE_TAG("Physics and projectiles");
 	cPhysics2D.Init();
 
+	// Create and initialise the CPathRequestQueue which solves the enemies' path requests
+	cPathRequestQueue = CPathRequestQueue::GetInstance();
+	cPathRequestQueue->Init();
+
+	// Initialise the spatial grids to cover a level
+	cEnemyGrid.Init(CSettings::GetInstance()->NUM_TILES_XAXIS, CSettings::GetInstance()->NUM_TILES_YAXIS);
+	cAmmoGrid.Init(CSettings::GetInstance()->NUM_TILES_XAXIS, CSettings::GetInstance()->NUM_TILES_YAXIS);
+
+	// Create and initialise the CProjectileSystem which updates and renders the enemies' projectiles
+	cProjectileSystem = CProjectileSystem::GetInstance();
+	cProjectileSystem->Init();
+
 	// Store the keyboard controller singleton instance here
 	cKeyboardController = CKeyboardController::GetInstance();
 
@@ -338,6 +391,7 @@ bool TerrestrialPlanet::Init(void)
 	camera2D->setTargetPos(cPlayer2D->vec2Index);
 
 	// Load the sounds into CSoundController
+	RESOURCE_TAG("Sounds");
 	cSoundController = CSoundController::GetInstance();
 
 
@@ -548,7 +602,7 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 
 	// click test
 	if (CMouseController::GetInstance()->IsButtonDown(CMouseController::BUTTON_TYPE::LMB)) {
-		std::cout << camera2D->getBlockSelected().x << " " << camera2D->getBlockSelected().y << "\n";
+		LOG_DEBUG_EVERY(0.25, "TerrestrialPlanet: Selected block ({}, {})", camera2D->getBlockSelected().x, camera2D->getBlockSelected().y);
 	}
 
 	// Checks if the coloured orbs have been obtained
@@ -952,10 +1006,31 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 		}
 	}
 
+	// Solve the path requests submitted by the enemies in the last frame
+	cPathRequestQueue->Update();
+
+	// Rebuild the spatial grids of this level's enemies and the player's active ammo,
+	// so the interaction checks below only look at what is nearby
+	cEnemyGrid.Clear();
+	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
+	{
+		cEnemyGrid.Insert(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+	}
+	cAmmoGrid.Clear();
+	const std::vector<CAmmo2D*>& playerAmmoList = cPlayer2D->getAmmoList();
+	for (unsigned int i = 0; i < playerAmmoList.size(); i++)
+	{
+		if (playerAmmoList[i]->getActive())
+			cAmmoGrid.Insert(playerAmmoList[i]);
+	}
+	// Entities found by the spatial grid queries
+	std::vector<CEntity2D*> vNearbyEntities;
+
 	// Call all of the cEnemy2D's update methods before Map2D
 	// as we want to capture the updates before Map2D update
 	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
+		PROFILE_SCOPE("Enemy update");
 		// informs all enemies that an enemy is going to activate the alarm
 		// if there is an enemy that is an alarmer (going to activate the alarm)
 		for (unsigned int j = 0; j < enemyVectors[cMap2D->GetCurrentLevel()].size(); j++)
@@ -975,10 +1050,13 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 		
 		// updates all enemies
 		enemyVectors[cMap2D->GetCurrentLevel()][i]->Update(dElapsedTime);
+		cEnemyGrid.Update(enemyVectors[cMap2D->GetCurrentLevel()][i]);
 
-		//player ammo collision check with enemy
-		std::vector<CAmmo2D*> ammoList = cPlayer2D->getAmmoList();
-		for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+		//player ammo collision check with enemy, only for the ammo in the tiles around this enemy
+		vNearbyEntities.clear();
+		cAmmoGrid.QueryAABB(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index - glm::vec2(1.0f),
+			enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index + glm::vec2(1.0f), vNearbyEntities);
+		for (std::vector<CEntity2D*>::iterator it = vNearbyEntities.begin(); it != vNearbyEntities.end(); ++it)
 		{
 			CAmmo2D* ammo = (CAmmo2D*)*it;
 			if (ammo->getActive())
@@ -998,7 +1076,7 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 		{
 			if (enemyVectors[cMap2D->GetCurrentLevel()][i]->getType() == CEnemy2D::ENEMYTYPE::KEYHOLDER_PURPLE)
 			{
-				CResource* res = new CResource(CResource::RESOURCE_TYPE::PURPLE_KEY); //create new key resource
+				CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::PURPLE_KEY); //create new key resource
 				res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 				//set resource's position where enemy's position is
 				res->SetShader("Shader2D_Colour"); //set shader
@@ -1006,7 +1084,7 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 			}
 			else if (enemyVectors[cMap2D->GetCurrentLevel()][i]->getType() == CEnemy2D::ENEMYTYPE::KEYHOLDER_CYAN)
 			{
-				CResource* res = new CResource(CResource::RESOURCE_TYPE::CYAN_KEY); //create new key resource
+				CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::CYAN_KEY); //create new key resource
 				res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 				//set resource's position where enemy's position is
 				res->SetShader("Shader2D_Colour"); //set shader
@@ -1030,7 +1108,7 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 				if (numOfKeyholders == numOfEnemies - 1)
 				{
 					//confirm drop an energy quartz
-					CResource* res = new CResource(CResource::RESOURCE_TYPE::ENERGY_QUARTZ); //create new energy quartz resource
+					CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::ENERGY_QUARTZ); //create new energy quartz resource
 					res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 					//set resource's position where enemy's position is
 					res->SetShader("Shader2D_Colour"); //set shader
@@ -1040,11 +1118,11 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 				else
 				{
 					//20% chance to drop scrap metal, 20% chance to drop battery, 10% chance to drop energy quartz
-					int resourceType = rand() % 20;
+					int resourceType = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(20);
 					std::cout << resourceType << std::endl;
 					if (resourceType < 4) //0 1 2 3
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::SCRAP_METAL); //create new scrap metal resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -1052,7 +1130,7 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 					}
 					else if (resourceType > 7 && resourceType < 12) //8 9 10 11
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::BATTERY); //create new battery resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -1060,7 +1138,7 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 					}
 					else if (resourceType > 16 && resourceType < 19) //17 18
 					{
-						CResource* res = new CResource(CResource::RESOURCE_TYPE::ENERGY_QUARTZ); //create new energy quartz resource
+						CResource* res = cLevelArenas[cMap2D->GetCurrentLevel()].Create<CResource>(CResource::RESOURCE_TYPE::ENERGY_QUARTZ); //create new energy quartz resource
 						res->setPosition(enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2Index, enemyVectors[cMap2D->GetCurrentLevel()][i]->vec2NumMicroSteps);
 						//set resource's position where enemy's position is
 						res->SetShader("Shader2D_Colour"); //set shader
@@ -1069,12 +1147,17 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 				}
 			}
 
-			delete enemyVectors[cMap2D->GetCurrentLevel()][i];
+			cEnemyGrid.Remove(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+			cProjectileSystem->RemoveByOwner(enemyVectors[cMap2D->GetCurrentLevel()][i]);
+			cLevelArenas[cMap2D->GetCurrentLevel()].Destroy(enemyVectors[cMap2D->GetCurrentLevel()][i]);
 			enemyVectors[cMap2D->GetCurrentLevel()][i] = NULL;
 			enemyVectors[cMap2D->GetCurrentLevel()].erase(enemyVectors[cMap2D->GetCurrentLevel()].begin() + i);
 		}
 	}
 
+	// Update the projectiles shot by the enemies
+	cProjectileSystem->Update(dElapsedTime);
+
 	//update all resources
 	for (unsigned int i = 0; i < resourceVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -1083,7 +1166,7 @@ bool TerrestrialPlanet::Update(const double dElapsedTime)
 		//if resource is collected
 		if (resourceVectors[cMap2D->GetCurrentLevel()][i]->getCollected())
 		{
-			delete resourceVectors[cMap2D->GetCurrentLevel()][i];
+			cLevelArenas[cMap2D->GetCurrentLevel()].Destroy(resourceVectors[cMap2D->GetCurrentLevel()][i]);
 			resourceVectors[cMap2D->GetCurrentLevel()][i] = NULL;
 			resourceVectors[cMap2D->GetCurrentLevel()].erase(resourceVectors[cMap2D->GetCurrentLevel()].begin() + i);
 		}
@@ -1201,6 +1284,7 @@ void TerrestrialPlanet::PreRender(void)
 void TerrestrialPlanet::Render(void)
 {
 	// Render Background
+	RENDER_STATS_PASS(BACKGROUND);
 	// Calls the Background's PreRender()
 	cBackground->PreRender();
 	// Calls the Background's Render()
@@ -1208,6 +1292,7 @@ void TerrestrialPlanet::Render(void)
 	// Calls the Background's PostRender()
 	cBackground->PostRender();
 	
+	RENDER_STATS_PASS(MAP);
 	// Calls the Map2D's PreRender()
 	cMap2D->PreRender();
 	// Calls the Map2D's Render()
@@ -1215,6 +1300,7 @@ void TerrestrialPlanet::Render(void)
 	// Calls the Map2D's PostRender()
 	cMap2D->PostRender();
 
+	RENDER_STATS_PASS(ENEMIES);
 	// Calls the CEnemy2D's PreRender()
 	for (unsigned int i = 0; i < enemyVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -1226,6 +1312,13 @@ void TerrestrialPlanet::Render(void)
 		enemyVectors[cMap2D->GetCurrentLevel()][i]->PostRender();
 	}
 
+	// Render the projectiles shot by the enemies
+	cProjectileSystem->PreRender();
+	cProjectileSystem->Render();
+	cProjectileSystem->PostRender();
+
+	// The resources are counted with the map which they lie on
+	RENDER_STATS_PASS(MAP);
 	// Calls the CResource's PreRender()
 	for (unsigned int i = 0; i < resourceVectors[cMap2D->GetCurrentLevel()].size(); i++)
 	{
@@ -1237,6 +1330,7 @@ void TerrestrialPlanet::Render(void)
 		resourceVectors[cMap2D->GetCurrentLevel()][i]->PostRender();
 	}
 
+	RENDER_STATS_PASS(PLAYER);
 	// Calls the CPlayer2D's PreRender()
 	cPlayer2D->PreRender();
 	// Calls the CPlayer2D's Render()
@@ -1244,6 +1338,7 @@ void TerrestrialPlanet::Render(void)
 	// Calls the CPlayer2D's PostRender()
 	cPlayer2D->PostRender();
 
+	RENDER_STATS_PASS(HUD);
 	// Calls the CGUI_Scene2D's PreRender()
 	cGUI_Scene2D->PreRender();
 	// Calls the CGUI_Scene2D's Render()
@@ -1252,8 +1347,9 @@ void TerrestrialPlanet::Render(void)
 	cGUI_Scene2D->PostRender();
 
 	//render player ammo
-	std::vector<CAmmo2D*> ammoList = cPlayer2D->getAmmoList();
-	for (std::vector<CAmmo2D*>::iterator it = ammoList.begin(); it != ammoList.end(); ++it)
+	RENDER_STATS_PASS(PLAYER);
+	const std::vector<CAmmo2D*>& ammoList = cPlayer2D->getAmmoList();
+	for (std::vector<CAmmo2D*>::const_iterator it = ammoList.begin(); it != ammoList.end(); ++it)
 	{
 		CAmmo2D* ammo = (CAmmo2D*)*it;
 		if (ammo->getActive())
@@ -1284,8 +1380,13 @@ void TerrestrialPlanet::DecideLevel(bool tutorial)
 	{
 		//random between 2 numbers to set us Scrap metal or battery
 		//according to which number type is set to, load which texture
-		int randomState = rand() % 100;
-		if (randomState < 50)
+		int randomState = CRandomManager::GetInstance()->Get(CRandomManager::WORLD).Next(100);
+		int forcedLevel = CGameInfo::GetInstance()->forcedLevel;
+		if ((forcedLevel == LEVEL1) || (forcedLevel == LEVEL2))
+		{
+			cMap2D->SetCurrentLevel(forcedLevel); //level of the scenario being run
+		}
+		else if (randomState < 50)
 		{
 			cMap2D->SetCurrentLevel(LEVEL1); //level 1
 		}
@@ -6,12 +6,15 @@
  */
 #include "GUI_SceneCombat.h"
 
+// Include CProfiler, to draw its overlay with the GUI
+#include "TimeControl/Profiler.h"
+
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 #include "../App/Source/GameStateManagement/GameInfo.h"
 #include "ShipEnemy.h"
 #include "Ship.h"
@@ -37,8 +40,15 @@ CGUI_SceneCombat::~CGUI_SceneCombat(void)
 	cInventoryManager = NULL;
 
 	// Cleanup
-	ImGui_ImplOpenGL3_Shutdown();
-	ImGui_ImplGlfw_Shutdown();
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		ImGui_ImplNull_Shutdown();
+	}
+	else
+	{
+		ImGui_ImplOpenGL3_Shutdown();
+		ImGui_ImplGlfw_Shutdown();
+	}
 	ImGui::DestroyContext();
 
 	// We won't delete this since it was created elsewhere
@@ -68,9 +78,17 @@ bool CGUI_SceneCombat::Init(void)
 	//ImGui::StyleColorsClassic();
 
 	// Setup Platform/Renderer bindings
-	ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
-	const char* glsl_version = "#version 330";
-	ImGui_ImplOpenGL3_Init(glsl_version);
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		// There is no window or context in the headless mode, so the GUI runs without being drawn
+		ImGui_ImplNull_Init((float)CSettings::GetInstance()->iWindowWidth, (float)CSettings::GetInstance()->iWindowHeight);
+	}
+	else
+	{
+		ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
+		const char* glsl_version = "#version 330";
+		ImGui_ImplOpenGL3_Init(glsl_version);
+	}
 
 	// Define the window flags
 	window_flags = 0;
@@ -84,33 +102,34 @@ bool CGUI_SceneCombat::Init(void)
 
 	CImageLoader* il = CImageLoader::GetInstance();
 	AcceptButtonData.fileName = "Image\\GUI\\tick.png";
-	AcceptButtonData.textureID = il->LoadTextureGetID(AcceptButtonData.fileName.c_str(), false);
+	AcceptButtonData.textureID = il->LoadTextureAsync(AcceptButtonData.fileName.c_str(), false);
 	RejectButtonData.fileName = "Image\\GUI\\cross.png";
-	RejectButtonData.textureID = il->LoadTextureGetID(RejectButtonData.fileName.c_str(), false);
+	RejectButtonData.textureID = il->LoadTextureAsync(RejectButtonData.fileName.c_str(), false);
 
 	// Decoration
-	PlayerBarTextureID = il->LoadTextureGetID("Image/GUI/PlayerBar.png", false);
-	BitTextureID = il->LoadTextureGetID("Image/GUI/ProgressBit.png", false);
-	ProgressBarTextureID = il->LoadTextureGetID("Image/GUI/ShipProgressBar.png", false);
-	FocusBarBackground = il->LoadTextureGetID("Image/GUI/BqMain.png", false);
-	boxBarBackground = il->LoadTextureGetID("Image/GUI/InfoBar.png", false);
-	SquareInfoTextureID = il->LoadTextureGetID("Image/GUI/InfoBar2.png", false);
-
-	ShipTextureID = il->LoadTextureGetID("Image/ShipCombat/shipBody.png", false);
-	smallWeaponUpgrade1 = il->LoadTextureGetID("Image/ShipCombat/weaponSmall_1.png", false);
-	smallWeaponUpgrade2 = il->LoadTextureGetID("Image/ShipCombat/weaponSmall_2.png", false);
-	smallWeaponUpgrade3 = il->LoadTextureGetID("Image/ShipCombat/weaponSmall_3.png", false);
-
-	largeWeaponUpgrade1 = il->LoadTextureGetID("Image/ShipCombat/weaponLarge_1.png", false);
-	largeWeaponUpgrade2 = il->LoadTextureGetID("Image/ShipCombat/weaponLarge_2.png", false);
-	largeWeaponUpgrade3 = il->LoadTextureGetID("Image/ShipCombat/weaponLarge_3.png", false);
-
-	enemyShip1 = il->LoadTextureGetID("Image/ShipCombat/RookieShip.png", false);
-	enemyShip2 = il->LoadTextureGetID("Image/ShipCombat/SargeantShip.png", false);
-	enemyShip3 = il->LoadTextureGetID("Image/ShipCombat/CommanderShip.png", false);
+	PlayerBarTextureID = il->LoadTextureAsync("Image/GUI/PlayerBar.png", false);
+	BitTextureID = il->LoadTextureAsync("Image/GUI/ProgressBit.png", false);
+	ProgressBarTextureID = il->LoadTextureAsync("Image/GUI/ShipProgressBar.png", false);
+	FocusBarBackground = il->LoadTextureAsync("Image/GUI/BqMain.png", false);
+	boxBarBackground = il->LoadTextureAsync("Image/GUI/InfoBar.png", false);
+	SquareInfoTextureID = il->LoadTextureAsync("Image/GUI/InfoBar2.png", false);
+
+	ShipTextureID = il->LoadTextureAsync("Image/ShipCombat/shipBody.png", false);
+	smallWeaponUpgrade1 = il->LoadTextureAsync("Image/ShipCombat/weaponSmall_1.png", false);
+	smallWeaponUpgrade2 = il->LoadTextureAsync("Image/ShipCombat/weaponSmall_2.png", false);
+	smallWeaponUpgrade3 = il->LoadTextureAsync("Image/ShipCombat/weaponSmall_3.png", false);
+
+	largeWeaponUpgrade1 = il->LoadTextureAsync("Image/ShipCombat/weaponLarge_1.png", false);
+	largeWeaponUpgrade2 = il->LoadTextureAsync("Image/ShipCombat/weaponLarge_2.png", false);
+	largeWeaponUpgrade3 = il->LoadTextureAsync("Image/ShipCombat/weaponLarge_3.png", false);
+
+	enemyShip1 = il->LoadTextureAsync("Image/ShipCombat/RookieShip.png", false);
+	enemyShip2 = il->LoadTextureAsync("Image/ShipCombat/SargeantShip.png", false);
+	enemyShip3 = il->LoadTextureAsync("Image/ShipCombat/CommanderShip.png", false);
 	
 	// Show the mouse pointer
-	glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+	if (CSettings::GetInstance()->bHeadless == false)
+		glfwSetInputMode(CSettings::GetInstance()->pWindow, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 	isShowPanel = false;
 	GuiState = GUI_STATE::noShow;
 	isCombat = false;
@@ -131,8 +150,15 @@ void CGUI_SceneCombat::Update(const double dElapsedTime)
 	CImageLoader* il = CImageLoader::GetInstance();
 
 	// Start the Dear ImGui frame
-	ImGui_ImplOpenGL3_NewFrame();
-	ImGui_ImplGlfw_NewFrame();
+	if (CSettings::GetInstance()->bHeadless)
+	{
+		ImGui_ImplNull_NewFrame((float)dElapsedTime);
+	}
+	else
+	{
+		ImGui_ImplOpenGL3_NewFrame();
+		ImGui_ImplGlfw_NewFrame();
+	}
 	ImGui::NewFrame();
 
 	// prevents crash when game is minimised
@@ -513,6 +539,7 @@ void CGUI_SceneCombat::Update(const double dElapsedTime)
 	switch (GuiState)
 	{	
 	case CGUI_SceneCombat::showWeapons:
+	{
 		glm::vec2 pos1 = Camera2D::GetInstance()->getBlockPositionWindow(glm::vec2(4, 18));
 		blockPosition = ImVec2(pos1.x, pos1.y);
 
@@ -626,7 +653,9 @@ void CGUI_SceneCombat::Update(const double dElapsedTime)
 		ImGui::End();
 		ImGui::End();
 		break;
+	}
 	case CGUI_SceneCombat::showWeaponUpgrade:
+	{
 		glm::vec2 pos = Camera2D::GetInstance()->getBlockPositionWindow(glm::vec2(4, 18));
 		blockPosition = ImVec2(pos.x, pos.y);
 
@@ -982,6 +1011,7 @@ void CGUI_SceneCombat::Update(const double dElapsedTime)
 			break;
 		}
 		break;
+	}
 
 	case CGUI_SceneCombat::showStorage:
 		ImGui::Begin("Storage", NULL, livesWindowFlags);
@@ -1451,9 +1481,14 @@ void CGUI_SceneCombat::PreRender(void)
  */
 void CGUI_SceneCombat::Render(void)
 {
+	// Draw the profiler overlay into this frame
+	CProfiler::GetInstance()->RenderOverlay();
+
 	// Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	// There is no OpenGL context to draw the GUI with in the headless mode
+	if (CSettings::GetInstance()->bHeadless == false)
+		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 }
 
 /**
@@ -13,7 +13,7 @@
 #include "Primitives/Entity2D.h"
 
 // FPS Counter
-#include "TimeControl\FPSCounter.h"
+#include "TimeControl/FPSCounter.h"
 
 // Include CInventoryManager
 #include "../App/Source/Scene2D/InventoryManager.h"
@@ -33,9 +33,10 @@
 // Include IMGUI
 // Important: GLEW and GLFW must be included before IMGUI
 #ifndef IMGUI_ACTIVE
-#include "GUI\imgui.h"
-#include "GUI\backends\imgui_impl_glfw.h"
-#include "GUI\backends\imgui_impl_opengl3.h"
+#include "GUI/imgui.h"
+#include "GUI/backends/imgui_impl_glfw.h"
+#include "GUI/backends/imgui_impl_opengl3.h"
+#include "GUI/backends/imgui_impl_null.h"
 #define IMGUI_ACTIVE
 #endif
 
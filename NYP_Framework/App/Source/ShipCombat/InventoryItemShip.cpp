@@ -7,7 +7,7 @@
 #include "InventoryItemShip.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 #include <iostream>
 
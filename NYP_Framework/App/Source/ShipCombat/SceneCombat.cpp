@@ -9,9 +9,19 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the GL calls of each pass of the scene
+#include "RenderControl/RenderStats.h"
+// Include CResourceTracker, to tag the resources which each part of the scene creates
+#include "System/ResourceTracker.h"
 
-#include "System\filesystem.h"
+#include "System/filesystem.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
+
+// Include CLogger, to log from the game loop without waiting for the console
+#include "System/Logger.h"
 #include "../App/Source/GameStateManagement/GameInfo.h"
 
 /**
@@ -90,7 +100,9 @@ bool CSceneCombat::Init(void)
 	// Include Shader Manager
 	CShaderManager::GetInstance()->Use("Shader2D");
 	
+	// Tag the resources which each part of the scene creates, until the next tag, so that their leaks can be told apart
 	// Create and initialise the cMap2D
+	RESOURCE_TAG("CMap2D");
 	cMap2D = CMap2D::GetInstance();
 	// Set a shader to this class
 	cMap2D->SetShader("Shader2D");
@@ -123,11 +135,13 @@ bool CSceneCombat::Init(void)
 	}
 
 	//Create Background Entity
+	RESOURCE_TAG("CBackgroundEntity");
 	background = new CBackgroundEntity("Image/space_bg.png");
 	background->SetShader("Shader2D");
 	background->Init();
 
 	// Create and initialise the CPlayer2D
+	RESOURCE_TAG("CShipPlayer");
 	cPlayer2D = CShipPlayer::GetInstance();
 	// Pass shader to cPlayer2D
 	cPlayer2D->SetShader("Shader2D_Colour");
@@ -142,6 +156,7 @@ bool CSceneCombat::Init(void)
 	cMap2D->SetMapInfo(cPlayer2D->vec2Index.y, cPlayer2D->vec2Index.x, 598);
 
 	// Initialise the Physics
+	RESOURCE_TAG("CShip and CShipEnemy");
 	cPhysics2D.Init();
 	
 	cShip = CShip::GetInstance();
@@ -152,6 +167,7 @@ bool CSceneCombat::Init(void)
 	cShipEnemy->Init();
 
 	// Create and initialise the CGUI_Scene2D
+	RESOURCE_TAG("CGUI_SceneCombat");
 	cGUI_SceneCombat = CGUI_SceneCombat::GetInstance();
 	// Initialise the instance
 	if (cGUI_SceneCombat->Init() == false)
@@ -176,7 +192,7 @@ bool CSceneCombat::Init(void)
 	lState = false;
 	blockSelected = glm::vec2(0, 0);
 	// max 2 encounters x
-	numOfEncounters = rand() % 2 + 1;
+	numOfEncounters = CRandomManager::GetInstance()->Get(CRandomManager::COMBAT).Next(2) + 1;
 	goToNextScene = false;
 	state = CURRENT_STATE::SHIP_NOSTATE;
 	fightTimeElapsed = 0.0f;
@@ -236,7 +252,7 @@ bool CSceneCombat::Update(const double dElapsedTime)
 
 	if ((state == CURRENT_STATE::SHIPREST) && numOfEncounters > 0) {
 		fightTimeElapsed += float(dElapsedTime);
-		std::cout << fightTimeElapsed << " " << kBreakTime << "\n";
+		LOG_TRACE_EVERY(1.0, "CSceneCombat: {} s of the {} s break", fightTimeElapsed, kBreakTime);
 
 		if (fightTimeElapsed > kBreakTime) {
 			fightTimeElapsed = 0.0f;
@@ -421,8 +437,10 @@ void CSceneCombat::PreRender(void)
 void CSceneCombat::Render(void)
 {
 	//Render Background
+	RENDER_STATS_PASS(BACKGROUND);
 	background->Render();
 
+	RENDER_STATS_PASS(MAP);
 	// Calls the Map2D's PreRender()
 	cMap2D->PreRender();
 	// Calls the Map2D's Render()
@@ -430,6 +448,7 @@ void CSceneCombat::Render(void)
 	// Calls the Map2D's PostRender()
 	cMap2D->PostRender();
 
+	RENDER_STATS_PASS(PLAYER);
 	// Calls the CPlayer2D's PreRender()
 	cPlayer2D->PreRender();
 	// Calls the CPlayer2D's Render()
@@ -437,6 +456,7 @@ void CSceneCombat::Render(void)
 	// Calls the CPlayer2D's PostRender()
 	cPlayer2D->PostRender();
 
+	RENDER_STATS_PASS(HUD);
 	// Calls the CGUI_Scene2D's PreRender()
 	cGUI_SceneCombat->PreRender();
 	// Calls the CGUI_Scene2D's Render()
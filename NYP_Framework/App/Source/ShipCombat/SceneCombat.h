@@ -22,7 +22,7 @@
 #include "../App/Source/Scene2D/BackgroundEntity.h"
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "../App/Source/Scene2D/Map2D.h"
@@ -40,7 +40,7 @@
 #include <vector>
 
 // Include Keyboard controller
-#include "Inputs\KeyboardController.h"
+#include "Inputs/KeyboardController.h"
 
 // Game Manager
 #include "../App/Source/Scene2D/GameManager.h"
@@ -52,7 +52,7 @@
 #include "GUI_SceneCombat.h"
 
 // Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 // Include Enemy
 #include "ShipEnemy.h"
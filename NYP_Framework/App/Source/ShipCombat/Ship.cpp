@@ -10,10 +10,13 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
+
+// Include CLogger, to log from the game loop without waiting for the console
+#include "System/Logger.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "../App/Source/Scene2D/Map2D.h"
@@ -102,8 +105,8 @@ bool CShip::Reset()
  */
 void CShip::Update(const double dElapsedTime)
 {
-	TimeElapsed += 0.0167f;
-	std::cout << ventilationTiming << " " << TimeElapsed << "\n";
+	TimeElapsed += (float)dElapsedTime;
+	LOG_TRACE_EVERY(1.0, "CShip: Ventilation at {} s, {} s elapsed", ventilationTiming, TimeElapsed);
 
 	CInventoryItem* cItem1 = cInventoryManager->GetItem("Ventilation");
 	if ((TimeElapsed - ventilationTiming) >= ventilationInterval) {
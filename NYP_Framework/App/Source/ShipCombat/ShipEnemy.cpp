@@ -10,10 +10,16 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
+
+// Include Random, for the seeded random number streams
+#include "System/Random.h"
+
+// Include CLogger, to log from the game loop without waiting for the console
+#include "System/Logger.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "../App/Source/Scene2D/Map2D.h"
@@ -109,7 +115,7 @@ bool CShipEnemy::Reset()
  */
 void CShipEnemy::Update(const double dElapsedTime)
 {
-	TimeElapsed += 0.0167;
+	TimeElapsed += (float)dElapsedTime;
 
 	switch (enemType)
 	{
@@ -135,8 +141,8 @@ void CShipEnemy::Update(const double dElapsedTime)
 	}
 
 	for (int i = 0; i < tileVector.size(); i++) {
-		tileVector[i].second += 0.0167;
-		std::cout << tileVector[i].second << "\n";
+		tileVector[i].second += (float)dElapsedTime;
+		LOG_TRACE_EVERY(1.0, "CShipEnemy: Danger tile ({}, {}) at {} s", tileVector[i].first.x, tileVector[i].first.y, tileVector[i].second);
 
 		if (tileVector[i].second >= kWarningLength) {
 			SetDamage(tileVector[i].first);
@@ -161,13 +167,13 @@ void CShipEnemy::Update(const double dElapsedTime)
 
 void CShipEnemy::Attack(void)
 {
-	int randX = rand() % 13 + 10;
-	int randY = rand() % 7 + 9;
+	int randX = CRandomManager::GetInstance()->Get(CRandomManager::COMBAT).Next(13) + 10;
+	int randY = CRandomManager::GetInstance()->Get(CRandomManager::COMBAT).Next(7) + 9;
 
 	switch (enemType)
 	{
 	case CShipEnemy::EASY:
-		std::cout << randX << " " << randY << " " << CMap2D::GetInstance()->GetMapInfo(randY, randX) << "\n";
+		LOG_DEBUG("CShipEnemy: Attack at ({}, {}) on tile {}", randX, randY, CMap2D::GetInstance()->GetMapInfo(randY, randX));
 
 		if (CMap2D::GetInstance()->GetMapInfo(randY, randX) == 598) {
 			SetDanger(glm::vec2(randX, randY));
@@ -244,7 +250,7 @@ void CShipEnemy::Randomise(int position)
 {
 	if (position > 20) {
 		// difficulter
-		int luckyDraw = rand() % 99 + 1;
+		int luckyDraw = CRandomManager::GetInstance()->Get(CRandomManager::COMBAT).Next(99) + 1;
 		if (luckyDraw < 30) {
 			enemType = CShipEnemy::EASY;
 			maxHealth = enemyHealth = 50;
@@ -263,7 +269,7 @@ void CShipEnemy::Randomise(int position)
 	}
 	else {
 		// easier
-		int luckyDraw = rand() % 99 + 1;
+		int luckyDraw = CRandomManager::GetInstance()->Get(CRandomManager::COMBAT).Next(99) + 1;
 		if (luckyDraw < 70) {
 			enemType = CShipEnemy::EASY;
 			maxHealth = enemyHealth = 50;
@@ -10,10 +10,12 @@
 using namespace std;
 
 // Include Shader Manager
-#include "RenderControl\ShaderManager.h"
+#include "RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "RenderControl/RenderStats.h"
 
 // Include ImageLoader
-#include "System\ImageLoader.h"
+#include "System/ImageLoader.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "../App/Source/Scene2D/Map2D.h"
@@ -184,7 +186,7 @@ bool CShipPlayer::Init(void)
 	}
 	if (cInventoryManager->Check("Ironwood") == false) {
 		// Add a ironwood as one of the inventory items
-		cInventoryItem = cInventoryManager->Add("Ironwood", "Image/GUI/Ironwood.tga", 99, 2);
+		cInventoryItem = cInventoryManager->Add("Ironwood", "Image/JunglePlanet/IronwoodTreeTrunk.tga", 99, 2);
 		cInventoryItem->vec2Size = glm::vec2(25, 25);
 	}
 	else {
@@ -278,7 +280,7 @@ bool CShipPlayer::Reset()
 void CShipPlayer::Update(const double dElapsedTime)
 {
 	// Increase time
-	TimeElapsed += 0.0167f;
+	TimeElapsed += (float)dElapsedTime;
 
 	// SUPERHOT movement
 	if (cPhysics2D.GetStatus() == CPhysics2D::STATUS::IDLE)
@@ -471,12 +473,14 @@ void CShipPlayer::Render(void)
 	glm::vec2 offset = glm::i32vec2(float(cSettings->NUM_TILES_XAXIS / 2.0f), float(cSettings->NUM_TILES_YAXIS / 2.0f));
 	glm::vec2 cameraPos = camera2D->getPos();
 
-	glm::vec2 IndexPos = vec2Index;
+	// Draw between the previous tick and the latest tick
+	glm::vec2 IndexPos, MicroSteps;
+	GetRenderPosition(vec2Index, vec2NumMicroSteps, IndexPos, MicroSteps);
 
 	glm::vec2 actualPos = IndexPos - cameraPos + offset;
 	actualPos = cSettings->ConvertIndexToUVSpace(actualPos) * camera2D->getZoom();
-	actualPos.x += vec2NumMicroSteps.x * cSettings->MICRO_STEP_XAXIS * camera2D->getZoom();
-	actualPos.y += vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS * camera2D->getZoom();
+	actualPos.x += MicroSteps.x * cSettings->MICRO_STEP_XAXIS * camera2D->getZoom();
+	actualPos.y += MicroSteps.y * cSettings->MICRO_STEP_YAXIS * camera2D->getZoom();
 
 	transform = glm::translate(transform, glm::vec3(actualPos.x, actualPos.y, 0.f));
 	transform = glm::scale(transform, glm::vec3(camera2D->getZoom()));
@@ -489,6 +493,7 @@ void CShipPlayer::Render(void)
 	glActiveTexture(GL_TEXTURE0);
 	// Get the texture to be rendered
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	//CS: Render the animated Sprite
 	animatedSprites->Render();
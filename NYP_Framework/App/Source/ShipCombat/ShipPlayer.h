@@ -7,7 +7,7 @@
 #pragma once
 
 // Include Singleton template
-#include "DesignPatterns\SingletonTemplate.h"
+#include "DesignPatterns/SingletonTemplate.h"
 
 // Include GLEW
 #ifndef GLEW_STATIC
@@ -27,7 +27,7 @@
 #include "../App/Source/Scene2D/Map2D.h"
 
 // Include Keyboard controller
-#include "Inputs\KeyboardController.h"
+#include "Inputs/KeyboardController.h"
 
 // Include AnimatedSprites
 #include "Primitives/SpriteAnimation.h"
@@ -45,7 +45,7 @@
 #include "InventoryManagerShip.h"
 
 // Include SoundController
-#include "..\SoundController\SoundController.h"
+#include "../SoundController/SoundController.h"
 
 // Include Camera2D
 #include "Primitives/Camera2D.h"
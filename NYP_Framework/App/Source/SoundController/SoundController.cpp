@@ -6,6 +6,11 @@
  */
 #include "SoundController.h"
 
+// Include CProfiler, to show the sound loads in the traces
+#include "TimeControl/Profiler.h"
+// Include CAssetArchive, to read the sounds from the archive instead of their files
+#include "System/AssetArchive.h"
+
 #include <iostream>
 using namespace std;
 
@@ -49,17 +54,25 @@ CSoundController::~CSoundController(void)
 
 /**
  @brief Initialise this class instance
+ @param bNullDevice A const bool which is true to play the sounds on a device which outputs nothing, e.g. when
+		there is no sound hardware. The sounds are still loaded and played
  @return A bool value. true is this class instance was initialised, else false
  */
-bool CSoundController::Init(void)
+bool CSoundController::Init(const bool bNullDevice)
 {
+#ifdef SOUND_DISABLED
+	// There is no sound engine without irrKlang, so the sounds are not loaded or played
+	(void)bNullDevice;
+	cout << "CSoundController::Init() : This build has no sound" << endl;
+#else
 	// Initialise the sound engine with default parameters
-	cSoundEngine = createIrrKlangDevice(ESOD_WIN_MM, ESEO_MULTI_THREADED);
+	cSoundEngine = createIrrKlangDevice(bNullDevice ? ESOD_NULL : ESOD_WIN_MM, ESEO_MULTI_THREADED);
 	if (cSoundEngine == NULL)
 	{
 		cout << "Unable to initialise the IrrKlang sound engine" << endl;
 		return false;
 	}
+#endif
 	return true;
 }
 
@@ -71,7 +84,7 @@ bool CSoundController::Init(void)
  @param bIsLooped A const bool variable which indicates if this iSoundSource will have loop playback.
  @param eSoundType A SOUNDTYPE enum variable which states the type of sound
  @param vec3dfSoundPos A vec3df variable which contains the 3D position of the sound
- @return A bool value. True if the sound was loaded, else false.
+ @return A bool value. True if the sound was loaded, else false. It is false without a sound engine
  */
 bool CSoundController::LoadSound(	string filename,
 									const int ID,
@@ -80,10 +93,22 @@ bool CSoundController::LoadSound(	string filename,
 									CSoundInfo::SOUNDTYPE eSoundType,
 									vec3df vec3dfSoundPos)
 {
-	// Load the sound from the file
-	ISoundSource* pSoundSource = cSoundEngine->addSoundSourceFromFile(filename.c_str(),
-																	E_STREAM_MODE::ESM_NO_STREAMING, 
-																	bPreload);
+	if (cSoundEngine == NULL)
+		return false;
+
+	PROFILE_SCOPE_DETAIL("CSoundController::LoadSound", "asset", filename);
+
+	// Load the sound from the asset archive if it is in it, or else from the file. A sound which is stored in the
+	// archive as it is is played from the mapped archive, which stays open until the sound engine is destroyed
+	ISoundSource* pSoundSource = NULL;
+	CAsset cAsset;
+	if (CAssetArchive::GetInstance()->Read(filename, cAsset))
+		pSoundSource = cSoundEngine->addSoundSourceFromMemory((void*)cAsset.GetData(), (ik_s32)cAsset.GetSize(),
+															  filename.c_str(), cAsset.IsMapped() == false);
+	else
+		pSoundSource = cSoundEngine->addSoundSourceFromFile(filename.c_str(),
+															E_STREAM_MODE::ESM_NO_STREAMING, 
+															bPreload);
 
 
 	// Trivial Rejection : Invalid pointer provided
@@ -118,6 +143,9 @@ bool CSoundController::LoadSound(	string filename,
  */
 void CSoundController::PlaySoundByID(const int ID)
 {
+	if (cSoundEngine == NULL)
+		return;
+
 	CSoundInfo* pSoundInfo = GetSound(ID);
 	if (!pSoundInfo)
 	{
@@ -150,6 +178,9 @@ void CSoundController::PlaySoundByID(const int ID)
  */
 void CSoundController::StopSoundByID(const int ID)
 {
+	if (cSoundEngine == NULL)
+		return;
+
 	CSoundInfo* pSoundInfo = GetSound(ID);
 	if (!pSoundInfo)
 	{
@@ -170,6 +201,9 @@ void CSoundController::StopSoundByID(const int ID)
  */
 bool CSoundController::MasterVolumeIncrease(void)
 {
+	if (cSoundEngine == NULL)
+		return false;
+
 	// Get the current volume
 	float fCurrentVolume = cSoundEngine->getSoundVolume() + 0.1f;
 	// Check if the maximum volume has been reached
@@ -189,6 +223,9 @@ bool CSoundController::MasterVolumeIncrease(void)
  */
 bool CSoundController::MasterVolumeDecrease(void)
 {
+	if (cSoundEngine == NULL)
+		return false;
+
 	// Get the current volume
 	float fCurrentVolume = cSoundEngine->getSoundVolume() - 0.1f;
 	// Check if the minimum volume has been reached
@@ -1,13 +1,14 @@
 /**
  CSoundController
- @brief A class which manages the sound objects
+ @brief A class which manages the sound objects.
+		Define SOUND_DISABLED to build without the irrKlang library, e.g. on Linux, where no sounds are loaded or played
  By: Toh Da Jun
  Date: Mar 2020
  */
 #pragma once
 
 // Include SingletonTemplate
-#include <DesignPatterns\SingletonTemplate.h>
+#include <DesignPatterns/SingletonTemplate.h>
 
 // Include GLEW
 #include <includes/irrKlang.h>
@@ -27,8 +28,8 @@ class CSoundController : public CSingletonTemplate<CSoundController>
 {
 	friend CSingletonTemplate<CSoundController>;
 public:
-	// Initialise this class instance
-	bool Init(void);
+	// Initialise this class instance. The null device outputs nothing
+	bool Init(const bool bNullDevice = false);
 
 	enum SOUND_LIST
 	{
@@ -8,13 +8,15 @@
 
 /**
  @brief This function is the main function which is called by the operating system when you run the executables
+ @param argc The number of command line arguments
+ @param argv The command line arguments, e.g. --headless. See Application::ParseCommandLine
  @return This function returns the error codes
  */
-int main(void)
+int main(int argc, char* argv[])
 {
 	Application* pApp = Application::GetInstance();
-	// if the application is initialised properly, then run it
-	if (pApp->Init() == true)
+	// if the command line is valid and the application is initialised properly, then run it
+	if ((pApp->ParseCommandLine(argc, argv) == true) && (pApp->Init() == true))
 	{
 		// Run the Application instance
 		pApp->Run();
@@ -0,0 +1,161 @@
+/**
+ AssetBenchmarks
+ @brief The benchmarks of the image decoding, the sprite animations and the inventory lookups
+ */
+#include "AssetBenchmarks.h"
+
+// Include ImageLoader
+#include "System/ImageLoader.h"
+// Include CResourceTracker, to forget the textures which the benchmarks delete
+#include "System/ResourceTracker.h"
+// Include CSpriteAnimation
+#include "Primitives/SpriteAnimation.h"
+// Include CInventoryManager
+#include "Scene2D/InventoryManager.h"
+
+#include <iostream>
+using namespace std;
+
+// The images which are decoded, from the biggest background to a small tile
+static const char* szImages[] = {
+	"Image/menuBG.jpg",
+	"Image/space_bg.png",
+	"Image/Scene2D_PlayerSpriteSheet.png",
+	"Image/JunglePlanet/BouncyBloom_Bloomed.tga",
+	"Image/TerrestrialPlanet/Tile_Ground.tga",
+};
+
+// The number of sprites which are updated in each run, about the number of animated entities in a level
+static const unsigned int NUM_SPRITES = 64;
+
+// The sprites which are updated by the CSpriteAnimation benchmark
+static std::vector<CSpriteAnimation*> vSprites;
+
+// The items of the inventory, as CGUI_Scene2D adds them
+static const char* szItems[] = {
+	"Lives", "Health", "Damage", "Ventilation", "Storage", "ScrapMetal", "Battery", "Ironwood",
+	"EnergyQuartz", "IceCrystal", "Upgrade_storage", "Upgrade_ventilation", "Upgrade_small1",
+	"Upgrade_small2", "Upgrade_large",
+};
+
+/**
+ @brief Get the name of an image without its folder
+ @param szFilename A const char* containing the file name of the image
+ */
+static std::string GetImageName(const char* szFilename)
+{
+	std::string sName = szFilename;
+	size_t uiSlash = sName.find_last_of("/\\");
+	if (uiSlash != string::npos)
+		sName = sName.substr(uiSlash + 1);
+	return sName;
+}
+
+/**
+ @brief Create the sprites, with the animations of CPlayer2D, at different points of their animations
+ */
+static void CreateSprites(void)
+{
+	if (vSprites.empty() == false)
+		return;
+
+	const char* szAnimations[] = { "idleR", "idleL", "runR", "runL" };
+	for (unsigned int i = 0; i < NUM_SPRITES; i++)
+	{
+		CSpriteAnimation* pSprite = new CSpriteAnimation(4, 4);
+		pSprite->AddAnimation("idleR", 0, 0);
+		pSprite->AddAnimation("idleL", 1, 1);
+		pSprite->AddAnimation("runR", 4, 7);
+		pSprite->AddAnimation("runL", 8, 11);
+		pSprite->AddAnimation("attackR", 2, 2);
+		pSprite->AddAnimation("attackL", 3, 3);
+		pSprite->AddAnimation("idleshieldR", 12, 12);
+		pSprite->AddAnimation("idleshieldL", 13, 13);
+		pSprite->PlayAnimation(szAnimations[i % 4], -1, 1.0f);
+		pSprite->Update(0.01 * i);
+		vSprites.push_back(pSprite);
+	}
+}
+
+/**
+ @brief Create the inventory. The items have no images, since only the lookups are timed
+ */
+static void CreateInventory(void)
+{
+	CInventoryManager* cInventoryManager = CInventoryManager::GetInstance();
+	if (cInventoryManager->GetNumItems() > 0)
+		return;
+
+	for (unsigned int i = 0; i < sizeof(szItems) / sizeof(szItems[0]); i++)
+		cInventoryManager->Add(szItems[i], NULL, 99, 1);
+}
+
+/**
+ @brief Add the benchmarks of the assets. The images are loaded from the Image folder of the current directory
+ @param cBenchmark A CBenchmark& which the benchmarks are added to
+ */
+void AddAssetBenchmarks(CBenchmark& cBenchmark)
+{
+	for (unsigned int i = 0; i < sizeof(szImages) / sizeof(szImages[0]); i++)
+	{
+		const char* szImage = szImages[i];
+		cBenchmark.Add("ImageLoader/Load/" + GetImageName(szImage), [szImage]() {
+			int iWidth = 0, iHeight = 0, iNumChannels = 0;
+			unsigned char* data = CImageLoader::GetInstance()->Load(szImage, iWidth, iHeight, iNumChannels, true);
+			CBenchmark::Consume(iWidth * iHeight * iNumChannels);
+			CImageLoader::GetInstance()->Free(data);
+		}, [szImage]() {
+			int iWidth = 0, iHeight = 0, iNumChannels = 0;
+			unsigned char* data = CImageLoader::GetInstance()->Load(szImage, iWidth, iHeight, iNumChannels, true);
+			if (data == NULL)
+				cout << "AssetBenchmarks: Unable to load " << szImage << endl;
+			CImageLoader::GetInstance()->Free(data);
+		});
+	}
+
+	// The textures are uploaded from their cooked textures instead of decoded, if the benchmarks read an archive
+	for (unsigned int i = 0; i < sizeof(szImages) / sizeof(szImages[0]); i++)
+	{
+		const char* szImage = szImages[i];
+		cBenchmark.Add("ImageLoader/LoadTextureGetID/" + GetImageName(szImage), [szImage]() {
+			GLuint uiTexture = CImageLoader::GetInstance()->LoadTextureGetID(szImage, true);
+			CBenchmark::Consume(uiTexture);
+			glDeleteTextures(1, &uiTexture);
+#ifndef RESOURCE_TRACKER_DISABLED
+			CResourceTracker::GetInstance()->RemoveTexture(uiTexture);
+#endif
+		});
+	}
+
+	cBenchmark.Add("SpriteAnimation/Update/" + to_string(NUM_SPRITES), []() {
+		for (unsigned int i = 0; i < vSprites.size(); i++)
+			vSprites[i]->Update(1.0 / 60.0);
+	}, CreateSprites);
+
+	// The game looks items up by string literals, so each lookup also makes a std::string
+	cBenchmark.Add("InventoryManager/GetItem/Literal", []() {
+		CInventoryManager* cInventoryManager = CInventoryManager::GetInstance();
+		CBenchmark::Consume(cInventoryManager->GetItem("Health")->GetCount());
+		CBenchmark::Consume(cInventoryManager->GetItem("Storage")->GetCount());
+		CBenchmark::Consume(cInventoryManager->GetItem("Upgrade_ventilation")->GetCount());
+		CBenchmark::Consume(cInventoryManager->GetItem("Lives")->GetCount());
+	}, CreateInventory);
+
+	cBenchmark.Add("InventoryManager/GetItem/AllItems", []() {
+		CInventoryManager* cInventoryManager = CInventoryManager::GetInstance();
+		for (unsigned int i = 0; i < sizeof(szItems) / sizeof(szItems[0]); i++)
+			CBenchmark::Consume(cInventoryManager->GetItem(szItems[i])->GetCount());
+	}, CreateInventory);
+}
+
+/**
+ @brief Delete the sprite animations and the inventory which were made for the benchmarks
+ */
+void DestroyAssetBenchmarks(void)
+{
+	for (unsigned int i = 0; i < vSprites.size(); i++)
+		delete vSprites[i];
+	vSprites.clear();
+
+	CInventoryManager::Destroy();
+}
@@ -0,0 +1,13 @@
+/**
+ AssetBenchmarks
+ @brief The benchmarks of the image decoding, the sprite animations and the inventory lookups
+ */
+#pragma once
+
+#include "Benchmark.h"
+
+// Add the benchmarks of the assets. The images are loaded from the Image folder of the current directory
+void AddAssetBenchmarks(CBenchmark& cBenchmark);
+
+// Delete the sprite animations and the inventory which were made for the benchmarks
+void DestroyAssetBenchmarks(void);
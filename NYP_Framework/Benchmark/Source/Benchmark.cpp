@@ -0,0 +1,273 @@
+/**
+ CBenchmark
+ @brief A class which times a list of benchmarks and saves the results as JSON, so that each optimisation
+		can be compared against the results of an earlier run.
+		Each benchmark is run in samples. A sample runs the benchmark enough times to take at least the minimum
+		sample time, and the time of each run is the time of the sample divided by the number of runs
+ */
+#include "Benchmark.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <algorithm>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+using namespace std;
+
+volatile unsigned int CBenchmark::uiSink = 0;
+
+/**
+ @brief Constructor
+ */
+CBenchmark::CBenchmark(void)
+	: uiNumSamples(20)
+	, dMinSampleTime(0.002)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CBenchmark::~CBenchmark(void)
+{
+}
+
+/**
+ @brief Set the number of samples of each benchmark
+ @param uiNumSamples A const unsigned int containing the number of samples
+ */
+void CBenchmark::SetNumSamples(const unsigned int uiNumSamples)
+{
+	this->uiNumSamples = (uiNumSamples > 0) ? uiNumSamples : 1;
+}
+
+/**
+ @brief Set the shortest time of a sample
+ @param dMinSampleTime A const double containing the time in seconds
+ */
+void CBenchmark::SetMinSampleTime(const double dMinSampleTime)
+{
+	this->dMinSampleTime = dMinSampleTime;
+}
+
+/**
+ @brief Only run the benchmarks whose names contain this
+ @param sFilter A const std::string& containing a part of the names. An empty string runs every benchmark
+ */
+void CBenchmark::SetFilter(const std::string& sFilter)
+{
+	this->sFilter = sFilter;
+}
+
+/**
+ @brief Add a benchmark
+ @param sName A const std::string& containing the name, as Group/Function/Case
+ @param function A const Function& containing the work which is timed
+ @param setup A const Function& which is called once before the benchmark is timed, or an empty Function
+ */
+void CBenchmark::Add(const std::string& sName, const Function& function, const Function& setup)
+{
+	SBenchmark sBenchmark;
+	sBenchmark.sName = sName;
+	sBenchmark.function = function;
+	sBenchmark.setup = setup;
+	vBenchmarks.push_back(sBenchmark);
+}
+
+/**
+ @brief Print out the names of the benchmarks
+ */
+void CBenchmark::List(void) const
+{
+	for (unsigned int i = 0; i < vBenchmarks.size(); i++)
+	{
+		if ((sFilter.empty()) || (vBenchmarks[i].sName.find(sFilter) != string::npos))
+			cout << vBenchmarks[i].sName << endl;
+	}
+}
+
+/**
+ @brief Run the benchmarks and print out their results
+ */
+void CBenchmark::Run(void)
+{
+	vResults.clear();
+
+	cout << left << setw(48) << "Benchmark" << right
+		<< setw(14) << "median ns" << setw(14) << "min ns" << setw(14) << "p95 ns" << setw(10) << "runs" << endl;
+
+	for (unsigned int i = 0; i < vBenchmarks.size(); i++)
+	{
+		if ((sFilter.empty() == false) && (vBenchmarks[i].sName.find(sFilter) == string::npos))
+			continue;
+
+		if (vBenchmarks[i].setup)
+			vBenchmarks[i].setup();
+
+		SResult sResult = Measure(vBenchmarks[i]);
+		vResults.push_back(sResult);
+
+		cout << left << setw(48) << sResult.sName << right << fixed << setprecision(1)
+			<< setw(14) << sResult.dMedian << setw(14) << sResult.dMin << setw(14) << sResult.dP95
+			<< setw(10) << sResult.uiRunsPerSample * sResult.uiNumSamples << endl;
+	}
+	cout.unsetf(ios::fixed);
+}
+
+/**
+ @brief Get the results of the benchmarks which were run
+ */
+const std::vector<CBenchmark::SResult>& CBenchmark::GetResults(void) const
+{
+	return vResults;
+}
+
+/**
+ @brief Save the results as JSON, with one benchmark on each line so that they are easy to compare with diff
+ @param sFilename A const std::string& containing the name of the file
+ */
+bool CBenchmark::SaveResults(const std::string& sFilename) const
+{
+	ofstream file(sFilename.c_str());
+	if (file.is_open() == false)
+	{
+		cout << "CBenchmark: Unable to save the results to " << sFilename << endl;
+		return false;
+	}
+
+	file << setprecision(10);
+	file << "{" << endl;
+	file << "\"unit\": \"ns\"," << endl;
+	file << "\"samples\": " << uiNumSamples << "," << endl;
+	file << "\"benchmarks\": [" << endl;
+	for (unsigned int i = 0; i < vResults.size(); i++)
+	{
+		const SResult& sResult = vResults[i];
+		file << "{\"name\": \"" << sResult.sName << "\""
+			<< ", \"runs_per_sample\": " << sResult.uiRunsPerSample
+			<< ", \"num_samples\": " << sResult.uiNumSamples
+			<< ", \"min\": " << sResult.dMin
+			<< ", \"median\": " << sResult.dMedian
+			<< ", \"mean\": " << sResult.dMean
+			<< ", \"p95\": " << sResult.dP95
+			<< ", \"stddev\": " << sResult.dStdDev << "}"
+			<< ((i + 1 < vResults.size()) ? "," : "") << endl;
+	}
+	file << "]" << endl;
+	file << "}" << endl;
+
+	cout << "CBenchmark: Saved " << vResults.size() << " results to " << sFilename << endl;
+	return true;
+}
+
+/**
+ @brief Print out the change of the median of each benchmark from the results of an earlier run
+ @param sFilename A const std::string& containing the name of a file which was saved by SaveResults
+ */
+bool CBenchmark::CompareWithBaseline(const std::string& sFilename) const
+{
+	ifstream file(sFilename.c_str());
+	if (file.is_open() == false)
+	{
+		cout << "CBenchmark: Unable to load the baseline " << sFilename << endl;
+		return false;
+	}
+
+	// SaveResults writes each benchmark on its own line, so the values can be found without a JSON parser
+	map<string, double> mapBaseline;
+	string sLine;
+	while (getline(file, sLine))
+	{
+		size_t uiName = sLine.find("\"name\": \"");
+		size_t uiMedian = sLine.find("\"median\": ");
+		if ((uiName == string::npos) || (uiMedian == string::npos))
+			continue;
+
+		uiName += 9;
+		size_t uiNameEnd = sLine.find('"', uiName);
+		if (uiNameEnd == string::npos)
+			continue;
+		mapBaseline[sLine.substr(uiName, uiNameEnd - uiName)] = atof(sLine.c_str() + uiMedian + 10);
+	}
+
+	cout << endl << "Compared with " << sFilename << endl;
+	cout << left << setw(48) << "Benchmark" << right
+		<< setw(14) << "baseline ns" << setw(14) << "median ns" << setw(10) << "change" << endl;
+	for (unsigned int i = 0; i < vResults.size(); i++)
+	{
+		cout << left << setw(48) << vResults[i].sName << right << fixed << setprecision(1);
+
+		map<string, double>::const_iterator it = mapBaseline.find(vResults[i].sName);
+		if ((it == mapBaseline.end()) || (it->second <= 0.0))
+		{
+			cout << setw(14) << "-" << setw(14) << vResults[i].dMedian << setw(10) << "new" << endl;
+			continue;
+		}
+
+		double dChange = (vResults[i].dMedian - it->second) / it->second * 100.0;
+		cout << setw(14) << it->second << setw(14) << vResults[i].dMedian
+			<< setw(9) << showpos << dChange << noshowpos << "%" << endl;
+	}
+	cout.unsetf(ios::fixed);
+	return true;
+}
+
+/**
+ @brief Time a benchmark
+ @param sBenchmark A const SBenchmark& containing the benchmark
+ */
+CBenchmark::SResult CBenchmark::Measure(const SBenchmark& sBenchmark) const
+{
+	// Warm up the caches, and find how many runs take the minimum sample time
+	unsigned int uiRunsPerSample = 1;
+	while (true)
+	{
+		Clock::time_point start = Clock::now();
+		for (unsigned int i = 0; i < uiRunsPerSample; i++)
+			sBenchmark.function();
+		double dTime = chrono::duration<double>(Clock::now() - start).count();
+
+		if ((dTime >= dMinSampleTime) || (uiRunsPerSample >= (1u << 30)))
+			break;
+
+		// Aim a little above the minimum, but do not grow too fast from a time which is mostly noise
+		double dScale = (dTime > 0.0) ? (dMinSampleTime * 1.2 / dTime) : 10.0;
+		if (dScale > 10.0)
+			dScale = 10.0;
+		unsigned int uiNextRuns = (unsigned int)(uiRunsPerSample * dScale);
+		uiRunsPerSample = (uiNextRuns > uiRunsPerSample) ? uiNextRuns : uiRunsPerSample + 1;
+	}
+
+	vector<double> vTimes(uiNumSamples);
+	for (unsigned int uiSample = 0; uiSample < uiNumSamples; uiSample++)
+	{
+		Clock::time_point start = Clock::now();
+		for (unsigned int i = 0; i < uiRunsPerSample; i++)
+			sBenchmark.function();
+		vTimes[uiSample] = chrono::duration<double, nano>(Clock::now() - start).count() / uiRunsPerSample;
+	}
+	sort(vTimes.begin(), vTimes.end());
+
+	SResult sResult;
+	sResult.sName = sBenchmark.sName;
+	sResult.uiRunsPerSample = uiRunsPerSample;
+	sResult.uiNumSamples = uiNumSamples;
+	sResult.dMin = vTimes.front();
+	sResult.dMedian = (uiNumSamples % 2 == 1) ? vTimes[uiNumSamples / 2]
+		: (vTimes[uiNumSamples / 2 - 1] + vTimes[uiNumSamples / 2]) * 0.5;
+	sResult.dP95 = vTimes[(unsigned int)ceil(uiNumSamples * 0.95) - 1];
+
+	double dSum = 0.0;
+	for (unsigned int i = 0; i < uiNumSamples; i++)
+		dSum += vTimes[i];
+	sResult.dMean = dSum / uiNumSamples;
+
+	double dSumSquares = 0.0;
+	for (unsigned int i = 0; i < uiNumSamples; i++)
+		dSumSquares += (vTimes[i] - sResult.dMean) * (vTimes[i] - sResult.dMean);
+	sResult.dStdDev = sqrt(dSumSquares / uiNumSamples);
+
+	return sResult;
+}
@@ -0,0 +1,92 @@
+/**
+ CBenchmark
+ @brief A class which times a list of benchmarks and saves the results as JSON, so that each optimisation
+		can be compared against the results of an earlier run.
+		Each benchmark is run in samples. A sample runs the benchmark enough times to take at least the minimum
+		sample time, and the time of each run is the time of the sample divided by the number of runs
+ */
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <chrono>
+
+class CBenchmark
+{
+public:
+	typedef std::function<void(void)> Function;
+	typedef std::chrono::steady_clock Clock;
+
+	// The times of a benchmark, in nanoseconds for each run
+	struct SResult
+	{
+		std::string sName;
+		// The number of runs in each sample, and the number of samples
+		unsigned int uiRunsPerSample;
+		unsigned int uiNumSamples;
+		double dMin;
+		double dMedian;
+		double dMean;
+		double dP95;
+		double dStdDev;
+	};
+
+	// Constructor
+	CBenchmark(void);
+
+	// Destructor
+	virtual ~CBenchmark(void);
+
+	// Set the number of samples of each benchmark
+	void SetNumSamples(const unsigned int uiNumSamples);
+	// Set the shortest time in seconds of a sample
+	void SetMinSampleTime(const double dMinSampleTime);
+	// Only run the benchmarks whose names contain this
+	void SetFilter(const std::string& sFilter);
+
+	// Add a benchmark. The setup is called once before the benchmark is timed, and is not timed
+	void Add(const std::string& sName, const Function& function, const Function& setup = Function());
+
+	// Print out the names of the benchmarks
+	void List(void) const;
+
+	// Run the benchmarks and print out their results
+	void Run(void);
+
+	// Get the results of the benchmarks which were run
+	const std::vector<SResult>& GetResults(void) const;
+
+	// Save the results as JSON, with one benchmark on each line
+	bool SaveResults(const std::string& sFilename) const;
+
+	// Print out the change of the median of each benchmark from the results of an earlier run
+	bool CompareWithBaseline(const std::string& sFilename) const;
+
+	// Keep a value, so that the compiler cannot remove the work which made it
+	template <typename T>
+	static void Consume(const T& value)
+	{
+		uiSink += (unsigned int)(value);
+	}
+
+protected:
+	struct SBenchmark
+	{
+		std::string sName;
+		Function function;
+		Function setup;
+	};
+
+	std::vector<SBenchmark> vBenchmarks;
+	std::vector<SResult> vResults;
+
+	unsigned int uiNumSamples;
+	double dMinSampleTime;
+	std::string sFilter;
+
+	static volatile unsigned int uiSink;
+
+	// Time a benchmark
+	SResult Measure(const SBenchmark& sBenchmark) const;
+};
@@ -0,0 +1,419 @@
+/**
+ MapBenchmarks
+ @brief The benchmarks of CMap2D: loading, path finding, tile searches and collision checks, on the levels
+		of the game and on bigger maps which are made by tiling a level
+ */
+#include "MapBenchmarks.h"
+
+// Include CMap2D
+#include "Scene2D/Map2D.h"
+// Include CRandom, to pick the same paths in every run
+#include "System/Random.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+using namespace std;
+
+// The levels of the game
+static const char* szLevels[] = {
+	"Maps/DM2292_Map_Terrestrial_Tutorial.csv",
+	"Maps/DM2292_Map_Terrestrial_01.csv",
+	"Maps/DM2292_Map_Terrestrial_02.csv",
+	"Maps/DM2292_Map_Jungle_Tutorial.csv",
+	"Maps/DM2292_Map_Jungle_01.csv",
+	"Maps/DM2292_Map_Jungle_02.csv",
+	"Maps/DM2292_Map_Snow_Tutorial.csv",
+	"Maps/DM2292_Map_Snow_01.csv",
+	"Maps/DM2292_Map_Snow_02.csv",
+	"Maps/DM2213_Map_Planet.csv",
+	"Maps/DM2213_Map_Ship.csv",
+};
+
+// The number of paths which each PathFind benchmark cycles through
+static const unsigned int NUM_PATHS = 32;
+
+// A map which the benchmarks run on
+struct SMapCase
+{
+	std::string sName;
+	std::string sFilename;
+	unsigned int uiNumRows;
+	unsigned int uiNumCols;
+	// The start and target of each path, which are in the same open area
+	std::vector<glm::vec2> vPathStarts;
+	std::vector<glm::vec2> vPathTargets;
+	unsigned int uiNextPath;
+	// A tile value which is in the map, for the searches
+	int iSearchValue;
+};
+
+// The maps which were made by CreateScaledMap, to be deleted at the end
+static std::vector<std::string> vScaledMaps;
+// The map which is loaded in CMap2D
+static std::string sLoadedMap;
+// The benchmarks keep pointers to the cases, so they are not stored in a vector which can move them
+static std::vector<SMapCase*> vMapCases;
+
+/**
+ @brief Get the name of a level without its folder, prefix and extension
+ @param sFilename A const std::string& containing the file name of the level
+ */
+static std::string GetLevelName(const std::string& sFilename)
+{
+	std::string sName = sFilename;
+	size_t uiSlash = sName.find_last_of("/\\");
+	if (uiSlash != string::npos)
+		sName = sName.substr(uiSlash + 1);
+	size_t uiMap = sName.find("_Map_");
+	if (uiMap != string::npos)
+		sName = sName.substr(uiMap + 5);
+	size_t uiDot = sName.rfind('.');
+	if (uiDot != string::npos)
+		sName = sName.substr(0, uiDot);
+	return sName;
+}
+
+/**
+ @brief Read the tiles of a map file. The first line of the file is a header
+ @param sFilename A const std::string& containing the file name of the map
+ @param vvTiles A std::vector<std::vector<int>>& which is set to the rows of tiles
+ */
+static bool ReadMapFile(const std::string& sFilename, std::vector<std::vector<int>>& vvTiles)
+{
+	ifstream file(sFilename.c_str());
+	if (file.is_open() == false)
+	{
+		cout << "MapBenchmarks: Unable to open " << sFilename << endl;
+		return false;
+	}
+
+	vvTiles.clear();
+	std::string sLine;
+	getline(file, sLine);
+	while (getline(file, sLine))
+	{
+		if ((sLine.empty() == false) && (sLine.back() == '\r'))
+			sLine.pop_back();
+		if (sLine.empty())
+			continue;
+
+		std::vector<int> vRow;
+		stringstream ss(sLine);
+		std::string sValue;
+		while (getline(ss, sValue, ','))
+			vRow.push_back(atoi(sValue.c_str()));
+		vvTiles.push_back(vRow);
+	}
+	return (vvTiles.empty() == false);
+}
+
+/**
+ @brief Make a bigger map by tiling a level, and opening the walls where the copies meet so that paths can cross them
+ @param sFilename A const std::string& containing the file name of the level
+ @param uiScale A const unsigned int containing the number of copies along each axis
+ @return The file name of the bigger map, or an empty string if it could not be made
+ */
+static std::string CreateScaledMap(const std::string& sFilename, const unsigned int uiScale)
+{
+	std::vector<std::vector<int>> vvTiles;
+	if (ReadMapFile(sFilename, vvTiles) == false)
+		return "";
+
+	unsigned int uiRows = (unsigned int)vvTiles.size();
+	unsigned int uiCols = (unsigned int)vvTiles[0].size();
+	std::string sScaledFilename = "Maps/Benchmark_" + GetLevelName(sFilename) + "_x" + to_string(uiScale) + ".csv";
+
+	ofstream file(sScaledFilename.c_str());
+	if (file.is_open() == false)
+	{
+		cout << "MapBenchmarks: Unable to create " << sScaledFilename << endl;
+		return "";
+	}
+	vScaledMaps.push_back(sScaledFilename);
+
+	file << "//";
+	for (unsigned int uiCol = 0; uiCol < uiCols * uiScale; uiCol++)
+		file << ((uiCol > 0) ? "," : "") << uiCol;
+	file << endl;
+
+	for (unsigned int uiRow = 0; uiRow < uiRows * uiScale; uiRow++)
+	{
+		unsigned int uiSourceRow = uiRow % uiRows;
+		bool bSeamRow = ((uiSourceRow == 0) && (uiRow > 0)) ||
+						((uiSourceRow == uiRows - 1) && (uiRow < uiRows * uiScale - 1));
+		for (unsigned int uiCol = 0; uiCol < uiCols * uiScale; uiCol++)
+		{
+			unsigned int uiSourceCol = uiCol % uiCols;
+			bool bSeamCol = ((uiSourceCol == 0) && (uiCol > 0)) ||
+							((uiSourceCol == uiCols - 1) && (uiCol < uiCols * uiScale - 1));
+
+			int iValue = (uiSourceCol < vvTiles[uiSourceRow].size()) ? vvTiles[uiSourceRow][uiSourceCol] : 0;
+			// Open the walls where the copies meet. The walls are the same range which CMap2D::isBlocked uses
+			if ((bSeamRow || bSeamCol) && (iValue >= 600) && (iValue < 1400))
+				iValue = 0;
+			file << ((uiCol > 0) ? "," : "") << iValue;
+		}
+		file << endl;
+	}
+	return sScaledFilename;
+}
+
+/**
+ @brief Load a map into CMap2D, unless it is already loaded. CMap2D is created again if the size of the map changes
+ @param sMapCase A const SMapCase& containing the map
+ */
+static bool LoadMapCase(const SMapCase& sMapCase)
+{
+	if (sLoadedMap == sMapCase.sFilename)
+		return true;
+
+	CSettings* cSettings = CSettings::GetInstance();
+	if ((sLoadedMap.empty()) ||
+		(cSettings->NUM_TILES_YAXIS != sMapCase.uiNumRows) ||
+		(cSettings->NUM_TILES_XAXIS != sMapCase.uiNumCols))
+	{
+		CMap2D::Destroy();
+		if (CMap2D::GetInstance()->Init(1, sMapCase.uiNumRows, sMapCase.uiNumCols) == false)
+		{
+			cout << "MapBenchmarks: Unable to initialise CMap2D" << endl;
+			return false;
+		}
+	}
+
+	if (CMap2D::GetInstance()->LoadMap(sMapCase.sFilename) == false)
+	{
+		cout << "MapBenchmarks: Unable to load " << sMapCase.sFilename << endl;
+		sLoadedMap = "";
+		return false;
+	}
+	sLoadedMap = sMapCase.sFilename;
+	return true;
+}
+
+/**
+ @brief Pick the paths of a map, between tiles in the biggest open area so that every path can be found.
+		The map must be loaded
+ @param sMapCase A SMapCase& whose paths are set
+ */
+static void PickPaths(SMapCase& sMapCase)
+{
+	std::vector<bool> vBlockedGrid;
+	CMap2D::GetInstance()->GetBlockedGrid(vBlockedGrid);
+
+	// Label the open areas with a flood fill, and keep the biggest one
+	int iNumRows = (int)sMapCase.uiNumRows;
+	int iNumCols = (int)sMapCase.uiNumCols;
+	std::vector<int> vArea(vBlockedGrid.size(), -1);
+	std::vector<int> vBiggestArea;
+	std::vector<int> vStack;
+	for (int iStart = 0; iStart < (int)vBlockedGrid.size(); iStart++)
+	{
+		if ((vBlockedGrid[iStart]) || (vArea[iStart] >= 0))
+			continue;
+
+		std::vector<int> vTiles;
+		vStack.push_back(iStart);
+		vArea[iStart] = iStart;
+		while (vStack.empty() == false)
+		{
+			int iTile = vStack.back();
+			vStack.pop_back();
+			vTiles.push_back(iTile);
+
+			int iRow = iTile / iNumCols;
+			int iCol = iTile % iNumCols;
+			const int iNeighbours[4][2] = { { iRow - 1, iCol }, { iRow + 1, iCol }, { iRow, iCol - 1 }, { iRow, iCol + 1 } };
+			for (int i = 0; i < 4; i++)
+			{
+				if ((iNeighbours[i][0] < 0) || (iNeighbours[i][0] >= iNumRows) ||
+					(iNeighbours[i][1] < 0) || (iNeighbours[i][1] >= iNumCols))
+					continue;
+				int iNeighbour = iNeighbours[i][0] * iNumCols + iNeighbours[i][1];
+				if ((vBlockedGrid[iNeighbour] == false) && (vArea[iNeighbour] < 0))
+				{
+					vArea[iNeighbour] = iStart;
+					vStack.push_back(iNeighbour);
+				}
+			}
+		}
+		if (vTiles.size() > vBiggestArea.size())
+			vBiggestArea.swap(vTiles);
+	}
+
+	sMapCase.vPathStarts.clear();
+	sMapCase.vPathTargets.clear();
+	if (vBiggestArea.size() < 2)
+		return;
+
+	CRandom cRandom;
+	cRandom.Seed(2292);
+	for (unsigned int i = 0; i < NUM_PATHS; i++)
+	{
+		int iStart = vBiggestArea[cRandom.Next((int)vBiggestArea.size())];
+		int iTarget = vBiggestArea[cRandom.Next((int)vBiggestArea.size())];
+		sMapCase.vPathStarts.push_back(glm::vec2(iStart % iNumCols, iStart / iNumCols));
+		sMapCase.vPathTargets.push_back(glm::vec2(iTarget % iNumCols, iTarget / iNumCols));
+	}
+}
+
+/**
+ @brief Find a tile value for the searches, preferring the waypoints which the enemies look up with GetTilePosition
+ @param vvTiles A const std::vector<std::vector<int>>& containing the rows of tiles
+ */
+static int PickSearchValue(const std::vector<std::vector<int>>& vvTiles)
+{
+	int iValue = 0;
+	for (unsigned int uiRow = 0; uiRow < vvTiles.size(); uiRow++)
+	{
+		for (unsigned int uiCol = 0; uiCol < vvTiles[uiRow].size(); uiCol++)
+		{
+			int iTile = vvTiles[uiRow][uiCol];
+			if ((iTile >= 300) && (iTile < 500) && ((iValue == 0) || (iTile < iValue)))
+				iValue = iTile;
+		}
+	}
+	return iValue;
+}
+
+/**
+ @brief Add a map which the benchmarks run on
+ @param sName A const std::string& containing the name of the map in the benchmark names
+ @param sFilename A const std::string& containing the file name of the map
+ */
+static SMapCase* AddMapCase(const std::string& sName, const std::string& sFilename)
+{
+	std::vector<std::vector<int>> vvTiles;
+	if ((sFilename.empty()) || (ReadMapFile(sFilename, vvTiles) == false))
+		return NULL;
+
+	SMapCase* pMapCase = new SMapCase();
+	pMapCase->sName = sName;
+	pMapCase->sFilename = sFilename;
+	pMapCase->uiNumRows = (unsigned int)vvTiles.size();
+	pMapCase->uiNumCols = (unsigned int)vvTiles[0].size();
+	pMapCase->uiNextPath = 0;
+	pMapCase->iSearchValue = PickSearchValue(vvTiles);
+	vMapCases.push_back(pMapCase);
+	return pMapCase;
+}
+
+/**
+ @brief Check the tiles around every open tile, as CPlayer2D::CheckPosition does for each direction it moves in
+ */
+static unsigned int CollisionSweep(void)
+{
+	CMap2D* cMap2D = CMap2D::GetInstance();
+	int iNumRows = cMap2D->GetNumRows();
+	int iNumCols = cMap2D->GetNumCols();
+
+	unsigned int uiNumBlocked = 0;
+	for (int iRow = 1; iRow < iNumRows - 1; iRow++)
+	{
+		for (int iCol = 1; iCol < iNumCols - 1; iCol++)
+		{
+			if (cMap2D->GetMapInfo(iRow, iCol) >= 600)
+				continue;
+
+			// Moving between 2 rows and 2 columns checks both of the tiles on the side which it moves to
+			if ((cMap2D->GetMapInfo(iRow, iCol - 1) >= 600) || (cMap2D->GetMapInfo(iRow + 1, iCol - 1) >= 600))
+				uiNumBlocked++;
+			if ((cMap2D->GetMapInfo(iRow, iCol + 1) >= 600) || (cMap2D->GetMapInfo(iRow + 1, iCol + 1) >= 600))
+				uiNumBlocked++;
+			if ((cMap2D->GetMapInfo(iRow + 1, iCol) >= 600) || (cMap2D->GetMapInfo(iRow + 1, iCol + 1) >= 600))
+				uiNumBlocked++;
+			if ((cMap2D->GetMapInfo(iRow - 1, iCol) >= 600) || (cMap2D->GetMapInfo(iRow - 1, iCol + 1) >= 600))
+				uiNumBlocked++;
+		}
+	}
+	return uiNumBlocked;
+}
+
+/**
+ @brief Add the benchmarks which run on a loaded map
+ @param cBenchmark A CBenchmark& which the benchmarks are added to
+ @param pMapCase A SMapCase* containing the map
+ */
+static void AddMapCaseBenchmarks(CBenchmark& cBenchmark, SMapCase* pMapCase)
+{
+	CBenchmark::Function setup = [pMapCase]() { LoadMapCase(*pMapCase); };
+
+	cBenchmark.Add("Map2D/LoadMap/" + pMapCase->sName, [pMapCase]() {
+		CBenchmark::Consume(CMap2D::GetInstance()->LoadMap(pMapCase->sFilename));
+	}, setup);
+
+	// The paths are picked once the map is loaded, since they need its blocked tiles
+	cBenchmark.Add("Map2D/PathFind/" + pMapCase->sName, [pMapCase]() {
+		if (pMapCase->vPathStarts.empty())
+			return;
+		unsigned int uiPath = pMapCase->uiNextPath++ % pMapCase->vPathStarts.size();
+		std::vector<glm::vec2> vPath = CMap2D::GetInstance()->PathFind(pMapCase->vPathStarts[uiPath],
+			pMapCase->vPathTargets[uiPath], heuristic::manhattan, 10);
+		CBenchmark::Consume(vPath.size());
+	}, [pMapCase]() {
+		if (LoadMapCase(*pMapCase) && (pMapCase->vPathStarts.empty()))
+			PickPaths(*pMapCase);
+		pMapCase->uiNextPath = 0;
+	});
+
+	cBenchmark.Add("Map2D/FindAllTiles/" + pMapCase->sName, [pMapCase]() {
+		CBenchmark::Consume(CMap2D::GetInstance()->FindAllTiles(pMapCase->iSearchValue).size());
+	}, setup);
+
+	// Replace the tiles and put them back, so that every run sees the same map
+	cBenchmark.Add("Map2D/ReplaceTiles/" + pMapCase->sName, [pMapCase]() {
+		CMap2D::GetInstance()->ReplaceTiles(pMapCase->iSearchValue, 1399);
+		CMap2D::GetInstance()->ReplaceTiles(1399, pMapCase->iSearchValue);
+	}, setup);
+
+	cBenchmark.Add("Map2D/GetTilePosition/" + pMapCase->sName, [pMapCase]() {
+		glm::vec2 vec2Position = CMap2D::GetInstance()->GetTilePosition(pMapCase->iSearchValue);
+		CBenchmark::Consume(vec2Position.x + vec2Position.y);
+	}, setup);
+
+	cBenchmark.Add("Map2D/CollisionSweep/" + pMapCase->sName, []() {
+		CBenchmark::Consume(CollisionSweep());
+	}, setup);
+}
+
+/**
+ @brief Add the benchmarks of CMap2D. The maps are loaded from the Maps folder of the current directory
+ @param cBenchmark A CBenchmark& which the benchmarks are added to
+ */
+void AddMapBenchmarks(CBenchmark& cBenchmark)
+{
+	for (unsigned int i = 0; i < sizeof(szLevels) / sizeof(szLevels[0]); i++)
+	{
+		SMapCase* pMapCase = AddMapCase(GetLevelName(szLevels[i]), szLevels[i]);
+		if (pMapCase)
+			AddMapCaseBenchmarks(cBenchmark, pMapCase);
+	}
+
+	// Bigger maps show how the costs grow with the number of tiles
+	const unsigned int uiScales[] = { 4, 16 };
+	for (unsigned int i = 0; i < sizeof(uiScales) / sizeof(uiScales[0]); i++)
+	{
+		std::string sFilename = CreateScaledMap(szLevels[1], uiScales[i]);
+		SMapCase* pMapCase = AddMapCase(GetLevelName(szLevels[1]) + "_x" + to_string(uiScales[i]), sFilename);
+		if (pMapCase)
+			AddMapCaseBenchmarks(cBenchmark, pMapCase);
+	}
+}
+
+/**
+ @brief Delete the bigger maps which were made for the benchmarks, and the CMap2D instance
+ */
+void DestroyMapBenchmarks(void)
+{
+	for (unsigned int i = 0; i < vScaledMaps.size(); i++)
+		remove(vScaledMaps[i].c_str());
+	vScaledMaps.clear();
+
+	for (unsigned int i = 0; i < vMapCases.size(); i++)
+		delete vMapCases[i];
+	vMapCases.clear();
+
+	CMap2D::Destroy();
+	sLoadedMap = "";
+}
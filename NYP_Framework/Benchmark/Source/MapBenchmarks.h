@@ -0,0 +1,14 @@
+/**
+ MapBenchmarks
+ @brief The benchmarks of CMap2D: loading, path finding, tile searches and collision checks, on the levels
+		of the game and on bigger maps which are made by tiling a level
+ */
+#pragma once
+
+#include "Benchmark.h"
+
+// Add the benchmarks of CMap2D. The maps are loaded from the Maps folder of the current directory
+void AddMapBenchmarks(CBenchmark& cBenchmark);
+
+// Delete the bigger maps which were made for the benchmarks, and the CMap2D instance
+void DestroyMapBenchmarks(void);
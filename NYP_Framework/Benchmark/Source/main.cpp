@@ -0,0 +1,115 @@
+/**
+ main.cpp
+ @brief This file contains the main function of the benchmarks of the engine's hot paths.
+		Run it from the App folder, so that the Maps and Image folders are found.
+		--list				Print out the names of the benchmarks
+		--filter <text>		Only run the benchmarks whose names contain this
+		--samples <count>	Time each benchmark this many times. The default is 20
+		--min-time <ms>		Run each benchmark for at least this long in each sample. The default is 2
+		--output <file>		Save the results to this file. The default is BenchmarkResults.json
+		--baseline <file>	Compare the results with a file which was saved by an earlier run
+		--archive <file>	Read the assets from an archive which the Packer made, instead of their files
+ */
+// Include CBenchmark
+#include "Benchmark.h"
+// Include the benchmarks
+#include "MapBenchmarks.h"
+#include "AssetBenchmarks.h"
+
+// Include CNullGLBackend, so that CMap2D can create its textures and meshes without an OpenGL context
+#include "RenderControl/NullGLBackend.h"
+// Include CProfiler, to turn off the timers which are in the code being measured
+#include "TimeControl/Profiler.h"
+// Include CSettings
+#include "GameControl/Settings.h"
+// Include CAssetArchive, to read the assets from an archive
+#include "System/AssetArchive.h"
+
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+using namespace std;
+
+/**
+ @brief This function is the main function which is called by the operating system when you run the executables
+ @param argc The number of command line arguments
+ @param argv The command line arguments
+ @return This function returns the error codes
+ */
+int main(int argc, char* argv[])
+{
+	CBenchmark cBenchmark;
+	bool bList = false;
+	string sOutput = "BenchmarkResults.json";
+	string sBaseline;
+	string sArchive;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--list") == 0)
+		{
+			bList = true;
+		}
+		else if ((strcmp(argv[i], "--filter") == 0) && (i + 1 < argc))
+		{
+			cBenchmark.SetFilter(argv[++i]);
+		}
+		else if ((strcmp(argv[i], "--samples") == 0) && (i + 1 < argc))
+		{
+			cBenchmark.SetNumSamples((unsigned int)strtoul(argv[++i], NULL, 10));
+		}
+		else if ((strcmp(argv[i], "--min-time") == 0) && (i + 1 < argc))
+		{
+			cBenchmark.SetMinSampleTime(strtod(argv[++i], NULL) / 1000.0);
+		}
+		else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+		{
+			sOutput = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--baseline") == 0) && (i + 1 < argc))
+		{
+			sBaseline = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--archive") == 0) && (i + 1 < argc))
+		{
+			sArchive = argv[++i];
+		}
+		else
+		{
+			cout << "Invalid option " << argv[i] << endl;
+			cout << "Options: --list, --filter <text>, --samples <count>, --min-time <ms>, --output <file>, --baseline <file>, --archive <file>" << endl;
+			return 1;
+		}
+	}
+
+	// The game is not run, so there is no window and no OpenGL context
+	CSettings::GetInstance()->bHeadless = true;
+	CNullGLBackend::Install();
+	CProfiler::GetInstance()->SetEnabled(false);
+	CProfiler::GetInstance()->SetTraceRecording(false);
+	if ((sArchive.empty() == false) && (CAssetArchive::GetInstance()->Open(sArchive) == false))
+		return 1;
+
+	AddMapBenchmarks(cBenchmark);
+	AddAssetBenchmarks(cBenchmark);
+
+	int iResult = 0;
+	if (bList)
+	{
+		cBenchmark.List();
+	}
+	else
+	{
+		cBenchmark.Run();
+		if (cBenchmark.SaveResults(sOutput) == false)
+			iResult = 1;
+		if ((sBaseline.empty() == false) && (cBenchmark.CompareWithBaseline(sBaseline) == false))
+			iResult = 1;
+	}
+
+	DestroyAssetBenchmarks();
+	DestroyMapBenchmarks();
+	CAssetArchive::Destroy();
+	CProfiler::Destroy();
+	return iResult;
+}
@@ -0,0 +1,276 @@
+/**
+ Object pool template
+ @brief A pool of objects which are stored in contiguous blocks, and acquired and released in O(1) through a free list.
+		A pool can keep the objects which are released constructed, so that objects which are expensive to set up,
+		e.g. those with GL objects, are set up once and reused
+ */
+#pragma once
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <cstring>
+#include <type_traits>
+#include <iostream>
+
+template <typename T>
+class CObjectPool
+{
+public:
+	// Constructor. The pool grows uiBlockSize objects at a time. If bKeepReleased is true, Release does not destroy
+	// the objects, and AcquireReleased hands them out again
+	CObjectPool(const unsigned int uiBlockSize = 64, const bool bKeepReleased = false)
+		: pFreeList(nullptr)
+		, uiBlockSize(uiBlockSize > 0 ? uiBlockSize : 1)
+		, uiCapacity(0)
+		, uiNumInUse(0)
+		, uiHighWaterMark(0)
+		, bKeepReleased(bKeepReleased)
+	{
+	}
+
+	// Destructor
+	virtual ~CObjectPool(void)
+	{
+		Clear();
+		for (unsigned int i = 0; i < vBlocks.size(); i++)
+			delete[] vBlocks[i];
+		vBlocks.clear();
+	}
+
+	// Allocate enough blocks to hold uiNumObjects objects, so that acquiring them later does not allocate
+	void Prewarm(const unsigned int uiNumObjects)
+	{
+		while (uiCapacity < uiNumObjects)
+			AddBlock();
+	}
+
+	// Construct an object in a free slot. The arguments are passed to the constructor of T
+	template <typename... Args>
+	T* Acquire(Args&&... args)
+	{
+		if (pFreeList == nullptr)
+			AddBlock();
+
+		// Pop the first free slot
+		SSlot* pSlot = pFreeList;
+		pFreeList = pSlot->pNextFree;
+
+		vState[pSlot->uiIndex] = IN_USE;
+		AddInUse();
+
+		return new (&pSlot->storage) T(std::forward<Args>(args)...);
+	}
+
+	// Get an object which was released and kept constructed, or nullptr if there is none. The object is in the
+	// state it was released in, so the caller resets it
+	T* AcquireReleased(void)
+	{
+		if (vReleased.empty())
+			return nullptr;
+
+		unsigned int uiSlotIndex = vReleased.back();
+		vReleased.pop_back();
+
+		vState[uiSlotIndex] = IN_USE;
+		AddInUse();
+
+		return reinterpret_cast<T*>(&GetSlot(uiSlotIndex)->storage);
+	}
+
+	// Return an object to the pool. It is destroyed, unless the pool keeps the released objects
+	bool Release(T* pObject)
+	{
+		if (pObject == nullptr)
+			return false;
+
+		SSlot* pSlot = reinterpret_cast<SSlot*>(pObject);
+		unsigned int uiSlotIndex = GetSlotIndex(pSlot);
+		if (uiSlotIndex == uiCapacity)
+		{
+			std::cout << "CObjectPool::Release: The object does not belong to this pool." << std::endl;
+			return false;
+		}
+		if (vState[uiSlotIndex] != IN_USE)
+		{
+			std::cout << "CObjectPool::Release: The object has already been released." << std::endl;
+			return false;
+		}
+		uiNumInUse--;
+
+		if (bKeepReleased)
+		{
+			vState[uiSlotIndex] = RELEASED;
+			vReleased.push_back(uiSlotIndex);
+			return true;
+		}
+
+		pObject->~T();
+		vState[uiSlotIndex] = FREE;
+
+#ifdef _DEBUG
+		// Poison the released object so that using it after it is released is easy to spot
+		memset(&pSlot->storage, 0xDD, sizeof(pSlot->storage));
+#endif
+
+		// Push the slot onto the free list
+		pSlot->pNextFree = pFreeList;
+		pFreeList = pSlot;
+
+		return true;
+	}
+
+	// Destroy all the objects, including those which were released and kept. The blocks are kept for reuse
+	void Clear(void)
+	{
+		pFreeList = nullptr;
+		// Rebuild the free list from the back, so that the slots are handed out in address order
+		for (int i = (int)uiCapacity - 1; i >= 0; i--)
+		{
+			SSlot* pSlot = GetSlot((unsigned int)i);
+			if (vState[i] != FREE)
+			{
+				reinterpret_cast<T*>(&pSlot->storage)->~T();
+				vState[i] = FREE;
+#ifdef _DEBUG
+				memset(&pSlot->storage, 0xDD, sizeof(pSlot->storage));
+#endif
+			}
+			pSlot->pNextFree = pFreeList;
+			pFreeList = pSlot;
+		}
+		vReleased.clear();
+		uiNumInUse = 0;
+	}
+
+	// Check if an object was acquired from this pool and has not been released
+	bool IsInUse(const T* pObject) const
+	{
+		unsigned int uiSlotIndex = GetSlotIndex(reinterpret_cast<const SSlot*>(pObject));
+		return (uiSlotIndex != uiCapacity) && (vState[uiSlotIndex] == IN_USE);
+	}
+
+	// Get the number of objects in use
+	unsigned int GetNumInUse(void) const
+	{
+		return uiNumInUse;
+	}
+
+	// Get the number of objects which were released and kept constructed
+	unsigned int GetNumReleased(void) const
+	{
+		return (unsigned int)vReleased.size();
+	}
+
+	// Get the number of objects the pool can hold without allocating
+	unsigned int GetCapacity(void) const
+	{
+		return uiCapacity;
+	}
+
+	// Get the largest number of objects which were in use at the same time
+	unsigned int GetHighWaterMark(void) const
+	{
+		return uiHighWaterMark;
+	}
+
+	// Reset the high water mark to the number of objects in use
+	void ResetHighWaterMark(void)
+	{
+		uiHighWaterMark = uiNumInUse;
+	}
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const
+	{
+		std::cout << "CObjectPool: " << uiNumInUse << " in use, " << vReleased.size() << " released, "
+			<< uiCapacity << " capacity in "
+			<< vBlocks.size() << " blocks, high water mark: " << uiHighWaterMark << std::endl;
+	}
+
+protected:
+	// The states of a slot
+	enum SLOT_STATE
+	{
+		FREE = 0,
+		IN_USE,
+		// The object was released and is kept constructed
+		RELEASED
+	};
+
+	// A slot holds an object while it is in use, and the link to the next free slot while it is free.
+	// The object is at the start of the slot, so a pointer to the object is also a pointer to its slot
+	struct SSlot
+	{
+		union
+		{
+			SSlot* pNextFree;
+			typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type storage;
+		};
+		// The index of the slot in the pool, so that it is found without searching the blocks
+		unsigned int uiIndex;
+	};
+
+	// The blocks of slots. Blocks are never moved, so pointers to the objects stay valid
+	std::vector<SSlot*> vBlocks;
+	// The SLOT_STATE of each slot
+	std::vector<unsigned char> vState;
+	// The first free slot
+	SSlot* pFreeList;
+	// The indices of the slots of the objects which were released and kept constructed
+	std::vector<unsigned int> vReleased;
+
+	unsigned int uiBlockSize;
+	unsigned int uiCapacity;
+	unsigned int uiNumInUse;
+	unsigned int uiHighWaterMark;
+	bool bKeepReleased;
+
+	// Count an object which was acquired
+	void AddInUse(void)
+	{
+		uiNumInUse++;
+		if (uiNumInUse > uiHighWaterMark)
+			uiHighWaterMark = uiNumInUse;
+	}
+
+	// Allocate a new block and add its slots to the free list
+	void AddBlock(void)
+	{
+		SSlot* pBlock = new SSlot[uiBlockSize];
+#ifdef _DEBUG
+		memset(pBlock, 0xCD, sizeof(SSlot) * uiBlockSize);
+#endif
+		// Link the slots from the back, so that the slots of the block are handed out in address order
+		for (int i = (int)uiBlockSize - 1; i >= 0; i--)
+		{
+			pBlock[i].pNextFree = pFreeList;
+			pBlock[i].uiIndex = uiCapacity + (unsigned int)i;
+			pFreeList = &pBlock[i];
+		}
+		vBlocks.push_back(pBlock);
+		vState.resize(vState.size() + uiBlockSize, FREE);
+		vReleased.reserve(vReleased.size() + uiBlockSize);
+		uiCapacity += uiBlockSize;
+	}
+
+	// Get a slot by its index
+	SSlot* GetSlot(const unsigned int uiSlotIndex) const
+	{
+		return &vBlocks[uiSlotIndex / uiBlockSize][uiSlotIndex % uiBlockSize];
+	}
+
+	// Get the index of a slot, or uiCapacity if the slot is not in this pool
+	unsigned int GetSlotIndex(const SSlot* pSlot) const
+	{
+		unsigned int uiSlotIndex = pSlot->uiIndex;
+		if ((uiSlotIndex >= uiCapacity) || (GetSlot(uiSlotIndex) != pSlot))
+			return uiCapacity;
+		return uiSlotIndex;
+	}
+
+private:
+	// A pool owns its objects, so it cannot be copied
+	CObjectPool(const CObjectPool&);
+	CObjectPool& operator=(const CObjectPool&);
+};
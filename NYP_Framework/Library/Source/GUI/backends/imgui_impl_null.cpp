@@ -0,0 +1,46 @@
+// dear imgui: Null Platform and Renderer Backend
+// Runs Dear ImGui without a window or a graphics API, e.g. in a headless simulation.
+// The GUI code runs as it does with a window, but nothing is drawn and there is no mouse or keyboard input.
+
+// Implemented features:
+//  [X] Platform: Display size and time step.
+//  [X] Renderer: Font atlas (built on the CPU, never uploaded).
+
+#include "../imgui.h"
+#include "imgui_impl_null.h"
+
+// Data
+static ImVec2       g_DisplaySize = ImVec2(0.0f, 0.0f);
+
+bool    ImGui_ImplNull_Init(float display_width, float display_height)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = "imgui_impl_null";
+    io.BackendRendererName = "imgui_impl_null";
+    g_DisplaySize = ImVec2(display_width, display_height);
+
+    // Do not load or save imgui.ini, so that a headless run does not overwrite the window layout of the game
+    io.IniFilename = NULL;
+
+    // Build the font atlas, which ImGui::NewFrame() needs to lay out text
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+    return true;
+}
+
+void    ImGui_ImplNull_Shutdown()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = NULL;
+    io.BackendRendererName = NULL;
+}
+
+void    ImGui_ImplNull_NewFrame(float delta_time)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.Fonts->IsBuilt() && "Font atlas not built! Missing call to ImGui_ImplNull_Init()?");
+
+    io.DisplaySize = g_DisplaySize;
+    io.DeltaTime = delta_time > 0.0f ? delta_time : (float)(1.0f / 60.0f);
+}
@@ -0,0 +1,15 @@
+// dear imgui: Null Platform and Renderer Backend
+// Runs Dear ImGui without a window or a graphics API, e.g. in a headless simulation.
+// The GUI code runs as it does with a window, but nothing is drawn and there is no mouse or keyboard input.
+
+// Implemented features:
+//  [X] Platform: Display size and time step.
+//  [X] Renderer: Font atlas (built on the CPU, never uploaded).
+// The window layout is not loaded from or saved to imgui.ini.
+
+#pragma once
+#include "../imgui.h"      // IMGUI_IMPL_API
+
+IMGUI_IMPL_API bool     ImGui_ImplNull_Init(float display_width, float display_height);
+IMGUI_IMPL_API void     ImGui_ImplNull_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplNull_NewFrame(float delta_time);
@@ -9,8 +9,14 @@
 #include <includes/glm.hpp>
 // Include SingletonTemplate
 #include "../DesignPatterns/SingletonTemplate.h"
+// Include CFramePacer
+#include "../TimeControl/FramePacer.h"
 
+#ifdef _WIN32
 #include <Windows.h>
+#endif
+
+#include <string>
 
 // Include GLM
 #include <includes/glm.hpp>
@@ -52,8 +58,46 @@ public:
 	bool bShowMousePointer = true;
 
 	// Frame Rate Information
-	const unsigned char FPS = 30; // FPS of this game
-	const unsigned int frameTime = 1000 / FPS; // time for each frame
+	CFramePacer::MODE eFramePacingMode = CFramePacer::CAPPED; // How the end of each frame is timed. Can be changed while running
+	double dTargetFrameRate = 30.0; // FPS of this game in the CAPPED mode
+	double dPacingSpinWindow = 0.002; // Seconds before the end of a frame to stop sleeping and spin. Longer is more accurate but uses more CPU
+	// If true, the next frame is simulated while the GPU draws and presents the current frame.
+	// This adds one frame of latency between input and what is shown
+	bool bPipelinedFrames = false;
+
+	// Simulation Information
+	unsigned int uiTickRate = 30; // Simulation ticks per second. The movement of the player, enemies and projectiles is in steps per tick
+	// Game seconds per real second. The game was tuned at 30 FPS with each frame updating it by 1/60 s,
+	// so each tick updates it by dGameTimeScale / uiTickRate seconds to keep its timers and physics at that speed
+	double dGameTimeScale = 0.5;
+	unsigned int uiMaxTicksPerFrame = 5; // Slower frames drop the rest of their time, so the simulation cannot fall further behind
+	unsigned int uiTickCount = 0; // Number of ticks simulated so far
+	float fRenderAlpha = 1.0f; // How far the rendered frame is from the previous tick (0) to the latest tick (1)
+
+	// Headless Information
+	bool bHeadless = false; // If true, the game runs without a window, GPU or sound device, and ticks as fast as it can
+	unsigned int uiHeadlessTicks = 0; // Number of ticks to run in the headless mode. 0 runs until the game quits
+	std::string sInputScript; // File of inputs to play back at their ticks, or empty for none. See CInputScript
+	std::string sInputRecording; // File to save the inputs of this run to, so that it can be played back, or empty for none
+	unsigned int uiRandomSeed = 0; // Seed of the CRandomManager streams. 0 picks a seed from the time
+
+	// Asset Information
+	std::string sAssetArchive = "Assets.pak"; // Archive which the assets are read from instead of their files, if it exists. See CAssetArchive
+	double dTextureUploadBudget = 0.002; // Seconds of each frame which the textures loading in the background may take to upload. See CImageLoader::LoadTextureAsync
+
+	// Scenario Information
+	std::string sScenarios; // Scenario benchmarks to run in the headless mode instead of the game, separated by commas, or "all". See CScenario
+	unsigned int uiScenarioFrames = 600; // Number of frames which are measured in each scenario
+	unsigned int uiScenarioEnemyMultiple = 1; // Number of each enemy of the maps which CMap2D spawns in the scenarios
+	unsigned int uiScenarioProjectileMultiple = 1; // Number of projectiles which each shot of CProjectileSystem spawns in the scenarios
+	std::string sScenarioRoute = "Scenarios/Route.txt"; // Inputs which the player plays in each scenario, from its first measured frame
+	std::string sScenarioReport = "ScenarioResults.csv"; // CSV file which the results of each run are added to
+	std::string sScenarioLabel; // Name of this build in the report, e.g. its commit. Empty uses the time it was built
+
+	// Profiling Information
+	bool bTraceRecording = true; // If true, the recent scopes of every thread are kept, so that F4 can save them as a trace
+	double dTraceSpikeTime = 0.0; // Save a trace when a frame takes longer than this many seconds. 0 only saves traces with F4
+	std::string sTraceFilePrefix = "Trace"; // Start of the names of the trace files, which are numbered from Trace_001.json
 
 	// Input control
 	//const bool bActivateMouseInput;
@@ -0,0 +1,380 @@
+/**
+ CInputScript
+ @brief A class which plays back a file of keyboard and mouse inputs, each at a simulation tick, into the
+		CKeyboardController and CMouseController, and records the inputs of a run into the same kind of file
+ */
+#include "InputScript.h"
+
+#include "KeyboardController.h"
+#include "MouseController.h"
+
+// Include GLFW, for the key codes
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+using namespace std;
+
+// The keys which have names in the file, other than the letters and digits
+static const struct { const char* szName; int iKey; } sNamedKeys[] =
+{
+	{ "SPACE", GLFW_KEY_SPACE }, { "ESCAPE", GLFW_KEY_ESCAPE }, { "ENTER", GLFW_KEY_ENTER },
+	{ "TAB", GLFW_KEY_TAB }, { "BACKSPACE", GLFW_KEY_BACKSPACE },
+	{ "LEFT", GLFW_KEY_LEFT }, { "RIGHT", GLFW_KEY_RIGHT }, { "UP", GLFW_KEY_UP }, { "DOWN", GLFW_KEY_DOWN },
+	{ "LEFT_SHIFT", GLFW_KEY_LEFT_SHIFT }, { "LEFT_CONTROL", GLFW_KEY_LEFT_CONTROL }, { "LEFT_ALT", GLFW_KEY_LEFT_ALT },
+};
+
+/**
+ @brief Constructor
+ */
+CInputScript::CInputScript(void)
+	: uiNextInput(0)
+	, bRecording(false)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CInputScript::~CInputScript(void)
+{
+}
+
+/**
+ @brief Load the inputs from a file
+ @param sFilename A const std::string& containing the name of the file
+ @return false if the file cannot be read or has an invalid line, in which case no input is loaded
+ */
+bool CInputScript::Load(const std::string& sFilename)
+{
+	Clear();
+
+	ifstream inputFile(sFilename.c_str());
+	if (inputFile.is_open() == false)
+	{
+		cout << "CInputScript::Load: Unable to open " << sFilename << endl;
+		return false;
+	}
+
+	string sLine;
+	unsigned int uiLineNumber = 0;
+	while (getline(inputFile, sLine))
+	{
+		uiLineNumber++;
+
+		istringstream lineStream(sLine);
+		string sFirst;
+		if (!(lineStream >> sFirst) || (sFirst[0] == '#'))
+			continue;
+
+		SInput sInput;
+		sInput.iCode = 0;
+		sInput.iAction = 0;
+		sInput.dX = sInput.dY = 0.0;
+
+		string sType;
+		istringstream tickStream(sFirst);
+		bool bValid = (tickStream >> sInput.uiTick) && (lineStream >> sType);
+		sType = ToUpper(sType);
+		if ((bValid) && ((sType == "KEY") || (sType == "MOUSE")))
+		{
+			string sCode, sAction;
+			bValid = (lineStream >> sCode >> sAction) ? true : false;
+			sCode = ToUpper(sCode);
+			sAction = ToUpper(sAction);
+			bValid = bValid && ((sAction == "PRESS") || (sAction == "RELEASE"));
+			if (sType == "KEY")
+			{
+				sInput.eType = KEY;
+				sInput.iCode = ParseKey(sCode);
+			}
+			else
+			{
+				sInput.eType = MOUSE;
+				sInput.iCode = (sCode == "LMB") ? CMouseController::LMB :
+					(sCode == "RMB") ? CMouseController::RMB :
+					(sCode == "MMB") ? CMouseController::MMB : -1;
+			}
+			sInput.iAction = (sAction == "PRESS") ? 1 : 0;
+			bValid = bValid && (sInput.iCode >= 0);
+		}
+		else if ((bValid) && ((sType == "CURSOR") || (sType == "SCROLL")))
+		{
+			sInput.eType = (sType == "CURSOR") ? CURSOR : SCROLL;
+			bValid = (lineStream >> sInput.dX >> sInput.dY) ? true : false;
+		}
+		else
+		{
+			bValid = false;
+		}
+
+		if (bValid == false)
+		{
+			cout << "CInputScript::Load: Invalid input at " << sFilename << " line " << uiLineNumber << ": " << sLine << endl;
+			Clear();
+			return false;
+		}
+		vInputs.push_back(sInput);
+	}
+
+	// Keep the inputs of the same tick in the order they were written
+	stable_sort(vInputs.begin(), vInputs.end(),
+		[](const SInput& a, const SInput& b) { return a.uiTick < b.uiTick; });
+
+	cout << "CInputScript: Loaded " << vInputs.size() << " inputs from " << sFilename << endl;
+	return true;
+}
+
+/**
+ @brief Play back the inputs up to and including a tick
+ @param uiTick A const unsigned int containing the tick which is about to be simulated
+ */
+void CInputScript::Apply(const unsigned int uiTick)
+{
+	while ((uiNextInput < vInputs.size()) && (vInputs[uiNextInput].uiTick <= uiTick))
+	{
+		const SInput& sInput = vInputs[uiNextInput];
+		switch (sInput.eType)
+		{
+		case KEY:
+			CKeyboardController::GetInstance()->Update(sInput.iCode, sInput.iAction);
+			break;
+		case MOUSE:
+			if (sInput.iAction == 1)
+				CMouseController::GetInstance()->UpdateMouseButtonPressed(sInput.iCode);
+			else
+				CMouseController::GetInstance()->UpdateMouseButtonReleased(sInput.iCode);
+			break;
+		case CURSOR:
+			CMouseController::GetInstance()->UpdateMousePosition(sInput.dX, sInput.dY);
+			break;
+		case SCROLL:
+			CMouseController::GetInstance()->UpdateMouseScroll(sInput.dX, sInput.dY);
+			break;
+		default:
+			break;
+		}
+		uiNextInput++;
+	}
+}
+
+/**
+ @brief Start playing back from the first input again
+ */
+void CInputScript::Rewind(void)
+{
+	uiNextInput = 0;
+}
+
+/**
+ @brief Remove all of the inputs
+ */
+void CInputScript::Clear(void)
+{
+	vInputs.clear();
+	uiNextInput = 0;
+}
+
+/**
+ @brief Check if all of the inputs were played back
+ */
+bool CInputScript::IsFinished(void) const
+{
+	return uiNextInput >= vInputs.size();
+}
+
+/**
+ @brief Get the number of inputs
+ */
+unsigned int CInputScript::GetNumInputs(void) const
+{
+	return (unsigned int)vInputs.size();
+}
+
+/**
+ @brief Remove all of the inputs and record the inputs which are given to Record
+ */
+void CInputScript::StartRecording(void)
+{
+	Clear();
+	bRecording = true;
+}
+
+/**
+ @brief Check if the inputs are being recorded
+ */
+bool CInputScript::IsRecording(void) const
+{
+	return bRecording;
+}
+
+/**
+ @brief Record an input at a tick
+ @param uiTick A const unsigned int containing the tick which the input is played back before
+ @param eType A const INPUT_TYPE containing the type of the input
+ @param iCode A const int containing the key or mouse button
+ @param iAction A const int containing 1 for a press and 0 for a release. Key repeats are not recorded
+ @param dX A const double containing the cursor position or scroll offset in the x-axis
+ @param dY A const double containing the cursor position or scroll offset in the y-axis
+ */
+void CInputScript::Record(	const unsigned int uiTick, const INPUT_TYPE eType, const int iCode, const int iAction,
+							const double dX, const double dY)
+{
+	if (bRecording == false)
+		return;
+	if (((eType == KEY) || (eType == MOUSE)) && (iAction != 0) && (iAction != 1))
+		return;
+	if ((eType == KEY) && (KeyName(iCode).empty()))
+		return;
+	if ((eType == MOUSE) && ((iCode < CMouseController::LMB) || (iCode > CMouseController::MMB)))
+		return;
+
+	if (eType == CURSOR)
+	{
+		// The cursor position is read every frame, so only record it when it moves
+		for (int i = (int)vInputs.size() - 1; i >= 0; i--)
+		{
+			if (vInputs[i].eType != CURSOR)
+				continue;
+			if ((vInputs[i].dX == dX) && (vInputs[i].dY == dY))
+				return;
+			break;
+		}
+	}
+
+	SInput sInput;
+	sInput.uiTick = uiTick;
+	sInput.eType = eType;
+	sInput.iCode = iCode;
+	sInput.iAction = iAction;
+	sInput.dX = dX;
+	sInput.dY = dY;
+	vInputs.push_back(sInput);
+}
+
+/**
+ @brief Save the inputs to a file which Load can read
+ @param sFilename A const std::string& containing the name of the file
+ @return false if the file cannot be written
+ */
+bool CInputScript::Save(const std::string& sFilename) const
+{
+	ofstream outputFile(sFilename.c_str());
+	if (outputFile.is_open() == false)
+	{
+		cout << "CInputScript::Save: Unable to open " << sFilename << endl;
+		return false;
+	}
+
+	// Write the positions exactly, so that the playback is the same as the recorded run
+	outputFile << setprecision(17);
+	outputFile << "# <tick> KEY|MOUSE|CURSOR|SCROLL ..." << endl;
+	for (unsigned int i = 0; i < vInputs.size(); i++)
+	{
+		const SInput& sInput = vInputs[i];
+		outputFile << sInput.uiTick << " ";
+		switch (sInput.eType)
+		{
+		case KEY:
+			outputFile << "KEY " << KeyName(sInput.iCode) << ((sInput.iAction == 1) ? " PRESS" : " RELEASE");
+			break;
+		case MOUSE:
+			outputFile << "MOUSE " << ((sInput.iCode == CMouseController::LMB) ? "LMB" :
+				(sInput.iCode == CMouseController::RMB) ? "RMB" : "MMB") << ((sInput.iAction == 1) ? " PRESS" : " RELEASE");
+			break;
+		case CURSOR:
+			outputFile << "CURSOR " << sInput.dX << " " << sInput.dY;
+			break;
+		case SCROLL:
+			outputFile << "SCROLL " << sInput.dX << " " << sInput.dY;
+			break;
+		default:
+			break;
+		}
+		outputFile << endl;
+	}
+
+	if (outputFile.fail())
+	{
+		cout << "CInputScript::Save: Unable to write " << sFilename << endl;
+		return false;
+	}
+	cout << "CInputScript: Saved " << vInputs.size() << " inputs to " << sFilename << endl;
+	return true;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CInputScript::PrintSelf(void) const
+{
+	cout << "CInputScript: " << uiNextInput << " of " << vInputs.size() << " inputs played back";
+	if (vInputs.empty() == false)
+		cout << ", last input at tick " << vInputs.back().uiTick;
+	cout << endl;
+}
+
+/**
+ @brief Convert a word of the file to upper case, so that the file is not case sensitive
+ @param sWord A const std::string& containing the word
+ */
+std::string CInputScript::ToUpper(const std::string& sWord)
+{
+	string sUpper = sWord;
+	for (unsigned int i = 0; i < sUpper.size(); i++)
+		sUpper[i] = (char)toupper((unsigned char)sUpper[i]);
+	return sUpper;
+}
+
+/**
+ @brief Convert the name of a key to its GLFW key code
+ @param sKey A const std::string& containing an upper case letter, a digit, the name of a key or a GLFW key code
+ @return The GLFW key code, or -1 if the name is not a key
+ */
+int CInputScript::ParseKey(const std::string& sKey)
+{
+	// The GLFW key codes of letters and digits are their upper case characters
+	if ((sKey.size() == 1) && ((isupper((unsigned char)sKey[0])) || (isdigit((unsigned char)sKey[0]))))
+		return sKey[0];
+
+	for (unsigned int i = 0; i < sizeof(sNamedKeys) / sizeof(sNamedKeys[0]); i++)
+	{
+		if (sKey == sNamedKeys[i].szName)
+			return sNamedKeys[i].iKey;
+	}
+
+	istringstream codeStream(sKey);
+	int iKey = -1;
+	if ((codeStream >> iKey) && (codeStream.eof()) && (iKey >= 0) && (iKey < CKeyboardController::MAX_KEYS))
+		return iKey;
+	return -1;
+}
+
+/**
+ @brief Convert a GLFW key code to the name which ParseKey reads
+ @param iKey A const int containing the GLFW key code
+ @return The name of the key, or an empty string if the key cannot be played back
+ */
+std::string CInputScript::KeyName(const int iKey)
+{
+	if (((iKey >= 'A') && (iKey <= 'Z')) || ((iKey >= '0') && (iKey <= '9')))
+		return string(1, (char)iKey);
+
+	for (unsigned int i = 0; i < sizeof(sNamedKeys) / sizeof(sNamedKeys[0]); i++)
+	{
+		if (iKey == sNamedKeys[i].iKey)
+			return sNamedKeys[i].szName;
+	}
+
+	if ((iKey >= 0) && (iKey < CKeyboardController::MAX_KEYS))
+	{
+		ostringstream codeStream;
+		codeStream << iKey;
+		return codeStream.str();
+	}
+	return string();
+}
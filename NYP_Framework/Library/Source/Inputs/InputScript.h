@@ -0,0 +1,101 @@
+/**
+ CInputScript
+ @brief A class which plays back a file of keyboard and mouse inputs, each at a simulation tick, into the
+		CKeyboardController and CMouseController. It can also record the inputs of a run into the same kind of
+		file, so that the run can be played back later. Each line of the file is one input:
+			<tick> KEY <key> PRESS|RELEASE
+			<tick> MOUSE <LMB|RMB|MMB> PRESS|RELEASE
+			<tick> CURSOR <x> <y>
+			<tick> SCROLL <x offset> <y offset>
+		A key is a letter, a digit, a name such as SPACE or ESCAPE, or a GLFW key code.
+		The words are not case sensitive, and lines which start with # are comments
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+
+class CInputScript
+{
+public:
+	// The types of input
+	enum INPUT_TYPE
+	{
+		KEY = 0,
+		MOUSE,
+		CURSOR,
+		SCROLL,
+		NUM_INPUT_TYPES
+	};
+
+	// An input and the tick it is played back at
+	struct SInput
+	{
+		unsigned int uiTick;
+		INPUT_TYPE eType;
+		// The key or mouse button
+		int iCode;
+		// 1 for a press and 0 for a release
+		int iAction;
+		// The cursor position or scroll offset
+		double dX;
+		double dY;
+	};
+
+	// Constructor
+	CInputScript(void);
+
+	// Destructor
+	virtual ~CInputScript(void);
+
+	// Load the inputs from a file
+	bool Load(const std::string& sFilename);
+
+	// Play back the inputs up to and including a tick
+	void Apply(const unsigned int uiTick);
+
+	// Start playing back from the first input again
+	void Rewind(void);
+
+	// Remove all of the inputs
+	void Clear(void);
+
+	// Check if all of the inputs were played back
+	bool IsFinished(void) const;
+
+	// Get the number of inputs
+	unsigned int GetNumInputs(void) const;
+
+	// Remove all of the inputs and record the inputs which are given to Record
+	void StartRecording(void);
+
+	// Check if the inputs are being recorded
+	bool IsRecording(void) const;
+
+	// Record an input at a tick. Key repeats and cursor positions which did not change are not recorded
+	void Record(const unsigned int uiTick, const INPUT_TYPE eType, const int iCode, const int iAction,
+				const double dX = 0.0, const double dY = 0.0);
+
+	// Save the inputs to a file which Load can read
+	bool Save(const std::string& sFilename) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// The inputs, in the order they are played back
+	std::vector<SInput> vInputs;
+	// The index of the next input to play back
+	unsigned int uiNextInput;
+	// True if Record adds the inputs
+	bool bRecording;
+
+	// Convert a word of the file to upper case
+	static std::string ToUpper(const std::string& sWord);
+
+	// Convert the name of a key to its GLFW key code. Returns -1 if the name is not a key
+	static int ParseKey(const std::string& sKey);
+
+	// Convert a GLFW key code to the name which ParseKey reads
+	static std::string KeyName(const int iKey);
+};
@@ -4,7 +4,6 @@
 #include "../GameControl/Settings.h"
 #include "../Inputs/MouseController.h"
 
-#include <ctime>
 #include <iostream>
 
 Camera2D::Camera2D(void) :
@@ -12,7 +11,10 @@ Camera2D::Camera2D(void) :
 	targetPos(0, 0),
 	targetZoom(1.15f),
 	SetupState(false),
-	zoom(1.f)
+	zoom(1.f),
+	prevPos(0, 0),
+	prevZoom(1.f),
+	uiUpdateTick(0)
 {
 }
 
@@ -21,14 +23,20 @@ Camera2D::~Camera2D(void)
 }
 
 void Camera2D::Update(float dElapsedTime) {
+	// Remember where this tick started, so that rendering can blend towards where it ends
+	uiUpdateTick = CSettings::GetInstance()->uiTickCount;
+
 	if (!SetupState) {
 		pos = targetPos;
 		zoom = targetZoom;
+		prevPos = pos;
+		prevZoom = zoom;
 		SetupState = true;
 		return;
 	}
 
-	srand(static_cast <unsigned> (time(0)));
+	prevPos = pos;
+	prevZoom = zoom;
 
 	if (noiseOn) {
 		timeElapsedHor += double(dElapsedTime) * kScreenShakeSpeedHor;
@@ -64,12 +72,19 @@ void Camera2D::Reset()
 
 float Camera2D::getZoom()
 {
-	return zoom;
+	// Only blend if the camera was updated in the latest tick, otherwise it has stopped
+	CSettings* cSettings = CSettings::GetInstance();
+	if (uiUpdateTick + 1 != cSettings->uiTickCount)
+		return zoom;
+	return lerp(prevZoom, zoom, cSettings->fRenderAlpha);
 }
 
 glm::vec2 Camera2D::getPos()
 {
-	return pos;
+	CSettings* cSettings = CSettings::GetInstance();
+	if (uiUpdateTick + 1 != cSettings->uiTickCount)
+		return pos;
+	return glm::mix(prevPos, pos, cSettings->fRenderAlpha);
 }
 
 void Camera2D::setTargetPos(glm::vec2 targetPos)
@@ -1,7 +1,7 @@
 #pragma once
 
 // Include template for singleton
-#include "..\DesignPatterns\SingletonTemplate.h"
+#include "../DesignPatterns/SingletonTemplate.h"
 
 // Include GLEW
 #ifndef GLEW_STATIC
@@ -39,6 +39,7 @@ public:
 	void Reset();
 	
 	//getters and settersss
+	// The zoom and position are blended between the previous tick and the latest tick, for rendering
 	float getZoom();
 	glm::vec2 getPos();
 	
@@ -68,6 +69,11 @@ private:
 	float zoom;
 	float targetZoom;
 	bool SetupState;
+
+	// The zoom and position before the latest Update, and the tick when it was called
+	glm::vec2 prevPos;
+	float prevZoom;
+	unsigned int uiUpdateTick;
 	bool ConstraintX;
 	bool ConstraintY;
 
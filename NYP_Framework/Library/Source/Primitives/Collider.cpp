@@ -1,7 +1,9 @@
 #include "Collider.h"
 
 // Include Shader Manager
-#include "..\RenderControl\ShaderManager.h"
+#include "../RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the draw calls
+#include "../RenderControl/RenderStats.h"
 
 #include <GLFW/glfw3.h>
 
@@ -142,6 +144,7 @@ void CCollider::Render(void)
 	// render box
 	glBindVertexArray(colliderVAO);
 	glDrawArrays(GL_LINE_LOOP, 0, 36);
+	RENDER_STATS_ADD(DRAW_CALLS, 1);
 	glBindVertexArray(0);
 }
 
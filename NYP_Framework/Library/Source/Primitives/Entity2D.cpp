@@ -7,10 +7,12 @@
 #include "MeshBuilder.h"
 
  // Include Shader Manager
-#include "..\RenderControl\ShaderManager.h"
+#include "../RenderControl/ShaderManager.h"
+// Include CRenderStats, to count the texture binds
+#include "../RenderControl/RenderStats.h"
 
 // Include ImageLoader
-#include "..\System\ImageLoader.h"
+#include "../System/ImageLoader.h"
 
 #include <iostream>
 using namespace std;
@@ -36,6 +38,9 @@ CEntity2D::CEntity2D(void)
 
 	// Initialise vec2UVCoordinate
 	vec2UVCoordinate = glm::vec2(0.0f);
+
+	// Initialise the positions used for rendering between ticks
+	ResetRenderPosition();
 }
 
 /**
@@ -159,6 +164,7 @@ void CEntity2D::Render(void)
 	// Get the texture to be rendered
 	glActiveTexture(GL_TEXTURE0);
 	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 		glBindVertexArray(VAO);
 
 		//CS: Use mesh to render
@@ -176,3 +182,63 @@ void CEntity2D::PostRender(void)
 	// Disable blending
 	glDisable(GL_BLEND);
 }
+
+/**
+ @brief Blend the tile index and micro steps between the previous tick and the latest tick, for rendering.
+		The rendered frame is up to one tick behind the simulation, so that it can be drawn between two
+		known positions when the display rate is higher than the tick rate
+ @param vec2TickIndex A const glm::vec2& containing the tile index at the latest tick
+ @param vec2TickMicroSteps A const glm::vec2& containing the micro steps at the latest tick
+ @param vec2RenderIndex A glm::vec2& which is set to the tile index to render at
+ @param vec2RenderMicroSteps A glm::vec2& which is set to the micro steps to render at
+ */
+void CEntity2D::GetRenderPosition(const glm::vec2& vec2TickIndex, const glm::vec2& vec2TickMicroSteps,
+								  glm::vec2& vec2RenderIndex, glm::vec2& vec2RenderMicroSteps)
+{
+	// cSettings is only set by the derived classes' Init, so use the instance directly
+	const unsigned int uiTickCount = CSettings::GetInstance()->uiTickCount;
+	const float fRenderAlpha = CSettings::GetInstance()->fRenderAlpha;
+
+	// Remember the position of each new tick the first time it is rendered
+	if (uiLastRenderedTick != uiTickCount)
+	{
+		if (uiLastRenderedTick + 1 == uiTickCount)
+		{
+			vec2PrevTickIndex = vec2LastTickIndex;
+			vec2PrevTickMicroSteps = vec2LastTickMicroSteps;
+		}
+		else
+		{
+			// The previous tick was not rendered, so there is nothing to blend from
+			vec2PrevTickIndex = vec2TickIndex;
+			vec2PrevTickMicroSteps = vec2TickMicroSteps;
+		}
+		vec2LastTickIndex = vec2TickIndex;
+		vec2LastTickMicroSteps = vec2TickMicroSteps;
+		uiLastRenderedTick = uiTickCount;
+	}
+
+	// Do not blend across a teleport or a change of level
+	glm::vec2 vec2Moved = glm::abs(vec2TickIndex - vec2PrevTickIndex);
+	if ((vec2Moved.x > 1.0f) || (vec2Moved.y > 1.0f))
+	{
+		vec2RenderIndex = vec2TickIndex;
+		vec2RenderMicroSteps = vec2TickMicroSteps;
+		return;
+	}
+
+	// The index and the micro steps are blended separately. The render position is linear in both, so this
+	// gives the same result as blending the combined position, even when the entity moves into the next tile
+	vec2RenderIndex = glm::mix(vec2PrevTickIndex, vec2TickIndex, fRenderAlpha);
+	vec2RenderMicroSteps = glm::mix(vec2PrevTickMicroSteps, vec2TickMicroSteps, fRenderAlpha);
+}
+
+/**
+ @brief Forget the ticks which were rendered, so that an Entity2D which is reused is not blended from where it was
+ */
+void CEntity2D::ResetRenderPosition(void)
+{
+	vec2PrevTickIndex = vec2LastTickIndex = glm::vec2(0.0f);
+	vec2PrevTickMicroSteps = vec2LastTickMicroSteps = glm::vec2(0.0f);
+	uiLastRenderedTick = 0;
+}
@@ -17,7 +17,7 @@
 #include <includes/gtc/type_ptr.hpp>
 
 // Include Settings
-#include "..\GameControl\Settings.h"
+#include "../GameControl/Settings.h"
 #include <string>
 
 //CS: Include Mesh.h to use to draw (include vertex and index buffers)
@@ -51,6 +51,12 @@ public:
 	// PostRender
 	virtual void PostRender(void);
 
+	// Blend the tile index and micro steps between the previous tick and the latest tick, for rendering
+	void GetRenderPosition(const glm::vec2& vec2TickIndex, const glm::vec2& vec2TickMicroSteps,
+						   glm::vec2& vec2RenderIndex, glm::vec2& vec2RenderMicroSteps);
+	// Forget the ticks which were rendered, so that an Entity2D which is reused is not blended from where it was
+	void ResetRenderPosition(void);
+
 	// The vec2 which stores the indices of an Entity2D in the Map2D
 	glm::vec2 vec2Index;
 
@@ -82,4 +88,9 @@ protected:
 
 	// colour variables
 	glm::vec4 colour;
+
+	// The position at the previous tick and the latest tick which were rendered, used by GetRenderPosition
+	glm::vec2 vec2PrevTickIndex, vec2PrevTickMicroSteps;
+	glm::vec2 vec2LastTickIndex, vec2LastTickMicroSteps;
+	unsigned int uiLastRenderedTick;
 };
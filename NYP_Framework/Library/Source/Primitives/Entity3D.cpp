@@ -6,7 +6,7 @@
 #include "Entity3D.h"
 
 // Include ImageLoader
-#include "..\System\ImageLoader.h"
+#include "../System/ImageLoader.h"
 
 #include <iostream>
 using namespace std;
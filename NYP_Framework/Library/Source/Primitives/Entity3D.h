@@ -17,7 +17,7 @@
 #include <includes/gtc/type_ptr.hpp>
 
 // Include Settings
-#include "..\GameControl\Settings.h"
+#include "../GameControl/Settings.h"
 
 //CS: Include Mesh.h to use to draw (include vertex and index buffers)
 #include "Mesh.h"
@@ -6,6 +6,9 @@
 #define GLEW_STATIC
 #endif
 
+// Include CRenderStats, to count the draw calls
+#include "../RenderControl/RenderStats.h"
+
 /**
  @brief Constructor
  */
@@ -47,6 +50,7 @@ void CMesh::Render(void)
 		glDrawElements(GL_TRIANGLE_STRIP, indexSize, GL_UNSIGNED_INT, 0);
 	else
 		glDrawElements(GL_TRIANGLES, indexSize, GL_UNSIGNED_INT, 0);
+	RENDER_STATS_ADD(DRAW_CALLS, 1);
 
 	glDisableVertexAttribArray(2);
 	glDisableVertexAttribArray(1);
@@ -50,8 +50,8 @@ public:
 
 	// Constructor
 	CMesh(void);
-	// Destructor
-	~CMesh(void);
+	// Destructor. This is virtual, as the sprite animations are deleted through their CMesh*
+	virtual ~CMesh(void);
 	virtual void Render();
 };
 
@@ -8,7 +8,10 @@ Sprite Animation
 */
 /******************************************************************************/
 #include "SpriteAnimation.h"
-#include "GL\glew.h"
+#include "GL/glew.h"
+
+// Include CRenderStats, to count the draw calls
+#include "../RenderControl/RenderStats.h"
 
 /******************************************************************************/
 /*!
@@ -134,6 +137,7 @@ void CSpriteAnimation::Render()
 		glDrawElements(GL_TRIANGLE_STRIP, 6, GL_UNSIGNED_INT, (void*)(currentFrame * 6 * sizeof(GLuint)));
 	else
 		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(currentFrame * 6 * sizeof(GLuint)));
+	RENDER_STATS_ADD(DRAW_CALLS, 1);
 
 	glDisableVertexAttribArray(2);
 	glDisableVertexAttribArray(1);
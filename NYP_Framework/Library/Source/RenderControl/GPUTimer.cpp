@@ -0,0 +1,275 @@
+/**
+ CGPUTimer
+ @brief A class which times each pass of the scene on the GPU, with GL_TIME_ELAPSED queries.
+		A query is started whenever the pass of CRenderStats changes, and the results of a frame are only read
+		a few frames later, once the GPU has finished it, so that the timer never waits for the GPU
+ */
+#include "GPUTimer.h"
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+// Include CNullGLBackend, which has no queries
+#include "NullGLBackend.h"
+// Include CProfiler, to add the times to its traces
+#include "../TimeControl/Profiler.h"
+// Include ImGui, to draw the times in the overlay
+#include "../GUI/imgui.h"
+
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CGPUTimer::CGPUTimer(void)
+	: bEnabled(false)
+	, uiCurrentFrame(0)
+	, uiNumPending(0)
+	, bQueryActive(false)
+	, ullNumFrames(0)
+	, dFrameTime(0.0)
+	, uiFramesBehind(0)
+	, uiNumDropped(0)
+{
+	memset(uiQueryNames, 0, sizeof(uiQueryNames));
+	memset(dPassTimes, 0, sizeof(dPassTimes));
+	for (unsigned int i = 0; i < NUM_FRAMES_IN_FLIGHT; i++)
+	{
+		sFrames[i].uiNumQueries = 0;
+		sFrames[i].ullFrame = 0;
+	}
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CGPUTimer::~CGPUTimer(void)
+{
+	if (bEnabled)
+	{
+		if (bQueryActive)
+			glEndQuery(GL_TIME_ELAPSED);
+		glDeleteQueries(NUM_FRAMES_IN_FLIGHT * MAX_QUERIES_PER_FRAME, uiQueryNames);
+	}
+}
+
+/**
+ @brief Create the queries, if the OpenGL context has timer queries. Call this after glewInit
+ @return false if the passes cannot be timed, in which case the timer does nothing
+ */
+bool CGPUTimer::Init(void)
+{
+	if (bEnabled)
+		return true;
+
+	// The null backend has no context, so nothing runs on a GPU
+	if (CNullGLBackend::IsInstalled())
+		return false;
+
+	if (((GLEW_VERSION_3_3 == GL_FALSE) && (GLEW_ARB_timer_query == GL_FALSE))
+		|| (glGenQueries == NULL) || (glBeginQuery == NULL) || (glEndQuery == NULL)
+		|| (glGetQueryObjectiv == NULL) || (glGetQueryObjectui64v == NULL))
+	{
+		cout << "CGPUTimer: The OpenGL context has no timer queries, so the GPU is not timed" << endl;
+		return false;
+	}
+
+	glGenQueries(NUM_FRAMES_IN_FLIGHT * MAX_QUERIES_PER_FRAME, uiQueryNames);
+	bEnabled = true;
+
+	// Software renderers such as llvmpipe time the rasterising on the CPU, so the renderer is printed with the times
+	const GLubyte* pszRenderer = glGetString(GL_RENDERER);
+	cout << "CGPUTimer: Timing the passes on " << (pszRenderer ? (const char*)pszRenderer : "an unknown renderer") << endl;
+	return true;
+}
+
+/**
+ @brief Check if the passes are timed
+ */
+bool CGPUTimer::IsEnabled(void) const
+{
+	return bEnabled;
+}
+
+/**
+ @brief Start timing a frame, before the game state renders it. The frame starts in the OTHER pass
+ */
+void CGPUTimer::BeginFrame(void)
+{
+	if (bEnabled == false)
+		return;
+
+	// The queries of the oldest frame are reused. If the GPU has not finished that frame, its results are dropped
+	// instead of waiting for them
+	if (uiNumPending == NUM_FRAMES_IN_FLIGHT)
+	{
+		uiNumPending--;
+		uiNumDropped++;
+	}
+
+	SFrameQueries& sFrame = sFrames[uiCurrentFrame];
+	sFrame.uiNumQueries = 0;
+	sFrame.ullFrame = ullNumFrames;
+	BeginQuery(CRenderStats::OTHER);
+}
+
+/**
+ @brief Start timing a pass of the frame. The query of the previous pass is ended, as only one
+		GL_TIME_ELAPSED query can be active at a time
+ @param ePass A const CRenderStats::PASS containing the pass
+ */
+void CGPUTimer::SetPass(const CRenderStats::PASS ePass)
+{
+	// The pass is only timed between BeginFrame and EndFrame
+	if (bQueryActive == false)
+		return;
+	if (sFrames[uiCurrentFrame].uiNumQueries == MAX_QUERIES_PER_FRAME)
+		return;
+
+	glEndQuery(GL_TIME_ELAPSED);
+	BeginQuery(ePass);
+}
+
+/**
+ @brief Stop timing the frame, and read the results of the frames which the GPU finished.
+		Call this before the buffers are swapped, so that the swap is not timed
+ */
+void CGPUTimer::EndFrame(void)
+{
+	if ((bEnabled == false) || (bQueryActive == false))
+		return;
+
+	glEndQuery(GL_TIME_ELAPSED);
+	bQueryActive = false;
+	uiCurrentFrame = (uiCurrentFrame + 1) % NUM_FRAMES_IN_FLIGHT;
+	uiNumPending++;
+	ullNumFrames++;
+
+	ReadResults();
+}
+
+/**
+ @brief Get the time of a pass of the latest frame which the GPU finished
+ @param ePass A const CRenderStats::PASS containing the pass
+ @return The time in seconds
+ */
+double CGPUTimer::GetPassTime(const CRenderStats::PASS ePass) const
+{
+	return dPassTimes[ePass];
+}
+
+/**
+ @brief Get the time of the latest frame which the GPU finished
+ @return The time in seconds
+ */
+double CGPUTimer::GetFrameTime(void) const
+{
+	return dFrameTime;
+}
+
+/**
+ @brief Draw the times of the latest frame which the GPU finished, as a row of the passes.
+		This must be called inside the window of the profiler overlay
+ */
+void CGPUTimer::RenderOverlay(void)
+{
+	if (bEnabled == false)
+	{
+		ImGui::TextDisabled("GPU not timed");
+		return;
+	}
+
+	ImGui::Text("GPU %.2f ms, %u frames behind, %u dropped", dFrameTime * 1000.0, uiFramesBehind, uiNumDropped);
+	ImGui::Columns(CRenderStats::NUM_PASSES, "GPUTimes", false);
+	for (unsigned int uiPass = 0; uiPass < CRenderStats::NUM_PASSES; uiPass++)
+	{
+		ImGui::Text("%s", CRenderStats::GetPassName((CRenderStats::PASS)uiPass));
+		ImGui::Text("%.3f ms", dPassTimes[uiPass] * 1000.0);
+		ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CGPUTimer::PrintSelf(void) const
+{
+	if (bEnabled == false)
+	{
+		cout << "CGPUTimer: The GPU is not timed" << endl;
+		return;
+	}
+
+	cout << "CGPUTimer: " << dFrameTime * 1000.0 << " ms on the GPU, " << uiFramesBehind << " frames behind, "
+		<< uiNumDropped << " frames dropped" << endl;
+	for (unsigned int uiPass = 0; uiPass < CRenderStats::NUM_PASSES; uiPass++)
+		cout << "\t" << CRenderStats::GetPassName((CRenderStats::PASS)uiPass) << ": " << dPassTimes[uiPass] * 1000.0 << " ms" << endl;
+}
+
+/**
+ @brief Get the query name of a query of a frame in flight
+ @param uiFrame A const unsigned int containing the index of the frame in flight
+ @param uiQuery A const unsigned int containing the index of the query in the frame
+ */
+unsigned int CGPUTimer::GetQueryName(const unsigned int uiFrame, const unsigned int uiQuery) const
+{
+	return uiQueryNames[uiFrame * MAX_QUERIES_PER_FRAME + uiQuery];
+}
+
+/**
+ @brief Start the next query of the current frame
+ @param ePass A const CRenderStats::PASS containing the pass which the query times
+ */
+void CGPUTimer::BeginQuery(const CRenderStats::PASS ePass)
+{
+	SFrameQueries& sFrame = sFrames[uiCurrentFrame];
+	SQuery& sQuery = sFrame.sQueries[sFrame.uiNumQueries];
+	sQuery.ePass = ePass;
+	sQuery.start = std::chrono::steady_clock::now();
+	glBeginQuery(GL_TIME_ELAPSED, GetQueryName(uiCurrentFrame, sFrame.uiNumQueries));
+	sFrame.uiNumQueries++;
+	bQueryActive = true;
+}
+
+/**
+ @brief Read the results of the oldest frames which the GPU finished. A frame is finished when the result of its
+		last query is available, as the GPU runs the queries in order. The frames after the first frame which is
+		not finished are left for a later frame, so that this never waits for the GPU
+ */
+void CGPUTimer::ReadResults(void)
+{
+	CProfiler* cProfiler = CProfiler::GetInstance();
+	while (uiNumPending > 0)
+	{
+		const unsigned int uiFrame = (uiCurrentFrame + NUM_FRAMES_IN_FLIGHT - uiNumPending) % NUM_FRAMES_IN_FLIGHT;
+		const SFrameQueries& sFrame = sFrames[uiFrame];
+
+		GLint iAvailable = GL_FALSE;
+		glGetQueryObjectiv(GetQueryName(uiFrame, sFrame.uiNumQueries - 1), GL_QUERY_RESULT_AVAILABLE, &iAvailable);
+		if (iAvailable == GL_FALSE)
+			break;
+
+		memset(dPassTimes, 0, sizeof(dPassTimes));
+		dFrameTime = 0.0;
+		for (unsigned int uiQuery = 0; uiQuery < sFrame.uiNumQueries; uiQuery++)
+		{
+			GLuint64 ui64Time = 0;
+			glGetQueryObjectui64v(GetQueryName(uiFrame, uiQuery), GL_QUERY_RESULT, &ui64Time);
+			const SQuery& sQuery = sFrame.sQueries[uiQuery];
+			dPassTimes[sQuery.ePass] += ui64Time / 1.0e9;
+			dFrameTime += ui64Time / 1.0e9;
+
+			// The GPU clock is not the CPU clock, so each pass is placed in the trace at the time the CPU started it
+			if ((cProfiler->IsTraceRecording()) && (ui64Time > 0))
+				cProfiler->AddGPUTraceScope(CRenderStats::GetPassName(sQuery.ePass), sQuery.start, (long long)ui64Time);
+		}
+		uiFramesBehind = (unsigned int)(ullNumFrames - 1 - sFrame.ullFrame);
+		uiNumPending--;
+	}
+}
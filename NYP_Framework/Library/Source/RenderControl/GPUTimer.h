@@ -0,0 +1,105 @@
+/**
+ CGPUTimer
+ @brief A class which times each pass of the scene on the GPU, with GL_TIME_ELAPSED queries.
+		A query is started whenever the pass of CRenderStats changes, and the results of a frame are only read
+		a few frames later, once the GPU has finished it, so that the timer never waits for the GPU.
+		The times are shown in the profiler overlay, and added to its traces on a GPU track.
+		It needs OpenGL 3.3 or ARB_timer_query, which Mesa's llvmpipe also has
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+// Include CRenderStats, for the passes of the scene
+#include "RenderStats.h"
+
+#include <chrono>
+
+class CGPUTimer : public CSingletonTemplate<CGPUTimer>
+{
+	friend CSingletonTemplate<CGPUTimer>;
+public:
+	// The number of frames whose queries can wait for the GPU at the same time
+	enum { NUM_FRAMES_IN_FLIGHT = 4 };
+	// The most queries in a frame. The passes after these are timed with the last query of the frame
+	enum { MAX_QUERIES_PER_FRAME = 16 };
+
+	// Create the queries, if the OpenGL context has timer queries. Call this after glewInit
+	bool Init(void);
+
+	// Check if the passes are timed
+	bool IsEnabled(void) const;
+
+	// Start timing a frame, before the game state renders it
+	void BeginFrame(void);
+	// Start timing a pass of the frame. CRenderStats calls this when its pass changes
+	void SetPass(const CRenderStats::PASS ePass);
+	// Stop timing the frame, before the buffers are swapped, and read the results of the frames which the GPU finished
+	void EndFrame(void);
+
+	// Get the time in seconds of a pass of the latest frame which the GPU finished
+	double GetPassTime(const CRenderStats::PASS ePass) const;
+	// Get the time in seconds of the latest frame which the GPU finished
+	double GetFrameTime(void) const;
+
+	// Draw the times of the latest frame which the GPU finished. The profiler overlay draws this in its window
+	void RenderOverlay(void);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// A query of a frame
+	struct SQuery
+	{
+		CRenderStats::PASS ePass;
+		// The time which the CPU started the pass, which places it in the trace
+		std::chrono::steady_clock::time_point start;
+	};
+
+	// The queries of a frame which the GPU may not have finished yet
+	struct SFrameQueries
+	{
+		SQuery sQueries[MAX_QUERIES_PER_FRAME];
+		unsigned int uiNumQueries;
+		// The number of the frame
+		unsigned long long ullFrame;
+	};
+
+	bool bEnabled;
+	// The query names, MAX_QUERIES_PER_FRAME for each frame in flight
+	unsigned int uiQueryNames[NUM_FRAMES_IN_FLIGHT * MAX_QUERIES_PER_FRAME];
+
+	// The frames in flight, in a ring buffer
+	SFrameQueries sFrames[NUM_FRAMES_IN_FLIGHT];
+	// The index of the frame which is being timed
+	unsigned int uiCurrentFrame;
+	// The number of frames which ended, whose results were not read yet
+	unsigned int uiNumPending;
+	// True if a query of the current frame was started, and not ended yet
+	bool bQueryActive;
+	unsigned long long ullNumFrames;
+
+	// The results of the latest frame which the GPU finished, in seconds
+	double dPassTimes[CRenderStats::NUM_PASSES];
+	double dFrameTime;
+	// The number of frames between the latest frame which the GPU finished and the frame which is timed
+	unsigned int uiFramesBehind;
+	// The number of frames whose results were dropped, as the GPU had not finished them when their queries were needed
+	unsigned int uiNumDropped;
+
+	// Constructor
+	CGPUTimer(void);
+
+	// Destructor
+	virtual ~CGPUTimer(void);
+
+	// Get the query name of a query of a frame in flight
+	unsigned int GetQueryName(const unsigned int uiFrame, const unsigned int uiQuery) const;
+
+	// Start the next query of the current frame
+	void BeginQuery(const CRenderStats::PASS ePass);
+
+	// Read the results of the oldest frames which the GPU finished
+	void ReadResults(void);
+};
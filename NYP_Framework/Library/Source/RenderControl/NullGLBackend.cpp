@@ -0,0 +1,158 @@
+/**
+ CNullGLBackend
+ @brief A class which points the GLEW entry points at functions which do nothing, so that the game can
+		create its meshes, shaders and textures without a window or an OpenGL context.
+		The OpenGL 1.1 functions are not loaded by GLEW. They do nothing when no context is current
+ */
+#include "NullGLBackend.h"
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+#include <atomic>
+
+#include <iostream>
+using namespace std;
+
+bool CNullGLBackend::bInstalled = false;
+
+// The last object name given out. Names are never reused, so each object still gets its own name
+static std::atomic<GLuint> uiLastName(0);
+
+/**
+ @brief Give out new object names
+ @param n A GLsizei containing the number of names
+ @param names A GLuint* which is set to the names
+ */
+static void GLAPIENTRY NullGenNames(GLsizei n, GLuint* names)
+{
+	for (GLsizei i = 0; i < n; i++)
+		names[i] = ++uiLastName;
+}
+
+static GLuint GLAPIENTRY NullCreateObject(void) { return ++uiLastName; }
+static GLuint GLAPIENTRY NullCreateShader(GLenum) { return ++uiLastName; }
+static void GLAPIENTRY NullDeleteNames(GLsizei, const GLuint*) {}
+static void GLAPIENTRY NullUint(GLuint) {}
+static void GLAPIENTRY NullEnum(GLenum) {}
+static void GLAPIENTRY NullEnumUint(GLenum, GLuint) {}
+static void GLAPIENTRY NullUintUint(GLuint, GLuint) {}
+static void GLAPIENTRY NullBufferData(GLenum, GLsizeiptr, const GLvoid*, GLenum) {}
+// A buffer has no storage to map, so the callers upload from memory instead
+static void* GLAPIENTRY NullMapBufferRange(GLenum, GLintptr, GLsizeiptr, GLbitfield) { return NULL; }
+static GLboolean GLAPIENTRY NullUnmapBuffer(GLenum) { return GL_TRUE; }
+static void GLAPIENTRY NullVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const GLvoid*) {}
+static void GLAPIENTRY NullShaderSource(GLuint, GLsizei, const GLchar**, const GLint*) {}
+static GLint GLAPIENTRY NullGetUniformLocation(GLuint, const GLchar*) { return 0; }
+static void GLAPIENTRY NullUniform1f(GLint, GLfloat) {}
+static void GLAPIENTRY NullUniform1i(GLint, GLint) {}
+static void GLAPIENTRY NullUniform2f(GLint, GLfloat, GLfloat) {}
+static void GLAPIENTRY NullUniform3f(GLint, GLfloat, GLfloat, GLfloat) {}
+static void GLAPIENTRY NullUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) {}
+static void GLAPIENTRY NullUniformfv(GLint, GLsizei, const GLfloat*) {}
+static void GLAPIENTRY NullUniformMatrixfv(GLint, GLsizei, GLboolean, const GLfloat*) {}
+static void GLAPIENTRY NullDrawElementsBaseVertex(GLenum, GLsizei, GLenum, void*, GLint) {}
+
+/**
+ @brief Report that shaders and programs compiled and linked, with an empty info log, whichever the object is
+ @param ePname A GLenum containing the parameter to get
+ @param piParam A GLint* which is set to the value of the parameter
+ */
+static void GLAPIENTRY NullGetObjectiv(GLuint, GLenum ePname, GLint* piParam)
+{
+	if ((ePname == GL_COMPILE_STATUS) || (ePname == GL_LINK_STATUS) || (ePname == GL_VALIDATE_STATUS))
+		*piParam = GL_TRUE;
+	else
+		*piParam = 0;
+}
+
+/**
+ @brief Get an empty info log
+ */
+static void GLAPIENTRY NullGetInfoLog(GLuint, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+	if (length)
+		*length = 0;
+	if ((infoLog) && (bufSize > 0))
+		infoLog[0] = '\0';
+}
+
+/**
+ @brief Point the GLEW entry points which the game uses at functions which do nothing.
+		This is used instead of glewInit, which needs a context
+ */
+void CNullGLBackend::Install(void)
+{
+	// Objects
+	__glewGenVertexArrays = NullGenNames;
+	__glewGenBuffers = NullGenNames;
+	__glewCreateProgram = NullCreateObject;
+	__glewCreateShader = NullCreateShader;
+	__glewDeleteVertexArrays = NullDeleteNames;
+	__glewDeleteBuffers = NullDeleteNames;
+	__glewDeleteProgram = NullUint;
+	__glewDeleteShader = NullUint;
+	__glewBindVertexArray = NullUint;
+	__glewBindBuffer = NullEnumUint;
+	__glewBufferData = NullBufferData;
+	__glewMapBufferRange = NullMapBufferRange;
+	__glewUnmapBuffer = NullUnmapBuffer;
+	__glewVertexAttribPointer = NullVertexAttribPointer;
+	__glewEnableVertexAttribArray = NullUint;
+	__glewDisableVertexAttribArray = NullUint;
+
+	// Textures
+	__glewActiveTexture = NullEnum;
+	__glewGenerateMipmap = NullEnum;
+	__glewBindSampler = NullUintUint;
+
+	// Shaders
+	__glewShaderSource = NullShaderSource;
+	__glewCompileShader = NullUint;
+	__glewAttachShader = NullUintUint;
+	__glewDetachShader = NullUintUint;
+	__glewLinkProgram = NullUint;
+	__glewUseProgram = NullUint;
+	__glewGetShaderiv = NullGetObjectiv;
+	__glewGetProgramiv = NullGetObjectiv;
+	__glewGetShaderInfoLog = NullGetInfoLog;
+	__glewGetProgramInfoLog = NullGetInfoLog;
+	__glewGetUniformLocation = NullGetUniformLocation;
+	__glewGetAttribLocation = NullGetUniformLocation;
+	__glewUniform1f = NullUniform1f;
+	__glewUniform1i = NullUniform1i;
+	__glewUniform2f = NullUniform2f;
+	__glewUniform3f = NullUniform3f;
+	__glewUniform4f = NullUniform4f;
+	__glewUniform2fv = NullUniformfv;
+	__glewUniform3fv = NullUniformfv;
+	__glewUniform4fv = NullUniformfv;
+	__glewUniformMatrix2fv = NullUniformMatrixfv;
+	__glewUniformMatrix3fv = NullUniformMatrixfv;
+	__glewUniformMatrix4fv = NullUniformMatrixfv;
+
+	// Drawing
+	__glewDrawElementsBaseVertex = NullDrawElementsBaseVertex;
+
+	bInstalled = true;
+	cout << "CNullGLBackend: Installed" << endl;
+}
+
+/**
+ @brief Check if the null backend is installed
+ */
+bool CNullGLBackend::IsInstalled(void)
+{
+	return bInstalled;
+}
+
+/**
+ @brief Give out a texture name, since glGenTextures is an OpenGL 1.1 function which gives none without a context
+ */
+unsigned int CNullGLBackend::GenTexture(void)
+{
+	return ++uiLastName;
+}
@@ -0,0 +1,23 @@
+/**
+ CNullGLBackend
+ @brief A class which points the GLEW entry points at functions which do nothing, so that the game can
+		create its meshes, shaders and textures without a window or an OpenGL context.
+		The OpenGL 1.1 functions are not loaded by GLEW. They do nothing when no context is current
+ */
+#pragma once
+
+class CNullGLBackend
+{
+public:
+	// Point the GLEW entry points which the game uses at functions which do nothing
+	static void Install(void);
+
+	// Check if the null backend is installed
+	static bool IsInstalled(void);
+
+	// Give out a texture name, since glGenTextures is an OpenGL 1.1 function which gives none without a context
+	static unsigned int GenTexture(void);
+
+protected:
+	static bool bInstalled;
+};
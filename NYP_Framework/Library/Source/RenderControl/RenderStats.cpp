@@ -0,0 +1,371 @@
+/**
+ CRenderStats
+ @brief A class which counts the GL calls of each frame, per pass of the scene, so that the cost of rendering
+		a scene can be compared between builds, and batching and culling can be judged by their numbers.
+		The calls through the GLEW entry points are counted by wrapping them, and the OpenGL 1.1 calls,
+		which GLEW does not load, are counted where they are called with RENDER_STATS_ADD
+ */
+#include "RenderStats.h"
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+// Include CGPUTimer, which times the passes on the GPU
+#include "GPUTimer.h"
+// Include CProfiler, to add the counts to its traces
+#include "../TimeControl/Profiler.h"
+// Include ImGui, to draw the overlay
+#include "../GUI/imgui.h"
+
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+// The names of the counters, which are also the names of the counters in the traces
+static const char* const szCounterNames[CRenderStats::NUM_COUNTERS] = {
+	"Draw calls", "Texture binds", "Program binds", "Uniform sets", "Uploads", "Uploaded bytes"
+};
+// The names of the passes, which are the series of each counter in the traces
+static const char* const szPassNames[CRenderStats::NUM_PASSES] = {
+	"Other", "Background", "Map", "Enemies", "Player", "HUD"
+};
+
+// The GLEW entry points which were wrapped, which the wrappers call on to
+static PFNGLUSEPROGRAMPROC pfnUseProgram = NULL;
+static PFNGLUNIFORM1FPROC pfnUniform1f = NULL;
+static PFNGLUNIFORM1IPROC pfnUniform1i = NULL;
+static PFNGLUNIFORM2FPROC pfnUniform2f = NULL;
+static PFNGLUNIFORM3FPROC pfnUniform3f = NULL;
+static PFNGLUNIFORM4FPROC pfnUniform4f = NULL;
+static PFNGLUNIFORM2FVPROC pfnUniform2fv = NULL;
+static PFNGLUNIFORM3FVPROC pfnUniform3fv = NULL;
+static PFNGLUNIFORM4FVPROC pfnUniform4fv = NULL;
+static PFNGLUNIFORMMATRIX2FVPROC pfnUniformMatrix2fv = NULL;
+static PFNGLUNIFORMMATRIX3FVPROC pfnUniformMatrix3fv = NULL;
+static PFNGLUNIFORMMATRIX4FVPROC pfnUniformMatrix4fv = NULL;
+static PFNGLBUFFERDATAPROC pfnBufferData = NULL;
+static PFNGLDRAWELEMENTSBASEVERTEXPROC pfnDrawElementsBaseVertex = NULL;
+
+static void GLAPIENTRY CountedUseProgram(GLuint program)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::PROGRAM_BINDS);
+	pfnUseProgram(program);
+}
+
+static void GLAPIENTRY CountedUniform1f(GLint location, GLfloat v0)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniform1f(location, v0);
+}
+
+static void GLAPIENTRY CountedUniform1i(GLint location, GLint v0)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniform1i(location, v0);
+}
+
+static void GLAPIENTRY CountedUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniform2f(location, v0, v1);
+}
+
+static void GLAPIENTRY CountedUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniform3f(location, v0, v1, v2);
+}
+
+static void GLAPIENTRY CountedUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniform4f(location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY CountedUniform2fv(GLint location, GLsizei count, const GLfloat* value)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniform2fv(location, count, value);
+}
+
+static void GLAPIENTRY CountedUniform3fv(GLint location, GLsizei count, const GLfloat* value)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniform3fv(location, count, value);
+}
+
+static void GLAPIENTRY CountedUniform4fv(GLint location, GLsizei count, const GLfloat* value)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniform4fv(location, count, value);
+}
+
+static void GLAPIENTRY CountedUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniformMatrix2fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY CountedUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniformMatrix3fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY CountedUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UNIFORM_SETS);
+	pfnUniformMatrix4fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY CountedBufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::UPLOADS);
+	CRenderStats::GetInstance()->Add(CRenderStats::UPLOADED_BYTES, (unsigned int)size);
+	pfnBufferData(target, size, data, usage);
+}
+
+static void GLAPIENTRY CountedDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, void* indices, GLint basevertex)
+{
+	CRenderStats::GetInstance()->Add(CRenderStats::DRAW_CALLS);
+	pfnDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+/**
+ @brief Wrap a GLEW entry point, if it was loaded
+ @param pfnEntryPoint A T& containing the GLEW entry point, which is set to the wrapper
+ @param pfnOriginal A T& which is set to the entry point which the wrapper calls on to
+ @param pfnWrapper A T containing the wrapper
+ */
+template <typename T>
+static void Wrap(T& pfnEntryPoint, T& pfnOriginal, T pfnWrapper)
+{
+	if (pfnEntryPoint == NULL)
+		return;
+	pfnOriginal = pfnEntryPoint;
+	pfnEntryPoint = pfnWrapper;
+}
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CRenderStats::CRenderStats(void)
+	: eCurrentPass(OTHER)
+	, bInstalled(false)
+{
+	memset(uiCounts, 0, sizeof(uiCounts));
+	memset(uiLastFrameCounts, 0, sizeof(uiLastFrameCounts));
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CRenderStats::~CRenderStats(void)
+{
+}
+
+/**
+ @brief Wrap the GLEW entry points which the game uses, so that the calls through them are counted.
+		The OpenGL 1.1 functions, such as glBindTexture and glDrawElements, are not loaded by GLEW,
+		so they are counted where they are called instead
+ */
+void CRenderStats::Install(void)
+{
+#ifndef RENDER_STATS_DISABLED
+	if (bInstalled)
+		return;
+
+	Wrap(__glewUseProgram, pfnUseProgram, CountedUseProgram);
+	Wrap(__glewUniform1f, pfnUniform1f, CountedUniform1f);
+	Wrap(__glewUniform1i, pfnUniform1i, CountedUniform1i);
+	Wrap(__glewUniform2f, pfnUniform2f, CountedUniform2f);
+	Wrap(__glewUniform3f, pfnUniform3f, CountedUniform3f);
+	Wrap(__glewUniform4f, pfnUniform4f, CountedUniform4f);
+	Wrap(__glewUniform2fv, pfnUniform2fv, CountedUniform2fv);
+	Wrap(__glewUniform3fv, pfnUniform3fv, CountedUniform3fv);
+	Wrap(__glewUniform4fv, pfnUniform4fv, CountedUniform4fv);
+	Wrap(__glewUniformMatrix2fv, pfnUniformMatrix2fv, CountedUniformMatrix2fv);
+	Wrap(__glewUniformMatrix3fv, pfnUniformMatrix3fv, CountedUniformMatrix3fv);
+	Wrap(__glewUniformMatrix4fv, pfnUniformMatrix4fv, CountedUniformMatrix4fv);
+	Wrap(__glewBufferData, pfnBufferData, CountedBufferData);
+	Wrap(__glewDrawElementsBaseVertex, pfnDrawElementsBaseVertex, CountedDrawElementsBaseVertex);
+
+	bInstalled = true;
+#endif
+}
+
+/**
+ @brief Add to a counter of the current pass
+ @param eCounter A const COUNTER containing the counter
+ @param uiAmount A const unsigned int containing the amount to add, e.g. the number of bytes which were uploaded
+ */
+void CRenderStats::Add(const COUNTER eCounter, const unsigned int uiAmount)
+{
+	uiCounts[eCurrentPass][eCounter] += uiAmount;
+}
+
+/**
+ @brief Set the pass which the calls are counted in, until the next pass is set or the frame ends.
+		The GPU timer also starts timing the pass
+ @param ePass A const PASS containing the pass
+ */
+void CRenderStats::SetPass(const PASS ePass)
+{
+	eCurrentPass = ePass;
+	CGPUTimer::GetInstance()->SetPass(ePass);
+}
+
+/**
+ @brief Get the pass which the calls are counted in
+ */
+CRenderStats::PASS CRenderStats::GetPass(void) const
+{
+	return eCurrentPass;
+}
+
+/**
+ @brief End the current frame, add its counts to the trace of the profiler, and start counting the next frame
+ */
+void CRenderStats::EndFrame(void)
+{
+#ifndef RENDER_STATS_DISABLED
+	CProfiler* cProfiler = CProfiler::GetInstance();
+	if (cProfiler->IsTraceRecording())
+	{
+		// Each counter is a graph in the trace, with the passes stacked in it
+		double dValues[NUM_PASSES];
+		for (unsigned int uiCounter = 0; uiCounter < NUM_COUNTERS; uiCounter++)
+		{
+			for (unsigned int uiPass = 0; uiPass < NUM_PASSES; uiPass++)
+				dValues[uiPass] = uiCounts[uiPass][uiCounter];
+			cProfiler->AddTraceCounter(szCounterNames[uiCounter], szPassNames, dValues, NUM_PASSES);
+		}
+	}
+#endif
+
+	memcpy(uiLastFrameCounts, uiCounts, sizeof(uiCounts));
+	memset(uiCounts, 0, sizeof(uiCounts));
+	eCurrentPass = OTHER;
+}
+
+/**
+ @brief Get a counter of a pass of the current frame so far
+ @param eCounter A const COUNTER containing the counter
+ @param ePass A const PASS containing the pass
+ */
+unsigned int CRenderStats::GetCount(const COUNTER eCounter, const PASS ePass) const
+{
+	return uiCounts[ePass][eCounter];
+}
+
+/**
+ @brief Get a counter of the current frame so far, over all of the passes
+ @param eCounter A const COUNTER containing the counter
+ */
+unsigned int CRenderStats::GetTotal(const COUNTER eCounter) const
+{
+	unsigned int uiTotal = 0;
+	for (unsigned int uiPass = 0; uiPass < NUM_PASSES; uiPass++)
+		uiTotal += uiCounts[uiPass][eCounter];
+	return uiTotal;
+}
+
+/**
+ @brief Get a counter of a pass of the last frame which was ended
+ @param eCounter A const COUNTER containing the counter
+ @param ePass A const PASS containing the pass
+ */
+unsigned int CRenderStats::GetLastFrameCount(const COUNTER eCounter, const PASS ePass) const
+{
+	return uiLastFrameCounts[ePass][eCounter];
+}
+
+/**
+ @brief Get a counter of the last frame which was ended, over all of the passes
+ @param eCounter A const COUNTER containing the counter
+ */
+unsigned int CRenderStats::GetLastFrameTotal(const COUNTER eCounter) const
+{
+	unsigned int uiTotal = 0;
+	for (unsigned int uiPass = 0; uiPass < NUM_PASSES; uiPass++)
+		uiTotal += uiLastFrameCounts[uiPass][eCounter];
+	return uiTotal;
+}
+
+/**
+ @brief Get the name of a counter
+ @param eCounter A const COUNTER containing the counter
+ */
+const char* CRenderStats::GetCounterName(const COUNTER eCounter)
+{
+	return szCounterNames[eCounter];
+}
+
+/**
+ @brief Get the name of a pass
+ @param ePass A const PASS containing the pass
+ */
+const char* CRenderStats::GetPassName(const PASS ePass)
+{
+	return szPassNames[ePass];
+}
+
+/**
+ @brief Draw the counts of the last frame in an ImGui window, as a table of the passes and the counters.
+		This must be called inside the ImGui frame of the active game state
+ */
+void CRenderStats::RenderOverlay(void)
+{
+#ifndef RENDER_STATS_DISABLED
+	ImGui::SetNextWindowPos(ImVec2(10.0f, 440.0f), ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowSize(ImVec2(560.0f, 190.0f), ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowBgAlpha(0.85f);
+	if (ImGui::Begin("Render Stats"))
+	{
+		ImGui::Columns(NUM_COUNTERS + 1, "RenderStats");
+		ImGui::Text("Pass");
+		ImGui::NextColumn();
+		for (unsigned int uiCounter = 0; uiCounter < NUM_COUNTERS; uiCounter++)
+		{
+			ImGui::Text("%s", szCounterNames[uiCounter]);
+			ImGui::NextColumn();
+		}
+		ImGui::Separator();
+		for (unsigned int uiPass = 0; uiPass <= NUM_PASSES; uiPass++)
+		{
+			// The last row is the whole frame
+			if (uiPass == NUM_PASSES)
+				ImGui::Separator();
+			ImGui::Text("%s", (uiPass < NUM_PASSES) ? szPassNames[uiPass] : "Total");
+			ImGui::NextColumn();
+			for (unsigned int uiCounter = 0; uiCounter < NUM_COUNTERS; uiCounter++)
+			{
+				unsigned int uiCount = (uiPass < NUM_PASSES) ? uiLastFrameCounts[uiPass][uiCounter]
+					: GetLastFrameTotal((COUNTER)uiCounter);
+				ImGui::Text("%u", uiCount);
+				ImGui::NextColumn();
+			}
+		}
+		ImGui::Columns(1);
+	}
+	ImGui::End();
+#endif
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CRenderStats::PrintSelf(void) const
+{
+	cout << "CRenderStats: The GL calls of the last frame" << (bInstalled ? "" : ", without the GLEW entry points") << endl;
+	for (unsigned int uiPass = 0; uiPass < NUM_PASSES; uiPass++)
+	{
+		cout << "\t" << szPassNames[uiPass] << ":";
+		for (unsigned int uiCounter = 0; uiCounter < NUM_COUNTERS; uiCounter++)
+			cout << " " << szCounterNames[uiCounter] << " " << uiLastFrameCounts[uiPass][uiCounter];
+		cout << endl;
+	}
+}
@@ -0,0 +1,103 @@
+/**
+ CRenderStats
+ @brief A class which counts the GL calls of each frame, per pass of the scene, so that the cost of rendering
+		a scene can be compared between builds, and batching and culling can be judged by their numbers.
+		The calls through the GLEW entry points are counted by wrapping them, and the OpenGL 1.1 calls,
+		which GLEW does not load, are counted where they are called with RENDER_STATS_ADD.
+		The counts are shown beside the profiler overlay, and added to its traces.
+		Define RENDER_STATS_DISABLED to compile the counting out
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+class CRenderStats : public CSingletonTemplate<CRenderStats>
+{
+	friend CSingletonTemplate<CRenderStats>;
+public:
+	// The GL calls which are counted
+	enum COUNTER
+	{
+		DRAW_CALLS = 0,
+		TEXTURE_BINDS,
+		PROGRAM_BINDS,
+		UNIFORM_SETS,
+		UPLOADS,			// Buffers and textures which are uploaded
+		UPLOADED_BYTES,
+		NUM_COUNTERS
+	};
+
+	// The passes of a scene which the calls are counted in
+	enum PASS
+	{
+		OTHER = 0,			// The calls outside of the passes, such as the menus
+		BACKGROUND,
+		MAP,
+		ENEMIES,
+		PLAYER,
+		HUD,
+		NUM_PASSES
+	};
+
+	// Wrap the GLEW entry points which the game uses, so that the calls through them are counted.
+	// Call this after glewInit or CNullGLBackend::Install
+	void Install(void);
+
+	// Add to a counter of the current pass
+	void Add(const COUNTER eCounter, const unsigned int uiAmount = 1);
+
+	// Set the pass which the calls are counted in, until the next pass is set or the frame ends. The GPU timer times the same passes
+	void SetPass(const PASS ePass);
+	// Get the pass which the calls are counted in
+	PASS GetPass(void) const;
+
+	// End the current frame, and start counting the next frame in the OTHER pass
+	void EndFrame(void);
+
+	// Get a counter of a pass of the current frame so far
+	unsigned int GetCount(const COUNTER eCounter, const PASS ePass) const;
+	// Get a counter of the current frame so far, over all of the passes
+	unsigned int GetTotal(const COUNTER eCounter) const;
+	// Get a counter of a pass of the last frame which was ended
+	unsigned int GetLastFrameCount(const COUNTER eCounter, const PASS ePass) const;
+	// Get a counter of the last frame which was ended, over all of the passes
+	unsigned int GetLastFrameTotal(const COUNTER eCounter) const;
+
+	// Get the name of a counter
+	static const char* GetCounterName(const COUNTER eCounter);
+	// Get the name of a pass
+	static const char* GetPassName(const PASS ePass);
+
+	// Draw the counts of the last frame in an ImGui window. The profiler overlay draws this
+	void RenderOverlay(void);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// The counters of the current frame, per pass
+	unsigned int uiCounts[NUM_PASSES][NUM_COUNTERS];
+	// The counters of the last frame which was ended, per pass
+	unsigned int uiLastFrameCounts[NUM_PASSES][NUM_COUNTERS];
+	// The pass which the calls are counted in
+	PASS eCurrentPass;
+	// True if the GLEW entry points were wrapped
+	bool bInstalled;
+
+	// Constructor
+	CRenderStats(void);
+
+	// Destructor
+	virtual ~CRenderStats(void);
+};
+
+#ifndef RENDER_STATS_DISABLED
+	// Add to a counter of the current pass, e.g. RENDER_STATS_ADD(DRAW_CALLS, 1)
+	#define RENDER_STATS_ADD(eCounter, uiAmount) CRenderStats::GetInstance()->Add(CRenderStats::eCounter, uiAmount)
+	// Count the calls which follow in a pass of the scene, e.g. RENDER_STATS_PASS(MAP)
+	#define RENDER_STATS_PASS(ePass) CRenderStats::GetInstance()->SetPass(CRenderStats::ePass)
+#else
+	#define RENDER_STATS_ADD(eCounter, uiAmount)
+	#define RENDER_STATS_PASS(ePass)
+#endif
@@ -5,6 +5,12 @@
  Date: Mar 2020
  */
 #include "ShaderManager.h"
+
+// Include CProfiler, to show the shader compiles in the traces
+#include "../TimeControl/Profiler.h"
+// Include CResourceTracker, to tag the shader programs
+#include "../System/ResourceTracker.h"
+
 #include <stdexcept>      // std::invalid_argument
 
 /**
@@ -50,10 +56,13 @@ void CShaderManager::Add(	const std::string& _name,
 							const char* fragmentPath, 
 							const char* geometryPath)
 {
+	PROFILE_SCOPE_DETAIL("CShaderManager::Add", "asset", _name);
+	RESOURCE_TAG("CShaderManager");
+
 	if (Check(_name))
 	{
 		// Scene Exist, unable to proceed
-		throw std::exception("Duplicate shader name provided");
+		throw std::invalid_argument("Duplicate shader name provided");
 		//Change to avoid crashing
 		return;
 	}
@@ -77,7 +86,7 @@ void CShaderManager::Remove(const std::string& _name)
 	try {
 		if (target == activeShader)
 		{
-			throw std::exception("Unable to remove active Shader");
+			throw std::invalid_argument("Unable to remove active Shader");
 		}
 	}
 	catch (const std::exception& e) {
@@ -98,7 +107,7 @@ void CShaderManager::Use(const std::string& _name)
 		if (!Check(_name))
 		{
 			// Shader does not exist
-			throw std::exception("Shader does not exist");
+			throw std::invalid_argument("Shader does not exist");
 		}
 	}
 	catch (const std::exception& e) {
@@ -0,0 +1,145 @@
+/**
+ CAllocationCounter
+ @brief A class which counts the calls to the global operator new, so that the allocations made by a frame
+		can be measured. AllocationCounter.cpp replaces the global operator new and operator delete, and is
+		only linked into an executable which calls one of these methods
+ */
+#include "AllocationCounter.h"
+
+// Include CResourceTracker, which keeps the live allocations of each tag
+#include "ResourceTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// The counts are atomic, as the worker threads of the CJobSystem allocate too.
+// They are constant initialised, so they can be used by allocations made before main
+static std::atomic<unsigned long long> uiNumAllocations(0);
+static std::atomic<unsigned long long> uiNumBytesAllocated(0);
+
+#ifndef RESOURCE_TRACKER_DISABLED
+// Each block starts with a header which keeps its size and tag, so that the block is removed from the live
+// allocations of the same tag when it is freed. The header is as big as the alignment of malloc on x64,
+// so the blocks keep that alignment
+struct SBlockHeader
+{
+	std::size_t uiSize;
+	unsigned int uiTag;
+};
+static const std::size_t BLOCK_HEADER_SIZE = 16;
+static_assert(sizeof(SBlockHeader) <= BLOCK_HEADER_SIZE, "The block header does not fit before the block");
+#endif
+
+/**
+ @brief Allocate a block of memory, and count it
+ @param uiSize A const std::size_t containing the size of the block in bytes
+ @return The block, or NULL if it cannot be allocated
+ */
+static void* CountedAlloc(const std::size_t uiSize)
+{
+	uiNumAllocations.fetch_add(1, std::memory_order_relaxed);
+	uiNumBytesAllocated.fetch_add(uiSize, std::memory_order_relaxed);
+#ifndef RESOURCE_TRACKER_DISABLED
+	unsigned char* pHeader = (unsigned char*)malloc(BLOCK_HEADER_SIZE + uiSize);
+	if (pHeader == NULL)
+		return NULL;
+	SBlockHeader* pBlockHeader = (SBlockHeader*)pHeader;
+	pBlockHeader->uiSize = uiSize;
+	pBlockHeader->uiTag = CResourceTracker::GetCurrentTag();
+	CResourceTracker::AddAllocation(pBlockHeader->uiTag, uiSize);
+	return pHeader + BLOCK_HEADER_SIZE;
+#else
+	// malloc may return NULL for a size of 0, but operator new must return a unique pointer
+	return malloc((uiSize > 0) ? uiSize : 1);
+#endif
+}
+
+/**
+ @brief Free a block of memory which CountedAlloc allocated
+ @param pBlock A void* containing the block, or NULL
+ */
+static void CountedFree(void* pBlock)
+{
+#ifndef RESOURCE_TRACKER_DISABLED
+	if (pBlock == NULL)
+		return;
+	SBlockHeader* pBlockHeader = (SBlockHeader*)((unsigned char*)pBlock - BLOCK_HEADER_SIZE);
+	CResourceTracker::RemoveAllocation(pBlockHeader->uiTag, pBlockHeader->uiSize);
+	free(pBlockHeader);
+#else
+	free(pBlock);
+#endif
+}
+
+void* operator new(std::size_t uiSize)
+{
+	void* pBlock = CountedAlloc(uiSize);
+	if (pBlock == NULL)
+		throw std::bad_alloc();
+	return pBlock;
+}
+
+void* operator new[](std::size_t uiSize)
+{
+	void* pBlock = CountedAlloc(uiSize);
+	if (pBlock == NULL)
+		throw std::bad_alloc();
+	return pBlock;
+}
+
+void* operator new(std::size_t uiSize, const std::nothrow_t&) noexcept
+{
+	return CountedAlloc(uiSize);
+}
+
+void* operator new[](std::size_t uiSize, const std::nothrow_t&) noexcept
+{
+	return CountedAlloc(uiSize);
+}
+
+void operator delete(void* pBlock) noexcept
+{
+	CountedFree(pBlock);
+}
+
+void operator delete[](void* pBlock) noexcept
+{
+	CountedFree(pBlock);
+}
+
+void operator delete(void* pBlock, const std::nothrow_t&) noexcept
+{
+	CountedFree(pBlock);
+}
+
+void operator delete[](void* pBlock, const std::nothrow_t&) noexcept
+{
+	CountedFree(pBlock);
+}
+
+void operator delete(void* pBlock, std::size_t) noexcept
+{
+	CountedFree(pBlock);
+}
+
+void operator delete[](void* pBlock, std::size_t) noexcept
+{
+	CountedFree(pBlock);
+}
+
+/**
+ @brief Get the number of allocations since the program started
+ */
+unsigned long long CAllocationCounter::GetNumAllocations(void)
+{
+	return uiNumAllocations.load(std::memory_order_relaxed);
+}
+
+/**
+ @brief Get the number of bytes which were allocated since the program started
+ */
+unsigned long long CAllocationCounter::GetNumBytesAllocated(void)
+{
+	return uiNumBytesAllocated.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,19 @@
+/**
+ CAllocationCounter
+ @brief A class which counts the calls to the global operator new, so that the allocations made by a frame
+		can be measured. AllocationCounter.cpp replaces the global operator new and operator delete, and is
+		only linked into an executable which calls one of these methods.
+		Each block also keeps its size and the tag of CResourceTracker which allocated it, so that the live
+		allocations of each tag are known, unless RESOURCE_TRACKER_DISABLED is defined
+ */
+#pragma once
+
+class CAllocationCounter
+{
+public:
+	// Get the number of allocations since the program started
+	static unsigned long long GetNumAllocations(void);
+
+	// Get the number of bytes which were allocated since the program started
+	static unsigned long long GetNumBytesAllocated(void);
+};
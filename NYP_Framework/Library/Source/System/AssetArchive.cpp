@@ -0,0 +1,927 @@
+/**
+ CAssetArchive
+ @brief A class which reads the images, sounds and maps of the game from one memory-mapped archive file,
+		instead of opening each of their files
+ */
+#include "AssetArchive.h"
+
+// Include CProfiler, to show the reads in the traces
+#include "../TimeControl/Profiler.h"
+// Include CImageLoader, which cooks the textures of the images
+#include "ImageLoader.h"
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <dirent.h>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+// Include FileSystem, to remove its root from the paths of the assets. It needs the std namespace
+#include "filesystem.h"
+
+// The start of every archive, and the version of its layout
+static const char szMagic[4] = { 'N', 'Y', 'P', 'K' };
+static const unsigned int VERSION = 1;
+
+// The extensions of the files which the loaders read, which are packed
+static const char* const szPackedExtensions[] = { ".png", ".jpg", ".tga", ".ogg", ".wav", ".mp3", ".csv", ".ttf" };
+// The extensions of the images, which are also cooked into textures
+static const char* const szImageExtensions[] = { ".png", ".jpg", ".tga" };
+
+// The files with this in their name are saved by the game while it runs, so they are read from their files
+// instead of a copy in the archive which would be out of date
+static const char* const szSaveGameName = "_savegame";
+
+// A compressed asset is only kept compressed if it is at most this much of its size, as the images and sounds
+// which are compressed already gain too little to be worth decompressing
+static const double COMPRESSION_RATIO = 0.9;
+
+// The LZ4 block format: the shortest match, the bytes at the end which are always literals, and the bytes at
+// the end which no match can start in
+static const size_t LZ4_MIN_MATCH = 4;
+static const size_t LZ4_LAST_LITERALS = 5;
+static const size_t LZ4_MATCH_LIMIT = 12;
+static const size_t LZ4_MAX_OFFSET = 65535;
+static const unsigned int LZ4_HASH_BITS = 16;
+
+/**
+ @brief Read 4 bytes of a buffer as one number
+ */
+static unsigned int Read32(const unsigned char* pData)
+{
+	unsigned int uiValue;
+	memcpy(&uiValue, pData, sizeof(uiValue));
+	return uiValue;
+}
+
+/**
+ @brief Add a length of the LZ4 block format, which continues in bytes of 255 once it reaches 15
+ */
+static void WriteLZ4Length(size_t uiLength, std::vector<unsigned char>& vOutput)
+{
+	while (uiLength >= 255)
+	{
+		vOutput.push_back(255);
+		uiLength -= 255;
+	}
+	vOutput.push_back((unsigned char)uiLength);
+}
+
+/**
+ @brief Read a length of the LZ4 block format, which continues in bytes of 255
+ @return false if the length goes past the end of the data
+ */
+static bool ReadLZ4Length(const unsigned char* pData, const size_t uiSize, size_t& uiPosition, size_t& uiLength)
+{
+	unsigned char ucByte = 255;
+	while (ucByte == 255)
+	{
+		if (uiPosition >= uiSize)
+			return false;
+		ucByte = pData[uiPosition++];
+		uiLength += ucByte;
+	}
+	return true;
+}
+
+/**
+ @brief Add a sequence of the LZ4 block format, which is literals followed by a match
+ */
+static void WriteLZ4Sequence(const unsigned char* pLiterals, const size_t uiNumLiterals, const size_t uiOffset,
+							 const size_t uiMatchLength, std::vector<unsigned char>& vOutput)
+{
+	const size_t uiMatchCode = uiMatchLength - LZ4_MIN_MATCH;
+	vOutput.push_back((unsigned char)(((uiNumLiterals < 15 ? uiNumLiterals : 15) << 4) | (uiMatchCode < 15 ? uiMatchCode : 15)));
+	if (uiNumLiterals >= 15)
+		WriteLZ4Length(uiNumLiterals - 15, vOutput);
+	vOutput.insert(vOutput.end(), pLiterals, pLiterals + uiNumLiterals);
+	vOutput.push_back((unsigned char)(uiOffset & 0xFF));
+	vOutput.push_back((unsigned char)(uiOffset >> 8));
+	if (uiMatchCode >= 15)
+		WriteLZ4Length(uiMatchCode - 15, vOutput);
+}
+
+/**
+ @brief Compress data in the LZ4 block format. Each position is matched with the last position which had the
+		same 4 bytes, which is fast and gives most of the gain on the uncompressed TGA images
+ @param pData A const unsigned char* containing the data
+ @param uiSize A const size_t containing the number of bytes of the data
+ @param vOutput A std::vector<unsigned char>& which the compressed data is put in
+ */
+static void CompressLZ4(const unsigned char* pData, const size_t uiSize, std::vector<unsigned char>& vOutput)
+{
+	vOutput.clear();
+	vOutput.reserve(uiSize + uiSize / 255 + 16);
+
+	size_t uiAnchor = 0;
+	if (uiSize > LZ4_MATCH_LIMIT)
+	{
+		// The positions after the last position which had each hash of 4 bytes, so that 0 is none
+		std::vector<unsigned int> vTable((size_t)1 << LZ4_HASH_BITS, 0);
+		const size_t uiMatchStartLimit = uiSize - LZ4_MATCH_LIMIT;
+		const size_t uiMatchEndLimit = uiSize - LZ4_LAST_LITERALS;
+
+		size_t uiPosition = 0;
+		while (uiPosition < uiMatchStartLimit)
+		{
+			const unsigned int uiSequence = Read32(pData + uiPosition);
+			const unsigned int uiHash = (uiSequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+			const size_t uiCandidate = vTable[uiHash];
+			vTable[uiHash] = (unsigned int)uiPosition + 1;
+
+			if ((uiCandidate == 0) || (uiPosition - (uiCandidate - 1) > LZ4_MAX_OFFSET)
+				|| (Read32(pData + uiCandidate - 1) != uiSequence))
+			{
+				uiPosition++;
+				continue;
+			}
+
+			const size_t uiMatch = uiCandidate - 1;
+			size_t uiLength = LZ4_MIN_MATCH;
+			while ((uiPosition + uiLength < uiMatchEndLimit) && (pData[uiMatch + uiLength] == pData[uiPosition + uiLength]))
+				uiLength++;
+
+			WriteLZ4Sequence(pData + uiAnchor, uiPosition - uiAnchor, uiPosition - uiMatch, uiLength, vOutput);
+			uiPosition += uiLength;
+			uiAnchor = uiPosition;
+		}
+	}
+
+	// The last sequence is only literals
+	const size_t uiNumLiterals = uiSize - uiAnchor;
+	vOutput.push_back((unsigned char)((uiNumLiterals < 15 ? uiNumLiterals : 15) << 4));
+	if (uiNumLiterals >= 15)
+		WriteLZ4Length(uiNumLiterals - 15, vOutput);
+	vOutput.insert(vOutput.end(), pData + uiAnchor, pData + uiSize);
+}
+
+/**
+ @brief Decompress data in the LZ4 block format. Every length and offset is checked, so a damaged archive
+		cannot write outside the output
+ @param pData A const unsigned char* containing the compressed data
+ @param uiSize A const size_t containing the number of bytes of the compressed data
+ @param pOutput An unsigned char* which the data is decompressed into
+ @param uiOutputSize A const size_t containing the number of bytes of the decompressed data
+ @return false if the data is damaged
+ */
+static bool DecompressLZ4(const unsigned char* pData, const size_t uiSize, unsigned char* pOutput, const size_t uiOutputSize)
+{
+	size_t uiInput = 0;
+	size_t uiOutput = 0;
+	while (uiInput < uiSize)
+	{
+		const unsigned char ucToken = pData[uiInput++];
+
+		size_t uiNumLiterals = ucToken >> 4;
+		if ((uiNumLiterals == 15) && (ReadLZ4Length(pData, uiSize, uiInput, uiNumLiterals) == false))
+			return false;
+		if ((uiNumLiterals > uiSize - uiInput) || (uiNumLiterals > uiOutputSize - uiOutput))
+			return false;
+		memcpy(pOutput + uiOutput, pData + uiInput, uiNumLiterals);
+		uiInput += uiNumLiterals;
+		uiOutput += uiNumLiterals;
+
+		// The last sequence has no match
+		if (uiInput == uiSize)
+			break;
+
+		if (uiSize - uiInput < 2)
+			return false;
+		const size_t uiOffset = pData[uiInput] | (pData[uiInput + 1] << 8);
+		uiInput += 2;
+		if ((uiOffset == 0) || (uiOffset > uiOutput))
+			return false;
+
+		size_t uiLength = ucToken & 15;
+		if ((uiLength == 15) && (ReadLZ4Length(pData, uiSize, uiInput, uiLength) == false))
+			return false;
+		uiLength += LZ4_MIN_MATCH;
+		if (uiLength > uiOutputSize - uiOutput)
+			return false;
+
+		// A match which overlaps its own output repeats the bytes before it, so it is copied a byte at a time
+		const unsigned char* pMatch = pOutput + uiOutput - uiOffset;
+		if (uiOffset >= uiLength)
+		{
+			memcpy(pOutput + uiOutput, pMatch, uiLength);
+		}
+		else
+		{
+			for (size_t i = 0; i < uiLength; i++)
+				pOutput[uiOutput + i] = pMatch[i];
+		}
+		uiOutput += uiLength;
+	}
+	return uiOutput == uiOutputSize;
+}
+
+/**
+ @brief Check if a file has one of a list of extensions
+ @param sName A const std::string& containing the name of the file
+ @param szExtensions A const char* const* containing the extensions, in lower case
+ @param uiNumExtensions A const unsigned int containing the number of extensions
+ */
+static bool HasExtension(const std::string& sName, const char* const* szExtensions, const unsigned int uiNumExtensions)
+{
+	const size_t uiDot = sName.find_last_of('.');
+	if (uiDot == string::npos)
+		return false;
+
+	std::string sExtension = sName.substr(uiDot);
+	for (size_t i = 0; i < sExtension.size(); i++)
+		sExtension[i] = (char)tolower((unsigned char)sExtension[i]);
+	for (unsigned int i = 0; i < uiNumExtensions; i++)
+	{
+		if (sExtension == szExtensions[i])
+			return true;
+	}
+	return false;
+}
+
+/**
+ @brief Check if a file has one of the extensions which are packed
+ */
+static bool IsPackedExtension(const std::string& sName)
+{
+	return HasExtension(sName, szPackedExtensions, sizeof(szPackedExtensions) / sizeof(szPackedExtensions[0]));
+}
+
+/**
+ @brief Check if a file is an image, which is cooked into a texture
+ */
+static bool IsImageExtension(const std::string& sName)
+{
+	return HasExtension(sName, szImageExtensions, sizeof(szImageExtensions) / sizeof(szImageExtensions[0]));
+}
+
+/**
+ @brief Check if a file is saved by the game, so it is not packed
+ */
+static bool IsSaveGame(const std::string& sName)
+{
+	std::string sLowerName = sName;
+	for (size_t i = 0; i < sLowerName.size(); i++)
+		sLowerName[i] = (char)tolower((unsigned char)sLowerName[i]);
+	return sLowerName.find(szSaveGameName) != string::npos;
+}
+
+/**
+ @brief Add the files of a folder and its subfolders to a list
+ @param sFolder A const std::string& containing the folder
+ @param vFiles A std::vector<std::string>& which the paths of the files are added to
+ */
+static void ListFiles(const std::string& sFolder, std::vector<std::string>& vFiles)
+{
+#ifdef _WIN32
+	WIN32_FIND_DATAA sFindData;
+	HANDLE hFind = FindFirstFileA((sFolder + "/*").c_str(), &sFindData);
+	if (hFind == INVALID_HANDLE_VALUE)
+		return;
+	do
+	{
+		const std::string sName = sFindData.cFileName;
+		if ((sName == ".") || (sName == ".."))
+			continue;
+		if (sFindData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			ListFiles(sFolder + "/" + sName, vFiles);
+		else
+			vFiles.push_back(sFolder + "/" + sName);
+	} while (FindNextFileA(hFind, &sFindData));
+	FindClose(hFind);
+#else
+	DIR* pDirectory = opendir(sFolder.c_str());
+	if (pDirectory == NULL)
+		return;
+	while (dirent* pEntry = readdir(pDirectory))
+	{
+		const std::string sName = pEntry->d_name;
+		if ((sName == ".") || (sName == ".."))
+			continue;
+		struct stat sStat;
+		const std::string sPath = sFolder + "/" + sName;
+		if (stat(sPath.c_str(), &sStat) != 0)
+			continue;
+		if (S_ISDIR(sStat.st_mode))
+			ListFiles(sPath, vFiles);
+		else
+			vFiles.push_back(sPath);
+	}
+	closedir(pDirectory);
+#endif
+}
+
+/**
+ @brief Constructor
+ */
+CAsset::CAsset(void)
+	: pData(NULL)
+	, uiSize(0)
+{
+}
+
+/**
+ @brief Get the data of the asset
+ */
+const unsigned char* CAsset::GetData(void) const
+{
+	return pData;
+}
+
+/**
+ @brief Get the number of bytes of the data
+ */
+size_t CAsset::GetSize(void) const
+{
+	return uiSize;
+}
+
+/**
+ @brief Check if the data is a view of the mapped archive, which stays valid until the archive is closed,
+		instead of a copy which is freed with this CAsset
+ */
+bool CAsset::IsMapped(void) const
+{
+	return vDecompressed.empty();
+}
+
+/**
+ @brief Constructor
+ @param cAsset A const CAsset& containing the asset which is read
+ */
+CAssetStreamBuf::CAssetStreamBuf(const CAsset& cAsset)
+{
+	char* pData = (char*)cAsset.GetData();
+	setg(pData, pData, pData + cAsset.GetSize());
+}
+
+/**
+ @brief Seek to a position relative to the start, the current position or the end
+ @param iOffset An off_type containing the offset
+ @param eDirection A std::ios_base::seekdir containing what the offset is from
+ @param eMode A std::ios_base::openmode containing the buffers which are moved. Only reading is supported
+ @return The new position, or -1 if it is outside the asset
+ */
+CAssetStreamBuf::pos_type CAssetStreamBuf::seekoff(off_type iOffset, std::ios_base::seekdir eDirection, std::ios_base::openmode eMode)
+{
+	if ((eMode & std::ios_base::in) == 0)
+		return pos_type(off_type(-1));
+
+	off_type iPosition = iOffset;
+	if (eDirection == std::ios_base::cur)
+		iPosition += gptr() - eback();
+	else if (eDirection == std::ios_base::end)
+		iPosition += egptr() - eback();
+	if ((iPosition < 0) || (iPosition > egptr() - eback()))
+		return pos_type(off_type(-1));
+
+	setg(eback(), eback() + iPosition, egptr());
+	return pos_type(iPosition);
+}
+
+/**
+ @brief Seek to a position from the start
+ @param iPosition A pos_type containing the position
+ @param eMode A std::ios_base::openmode containing the buffers which are moved. Only reading is supported
+ @return The new position, or -1 if it is outside the asset
+ */
+CAssetStreamBuf::pos_type CAssetStreamBuf::seekpos(pos_type iPosition, std::ios_base::openmode eMode)
+{
+	return seekoff(off_type(iPosition), std::ios_base::beg, eMode);
+}
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CAssetArchive::CAssetArchive(void)
+	: pArchive(NULL)
+	, uiArchiveSize(0)
+	, pEntries(NULL)
+	, uiNumEntries(0)
+	, pNames(NULL)
+#ifdef _WIN32
+	, hFile(INVALID_HANDLE_VALUE)
+	, hMapping(NULL)
+#else
+	, iFile(-1)
+#endif
+	, uiNumReads(0)
+	, uiNumDecompressed(0)
+	, pvReadRecord(NULL)
+{
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CAssetArchive::~CAssetArchive(void)
+{
+	Close();
+}
+
+/**
+ @brief Map an archive which the Packer made. The archive which was open is closed first
+ @param sFilename A const std::string& containing the file name of the archive
+ @return false if the archive does not exist or is not valid, in which case the assets are read from their files
+ */
+bool CAssetArchive::Open(const std::string& sFilename)
+{
+	PROFILE_SCOPE_DETAIL("CAssetArchive::Open", "asset", sFilename);
+
+	Close();
+
+#ifdef _WIN32
+	hFile = CreateFileA(sFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		cout << "CAssetArchive: There is no archive " << sFilename << ", so the assets are read from their files" << endl;
+		return false;
+	}
+	LARGE_INTEGER iFileSize;
+	if ((GetFileSizeEx(hFile, &iFileSize) == FALSE) || (iFileSize.QuadPart < (LONGLONG)sizeof(SHeader)))
+	{
+		cout << "CAssetArchive: " << sFilename << " is too small to be an archive" << endl;
+		Close();
+		return false;
+	}
+	uiArchiveSize = (size_t)iFileSize.QuadPart;
+	hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (hMapping != NULL)
+		pArchive = (const unsigned char*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+#else
+	iFile = open(sFilename.c_str(), O_RDONLY);
+	if (iFile < 0)
+	{
+		cout << "CAssetArchive: There is no archive " << sFilename << ", so the assets are read from their files" << endl;
+		return false;
+	}
+	struct stat sStat;
+	if ((fstat(iFile, &sStat) != 0) || (sStat.st_size < (off_t)sizeof(SHeader)))
+	{
+		cout << "CAssetArchive: " << sFilename << " is too small to be an archive" << endl;
+		Close();
+		return false;
+	}
+	uiArchiveSize = (size_t)sStat.st_size;
+	void* pMapping = mmap(NULL, uiArchiveSize, PROT_READ, MAP_PRIVATE, iFile, 0);
+	if (pMapping != MAP_FAILED)
+		pArchive = (const unsigned char*)pMapping;
+#endif
+	if (pArchive == NULL)
+	{
+		cout << "CAssetArchive: Unable to map " << sFilename << endl;
+		Close();
+		return false;
+	}
+
+	const SHeader* pHeader = (const SHeader*)pArchive;
+	pEntries = (const SEntry*)(pArchive + sizeof(SHeader));
+	uiNumEntries = pHeader->uiNumEntries;
+	pNames = (const char*)(pEntries + uiNumEntries);
+	if (Validate() == false)
+	{
+		cout << "CAssetArchive: " << sFilename << " is not a valid archive of version " << VERSION << endl;
+		Close();
+		return false;
+	}
+
+	this->sFilename = sFilename;
+	cout << "CAssetArchive: Opened " << sFilename << " with " << uiNumEntries << " assets" << endl;
+	return true;
+}
+
+/**
+ @brief Unmap the archive. The views of its assets are no longer valid
+ */
+void CAssetArchive::Close(void)
+{
+#ifdef _WIN32
+	if (pArchive)
+		UnmapViewOfFile(pArchive);
+	if (hMapping)
+		CloseHandle(hMapping);
+	if (hFile != INVALID_HANDLE_VALUE)
+		CloseHandle(hFile);
+	hMapping = NULL;
+	hFile = INVALID_HANDLE_VALUE;
+#else
+	if (pArchive)
+		munmap((void*)pArchive, uiArchiveSize);
+	if (iFile >= 0)
+		close(iFile);
+	iFile = -1;
+#endif
+	pArchive = NULL;
+	uiArchiveSize = 0;
+	pEntries = NULL;
+	uiNumEntries = 0;
+	pNames = NULL;
+	sFilename.clear();
+}
+
+/**
+ @brief Check if an archive is open
+ */
+bool CAssetArchive::IsOpen(void) const
+{
+	return pArchive != NULL;
+}
+
+/**
+ @brief Check if an asset is in the archive
+ @param sPath A const std::string& containing the path of the asset, with or without the root of FileSystem::getPath
+ */
+bool CAssetArchive::Contains(const std::string& sPath) const
+{
+	return Find(sPath) != NULL;
+}
+
+/**
+ @brief Read an asset from the archive. An asset which was stored as it is is a view of the mapped archive,
+		and a compressed asset is decompressed into the CAsset. This can be called from any thread
+ @param sPath A const std::string& containing the path of the asset, with or without the root of FileSystem::getPath
+ @param cAsset A CAsset& which is set to the data of the asset
+ @return false if there is no archive, the asset is not in it, or it could not be decompressed
+ */
+bool CAssetArchive::Read(const std::string& sPath, CAsset& cAsset) const
+{
+	// The path is recorded even if the asset is not in the archive, as its loader reads the file instead
+	std::vector<std::string>* pvRecord = pvReadRecord.load(std::memory_order_acquire);
+	if ((pvRecord) && (std::this_thread::get_id() == idRecordThread))
+		pvRecord->push_back(sPath);
+
+	const SEntry* pEntry = Find(sPath);
+	if (pEntry == NULL)
+		return false;
+
+	PROFILE_SCOPE_DETAIL("CAssetArchive::Read", "asset", sPath);
+	uiNumReads++;
+
+	const unsigned char* pStored = pArchive + pEntry->ullOffset;
+	if (pEntry->uiCompression == NONE)
+	{
+		cAsset.vDecompressed.clear();
+		cAsset.pData = pStored;
+		cAsset.uiSize = pEntry->uiSize;
+		return true;
+	}
+
+	cAsset.vDecompressed.resize(pEntry->uiSize);
+	if (DecompressLZ4(pStored, pEntry->uiStoredSize, cAsset.vDecompressed.data(), pEntry->uiSize) == false)
+	{
+		cout << "CAssetArchive: " << sPath << " is damaged in " << sFilename << endl;
+		cAsset.vDecompressed.clear();
+		cAsset.pData = NULL;
+		cAsset.uiSize = 0;
+		return false;
+	}
+	uiNumDecompressed++;
+	cAsset.pData = cAsset.vDecompressed.data();
+	cAsset.uiSize = cAsset.vDecompressed.size();
+	return true;
+}
+
+/**
+ @brief Bring the pages of an asset into memory, so that its loader does not wait for the disk. An asset in the
+		archive has a byte of each of its pages read, which makes the system read the page from the file, and is
+		not decompressed. Any other asset is read from its file and discarded, which leaves it in the file cache
+		of the system. Call this on a worker thread
+ @param sPath A const std::string& containing the path of the asset
+ */
+void CAssetArchive::Prefetch(const std::string& sPath) const
+{
+	PROFILE_SCOPE_DETAIL("CAssetArchive::Prefetch", "asset", sPath);
+
+	const SEntry* pEntry = Find(sPath);
+	if (pEntry)
+	{
+		const volatile unsigned char* pStored = pArchive + pEntry->ullOffset;
+		unsigned char ucTouched = 0;
+		for (size_t i = 0; i < pEntry->uiStoredSize; i += ALIGNMENT)
+			ucTouched ^= pStored[i];
+		(void)ucTouched;
+		return;
+	}
+
+	ifstream file(FileSystem::getPath(sPath).c_str(), ios::binary);
+	std::vector<char> vBuffer(64 * 1024);
+	while (file.read(vBuffer.data(), vBuffer.size()))
+	{
+	}
+}
+
+/**
+ @brief Record the paths which Read is called with on this thread into a list, e.g. to prefetch the same assets
+		the next time. The paths of the assets which are not in the archive are recorded as well. The reads of the
+		other threads are not recorded, so that the list is not written to by the worker threads
+ @param pvReadRecord A std::vector<std::string>* which the paths are added to, or NULL to stop recording
+ */
+void CAssetArchive::SetReadRecord(std::vector<std::string>* pvReadRecord)
+{
+	// The thread is only changed while nothing is recorded, as the other threads compare it with theirs
+	if (pvReadRecord)
+		idRecordThread = std::this_thread::get_id();
+	this->pvReadRecord.store(pvReadRecord, std::memory_order_release);
+}
+
+/**
+ @brief Get the number of assets in the archive
+ */
+unsigned int CAssetArchive::GetNumAssets(void) const
+{
+	return uiNumEntries;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CAssetArchive::PrintSelf(void) const
+{
+	if (IsOpen() == false)
+	{
+		cout << "CAssetArchive: No archive is open" << endl;
+		return;
+	}
+
+	unsigned long long ullSize = 0;
+	unsigned long long ullStoredSize = 0;
+	unsigned int uiNumCompressed = 0;
+	for (unsigned int i = 0; i < uiNumEntries; i++)
+	{
+		ullSize += pEntries[i].uiSize;
+		ullStoredSize += pEntries[i].uiStoredSize;
+		if (pEntries[i].uiCompression != NONE)
+			uiNumCompressed++;
+	}
+	cout << "CAssetArchive: " << sFilename << " has " << uiNumEntries << " assets, " << uiNumCompressed << " compressed, "
+		<< ullStoredSize << " of " << ullSize << " bytes stored. " << uiNumReads << " reads, "
+		<< uiNumDecompressed << " decompressed" << endl;
+}
+
+/**
+ @brief Make an archive of the files with the extensions which the loaders read, in folders of the current
+		directory. The assets are named by their paths from the current directory, so run this from the App folder
+ @param sFilename A const std::string& containing the file name of the archive
+ @param vFolders A const std::vector<std::string>& containing the folders, e.g. Image, Sounds and Maps
+ @param bCompress A const bool which is true to compress the assets which become smaller enough
+ @param bCookTextures A const bool which is true to add the cooked texture of each image, as another asset
+ @return false if a file could not be read, or the archive could not be written
+ */
+bool CAssetArchive::Pack(const std::string& sFilename, const std::vector<std::string>& vFolders, const bool bCompress,
+	const bool bCookTextures)
+{
+	std::vector<std::string> vFiles;
+	for (unsigned int i = 0; i < vFolders.size(); i++)
+		ListFiles(vFolders[i], vFiles);
+
+	// The data of each asset, as it is stored, and its entry
+	std::vector<std::pair<SEntry, std::vector<unsigned char> > > vAssets;
+	std::vector<std::string> vNames;
+	unsigned long long ullSize = 0;
+	unsigned long long ullStoredSize = 0;
+	unsigned int uiNumCooked = 0;
+	// Add an asset, and compress it if it becomes smaller enough
+	auto AddAsset = [&](const std::string& sName, std::vector<unsigned char>& vData, const bool bCompressAsset)
+	{
+		SEntry sEntry;
+		memset(&sEntry, 0, sizeof(sEntry));
+		sEntry.ullHash = Hash(sName);
+		sEntry.uiSize = (unsigned int)vData.size();
+		sEntry.uiCompression = NONE;
+		sEntry.uiNameOffset = (unsigned int)vNames.size();
+
+		if (bCompressAsset)
+		{
+			std::vector<unsigned char> vCompressed;
+			CompressLZ4(vData.data(), vData.size(), vCompressed);
+			if (vCompressed.size() <= vData.size() * COMPRESSION_RATIO)
+			{
+				vData.swap(vCompressed);
+				sEntry.uiCompression = LZ4;
+			}
+		}
+		sEntry.uiStoredSize = (unsigned int)vData.size();
+		ullSize += sEntry.uiSize;
+		ullStoredSize += sEntry.uiStoredSize;
+
+		vNames.push_back(sName);
+		vAssets.push_back(std::make_pair(sEntry, std::vector<unsigned char>()));
+		vAssets.back().second.swap(vData);
+	};
+
+	for (unsigned int i = 0; i < vFiles.size(); i++)
+	{
+		if ((IsPackedExtension(vFiles[i]) == false) || (IsSaveGame(vFiles[i])))
+			continue;
+
+		ifstream file(vFiles[i].c_str(), ios::binary);
+		std::vector<unsigned char> vData((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+		if (file.bad())
+		{
+			cout << "CAssetArchive::Pack: Unable to read " << vFiles[i] << endl;
+			return false;
+		}
+
+		// The image is kept as well as its texture, for CImageLoader::Load and the images which cannot be cooked
+		std::vector<unsigned char> vCooked;
+		if ((bCookTextures) && (IsImageExtension(vFiles[i])))
+		{
+			if (CImageLoader::CookTexture(vData.data(), vData.size(), vCooked))
+			{
+				// The cooked textures are not compressed, so that they are uploaded from the mapped archive
+				// without being copied
+				AddAsset(CImageLoader::GetCookedName(vFiles[i]), vCooked, false);
+				uiNumCooked++;
+			}
+			else
+			{
+				cout << "CAssetArchive::Pack: Unable to cook " << vFiles[i] << ", so it is decoded when it is loaded" << endl;
+			}
+		}
+		AddAsset(GetAssetName(vFiles[i]), vData, bCompress);
+	}
+
+	// The index is sorted by the hashes, which Find searches. Two names with the same hash are both kept,
+	// and told apart by their names
+	std::sort(vAssets.begin(), vAssets.end(),
+		[&vNames](const std::pair<SEntry, std::vector<unsigned char> >& a, const std::pair<SEntry, std::vector<unsigned char> >& b)
+		{
+			if (a.first.ullHash != b.first.ullHash)
+				return a.first.ullHash < b.first.ullHash;
+			return vNames[a.first.uiNameOffset] < vNames[b.first.uiNameOffset];
+		});
+
+	// The names follow the index, and the data of the assets follows the names
+	std::string sNames;
+	for (unsigned int i = 0; i < vAssets.size(); i++)
+	{
+		const std::string& sName = vNames[vAssets[i].first.uiNameOffset];
+		if ((i > 0) && (sName == vNames[vAssets[i - 1].first.uiNameOffset]))
+		{
+			cout << "CAssetArchive::Pack: Two files are named " << sName << endl;
+			return false;
+		}
+		vAssets[i].first.uiNameOffset = (unsigned int)sNames.size();
+		sNames += sName;
+		sNames += '\0';
+	}
+
+	unsigned long long ullOffset = sizeof(SHeader) + vAssets.size() * sizeof(SEntry) + sNames.size();
+	for (unsigned int i = 0; i < vAssets.size(); i++)
+	{
+		ullOffset = (ullOffset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+		vAssets[i].first.ullOffset = ullOffset;
+		ullOffset += vAssets[i].first.uiStoredSize;
+	}
+
+	ofstream file(sFilename.c_str(), ios::binary | ios::trunc);
+	if (file.is_open() == false)
+	{
+		cout << "CAssetArchive::Pack: Unable to write " << sFilename << endl;
+		return false;
+	}
+
+	SHeader sHeader;
+	memcpy(sHeader.cMagic, szMagic, sizeof(szMagic));
+	sHeader.uiVersion = VERSION;
+	sHeader.uiNumEntries = (unsigned int)vAssets.size();
+	sHeader.uiNamesSize = (unsigned int)sNames.size();
+	file.write((const char*)&sHeader, sizeof(sHeader));
+	for (unsigned int i = 0; i < vAssets.size(); i++)
+		file.write((const char*)&vAssets[i].first, sizeof(SEntry));
+	file.write(sNames.data(), sNames.size());
+
+	const std::vector<char> vPadding(ALIGNMENT, 0);
+	for (unsigned int i = 0; i < vAssets.size(); i++)
+	{
+		file.write(vPadding.data(), (std::streamsize)(vAssets[i].first.ullOffset - (unsigned long long)file.tellp()));
+		file.write((const char*)vAssets[i].second.data(), vAssets[i].second.size());
+	}
+	if (file.good() == false)
+	{
+		cout << "CAssetArchive::Pack: Unable to write " << sFilename << endl;
+		return false;
+	}
+
+	cout << "CAssetArchive::Pack: Packed " << vAssets.size() << " assets into " << sFilename << ", of which "
+		<< uiNumCooked << " are cooked textures, " << ullStoredSize << " of " << ullSize << " bytes stored" << endl;
+	return true;
+}
+
+/**
+ @brief Get the name which an asset has in an archive. Its folders are separated by /, in lower case, and the
+		root which FileSystem::getPath adds is removed, so that the loaders can use either path
+ @param sPath A const std::string& containing the path of the asset
+ */
+std::string CAssetArchive::GetAssetName(const std::string& sPath)
+{
+	static const std::string sRoot = FileSystem::getPath("");
+	size_t uiStart = 0;
+	if ((sRoot.empty() == false) && (sPath.compare(0, sRoot.size(), sRoot) == 0))
+		uiStart = sRoot.size();
+
+	std::string sName;
+	sName.reserve(sPath.size() - uiStart);
+	for (size_t i = uiStart; i < sPath.size(); i++)
+	{
+		char cChar = sPath[i];
+		if (cChar == '\\')
+			cChar = '/';
+		// The paths of the game mix / and \, and sometimes repeat them
+		if ((cChar == '/') && ((sName.empty()) || (sName.back() == '/')))
+			continue;
+		// A ./ at the start of a folder is the same folder
+		if ((cChar == '.') && (i + 1 < sPath.size()) && ((sPath[i + 1] == '/') || (sPath[i + 1] == '\\'))
+			&& ((sName.empty()) || (sName.back() == '/')))
+		{
+			i++;
+			continue;
+		}
+		sName += (char)tolower((unsigned char)cChar);
+	}
+	return sName;
+}
+
+/**
+ @brief Find the entry of an asset, by a binary search of the hashes of the index
+ @param sPath A const std::string& containing the path of the asset
+ @return The entry, or NULL if there is no archive or the asset is not in it
+ */
+const CAssetArchive::SEntry* CAssetArchive::Find(const std::string& sPath) const
+{
+	if (pArchive == NULL)
+		return NULL;
+
+	const std::string sName = GetAssetName(sPath);
+	const unsigned long long ullHash = Hash(sName);
+	const SEntry* pEntry = std::lower_bound(pEntries, pEntries + uiNumEntries, ullHash,
+		[](const SEntry& sEntry, const unsigned long long ullValue)
+		{
+			return sEntry.ullHash < ullValue;
+		});
+	for (; (pEntry != pEntries + uiNumEntries) && (pEntry->ullHash == ullHash); pEntry++)
+	{
+		if (sName == pNames + pEntry->uiNameOffset)
+			return pEntry;
+	}
+	return NULL;
+}
+
+/**
+ @brief Check that the header, the index and the data of each asset of the mapped archive are inside the file,
+		so that a damaged archive is not read outside the mapping
+ */
+bool CAssetArchive::Validate(void) const
+{
+	const SHeader* pHeader = (const SHeader*)pArchive;
+	if ((memcmp(pHeader->cMagic, szMagic, sizeof(szMagic)) != 0) || (pHeader->uiVersion != VERSION))
+		return false;
+
+	const unsigned long long ullIndexEnd = sizeof(SHeader) + (unsigned long long)uiNumEntries * sizeof(SEntry) + pHeader->uiNamesSize;
+	if (ullIndexEnd > uiArchiveSize)
+		return false;
+	if ((pHeader->uiNamesSize > 0) && (pNames[pHeader->uiNamesSize - 1] != '\0'))
+		return false;
+
+	for (unsigned int i = 0; i < uiNumEntries; i++)
+	{
+		const SEntry& sEntry = pEntries[i];
+		if ((sEntry.uiNameOffset >= pHeader->uiNamesSize) || (sEntry.uiCompression >= NUM_COMPRESSIONS)
+			|| (sEntry.ullOffset < ullIndexEnd) || (sEntry.ullOffset + sEntry.uiStoredSize > uiArchiveSize)
+			|| ((sEntry.uiCompression == NONE) && (sEntry.uiStoredSize != sEntry.uiSize))
+			|| ((i > 0) && (pEntries[i - 1].ullHash > sEntry.ullHash)))
+			return false;
+	}
+	return true;
+}
+
+/**
+ @brief Get the hash of the name of an asset, with 64 bit FNV-1a
+ @param sName A const std::string& containing the name
+ */
+unsigned long long CAssetArchive::Hash(const std::string& sName)
+{
+	unsigned long long ullHash = 14695981039346656037ull;
+	for (size_t i = 0; i < sName.size(); i++)
+	{
+		ullHash ^= (unsigned char)sName[i];
+		ullHash *= 1099511628211ull;
+	}
+	return ullHash;
+}
@@ -0,0 +1,178 @@
+/**
+ CAssetArchive
+ @brief A class which reads the images, sounds and maps of the game from one archive file, instead of opening
+		each of their files. The archive is memory-mapped, and has an index of the assets which is sorted by the
+		hash of their names, so an asset is found without a search of the folders, and is read as a view of the
+		mapped file without a copy. Assets which the Packer compressed are decompressed when they are read.
+		The Packer makes the archive from the asset folders. The assets which are not in the archive are read
+		from their files as before
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+#include <string>
+#include <vector>
+#include <streambuf>
+#include <atomic>
+#include <thread>
+
+class CAssetArchive;
+
+/**
+ CAsset
+ @brief The data of an asset which was read from a CAssetArchive
+ */
+class CAsset
+{
+	friend CAssetArchive;
+public:
+	// Constructor
+	CAsset(void);
+
+	// Get the data of the asset
+	const unsigned char* GetData(void) const;
+	// Get the number of bytes of the data
+	size_t GetSize(void) const;
+
+	// Check if the data is a view of the mapped archive, which stays valid until the archive is closed,
+	// instead of a copy which is freed with this CAsset
+	bool IsMapped(void) const;
+
+protected:
+	const unsigned char* pData;
+	size_t uiSize;
+	// The data of a compressed asset, once it was decompressed
+	std::vector<unsigned char> vDecompressed;
+};
+
+/**
+ CAssetStreamBuf
+ @brief A stream buffer which reads the data of a CAsset, so that an asset can be given to a loader which reads
+		from a std::istream. The CAsset must outlive it
+ */
+class CAssetStreamBuf : public std::streambuf
+{
+public:
+	// Constructor
+	explicit CAssetStreamBuf(const CAsset& cAsset);
+
+protected:
+	// Seek to a position relative to the start, the current position or the end
+	virtual pos_type seekoff(off_type iOffset, std::ios_base::seekdir eDirection, std::ios_base::openmode eMode);
+	// Seek to a position from the start
+	virtual pos_type seekpos(pos_type iPosition, std::ios_base::openmode eMode);
+};
+
+class CAssetArchive : public CSingletonTemplate<CAssetArchive>
+{
+	friend CSingletonTemplate<CAssetArchive>;
+public:
+	// The ways that an asset can be stored
+	enum COMPRESSION
+	{
+		NONE = 0,
+		// The LZ4 block format
+		LZ4,
+		NUM_COMPRESSIONS
+	};
+
+	// The data of each asset starts at a multiple of this, so that the pages of an asset are not shared with
+	// the asset before it
+	enum { ALIGNMENT = 4096 };
+
+	// Map an archive which the Packer made
+	bool Open(const std::string& sFilename);
+	// Unmap the archive. The views of its assets are no longer valid
+	void Close(void);
+	// Check if an archive is open
+	bool IsOpen(void) const;
+
+	// Check if an asset is in the archive
+	bool Contains(const std::string& sPath) const;
+	// Read an asset from the archive. Returns false if there is no archive, or the asset is not in it
+	bool Read(const std::string& sPath, CAsset& cAsset) const;
+	// Bring the pages of an asset into memory, from the archive if it is in it or else from its file, so that
+	// its loader does not wait for the disk. Call this on a worker thread
+	void Prefetch(const std::string& sPath) const;
+	// Record the paths which Read is called with on this thread into a list until it is set to NULL, e.g. to
+	// prefetch the same assets the next time. The reads of the other threads are not recorded
+	void SetReadRecord(std::vector<std::string>* pvReadRecord);
+
+	// Get the number of assets in the archive
+	unsigned int GetNumAssets(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+	// Make an archive of the files with the extensions which the loaders read, in folders of the current directory.
+	// The images are also cooked into the textures which CImageLoader uploads without decoding them
+	static bool Pack(const std::string& sFilename, const std::vector<std::string>& vFolders, const bool bCompress = true,
+		const bool bCookTextures = true);
+
+	// Get the name which an asset has in an archive. Its folders are separated by /, in lower case, and the root
+	// which FileSystem::getPath adds is removed, so that the loaders can use either path
+	static std::string GetAssetName(const std::string& sPath);
+
+protected:
+	// The start of an archive
+	struct SHeader
+	{
+		char cMagic[4];
+		unsigned int uiVersion;
+		unsigned int uiNumEntries;
+		unsigned int uiNamesSize;
+	};
+
+	// An asset in the index of an archive. The entries follow the header, sorted by their hashes,
+	// and the names of the assets follow the entries
+	struct SEntry
+	{
+		unsigned long long ullHash;
+		unsigned long long ullOffset;
+		unsigned int uiStoredSize;
+		unsigned int uiSize;
+		unsigned int uiCompression;
+		unsigned int uiNameOffset;
+	};
+
+	// The mapped archive
+	const unsigned char* pArchive;
+	size_t uiArchiveSize;
+	const SEntry* pEntries;
+	unsigned int uiNumEntries;
+	const char* pNames;
+	std::string sFilename;
+
+	// The handles of the mapped file
+#ifdef _WIN32
+	void* hFile;
+	void* hMapping;
+#else
+	int iFile;
+#endif
+
+	// Statistics
+	mutable std::atomic<unsigned int> uiNumReads;
+	mutable std::atomic<unsigned int> uiNumDecompressed;
+
+	// The list which the reads are recorded into, or NULL, and the thread whose reads are recorded
+	std::atomic<std::vector<std::string>*> pvReadRecord;
+	std::thread::id idRecordThread;
+
+	// Constructor
+	CAssetArchive(void);
+
+	// Destructor
+	virtual ~CAssetArchive(void);
+
+	// Find the entry of an asset, or NULL if it is not in the archive
+	const SEntry* Find(const std::string& sPath) const;
+
+	// Check that the index of the mapped archive is inside the file
+	bool Validate(void) const;
+
+	// Get the hash of the name of an asset
+	static unsigned long long Hash(const std::string& sName);
+};
@@ -6,7 +6,13 @@
  */
 #include "ImageLoader.h"
 
+// Include CProfiler, to show the image loads in the traces
+#include "../TimeControl/Profiler.h"
+
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <limits>
 using namespace std;
 
 // Include GLEW
@@ -22,18 +28,113 @@ using namespace std;
 #include <includes/stb_image.h>
 #include "filesystem.h"
 
+// Include CNullGLBackend, to give the textures names in the headless mode
+#include "../RenderControl/NullGLBackend.h"
+// Include CRenderStats, to count the texture binds and uploads
+#include "../RenderControl/RenderStats.h"
+// Include CResourceTracker, to track the textures which are created
+#include "ResourceTracker.h"
+// Include CAssetArchive, to read the images from the archive instead of their files
+#include "AssetArchive.h"
+
+// The start of every cooked texture, the version of its layout, and the end of the name of its asset
+static const char szCookedMagic[4] = { 'N', 'Y', 'P', 'T' };
+static const unsigned int COOKED_VERSION = 2;
+static const char* const szCookedSuffix = ".cooked";
+
+/**
+ @brief Get the OpenGL format of the pixels of an image
+ @param nrChannels A const int containing the number of channels of the image
+ @return The format, or 0 if the image has a number of channels which is not uploaded
+ */
+static GLenum GetPixelFormat(const int nrChannels)
+{
+	if (nrChannels == 1)
+		return GL_LUMINANCE;
+	else if (nrChannels == 3)
+		return GL_RGB;
+	else if (nrChannels == 4)
+		return GL_RGBA;
+	return 0;
+}
+
+/**
+ @brief Flip the rows of an image, so that its first row is its bottom row
+ @param data An unsigned char* containing the pixels of the image
+ @param width A const int containing the width of the image
+ @param height A const int containing the height of the image
+ @param nrChannels A const int containing the number of channels of the image
+ */
+static void FlipRows(unsigned char* data, const int width, const int height, const int nrChannels)
+{
+	const size_t uiRowSize = (size_t)width * nrChannels;
+	std::vector<unsigned char> vRow(uiRowSize);
+	for (int iRow = 0; iRow < height / 2; iRow++)
+	{
+		unsigned char* pTop = data + iRow * uiRowSize;
+		unsigned char* pBottom = data + (height - 1 - iRow) * uiRowSize;
+		memcpy(vRow.data(), pTop, uiRowSize);
+		memcpy(pTop, pBottom, uiRowSize);
+		memcpy(pBottom, vRow.data(), uiRowSize);
+	}
+}
+
+/**
+ @brief Decode an image, from the asset archive if it is in it, or else from its file. The images are flipped
+		here instead of by stb_image, whose flag is shared by all of the threads, so that the images can be
+		decoded on the worker threads
+ @param filename A const char* storing the name of the image file
+ @param width A int variable passed in by reference. It stores the width of the image.
+ @param height A int variable passed in by reference. It stores the height of the image.
+ @param nrChannels A int variable passed in by reference. It stores the number of channels in the image.
+ @param bInvert A const bool which is true to flip the image on the y-axis
+ @return The pixels, which are freed with stbi_image_free, or NULL if the image could not be loaded
+ */
+static unsigned char* DecodeImage(const char* filename, int& width, int& height, int& nrChannels, const bool bInvert)
+{
+	unsigned char* data = NULL;
+	CAsset cAsset;
+	if (CAssetArchive::GetInstance()->Read(filename, cAsset))
+		data = stbi_load_from_memory(cAsset.GetData(), (int)cAsset.GetSize(), &width, &height, &nrChannels, 0);
+	else
+		data = stbi_load(FileSystem::getPath(filename).c_str(), &width, &height, &nrChannels, 0);
+
+	if ((data) && (bInvert))
+		FlipRows(data, width, height, nrChannels);
+	return data;
+}
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 CImageLoader::CImageLoader(void)
+	: uiPixelBuffer(0)
+	, pvLoadRecord(NULL)
 {
 }
 
 /**
- @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton.
+		The images which are still being decoded are waited for, and are not uploaded
  */
 CImageLoader::~CImageLoader(void)
 {
+	CancelPreloads();
+	CJobSystem::GetInstance()->Wait(cTextureJobs);
+	CJobSystem::GetInstance()->Wait(cPreloadJobs);
+	for (unsigned int i = 0; i < dequeTextureLoads.size(); i++)
+	{
+		ReleaseImage(dequeTextureLoads[i]->pImage);
+		delete dequeTextureLoads[i];
+	}
+	dequeTextureLoads.clear();
+	FreeReleasedImages();
+
+	if (uiPixelBuffer != 0)
+	{
+		glDeleteBuffers(1, &uiPixelBuffer);
+		uiPixelBuffer = 0;
+	}
 }
 
 /**
@@ -54,17 +155,25 @@ bool CImageLoader::Init(void)
  */
 unsigned char * CImageLoader::Load(const char* filename, int& width, int& height, int& nrChannels, const bool bInvert)
 {
-	// tell stb_image.h to flip loaded texture's on the y-axis.
-	stbi_set_flip_vertically_on_load(bInvert);
+	PROFILE_SCOPE_DETAIL("CImageLoader::Load", "asset", filename);
 
-	// load image, create texture and generate mipmaps
-	unsigned char *data = stbi_load(FileSystem::getPath(filename).c_str(),
-									&width, &height, &nrChannels, 0);
+	// load image
+	unsigned char *data = DecodeImage(filename, width, height, nrChannels, bInvert);
 
 	// Return the data but you must remember to free up the memory of the file data read in
 	return data;
 }
 
+/**
+ @brief Free the data of an image which was returned by Load
+ @param data An unsigned char* containing the data of the image, or NULL
+ */
+void CImageLoader::Free(unsigned char* data)
+{
+	if (data)
+		stbi_image_free(data);
+}
+
 /**
  @brief Load an image into the graphics card and return its ID.
  @param filename A const char* storing the name of the image file
@@ -72,17 +181,41 @@ unsigned char * CImageLoader::Load(const char* filename, int& width, int& height
  */
 unsigned int CImageLoader::LoadTextureGetID(const char* filename,  const bool bInvert)
 {
+	PROFILE_SCOPE_DETAIL("CImageLoader::LoadTextureGetID", "asset", filename);
+	if (pvLoadRecord)
+		pvLoadRecord->push_back(std::make_pair(std::string(filename), bInvert));
+
+	// Upload the cooked texture if the archive has one, so that the image is not decoded
+	CAsset cCooked;
+	if (CAssetArchive::GetInstance()->Read(GetCookedName(filename), cCooked))
+	{
+		const unsigned int uiTexture = LoadCookedTexture(cCooked, bInvert);
+		if (uiTexture != 0)
+			return uiTexture;
+		cout << "CImageLoader::LoadTextureGetID(): The cooked texture of " << filename << " is damaged or out of date, so the image is decoded" << endl;
+	}
+
 	// Load from file
 	int image_width = 0;
 	int image_height = 0;
 	int nrChannels = 0;
 
-	// tell stb_image.h to flip loaded texture's on the y-axis.
-	stbi_set_flip_vertically_on_load(bInvert);
-
-	// load image, create texture and generate mipmaps
-	unsigned char* data = stbi_load(FileSystem::getPath(filename).c_str(),
-		&image_width, &image_height, &nrChannels, 0);
+	// Take the pixels of the image if it was preloaded, or else decode it. An image which is still being
+	// preloaded is decoded here as well, instead of waiting for the jobs of the other preloads
+	unsigned char* data = NULL;
+	const SDecodedImage* pPreloadedImage = FindPreloadedImage(filename, bInvert);
+	if ((pPreloadedImage) && (pPreloadedImage->bDecoded.load(std::memory_order_acquire)) && (pPreloadedImage->pPixels))
+	{
+		data = pPreloadedImage->pPixels;
+		image_width = pPreloadedImage->iWidth;
+		image_height = pPreloadedImage->iHeight;
+		nrChannels = pPreloadedImage->iNumChannels;
+	}
+	else
+	{
+		pPreloadedImage = NULL;
+		data = DecodeImage(filename, image_width, image_height, nrChannels, bInvert);
+	}
 
 	if (data == NULL)
 	{
@@ -91,9 +224,95 @@ unsigned int CImageLoader::LoadTextureGetID(const char* filename,  const bool bI
 	}
 
 	// Create a OpenGL texture identifier
-	GLuint image_texture;
+	GLuint image_texture = CreateTexture();
+
+	// Upload pixels into texture
+#if defined(GL_UNPACK_ROW_LENGTH) && !defined(__EMSCRIPTEN__)
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+	const GLenum ePixelFormat = GetPixelFormat(nrChannels);
+	if (ePixelFormat != 0)
+		glTexImage2D(GL_TEXTURE_2D, 0, ePixelFormat, image_width, image_height, 0, ePixelFormat, GL_UNSIGNED_BYTE, data);
+	RENDER_STATS_ADD(UPLOADS, 1);
+	RENDER_STATS_ADD(UPLOADED_BYTES, image_width * image_height * nrChannels);
+#ifndef RESOURCE_TRACKER_DISABLED
+	CResourceTracker::GetInstance()->AddTexture(image_texture, (unsigned long long)image_width * image_height * nrChannels);
+#endif
+	
+	// No mipmaps are generated, as the textures are minified with GL_LINEAR, which only samples the image
+//	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	// The pixels of a preloaded image are kept for the other textures of the same image
+	if (pPreloadedImage == NULL)
+		stbi_image_free(data);
+
+	return image_texture;
+}
+
+
+/**
+ @brief Decode an image file into a cooked texture, which LoadTextureGetID uploads without decoding it.
+		The pixels are kept in the channels of the image, with their rows from the bottom. No mipmaps are
+		cooked, as the textures are minified with GL_LINEAR, which never samples them
+ @param pFileData A const unsigned char* containing the data of the image file
+ @param uiFileSize A const size_t containing the number of bytes of the image file
+ @param vCooked A std::vector<unsigned char>& which the cooked texture is stored in
+ @return false if the image could not be decoded, or has a number of channels which is not uploaded
+ */
+bool CImageLoader::CookTexture(const unsigned char* pFileData, const size_t uiFileSize, std::vector<unsigned char>& vCooked)
+{
+	int image_width = 0;
+	int image_height = 0;
+	int nrChannels = 0;
+
+	unsigned char* data = stbi_load_from_memory(pFileData, (int)uiFileSize, &image_width, &image_height, &nrChannels, 0);
+	if (data == NULL)
+		return false;
+	if (GetPixelFormat(nrChannels) == 0)
+	{
+		stbi_image_free(data);
+		return false;
+	}
+	// Most of the images are loaded flipped, so those can be uploaded from the cooked texture as they are
+	FlipRows(data, image_width, image_height, nrChannels);
+
+	SCookedTexture sHeader;
+	memcpy(sHeader.cMagic, szCookedMagic, sizeof(szCookedMagic));
+	sHeader.uiVersion = COOKED_VERSION;
+	sHeader.uiWidth = (unsigned int)image_width;
+	sHeader.uiHeight = (unsigned int)image_height;
+	sHeader.uiChannels = (unsigned int)nrChannels;
+
+	vCooked.assign((const unsigned char*)&sHeader, (const unsigned char*)&sHeader + sizeof(sHeader));
+	vCooked.insert(vCooked.end(), data, data + (size_t)image_width * image_height * nrChannels);
+	stbi_image_free(data);
+	return true;
+}
+
+/**
+ @brief Get the name of the cooked texture of an image in a CAssetArchive
+ @param sFilename A const std::string& containing the name of the image file
+ */
+std::string CImageLoader::GetCookedName(const std::string& sFilename)
+{
+	return CAssetArchive::GetAssetName(sFilename) + szCookedSuffix;
+}
+
+/**
+ @brief Create a texture with the filtering parameters of the images, and bind it
+ @return The ID of the texture
+ */
+unsigned int CImageLoader::CreateTexture(void)
+{
+	// Create a OpenGL texture identifier
+	GLuint image_texture = 0;
 	glGenTextures(1, &image_texture);
+	// Without an OpenGL context no name is given, and 0 would be taken as a texture which failed to load
+	if ((image_texture == 0) && (CNullGLBackend::IsInstalled()))
+		image_texture = CNullGLBackend::GenTexture();
+	// The name may be reused from a texture which was deleted after its image failed to load
+	setFailedTextures.erase(image_texture);
 	glBindTexture(GL_TEXTURE_2D, image_texture);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
 
 	// Setup filtering parameters for display
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -101,22 +320,419 @@ unsigned int CImageLoader::LoadTextureGetID(const char* filename,  const bool bI
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); // This is required on WebGL for non power-of-two textures
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE); // Same
 
-	// Upload pixels into texture
+	return image_texture;
+}
+
+/**
+ @brief Upload a cooked texture, straight from the archive for the images which are flipped
+ @param cCooked A const CAsset& containing the cooked texture
+ @param bInvert A const bool which is false to upload the rows from the top instead
+ @return The ID of the texture, or 0 if the cooked texture is damaged, or was cooked in another version
+ */
+unsigned int CImageLoader::LoadCookedTexture(const CAsset& cCooked, const bool bInvert)
+{
+	if (cCooked.GetSize() < sizeof(SCookedTexture))
+		return 0;
+	SCookedTexture sHeader;
+	memcpy(&sHeader, cCooked.GetData(), sizeof(sHeader));
+	const GLenum ePixelFormat = GetPixelFormat((int)sHeader.uiChannels);
+	if ((memcmp(sHeader.cMagic, szCookedMagic, sizeof(szCookedMagic)) != 0) || (sHeader.uiVersion != COOKED_VERSION)
+		|| (ePixelFormat == 0) || (sHeader.uiWidth == 0) || (sHeader.uiHeight == 0))
+		return 0;
+
+	// Check that all of the pixels are in the asset
+	const size_t uiRowSize = (size_t)sHeader.uiWidth * sHeader.uiChannels;
+	const size_t uiPixelsSize = uiRowSize * sHeader.uiHeight;
+	if (sizeof(SCookedTexture) + uiPixelsSize != cCooked.GetSize())
+		return 0;
+
+	GLuint image_texture = CreateTexture();
+
+	const unsigned char* pPixels = cCooked.GetData() + sizeof(SCookedTexture);
+	if (bInvert == false)
+	{
+		// The cooked rows are from the bottom, so they are copied in the other order
+		vUnflipped.resize(uiPixelsSize);
+		for (unsigned int uiRow = 0; uiRow < sHeader.uiHeight; uiRow++)
+			memcpy(&vUnflipped[uiRow * uiRowSize], pPixels + (sHeader.uiHeight - 1 - uiRow) * uiRowSize, uiRowSize);
+		pPixels = vUnflipped.data();
+	}
+
+	// Upload pixels into texture. The rows of the images are not padded to 4 bytes
 #if defined(GL_UNPACK_ROW_LENGTH) && !defined(__EMSCRIPTEN__)
 	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 #endif
-	if (nrChannels == 1)
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, image_width, image_height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, data);
-	else if (nrChannels == 3)
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, image_width, image_height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-	else if (nrChannels == 4)
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-	
-	// Generate mipmaps
-	glGenerateMipmap(GL_TEXTURE_2D);
-//	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-	stbi_image_free(data);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, ePixelFormat, sHeader.uiWidth, sHeader.uiHeight, 0, ePixelFormat, GL_UNSIGNED_BYTE, pPixels);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	RENDER_STATS_ADD(UPLOADS, 1);
+	RENDER_STATS_ADD(UPLOADED_BYTES, uiPixelsSize);
+#ifndef RESOURCE_TRACKER_DISABLED
+	CResourceTracker::GetInstance()->AddTexture(image_texture, (unsigned long long)uiPixelsSize);
+#endif
 
 	return image_texture;
 }
 
+/**
+ @brief Create a texture which is transparent until its image is decoded on a worker thread and uploaded by
+		UploadTextures, and return its ID. The ID stays the same once the image is uploaded, so it can be used
+		at once. A cooked texture is uploaded at once instead, as it is not decoded, and so are the images
+		when there are no worker threads to decode them
+ @param filename A const char* storing the name of the image file
+ @param bInvert A const bool which is true to flip the image on the y-axis
+ */
+unsigned int CImageLoader::LoadTextureAsync(const char* filename, const bool bInvert)
+{
+	if ((CJobSystem::GetInstance()->GetNumWorkers() == 0) || (CAssetArchive::GetInstance()->Contains(GetCookedName(filename))))
+		return LoadTextureGetID(filename, bInvert);
+
+	PROFILE_SCOPE_DETAIL("CImageLoader::LoadTextureAsync", "asset", filename);
+	if (pvLoadRecord)
+		pvLoadRecord->push_back(std::make_pair(std::string(filename), bInvert));
+
+	GLuint image_texture = CreateTexture();
+	const unsigned char ucPlaceholder[4] = { 0, 0, 0, 0 };
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, ucPlaceholder);
+	RENDER_STATS_ADD(UPLOADS, 1);
+	RENDER_STATS_ADD(UPLOADED_BYTES, sizeof(ucPlaceholder));
+
+	STextureLoad* pTextureLoad = new STextureLoad();
+	pTextureLoad->uiTexture = image_texture;
+	pTextureLoad->uiTag = 0;
+	// A preloaded image is uploaded once it is decoded, even if it is still being decoded
+	pTextureLoad->pImage = FindPreloadedImage(filename, bInvert);
+	if (pTextureLoad->pImage)
+		pTextureLoad->pImage->uiNumUsers++;
+	else
+		pTextureLoad->pImage = DecodeImageAsync(filename, bInvert, cTextureJobs);
+#ifndef RESOURCE_TRACKER_DISABLED
+	pTextureLoad->uiTag = CResourceTracker::GetCurrentTag();
+	CResourceTracker::GetInstance()->AddTexture(image_texture, sizeof(ucPlaceholder));
+#endif
+	dequeTextureLoads.push_back(pTextureLoad);
+
+	return image_texture;
+}
+
+/**
+ @brief Upload the textures whose images were decoded, until a time budget is used up. At least one texture is
+		uploaded, so that a big image is not put off for ever. Call this on the main thread once a frame
+ @param dBudget A const double containing the time in seconds which the uploads may take
+ */
+void CImageLoader::UploadTextures(const double dBudget)
+{
+	FreeReleasedImages();
+
+	if (dequeTextureLoads.empty())
+		return;
+
+	PROFILE_SCOPE_CATEGORY("CImageLoader::UploadTextures", "asset");
+
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	std::deque<STextureLoad*>::iterator it = dequeTextureLoads.begin();
+	while (it != dequeTextureLoads.end())
+	{
+		STextureLoad* pTextureLoad = *it;
+		if (pTextureLoad->pImage->bDecoded.load(std::memory_order_acquire) == false)
+		{
+			++it;
+			continue;
+		}
+
+		if (UploadTexture(pTextureLoad) == false)
+			setFailedTextures.insert(pTextureLoad->uiTexture);
+		ReleaseImage(pTextureLoad->pImage);
+		delete pTextureLoad;
+		it = dequeTextureLoads.erase(it);
+
+		if (std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count() >= dBudget)
+			break;
+	}
+
+	// The pixel buffer is deleted once no texture is loading, so that it does not keep the size of the biggest image
+	if ((dequeTextureLoads.empty()) && (uiPixelBuffer != 0))
+	{
+		glDeleteBuffers(1, &uiPixelBuffer);
+		uiPixelBuffer = 0;
+	}
+}
+
+/**
+ @brief Wait for all of the textures which are loading, and upload them. The main thread helps to decode them.
+		The preloads are waited for as well, as some of the textures may be uploaded from them
+ @return false if the image of any of the textures failed to load, so that it stays transparent
+ */
+bool CImageLoader::FinishTextures(void)
+{
+	if (dequeTextureLoads.empty())
+		return true;
+
+	PROFILE_SCOPE_CATEGORY("CImageLoader::FinishTextures", "asset");
+	const size_t uiNumFailed = setFailedTextures.size();
+	CJobSystem::GetInstance()->Wait(cTextureJobs);
+	CJobSystem::GetInstance()->Wait(cPreloadJobs);
+	UploadTextures(std::numeric_limits<double>::max());
+	return setFailedTextures.size() == uiNumFailed;
+}
+
+/**
+ @brief Check if the image of a texture from LoadTextureAsync was uploaded
+ @param uiTexture A const unsigned int containing the ID of the texture
+ @return true if the texture is not loading and its image did not fail to load
+ */
+bool CImageLoader::IsTextureLoaded(const unsigned int uiTexture) const
+{
+	for (unsigned int i = 0; i < dequeTextureLoads.size(); i++)
+	{
+		if (dequeTextureLoads[i]->uiTexture == uiTexture)
+			return false;
+	}
+	return IsTextureFailed(uiTexture) == false;
+}
+
+/**
+ @brief Check if the image of a texture from LoadTextureAsync failed to load. The texture is left transparent
+ @param uiTexture A const unsigned int containing the ID of the texture
+ */
+bool CImageLoader::IsTextureFailed(const unsigned int uiTexture) const
+{
+	return setFailedTextures.count(uiTexture) != 0;
+}
+
+/**
+ @brief Get the number of textures from LoadTextureAsync whose images failed to load
+ */
+unsigned int CImageLoader::GetNumFailedTextures(void) const
+{
+	return (unsigned int)setFailedTextures.size();
+}
+
+/**
+ @brief Get the number of textures which are still loading
+ */
+unsigned int CImageLoader::GetNumLoadingTextures(void) const
+{
+	return (unsigned int)dequeTextureLoads.size();
+}
+
+/**
+ @brief Decode an image on a worker thread before it is loaded, e.g. for a scene which is likely to be started
+		next. The pixels are kept until CancelPreloads, so that LoadTextureGetID and LoadTextureAsync upload them
+		without decoding the image again. A cooked texture is not preloaded, as it is not decoded, and nothing is
+		preloaded when there are no worker threads
+ @param filename A const char* storing the name of the image file
+ @param bInvert A const bool which is true to flip the image on the y-axis, as it will be loaded
+ */
+void CImageLoader::PreloadImage(const char* filename, const bool bInvert)
+{
+	if ((CJobSystem::GetInstance()->GetNumWorkers() == 0) || (CAssetArchive::GetInstance()->Contains(GetCookedName(filename))))
+		return;
+	if (FindPreloadedImage(filename, bInvert))
+		return;
+
+	mapPreloadedImages[std::make_pair(CAssetArchive::GetAssetName(filename), bInvert)] = DecodeImageAsync(filename, bInvert, cPreloadJobs);
+}
+
+/**
+ @brief Discard the preloaded images which were not loaded. The textures which are being uploaded from a
+		preloaded image keep it until they are uploaded, and the images which have not started decoding are skipped
+ */
+void CImageLoader::CancelPreloads(void)
+{
+	std::map<std::pair<std::string, bool>, SDecodedImage*>::iterator it;
+	for (it = mapPreloadedImages.begin(); it != mapPreloadedImages.end(); ++it)
+		ReleaseImage(it->second);
+	mapPreloadedImages.clear();
+}
+
+/**
+ @brief Get the number of preloaded images
+ */
+unsigned int CImageLoader::GetNumPreloadedImages(void) const
+{
+	return (unsigned int)mapPreloadedImages.size();
+}
+
+/**
+ @brief Get the number of preloaded images which were decoded
+ */
+unsigned int CImageLoader::GetNumDecodedPreloads(void) const
+{
+	unsigned int uiNumDecoded = 0;
+	std::map<std::pair<std::string, bool>, SDecodedImage*>::const_iterator it;
+	for (it = mapPreloadedImages.begin(); it != mapPreloadedImages.end(); ++it)
+	{
+		if (it->second->bDecoded.load(std::memory_order_acquire))
+			uiNumDecoded++;
+	}
+	return uiNumDecoded;
+}
+
+/**
+ @brief Record the images which LoadTextureGetID and LoadTextureAsync load, and whether they are flipped, into a
+		list, e.g. to preload them the next time. An image is recorded each time that it is loaded. Call this on
+		the main thread
+ @param pvLoadRecord A std::vector<std::pair<std::string, bool> >* which the images are added to, or NULL to
+		stop recording
+ */
+void CImageLoader::SetLoadRecord(std::vector<std::pair<std::string, bool> >* pvLoadRecord)
+{
+	this->pvLoadRecord = pvLoadRecord;
+}
+
+/**
+ @brief Schedule the decoding of an image on the worker threads
+ @param filename A const char* storing the name of the image file
+ @param bInvert A const bool which is true to flip the image on the y-axis
+ @param cCounter A CJobCounter& which counts the job
+ @return The image, which has one user
+ */
+CImageLoader::SDecodedImage* CImageLoader::DecodeImageAsync(const char* filename, const bool bInvert, CJobCounter& cCounter)
+{
+	SDecodedImage* pImage = new SDecodedImage();
+	pImage->sFilename = filename;
+	pImage->bInvert = bInvert;
+	pImage->pPixels = NULL;
+	pImage->iWidth = 0;
+	pImage->iHeight = 0;
+	pImage->iNumChannels = 0;
+	pImage->bDecoded = false;
+	pImage->bCancelled = false;
+	pImage->uiNumUsers = 1;
+
+	CJobSystem::GetInstance()->Schedule([pImage]() { DecodeTexture(pImage); }, &cCounter);
+	return pImage;
+}
+
+/**
+ @brief Remove a user of an image. The image is freed after its last user, once it has finished decoding
+ @param pImage A SDecodedImage* containing the image
+ */
+void CImageLoader::ReleaseImage(SDecodedImage* pImage)
+{
+	if (--pImage->uiNumUsers > 0)
+		return;
+
+	pImage->bCancelled.store(true, std::memory_order_relaxed);
+	vReleasedImages.push_back(pImage);
+	FreeReleasedImages();
+}
+
+/**
+ @brief Free the released images whose jobs have finished. The others are freed by a later call
+ */
+void CImageLoader::FreeReleasedImages(void)
+{
+	std::vector<SDecodedImage*>::iterator it = vReleasedImages.begin();
+	while (it != vReleasedImages.end())
+	{
+		SDecodedImage* pImage = *it;
+		if (pImage->bDecoded.load(std::memory_order_acquire) == false)
+		{
+			++it;
+			continue;
+		}
+
+		Free(pImage->pPixels);
+		delete pImage;
+		it = vReleasedImages.erase(it);
+	}
+}
+
+/**
+ @brief Find a preloaded image, by the name of its asset, so that the folders can be separated by / or by \
+ @param filename A const char* storing the name of the image file
+ @param bInvert A const bool which is true if the image is flipped on the y-axis
+ @return The image, or NULL if it was not preloaded
+ */
+CImageLoader::SDecodedImage* CImageLoader::FindPreloadedImage(const char* filename, const bool bInvert) const
+{
+	if (mapPreloadedImages.empty())
+		return NULL;
+
+	std::map<std::pair<std::string, bool>, SDecodedImage*>::const_iterator it
+		= mapPreloadedImages.find(std::make_pair(CAssetArchive::GetAssetName(filename), bInvert));
+	return (it != mapPreloadedImages.end()) ? it->second : NULL;
+}
+
+/**
+ @brief Decode an image of a texture which is loading, or of a preload. This runs on the worker threads.
+		An image which nothing uses any more is not decoded
+ @param pImage A SDecodedImage* containing the image
+ */
+void CImageLoader::DecodeTexture(SDecodedImage* pImage)
+{
+	if (pImage->bCancelled.load(std::memory_order_relaxed) == false)
+	{
+		PROFILE_SCOPE_DETAIL("CImageLoader::DecodeTexture", "asset", pImage->sFilename);
+
+		pImage->pPixels = DecodeImage(pImage->sFilename.c_str(), pImage->iWidth, pImage->iHeight,
+			pImage->iNumChannels, pImage->bInvert);
+	}
+	// The release makes the pixels visible to the main thread before it sees that they were decoded
+	pImage->bDecoded.store(true, std::memory_order_release);
+}
+
+/**
+ @brief Upload the image of a texture which was decoded, into its texture. The pixels are copied into the
+		pixel buffer, so that glTexImage2D returns without the driver copying them
+ @param pTextureLoad A STextureLoad* containing the texture
+ @return false if the image failed to load, so that the texture stays transparent
+ */
+bool CImageLoader::UploadTexture(STextureLoad* pTextureLoad)
+{
+	const SDecodedImage* pImage = pTextureLoad->pImage;
+	PROFILE_SCOPE_DETAIL("CImageLoader::UploadTexture", "asset", pImage->sFilename);
+
+	const GLenum ePixelFormat = GetPixelFormat(pImage->iNumChannels);
+	if ((pImage->pPixels == NULL) || (ePixelFormat == 0))
+	{
+		// The texture stays transparent
+		cout << "CImageLoader::UploadTextures(): Unable to load " << FileSystem::getPath(pImage->sFilename).c_str() << endl;
+		return false;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, pTextureLoad->uiTexture);
+	RENDER_STATS_ADD(TEXTURE_BINDS, 1);
+
+	// The upload is counted by glBufferData
+	const size_t uiSize = (size_t)pImage->iWidth * pImage->iHeight * pImage->iNumChannels;
+	const unsigned char* pUpload = pImage->pPixels;
+	if (uiPixelBuffer == 0)
+		glGenBuffers(1, &uiPixelBuffer);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uiPixelBuffer);
+	// The buffer gets new storage for each image, so that the upload of the image before it is not waited for
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, uiSize, NULL, GL_STREAM_DRAW);
+	void* pBuffer = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, uiSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (pBuffer)
+	{
+		memcpy(pBuffer, pImage->pPixels, uiSize);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		// The pixels are read from the start of the bound pixel buffer
+		pUpload = NULL;
+	}
+	else
+	{
+		// Nothing is mapped without an OpenGL context, so the pixels are uploaded from memory
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+
+#if defined(GL_UNPACK_ROW_LENGTH) && !defined(__EMSCRIPTEN__)
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+	// The rows of the images are not padded to 4 bytes
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, ePixelFormat, pImage->iWidth, pImage->iHeight, 0, ePixelFormat, GL_UNSIGNED_BYTE, pUpload);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+#ifndef RESOURCE_TRACKER_DISABLED
+	// The texture is counted again with the bytes of its image, in the tag which it was created with
+	CResourceTag cResourceTag(pTextureLoad->uiTag);
+	CResourceTracker::GetInstance()->RemoveTexture(pTextureLoad->uiTexture);
+	CResourceTracker::GetInstance()->AddTexture(pTextureLoad->uiTexture, (unsigned long long)uiSize);
+#endif
+
+	return true;
+}
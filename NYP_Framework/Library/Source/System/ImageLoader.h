@@ -15,6 +15,18 @@
 #define GLEW_STATIC
 #endif
 
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <atomic>
+
+// Include CJobSystem, which decodes the images of the textures which are loaded in the background
+#include "JobSystem.h"
+
+class CAsset;
+
 class CImageLoader : public CSingletonTemplate<CImageLoader>
 {
 	friend CSingletonTemplate<CImageLoader>;
@@ -27,13 +39,127 @@ public:
 							int& width, int& height, 
 							int& nrChannels, const bool bInvert = false);
 
+	// Free the data of an image which was returned by Load
+	void Free(unsigned char* data);
+
 	// Load an image and return as a Texture ID
 	unsigned int LoadTextureGetID(const char* filename, const bool bInvert);
+
+	// Create a texture which is empty until its image is decoded on a worker thread and uploaded by
+	// UploadTextures, and return its ID. The ID stays the same once the image is uploaded
+	unsigned int LoadTextureAsync(const char* filename, const bool bInvert);
+	// Upload the textures whose images were decoded, until a time budget in seconds is used up.
+	// Call this on the main thread once a frame
+	void UploadTextures(const double dBudget);
+	// Wait for all of the textures which are loading, and upload them. Returns false if any of their images failed to load
+	bool FinishTextures(void);
+	// Check if the image of a texture from LoadTextureAsync was uploaded. This is false while it is loading, and if it failed
+	bool IsTextureLoaded(const unsigned int uiTexture) const;
+	// Check if the image of a texture from LoadTextureAsync failed to load, so that the texture stays transparent
+	bool IsTextureFailed(const unsigned int uiTexture) const;
+	// Get the number of textures from LoadTextureAsync whose images failed to load
+	unsigned int GetNumFailedTextures(void) const;
+	// Get the number of textures which are still loading
+	unsigned int GetNumLoadingTextures(void) const;
+
+	// Decode an image on a worker thread before it is loaded, e.g. for a scene which is likely to be started next.
+	// LoadTextureGetID and LoadTextureAsync take the pixels of the preloaded image instead of decoding it again
+	void PreloadImage(const char* filename, const bool bInvert);
+	// Discard the preloaded images which were not loaded. The images which have not started decoding are skipped
+	void CancelPreloads(void);
+	// Get the number of preloaded images, and how many of them were decoded
+	unsigned int GetNumPreloadedImages(void) const;
+	unsigned int GetNumDecodedPreloads(void) const;
+	// Record the images which LoadTextureGetID and LoadTextureAsync load, and whether they are flipped, into a
+	// list until it is set to NULL, e.g. to preload them the next time. Call this on the main thread
+	void SetLoadRecord(std::vector<std::pair<std::string, bool> >* pvLoadRecord);
+
+	// Decode an image file into a cooked texture, which LoadTextureGetID uploads without decoding it
+	static bool CookTexture(const unsigned char* pFileData, const size_t uiFileSize, std::vector<unsigned char>& vCooked);
+	// Get the name of the cooked texture of an image in a CAssetArchive
+	static std::string GetCookedName(const std::string& sFilename);
+
 protected:
+	// The start of a cooked texture. The pixels of the image follow it, with their rows from the bottom,
+	// as stb_image gives them when it flips the images
+	struct SCookedTexture
+	{
+		char cMagic[4];
+		unsigned int uiVersion;
+		unsigned int uiWidth;
+		unsigned int uiHeight;
+		unsigned int uiChannels;
+	};
+
+	// An image which is decoded on a worker thread. The job which decodes it sets the pixels, and then bDecoded.
+	// It is shared by the textures which are uploaded from it and by the preloads, and is freed after the last of them
+	struct SDecodedImage
+	{
+		std::string sFilename;
+		bool bInvert;
+		unsigned char* pPixels;
+		int iWidth;
+		int iHeight;
+		int iNumChannels;
+		std::atomic<bool> bDecoded;
+		// Set once nothing uses the image, so that it is not decoded if its job has not started
+		std::atomic<bool> bCancelled;
+		// The number of textures and preloads which use the image. Only the main thread changes this
+		unsigned int uiNumUsers;
+	};
+
+	// A texture which is loading
+	struct STextureLoad
+	{
+		unsigned int uiTexture;
+		// The resource tag which the texture was created with, which its image is counted in
+		unsigned int uiTag;
+		SDecodedImage* pImage;
+	};
+
+	// The textures which are loading, in the order which they were loaded
+	std::deque<STextureLoad*> dequeTextureLoads;
+	// The textures whose images failed to load, which are left transparent
+	std::set<unsigned int> setFailedTextures;
+	// The preloaded images, by the names of their assets and whether they are flipped
+	std::map<std::pair<std::string, bool>, SDecodedImage*> mapPreloadedImages;
+	// The images which nothing uses, which are freed once their jobs have finished
+	std::vector<SDecodedImage*> vReleasedImages;
+	// The jobs which decode the images of the textures, and of the preloads
+	CJobCounter cTextureJobs;
+	CJobCounter cPreloadJobs;
+	// The pixel buffer which the decoded images are copied into, so that the driver uploads them from it
+	// without the main thread waiting for the copy
+	unsigned int uiPixelBuffer;
+	// The list which the loaded images are recorded into, or NULL
+	std::vector<std::pair<std::string, bool> >* pvLoadRecord;
+
 	// Constructor
 	CImageLoader(void);
 
 	// Destructor
 	virtual ~CImageLoader(void);
+
+	// Create a texture with the filtering parameters of the images, and bind it
+	unsigned int CreateTexture(void);
+	// Upload a cooked texture and return its ID, or 0 if it is damaged
+	unsigned int LoadCookedTexture(const CAsset& cCooked, const bool bInvert);
+
+	// Schedule the decoding of an image, which has one user
+	SDecodedImage* DecodeImageAsync(const char* filename, const bool bInvert, CJobCounter& cCounter);
+	// Remove a user of an image, and free it if it was the last one
+	void ReleaseImage(SDecodedImage* pImage);
+	// Free the released images which have finished decoding
+	void FreeReleasedImages(void);
+	// Find a preloaded image, or NULL if the image was not preloaded
+	SDecodedImage* FindPreloadedImage(const char* filename, const bool bInvert) const;
+
+	// Decode an image of a texture which is loading, or of a preload. This runs on the worker threads
+	static void DecodeTexture(SDecodedImage* pImage);
+	// Upload the image of a texture which was decoded. Returns false if the image failed to load
+	bool UploadTexture(STextureLoad* pTextureLoad);
+
+	// A copy of the pixels of a cooked texture with their rows from the top, for the images which are not flipped
+	std::vector<unsigned char> vUnflipped;
 };
 
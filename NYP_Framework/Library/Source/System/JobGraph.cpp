@@ -0,0 +1,174 @@
+/**
+ CJobGraph
+ @brief A class which runs a set of jobs on the CJobSystem, where a job only starts after the jobs it depends on
+		have finished. Jobs without dependencies between them run at the same time
+ */
+#include "JobGraph.h"
+
+#include <iostream>
+using namespace std;
+
+/**
+ @brief Constructor
+ */
+CJobGraph::CJobGraph(void)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CJobGraph::~CJobGraph(void)
+{
+	Clear();
+}
+
+/**
+ @brief Add a job
+ @param function A const CJobSystem::JobFunction& containing the function to run
+ @param sName A const std::string& containing the name of the job, for PrintSelf
+ @return The index of the job, which is used by AddDependency
+ */
+unsigned int CJobGraph::AddJob(const CJobSystem::JobFunction& function, const std::string& sName)
+{
+	SNode sNode;
+	sNode.function = function;
+	sNode.sName = sName;
+	sNode.iNumDependencies = 0;
+	vNodes.push_back(sNode);
+	return (unsigned int)vNodes.size() - 1;
+}
+
+/**
+ @brief Make a job wait for another job to finish
+ @param uiBefore A const unsigned int containing the job which runs first
+ @param uiAfter A const unsigned int containing the job which runs after uiBefore has finished
+ */
+bool CJobGraph::AddDependency(const unsigned int uiBefore, const unsigned int uiAfter)
+{
+	if ((uiBefore >= vNodes.size()) || (uiAfter >= vNodes.size()) || (uiBefore == uiAfter))
+	{
+		cout << "CJobGraph::AddDependency: Invalid jobs " << uiBefore << " and " << uiAfter << endl;
+		return false;
+	}
+
+	vNodes[uiBefore].vDependents.push_back(uiAfter);
+	vNodes[uiAfter].iNumDependencies++;
+	return true;
+}
+
+/**
+ @brief Run all of the jobs and wait for them to finish
+ @return false if the dependencies have a cycle, in which case no job is run
+ */
+bool CJobGraph::Run(void)
+{
+	if (vNodes.empty())
+		return true;
+
+	if (IsAcyclic() == false)
+	{
+		cout << "CJobGraph::Run: The dependencies have a cycle" << endl;
+		return false;
+	}
+
+	pRemainingDependencies.reset(new std::atomic<int>[vNodes.size()]);
+	for (unsigned int i = 0; i < vNodes.size(); i++)
+		pRemainingDependencies[i] = vNodes[i].iNumDependencies;
+
+	// Dependents are scheduled before their dependency is marked as done, so the counter only reaches 0 at the end
+	CJobSystem* cJobSystem = CJobSystem::GetInstance();
+	CJobCounter cCounter;
+	for (unsigned int i = 0; i < vNodes.size(); i++)
+	{
+		if (vNodes[i].iNumDependencies == 0)
+			cJobSystem->Schedule([this, i, &cCounter]() { RunNode(i, &cCounter); }, &cCounter);
+	}
+	cJobSystem->Wait(cCounter);
+
+	return true;
+}
+
+/**
+ @brief Remove all of the jobs
+ */
+void CJobGraph::Clear(void)
+{
+	vNodes.clear();
+	pRemainingDependencies.reset();
+}
+
+/**
+ @brief Get the number of jobs
+ */
+unsigned int CJobGraph::GetNumJobs(void) const
+{
+	return (unsigned int)vNodes.size();
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CJobGraph::PrintSelf(void) const
+{
+	cout << "CJobGraph: " << vNodes.size() << " jobs" << endl;
+	for (unsigned int i = 0; i < vNodes.size(); i++)
+	{
+		cout << "\t" << i << " " << vNodes[i].sName << " -> ";
+		for (unsigned int j = 0; j < vNodes[i].vDependents.size(); j++)
+			cout << vNodes[i].vDependents[j] << " ";
+		cout << endl;
+	}
+}
+
+/**
+ @brief Check that the jobs can be ordered so that each job runs after its dependencies
+ */
+bool CJobGraph::IsAcyclic(void) const
+{
+	vector<int> vRemaining(vNodes.size());
+	vector<unsigned int> vReady;
+	for (unsigned int i = 0; i < vNodes.size(); i++)
+	{
+		vRemaining[i] = vNodes[i].iNumDependencies;
+		if (vRemaining[i] == 0)
+			vReady.push_back(i);
+	}
+
+	unsigned int uiNumOrdered = 0;
+	while (vReady.empty() == false)
+	{
+		unsigned int uiNode = vReady.back();
+		vReady.pop_back();
+		uiNumOrdered++;
+
+		for (unsigned int j = 0; j < vNodes[uiNode].vDependents.size(); j++)
+		{
+			unsigned int uiDependent = vNodes[uiNode].vDependents[j];
+			if (--vRemaining[uiDependent] == 0)
+				vReady.push_back(uiDependent);
+		}
+	}
+
+	return uiNumOrdered == vNodes.size();
+}
+
+/**
+ @brief Run a job, then schedule the dependents which are ready
+ @param uiNode A const unsigned int containing the index of the job
+ @param pCounter A CJobCounter* containing the counter of the current Run
+ */
+void CJobGraph::RunNode(const unsigned int uiNode, CJobCounter* pCounter)
+{
+	if (vNodes[uiNode].function)
+		vNodes[uiNode].function();
+
+	CJobSystem* cJobSystem = CJobSystem::GetInstance();
+	const vector<unsigned int>& vDependents = vNodes[uiNode].vDependents;
+	for (unsigned int i = 0; i < vDependents.size(); i++)
+	{
+		unsigned int uiDependent = vDependents[i];
+		if (pRemainingDependencies[uiDependent].fetch_sub(1) == 1)
+			cJobSystem->Schedule([this, uiDependent, pCounter]() { RunNode(uiDependent, pCounter); }, pCounter);
+	}
+}
@@ -0,0 +1,62 @@
+/**
+ CJobGraph
+ @brief A class which runs a set of jobs on the CJobSystem, where a job only starts after the jobs it depends on
+		have finished. Jobs without dependencies between them run at the same time
+ */
+#pragma once
+
+// Include CJobSystem
+#include "JobSystem.h"
+
+#include <vector>
+#include <memory>
+#include <string>
+
+class CJobGraph
+{
+public:
+	// Constructor
+	CJobGraph(void);
+
+	// Destructor
+	virtual ~CJobGraph(void);
+
+	// Add a job and return its index
+	unsigned int AddJob(const CJobSystem::JobFunction& function, const std::string& sName = "");
+
+	// Make the job uiAfter wait for the job uiBefore to finish
+	bool AddDependency(const unsigned int uiBefore, const unsigned int uiAfter);
+
+	// Run all of the jobs and wait for them to finish. Returns false if the dependencies have a cycle
+	bool Run(void);
+
+	// Remove all of the jobs
+	void Clear(void);
+
+	// Get the number of jobs
+	unsigned int GetNumJobs(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// A job and the jobs which wait for it
+	struct SNode
+	{
+		CJobSystem::JobFunction function;
+		std::string sName;
+		std::vector<unsigned int> vDependents;
+		int iNumDependencies;
+	};
+
+	std::vector<SNode> vNodes;
+
+	// The number of dependencies of each job which have not finished in the current Run
+	std::unique_ptr<std::atomic<int>[]> pRemainingDependencies;
+
+	// Check that the jobs can be ordered so that each job runs after its dependencies
+	bool IsAcyclic(void) const;
+
+	// Run a job, then schedule the dependents which are ready
+	void RunNode(const unsigned int uiNode, CJobCounter* pCounter);
+};
@@ -0,0 +1,283 @@
+/**
+ CJobSystem
+ @brief A class which runs jobs on a pool of worker threads. Each thread has its own queue of jobs,
+		and threads which run out of jobs steal from the other queues
+ */
+#include "JobSystem.h"
+
+// Include CProfiler, to show the jobs of each thread in the traces
+#include "../TimeControl/Profiler.h"
+
+#include <iostream>
+using namespace std;
+
+// The index of the thread which is running. Threads which are not workers use the main thread's queue
+static thread_local unsigned int uiThisThreadIndex = 0;
+
+/**
+ @brief Constructor
+ */
+CJobSystem::CJobSystem(void)
+	: iNumQueuedJobs(0)
+	, bRunning(false)
+	, uiNumJobsRun(0)
+	, uiNumJobsStolen(0)
+{
+	// The main thread's queue always exists, so jobs can be scheduled before Init
+	vQueues.push_back(new SJobQueue());
+}
+
+/**
+ @brief Destructor
+ */
+CJobSystem::~CJobSystem(void)
+{
+	Shutdown();
+
+	for (unsigned int i = 0; i < vQueues.size(); i++)
+		delete vQueues[i];
+	vQueues.clear();
+}
+
+/**
+ @brief Start the worker threads
+ @param uiNumWorkers A const unsigned int containing the number of worker threads. 0 uses one thread
+		for each core, except the main thread's
+ */
+bool CJobSystem::Init(const unsigned int uiNumWorkers)
+{
+	if (bRunning)
+		return true;
+
+	unsigned int uiWorkers = uiNumWorkers;
+	if (uiWorkers == 0)
+	{
+		unsigned int uiNumCores = std::thread::hardware_concurrency();
+		uiWorkers = (uiNumCores > 1) ? uiNumCores - 1 : 0;
+	}
+
+	bRunning = true;
+	for (unsigned int i = 0; i < uiWorkers; i++)
+	{
+		vQueues.push_back(new SJobQueue());
+	}
+	for (unsigned int i = 0; i < uiWorkers; i++)
+	{
+		vWorkers.push_back(std::thread(&CJobSystem::WorkerLoop, this, i + 1));
+	}
+
+	cout << "CJobSystem: Started " << uiWorkers << " worker threads" << endl;
+	return true;
+}
+
+/**
+ @brief Finish the queued jobs and stop the worker threads
+ */
+void CJobSystem::Shutdown(void)
+{
+	if (bRunning == false)
+		return;
+
+	// Run whatever is left, so that no counter is left waiting
+	while (RunOneJob(GetThreadIndex()))
+	{
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		bRunning = false;
+	}
+	sleepCondition.notify_all();
+
+	for (unsigned int i = 0; i < vWorkers.size(); i++)
+		vWorkers[i].join();
+	vWorkers.clear();
+
+	// Keep only the main thread's queue
+	for (unsigned int i = 1; i < vQueues.size(); i++)
+		delete vQueues[i];
+	vQueues.resize(1);
+}
+
+/**
+ @brief Add a job to the queue of this thread
+ @param function A const JobFunction& containing the function to run
+ @param pCounter A CJobCounter* which is incremented now and decremented when the job has finished, or NULL
+ */
+void CJobSystem::Schedule(const JobFunction& function, CJobCounter* pCounter)
+{
+	if (pCounter)
+		pCounter->Add(1);
+
+	SJob sJob;
+	sJob.function = function;
+	sJob.pCounter = pCounter;
+
+	// Count the job before it is queued, so that the count cannot drop below 0 when it is taken
+	iNumQueuedJobs.fetch_add(1);
+	SJobQueue* pQueue = vQueues[GetThreadIndex()];
+	{
+		std::lock_guard<std::mutex> lock(pQueue->queueMutex);
+		pQueue->dequeJobs.push_back(sJob);
+	}
+
+	// Lock the sleep mutex so that a worker cannot miss the wake up between checking and sleeping
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+	}
+	sleepCondition.notify_one();
+}
+
+/**
+ @brief Run jobs on this thread until all of the jobs in a counter have finished
+ @param cCounter A CJobCounter& containing the jobs to wait for
+ */
+void CJobSystem::Wait(CJobCounter& cCounter)
+{
+	unsigned int uiThreadIndex = GetThreadIndex();
+	while (cCounter.IsDone() == false)
+	{
+		// Help with the jobs instead of blocking, so that waiting inside a job cannot deadlock the pool
+		if (RunOneJob(uiThreadIndex) == false)
+			std::this_thread::yield();
+	}
+}
+
+/**
+ @brief Call a function for batches of [0, uiCount) on all threads, and wait for them to finish
+ @param uiCount A const unsigned int containing the number of items
+ @param uiBatchSize A const unsigned int containing the number of items in each job
+ @param function A const RangeFunction& which is called with the range of items of each job
+ */
+void CJobSystem::ParallelFor(const unsigned int uiCount, const unsigned int uiBatchSize, const RangeFunction& function)
+{
+	if (uiCount == 0)
+		return;
+
+	unsigned int uiBatch = (uiBatchSize > 0) ? uiBatchSize : 1;
+
+	// Scheduling costs more than running a single batch, so run it on this thread
+	if ((vWorkers.empty()) || (uiCount <= uiBatch))
+	{
+		function(0, uiCount);
+		return;
+	}
+
+	CJobCounter cCounter;
+	for (unsigned int uiBegin = uiBatch; uiBegin < uiCount; uiBegin += uiBatch)
+	{
+		unsigned int uiEnd = (uiCount - uiBegin > uiBatch) ? uiBegin + uiBatch : uiCount;
+		Schedule([&function, uiBegin, uiEnd]() { function(uiBegin, uiEnd); }, &cCounter);
+	}
+
+	// This thread runs the first batch itself, then helps with the rest
+	function(0, uiBatch);
+	Wait(cCounter);
+}
+
+/**
+ @brief Get the number of worker threads
+ */
+unsigned int CJobSystem::GetNumWorkers(void) const
+{
+	return (unsigned int)vWorkers.size();
+}
+
+/**
+ @brief Get the index of the thread which calls this, which is 0 for the main thread and 1 onwards for the workers
+ */
+unsigned int CJobSystem::GetThreadIndex(void)
+{
+	return uiThisThreadIndex;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CJobSystem::PrintSelf(void)
+{
+	cout << "CJobSystem: " << vWorkers.size() << " workers, " << uiNumJobsRun << " jobs run, "
+		<< uiNumJobsStolen << " jobs stolen, " << iNumQueuedJobs << " jobs queued" << endl;
+}
+
+/**
+ @brief The loop of each worker thread
+ @param uiThreadIndex A const unsigned int containing the index of this worker's queue
+ */
+void CJobSystem::WorkerLoop(const unsigned int uiThreadIndex)
+{
+	uiThisThreadIndex = uiThreadIndex;
+	CProfiler::GetInstance()->SetThreadName("Worker " + to_string(uiThreadIndex));
+
+	while (true)
+	{
+		if (RunOneJob(uiThreadIndex))
+			continue;
+
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		sleepCondition.wait(lock, [this]() { return (iNumQueuedJobs.load() > 0) || (bRunning == false); });
+		if ((bRunning == false) && (iNumQueuedJobs.load() <= 0))
+			break;
+	}
+}
+
+/**
+ @brief Take a job from this thread's queue, or steal one from another queue, and run it
+ @param uiThreadIndex A const unsigned int containing the index of this thread's queue
+ @return true if a job was run
+ */
+bool CJobSystem::RunOneJob(const unsigned int uiThreadIndex)
+{
+	SJob sJob;
+	bool bFound = PopJob(uiThreadIndex, false, sJob);
+
+	// Start with the next queue, so that the threads do not all steal from the same one
+	for (unsigned int i = 1; (bFound == false) && (i < vQueues.size()); i++)
+	{
+		if (PopJob((uiThreadIndex + i) % vQueues.size(), true, sJob))
+		{
+			bFound = true;
+			uiNumJobsStolen.fetch_add(1);
+		}
+	}
+
+	if (bFound == false)
+		return false;
+
+	iNumQueuedJobs.fetch_sub(1);
+	{
+		PROFILE_SCOPE_CATEGORY("CJobSystem::Job", "job");
+		sJob.function();
+	}
+	if (sJob.pCounter)
+		sJob.pCounter->Done();
+	uiNumJobsRun.fetch_add(1);
+	return true;
+}
+
+/**
+ @brief Take a job from a queue. The owner takes the newest job, and other threads take the oldest
+ @param uiQueue A const unsigned int containing the index of the queue
+ @param bSteal A const bool which is true if this thread does not own the queue
+ @param sJob A SJob& which is set to the job
+ @return true if a job was taken
+ */
+bool CJobSystem::PopJob(const unsigned int uiQueue, const bool bSteal, SJob& sJob)
+{
+	SJobQueue* pQueue = vQueues[uiQueue];
+	std::lock_guard<std::mutex> lock(pQueue->queueMutex);
+	if (pQueue->dequeJobs.empty())
+		return false;
+
+	if (bSteal)
+	{
+		sJob = pQueue->dequeJobs.front();
+		pQueue->dequeJobs.pop_front();
+	}
+	else
+	{
+		sJob = pQueue->dequeJobs.back();
+		pQueue->dequeJobs.pop_back();
+	}
+	return true;
+}
@@ -0,0 +1,132 @@
+/**
+ CJobSystem
+ @brief A class which runs jobs on a pool of worker threads. Each thread has its own queue of jobs,
+		and threads which run out of jobs steal from the other queues
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// A counter of the jobs which have not finished yet. Pass it to CJobSystem::Wait to wait for the jobs
+class CJobCounter
+{
+public:
+	// Constructor
+	CJobCounter(void)
+		: iCount(0)
+	{
+	}
+
+	// Add jobs to the counter
+	void Add(const int iNumJobs)
+	{
+		iCount.fetch_add(iNumJobs);
+	}
+
+	// Mark a job as finished
+	void Done(void)
+	{
+		iCount.fetch_sub(1);
+	}
+
+	// Check if all of the jobs have finished
+	bool IsDone(void) const
+	{
+		return iCount.load() == 0;
+	}
+
+protected:
+	std::atomic<int> iCount;
+
+private:
+	CJobCounter(const CJobCounter&);
+	CJobCounter& operator=(const CJobCounter&);
+};
+
+class CJobSystem : public CSingletonTemplate<CJobSystem>
+{
+	friend CSingletonTemplate<CJobSystem>;
+
+public:
+	// A function which is run by the job system
+	typedef std::function<void(void)> JobFunction;
+	// A function which is run for the items [uiBegin, uiEnd) of a ParallelFor
+	typedef std::function<void(const unsigned int uiBegin, const unsigned int uiEnd)> RangeFunction;
+
+	// Start the worker threads. 0 workers uses one thread for each core, except the main thread's
+	bool Init(const unsigned int uiNumWorkers = 0);
+
+	// Finish the queued jobs and stop the worker threads
+	void Shutdown(void);
+
+	// Add a job to the queue of this thread. pCounter is decremented when the job has finished
+	void Schedule(const JobFunction& function, CJobCounter* pCounter = NULL);
+
+	// Run jobs on this thread until all of the jobs in a counter have finished
+	void Wait(CJobCounter& cCounter);
+
+	// Call function for batches of [0, uiCount), on all threads, and wait for them to finish
+	void ParallelFor(const unsigned int uiCount, const unsigned int uiBatchSize, const RangeFunction& function);
+
+	// Get the number of worker threads
+	unsigned int GetNumWorkers(void) const;
+
+	// Get the index of the thread which calls this, which is 0 for the main thread and 1 onwards for the workers
+	static unsigned int GetThreadIndex(void);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
+protected:
+	// A job in a queue
+	struct SJob
+	{
+		JobFunction function;
+		CJobCounter* pCounter;
+	};
+
+	// The jobs of one thread. The owner takes jobs from the back, and other threads steal from the front
+	struct SJobQueue
+	{
+		std::mutex queueMutex;
+		std::deque<SJob> dequeJobs;
+	};
+
+	// The queues of the main thread and of each worker
+	std::vector<SJobQueue*> vQueues;
+	std::vector<std::thread> vWorkers;
+
+	// The workers sleep on this while there are no jobs
+	std::mutex sleepMutex;
+	std::condition_variable sleepCondition;
+	std::atomic<int> iNumQueuedJobs;
+	std::atomic<bool> bRunning;
+
+	// Statistics
+	std::atomic<unsigned int> uiNumJobsRun;
+	std::atomic<unsigned int> uiNumJobsStolen;
+
+	// Constructor
+	CJobSystem(void);
+
+	// Destructor
+	virtual ~CJobSystem(void);
+
+	// The loop of each worker thread
+	void WorkerLoop(const unsigned int uiThreadIndex);
+
+	// Take a job from this thread's queue, or steal one from another queue, and run it
+	bool RunOneJob(const unsigned int uiThreadIndex);
+
+	// Take a job from a queue. The owner takes the newest job, and other threads take the oldest
+	bool PopJob(const unsigned int uiQueue, const bool bSteal, SJob& sJob);
+};
@@ -10,6 +10,11 @@
 
 #include "LoadOBJ.h"
 
+// sscanf_s is only in the Microsoft C runtime. The formats below only read numbers, which sscanf reads the same way
+#ifndef _MSC_VER
+#define sscanf_s sscanf
+#endif
+
 struct PackedVertex{
 	glm::vec3 position;
 	glm::vec2 uv;
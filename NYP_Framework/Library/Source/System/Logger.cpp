@@ -0,0 +1,324 @@
+/**
+ CLogger
+ @brief A class which writes log messages to the console on a background thread, so that logging from the
+		game loop does not wait for the console
+ */
+#include "Logger.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+// The time which the writer thread sleeps between writing the records
+static const std::chrono::milliseconds WRITE_INTERVAL(10);
+
+thread_local CLogger::SThreadLog* CLogger::pThisThreadLog = NULL;
+thread_local unsigned int CLogger::uiThisThreadGeneration = 0;
+unsigned int CLogger::uiGeneration = 0;
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton.
+		The writer thread is started here, so that messages can be logged before the game is initialised
+ */
+CLogger::CLogger(void)
+	: bRunning(true)
+	, llStartTime(std::chrono::steady_clock::now().time_since_epoch().count())
+	, ullNumWritten(0)
+	, uiNumDropped(0)
+{
+	uiGeneration++;
+	writerThread = std::thread(&CLogger::WriterLoop, this);
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton.
+		The writer thread is stopped after it has written the messages which were logged
+ */
+CLogger::~CLogger(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(writerMutex);
+		bRunning = false;
+	}
+	writerCondition.notify_one();
+	if (writerThread.joinable())
+		writerThread.join();
+
+	for (unsigned int i = 0; i < vThreadLogs.size(); i++)
+		delete vThreadLogs[i];
+	vThreadLogs.clear();
+}
+
+/**
+ @brief Write the messages which were logged so far, on this thread, instead of waiting for the writer thread.
+		Call this before the console is read by something other than the game, e.g. before a crash is reported
+ */
+void CLogger::Flush(void)
+{
+	WriteRecords();
+}
+
+/**
+ @brief Get the number of messages which were dropped as the ring of their thread was full
+ */
+unsigned int CLogger::GetNumDropped(void) const
+{
+	return uiNumDropped;
+}
+
+/**
+ @brief Get the name of a level
+ @param eLevel A const LEVEL containing the level
+ */
+const char* CLogger::GetLevelName(const LEVEL eLevel)
+{
+	static const char* const szNames[NUM_LEVELS] = { "TRACE", "DEBUG", "INFO", "WARN", "ERROR" };
+	return szNames[eLevel];
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CLogger::PrintSelf(void)
+{
+	Flush();
+
+	std::lock_guard<std::mutex> lock(threadLogsMutex);
+	cout << "CLogger: " << ullNumWritten << " messages written, " << uiNumDropped << " dropped, from "
+		<< vThreadLogs.size() << " threads" << endl;
+}
+
+/**
+ @brief Get the next record of this thread's ring
+ @return The record, or NULL if the ring is full, in which case the message is dropped
+ */
+CLogger::SRecord* CLogger::BeginRecord(void)
+{
+	SThreadLog* pThreadLog = GetThreadLog();
+	const unsigned int uiHead = pThreadLog->uiHead.load(std::memory_order_relaxed);
+	if (uiHead - pThreadLog->uiCachedTail == NUM_RECORDS)
+	{
+		pThreadLog->uiCachedTail = pThreadLog->uiTail.load(std::memory_order_acquire);
+		if (uiHead - pThreadLog->uiCachedTail == NUM_RECORDS)
+		{
+			pThreadLog->uiNumDropped.fetch_add(1, std::memory_order_relaxed);
+			return NULL;
+		}
+	}
+
+	SRecord* pRecord = &pThreadLog->sRecords[uiHead % NUM_RECORDS];
+	pRecord->llTime = std::chrono::steady_clock::now().time_since_epoch().count();
+	return pRecord;
+}
+
+/**
+ @brief Pass the record which BeginRecord returned to the writer thread
+ */
+void CLogger::EndRecord(void)
+{
+	// The release makes the record visible to the writer thread before it sees the new head. Only this thread
+	// moves the head, so it does not need a read-modify-write
+	pThisThreadLog->uiHead.store(pThisThreadLog->uiHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/**
+ @brief Get the ring of this thread, and create it if this thread has not logged yet
+ */
+CLogger::SThreadLog* CLogger::GetThreadLog(void)
+{
+	if ((pThisThreadLog) && (uiThisThreadGeneration == uiGeneration))
+		return pThisThreadLog;
+
+	SThreadLog* pThreadLog = new SThreadLog();
+	pThreadLog->uiHead = 0;
+	pThreadLog->uiCachedTail = 0;
+	pThreadLog->uiTail = 0;
+	pThreadLog->uiNumDropped = 0;
+	{
+		std::lock_guard<std::mutex> lock(threadLogsMutex);
+		vThreadLogs.push_back(pThreadLog);
+		pThreadLog->uiThreadIndex = (unsigned int)vThreadLogs.size() - 1;
+	}
+
+	pThisThreadLog = pThreadLog;
+	uiThisThreadGeneration = uiGeneration;
+	return pThreadLog;
+}
+
+/**
+ @brief The loop of the writer thread, which writes the records every WRITE_INTERVAL until the logger is destroyed
+ */
+void CLogger::WriterLoop(void)
+{
+	std::unique_lock<std::mutex> lock(writerMutex);
+	while (bRunning)
+	{
+		writerCondition.wait_for(lock, WRITE_INTERVAL);
+		lock.unlock();
+		WriteRecords();
+		lock.lock();
+	}
+	lock.unlock();
+
+	// Write the messages which were logged while the logger was stopping
+	WriteRecords();
+}
+
+/**
+ @brief Format and write the records of all of the rings, in the order which they were logged.
+		The console is written to once, with all of the records
+ */
+void CLogger::WriteRecords(void)
+{
+	std::lock_guard<std::mutex> writeLock(writeMutex);
+
+	std::vector<SThreadLog*> vLogs;
+	{
+		std::lock_guard<std::mutex> lock(threadLogsMutex);
+		vLogs = vThreadLogs;
+	}
+
+	// Gather the records of each ring up to its head when it was read. The records after that are left for later
+	std::vector<std::pair<const SRecord*, unsigned int> > vRecords;
+	std::vector<unsigned int> vHeads(vLogs.size());
+	for (unsigned int i = 0; i < vLogs.size(); i++)
+	{
+		SThreadLog* pThreadLog = vLogs[i];
+		const unsigned int uiTail = pThreadLog->uiTail.load(std::memory_order_relaxed);
+		vHeads[i] = pThreadLog->uiHead.load(std::memory_order_acquire);
+		for (unsigned int uiRecord = uiTail; uiRecord != vHeads[i]; uiRecord++)
+			vRecords.push_back(std::make_pair(&pThreadLog->sRecords[uiRecord % NUM_RECORDS], pThreadLog->uiThreadIndex));
+
+		const unsigned int uiDropped = pThreadLog->uiNumDropped.exchange(0);
+		if (uiDropped > 0)
+		{
+			uiNumDropped += uiDropped;
+			sOutput += "CLogger: " + to_string(uiDropped) + " messages of thread " + to_string(pThreadLog->uiThreadIndex)
+				+ " were dropped, as it logged faster than they were written\n";
+		}
+	}
+
+	std::stable_sort(vRecords.begin(), vRecords.end(),
+		[](const std::pair<const SRecord*, unsigned int>& a, const std::pair<const SRecord*, unsigned int>& b)
+		{
+			return a.first->llTime < b.first->llTime;
+		});
+	for (unsigned int i = 0; i < vRecords.size(); i++)
+		FormatRecord(*vRecords[i].first, vRecords[i].second, sOutput);
+	ullNumWritten += vRecords.size();
+
+	// The records are only given back to their threads once they were formatted
+	for (unsigned int i = 0; i < vLogs.size(); i++)
+		vLogs[i]->uiTail.store(vHeads[i], std::memory_order_release);
+
+	if (sOutput.empty() == false)
+	{
+		cout << sOutput;
+		cout.flush();
+		sOutput.clear();
+	}
+}
+
+/**
+ @brief Format a record onto the end of a string, as its time, level and message. Each {} of the format
+		string is replaced by the next argument
+ @param sRecord A const SRecord& containing the record
+ @param uiThreadIndex A const unsigned int containing the index of the thread which logged it
+ @param sOutput A std::string& which the line is added to
+ */
+void CLogger::FormatRecord(const SRecord& sRecord, const unsigned int uiThreadIndex, std::string& sOutput) const
+{
+	char szBuffer[64];
+	const double dTime = std::chrono::duration<double>(std::chrono::steady_clock::duration(sRecord.llTime - llStartTime)).count();
+	snprintf(szBuffer, sizeof(szBuffer), "[%9.3f] %-5s ", dTime, GetLevelName(sRecord.eLevel));
+	sOutput += szBuffer;
+	if (uiThreadIndex > 0)
+	{
+		snprintf(szBuffer, sizeof(szBuffer), "(thread %u) ", uiThreadIndex);
+		sOutput += szBuffer;
+	}
+
+	unsigned int uiArg = 0;
+	for (const char* pChar = sRecord.szFormat; *pChar; pChar++)
+	{
+		if ((pChar[0] != '{') || (pChar[1] != '}') || (uiArg == sRecord.uiNumArgs))
+		{
+			sOutput += *pChar;
+			continue;
+		}
+
+		const SArg& sArg = sRecord.sArgs[uiArg++];
+		switch (sArg.eType)
+		{
+		case ARG_SIGNED:
+			snprintf(szBuffer, sizeof(szBuffer), "%lld", sArg.llValue);
+			break;
+		case ARG_UNSIGNED:
+			snprintf(szBuffer, sizeof(szBuffer), "%llu", sArg.ullValue);
+			break;
+		case ARG_DOUBLE:
+			snprintf(szBuffer, sizeof(szBuffer), "%g", sArg.dValue);
+			break;
+		case ARG_BOOL:
+			snprintf(szBuffer, sizeof(szBuffer), "%s", sArg.llValue ? "true" : "false");
+			break;
+		case ARG_CHAR:
+			snprintf(szBuffer, sizeof(szBuffer), "%c", (char)sArg.llValue);
+			break;
+		case ARG_TEXT:
+			snprintf(szBuffer, sizeof(szBuffer), "%s", sRecord.szText + sArg.uiTextOffset);
+			break;
+		}
+		sOutput += szBuffer;
+		pChar++;
+	}
+
+	if (sRecord.uiSuppressed > 0)
+	{
+		snprintf(szBuffer, sizeof(szBuffer), " (%u more since the last)", sRecord.uiSuppressed);
+		sOutput += szBuffer;
+	}
+	sOutput += '\n';
+}
+
+/**
+ @brief Copy a string argument into the text of a record. The string is cut short if the text is full
+ @param sArg A SArg& containing the argument
+ @param sRecord A SRecord& containing the record
+ @param szValue A const char* containing the string
+ */
+void CLogger::SetArg(SArg& sArg, SRecord& sRecord, const char* szValue)
+{
+	if (szValue == NULL)
+		szValue = "(null)";
+
+	sArg.eType = ARG_TEXT;
+	if (sRecord.uiTextUsed == MAX_TEXT)
+	{
+		// There is no space for the string, so the last character is used as an empty string
+		sArg.uiTextOffset = MAX_TEXT - 1;
+		return;
+	}
+
+	const unsigned int uiSpace = MAX_TEXT - sRecord.uiTextUsed - 1;
+	unsigned int uiLength = (unsigned int)strlen(szValue);
+	if (uiLength > uiSpace)
+		uiLength = uiSpace;
+	memcpy(sRecord.szText + sRecord.uiTextUsed, szValue, uiLength);
+	sRecord.szText[sRecord.uiTextUsed + uiLength] = '\0';
+	sArg.uiTextOffset = sRecord.uiTextUsed;
+	sRecord.uiTextUsed += uiLength + 1;
+}
+
+/**
+ @brief Copy a string argument into the text of a record
+ @param sArg A SArg& containing the argument
+ @param sRecord A SRecord& containing the record
+ @param sValue A const std::string& containing the string
+ */
+void CLogger::SetArg(SArg& sArg, SRecord& sRecord, const std::string& sValue)
+{
+	SetArg(sArg, sRecord, sValue.c_str());
+}
@@ -0,0 +1,315 @@
+/**
+ CLogger
+ @brief A class which writes log messages to the console on a background thread, so that logging from the
+		game loop does not wait for the console.
+		Each thread which logs has its own ring of records, which only it writes to and only the writer
+		thread reads from, so logging takes no locks. A record keeps the format string and a copy of the
+		arguments, and the writer thread formats it later. When a ring is full, its messages are dropped
+		and counted instead of waiting for the writer thread.
+		Log with the LOG_ macros. Their format strings must be string literals, with {} for each argument,
+		e.g. LOG_DEBUG("CShip: Ventilation at {} s", fTime). The messages below LOG_MIN_LEVEL are compiled
+		out, and the _EVERY macros log at most once in a number of seconds from each call site, for the
+		messages which would otherwise be logged every frame
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+// The levels of the messages, as numbers so that LOG_MIN_LEVEL can be compared by the preprocessor
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_WARNING 3
+#define LOG_LEVEL_ERROR 4
+
+// The lowest level which is compiled in. Debug builds keep all of the messages, and the others only
+// keep the messages from LOG_LEVEL_INFO up
+#ifndef LOG_MIN_LEVEL
+	#ifdef _DEBUG
+		#define LOG_MIN_LEVEL LOG_LEVEL_TRACE
+	#else
+		#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+	#endif
+#endif
+
+/**
+ CLogRateLimit
+ @brief A class which lets a call site log at most once in an interval, and counts the messages it stopped.
+		The LOG_ _EVERY macros keep one of these for each call site
+ */
+class CLogRateLimit
+{
+public:
+	// Constructor
+	explicit CLogRateLimit(const double dInterval)
+		: llInterval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(dInterval)).count())
+		, llNextTime(0)
+		, uiNumSuppressed(0)
+	{
+	}
+
+	// Check if a message can be logged now. If it can, uiSuppressed is set to the number of messages which were
+	// stopped since the last one
+	bool Allow(unsigned int& uiSuppressed)
+	{
+		const long long llNow = std::chrono::steady_clock::now().time_since_epoch().count();
+		long long llNext = llNextTime.load(std::memory_order_relaxed);
+		if ((llNow < llNext) || (llNextTime.compare_exchange_strong(llNext, llNow + llInterval) == false))
+		{
+			uiNumSuppressed.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		uiSuppressed = uiNumSuppressed.exchange(0);
+		return true;
+	}
+
+protected:
+	long long llInterval;
+	std::atomic<long long> llNextTime;
+	std::atomic<unsigned int> uiNumSuppressed;
+
+private:
+	CLogRateLimit(const CLogRateLimit&);
+	CLogRateLimit& operator=(const CLogRateLimit&);
+};
+
+class CLogger : public CSingletonTemplate<CLogger>
+{
+	friend CSingletonTemplate<CLogger>;
+public:
+	// The levels of the messages
+	enum LEVEL
+	{
+		TRACE_LEVEL = LOG_LEVEL_TRACE,
+		DEBUG_LEVEL = LOG_LEVEL_DEBUG,
+		INFO_LEVEL = LOG_LEVEL_INFO,
+		WARNING_LEVEL = LOG_LEVEL_WARNING,
+		ERROR_LEVEL = LOG_LEVEL_ERROR,
+		NUM_LEVELS
+	};
+
+	// The number of records in the ring of each thread
+	enum { NUM_RECORDS = 1024 };
+	// The most arguments of a message. The arguments after these are not printed
+	enum { MAX_ARGS = 6 };
+	// The bytes of each record which hold copies of the string arguments. Longer strings are cut short
+	enum { MAX_TEXT = 64 };
+
+	// Log a message. Use the LOG_ macros instead of this, so that the levels are filtered when compiling
+	template <typename... Args>
+	void Write(const LEVEL eLevel, const unsigned int uiSuppressed, const char* szFormat, const Args&... args)
+	{
+		SRecord* pRecord = BeginRecord();
+		if (pRecord == NULL)
+			return;
+
+		pRecord->eLevel = eLevel;
+		pRecord->uiSuppressed = uiSuppressed;
+		pRecord->szFormat = szFormat;
+		pRecord->uiNumArgs = 0;
+		pRecord->uiTextUsed = 0;
+		SetArgs(*pRecord, args...);
+		EndRecord();
+	}
+
+	// Write the messages which were logged so far, and wait for them to be written
+	void Flush(void);
+
+	// Get the number of messages which were dropped as the ring of their thread was full
+	unsigned int GetNumDropped(void) const;
+
+	// Get the name of a level
+	static const char* GetLevelName(const LEVEL eLevel);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
+protected:
+	// The types of the arguments of a message
+	enum ARG_TYPE
+	{
+		ARG_SIGNED = 0,
+		ARG_UNSIGNED,
+		ARG_DOUBLE,
+		ARG_BOOL,
+		ARG_CHAR,
+		// A string which was copied into the text of the record
+		ARG_TEXT
+	};
+
+	// An argument of a message
+	struct SArg
+	{
+		ARG_TYPE eType;
+		union
+		{
+			long long llValue;
+			unsigned long long ullValue;
+			double dValue;
+			// The offset of the string in the text of the record
+			unsigned int uiTextOffset;
+		};
+	};
+
+	// A message which was logged, which is formatted by the writer thread
+	struct SRecord
+	{
+		long long llTime;
+		LEVEL eLevel;
+		// The number of messages which the rate limit of the call site stopped before this one
+		unsigned int uiSuppressed;
+		const char* szFormat;
+		unsigned int uiNumArgs;
+		SArg sArgs[MAX_ARGS];
+		unsigned int uiTextUsed;
+		char szText[MAX_TEXT];
+	};
+
+	// The ring of records of a thread. The thread which logs moves the head, and the writer thread moves the tail.
+	// They are on their own cache lines, so that the two threads do not take the line from each other on each message
+	struct SThreadLog
+	{
+		SRecord sRecords[NUM_RECORDS];
+		std::atomic<unsigned int> uiHead;
+		// The tail which the thread which logs last read, so that it only reads the tail when the ring looks full
+		unsigned int uiCachedTail;
+		std::atomic<unsigned int> uiNumDropped;
+		char cPadding[64];
+		std::atomic<unsigned int> uiTail;
+		unsigned int uiThreadIndex;
+	};
+
+	// The rings of the threads which logged
+	std::vector<SThreadLog*> vThreadLogs;
+	std::mutex threadLogsMutex;
+
+	// The writer thread, which wakes up every WRITE_INTERVAL, or when it is stopped
+	std::thread writerThread;
+	std::mutex writerMutex;
+	std::condition_variable writerCondition;
+	bool bRunning;
+	// Only one thread writes the records at a time, as Flush also writes them
+	std::mutex writeMutex;
+	std::string sOutput;
+
+	// The time which the logger was created, which the times of the messages are from
+	long long llStartTime;
+	// The number of messages which were written and dropped
+	unsigned long long ullNumWritten;
+	unsigned int uiNumDropped;
+
+	// The ring of this thread, and the logger it was created by
+	static thread_local SThreadLog* pThisThreadLog;
+	static thread_local unsigned int uiThisThreadGeneration;
+	// The number of loggers which were created, so that the rings of a destroyed logger are not used
+	static unsigned int uiGeneration;
+
+	// Constructor
+	CLogger(void);
+
+	// Destructor
+	virtual ~CLogger(void);
+
+	// Get the next record of this thread's ring, or NULL if the ring is full
+	SRecord* BeginRecord(void);
+	// Pass the record to the writer thread
+	void EndRecord(void);
+
+	// Get the ring of this thread, and create it if this thread has not logged yet
+	SThreadLog* GetThreadLog(void);
+
+	// The loop of the writer thread
+	void WriterLoop(void);
+	// Format and write the records of all of the rings, in the order which they were logged
+	void WriteRecords(void);
+	// Format a record onto the end of a string
+	void FormatRecord(const SRecord& sRecord, const unsigned int uiThreadIndex, std::string& sOutput) const;
+
+	// Copy the arguments of a message into a record
+	static void SetArgs(SRecord&)
+	{
+	}
+	template <typename T, typename... Args>
+	static void SetArgs(SRecord& sRecord, const T& arg, const Args&... args)
+	{
+		if (sRecord.uiNumArgs < MAX_ARGS)
+		{
+			SetArg(sRecord.sArgs[sRecord.uiNumArgs], sRecord, arg);
+			sRecord.uiNumArgs++;
+		}
+		SetArgs(sRecord, args...);
+	}
+
+	// Copy an argument into a record
+	static void SetArg(SArg& sArg, SRecord&, const int iValue) { sArg.eType = ARG_SIGNED; sArg.llValue = iValue; }
+	static void SetArg(SArg& sArg, SRecord&, const long lValue) { sArg.eType = ARG_SIGNED; sArg.llValue = lValue; }
+	static void SetArg(SArg& sArg, SRecord&, const long long llValue) { sArg.eType = ARG_SIGNED; sArg.llValue = llValue; }
+	static void SetArg(SArg& sArg, SRecord&, const unsigned int uiValue) { sArg.eType = ARG_UNSIGNED; sArg.ullValue = uiValue; }
+	static void SetArg(SArg& sArg, SRecord&, const unsigned long ulValue) { sArg.eType = ARG_UNSIGNED; sArg.ullValue = ulValue; }
+	static void SetArg(SArg& sArg, SRecord&, const unsigned long long ullValue) { sArg.eType = ARG_UNSIGNED; sArg.ullValue = ullValue; }
+	static void SetArg(SArg& sArg, SRecord&, const float fValue) { sArg.eType = ARG_DOUBLE; sArg.dValue = fValue; }
+	static void SetArg(SArg& sArg, SRecord&, const double dValue) { sArg.eType = ARG_DOUBLE; sArg.dValue = dValue; }
+	static void SetArg(SArg& sArg, SRecord&, const bool bValue) { sArg.eType = ARG_BOOL; sArg.llValue = bValue; }
+	static void SetArg(SArg& sArg, SRecord&, const char cValue) { sArg.eType = ARG_CHAR; sArg.llValue = cValue; }
+	static void SetArg(SArg& sArg, SRecord& sRecord, const char* szValue);
+	static void SetArg(SArg& sArg, SRecord& sRecord, const std::string& sValue);
+};
+
+// Log a message from a call site, at most once in dSeconds
+#define LOG_EVERY(eLevel, dSeconds, ...) \
+	do \
+	{ \
+		static CLogRateLimit cLogRateLimit(dSeconds); \
+		unsigned int uiLogSuppressed = 0; \
+		if (cLogRateLimit.Allow(uiLogSuppressed)) \
+			CLogger::GetInstance()->Write(eLevel, uiLogSuppressed, __VA_ARGS__); \
+	} while (false)
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_TRACE
+	#define LOG_TRACE(...) CLogger::GetInstance()->Write(CLogger::TRACE_LEVEL, 0, __VA_ARGS__)
+	#define LOG_TRACE_EVERY(dSeconds, ...) LOG_EVERY(CLogger::TRACE_LEVEL, dSeconds, __VA_ARGS__)
+#else
+	#define LOG_TRACE(...) ((void)0)
+	#define LOG_TRACE_EVERY(dSeconds, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_DEBUG
+	#define LOG_DEBUG(...) CLogger::GetInstance()->Write(CLogger::DEBUG_LEVEL, 0, __VA_ARGS__)
+	#define LOG_DEBUG_EVERY(dSeconds, ...) LOG_EVERY(CLogger::DEBUG_LEVEL, dSeconds, __VA_ARGS__)
+#else
+	#define LOG_DEBUG(...) ((void)0)
+	#define LOG_DEBUG_EVERY(dSeconds, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_INFO
+	#define LOG_INFO(...) CLogger::GetInstance()->Write(CLogger::INFO_LEVEL, 0, __VA_ARGS__)
+	#define LOG_INFO_EVERY(dSeconds, ...) LOG_EVERY(CLogger::INFO_LEVEL, dSeconds, __VA_ARGS__)
+#else
+	#define LOG_INFO(...) ((void)0)
+	#define LOG_INFO_EVERY(dSeconds, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARNING
+	#define LOG_WARNING(...) CLogger::GetInstance()->Write(CLogger::WARNING_LEVEL, 0, __VA_ARGS__)
+	#define LOG_WARNING_EVERY(dSeconds, ...) LOG_EVERY(CLogger::WARNING_LEVEL, dSeconds, __VA_ARGS__)
+#else
+	#define LOG_WARNING(...) ((void)0)
+	#define LOG_WARNING_EVERY(dSeconds, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_ERROR
+	#define LOG_ERROR(...) CLogger::GetInstance()->Write(CLogger::ERROR_LEVEL, 0, __VA_ARGS__)
+	#define LOG_ERROR_EVERY(dSeconds, ...) LOG_EVERY(CLogger::ERROR_LEVEL, dSeconds, __VA_ARGS__)
+#else
+	#define LOG_ERROR(...) ((void)0)
+	#define LOG_ERROR_EVERY(dSeconds, ...) ((void)0)
+#endif
@@ -0,0 +1,176 @@
+/**
+ CRandom
+ @brief A class which generates pseudo-random numbers with PCG32. Unlike rand(), each generator has its own
+		state, so the same seed always gives the same numbers no matter what else draws numbers
+ */
+#include "Random.h"
+
+#include <ctime>
+#include <iostream>
+#include <iomanip>
+using namespace std;
+
+/**
+ @brief Constructor
+ */
+CRandom::CRandom(void)
+	: ullState(0)
+	, ullIncrement(1)
+	, ullNumDraws(0)
+{
+	Seed(0);
+}
+
+/**
+ @brief Destructor
+ */
+CRandom::~CRandom(void)
+{
+}
+
+/**
+ @brief Start the sequence of a seed
+ @param ullSeed A const unsigned long long containing the seed
+ @param ullStream A const unsigned long long which selects one of the independent sequences of the seed
+ */
+void CRandom::Seed(const unsigned long long ullSeed, const unsigned long long ullStream)
+{
+	// The increment must be odd
+	ullState = 0;
+	ullIncrement = (ullStream << 1) | 1;
+	Next();
+	ullState += ullSeed;
+	Next();
+	ullNumDraws = 0;
+}
+
+/**
+ @brief Get a number in [0, 2^32)
+ */
+unsigned int CRandom::Next(void)
+{
+	unsigned long long ullOldState = ullState;
+	ullState = ullOldState * 6364136223846793005ULL + ullIncrement;
+	ullNumDraws++;
+
+	unsigned int uiXorShifted = (unsigned int)(((ullOldState >> 18) ^ ullOldState) >> 27);
+	unsigned int uiRotation = (unsigned int)(ullOldState >> 59);
+	return (uiXorShifted >> uiRotation) | (uiXorShifted << ((32 - uiRotation) & 31));
+}
+
+/**
+ @brief Get a number in [0, iBound). Unlike rand() % iBound, every number is equally likely
+ @param iBound A const int containing the number of possible results
+ @return The number, or 0 if iBound is not positive
+ */
+int CRandom::Next(const int iBound)
+{
+	if (iBound <= 0)
+		return 0;
+
+	// Reject the lowest numbers which would make the smaller results more likely
+	unsigned int uiBound = (unsigned int)iBound;
+	unsigned int uiThreshold = (0u - uiBound) % uiBound;
+	while (true)
+	{
+		unsigned int uiNumber = Next();
+		if (uiNumber >= uiThreshold)
+			return (int)(uiNumber % uiBound);
+	}
+}
+
+/**
+ @brief Get a number in [iMin, iMax]
+ @param iMin A const int containing the smallest result
+ @param iMax A const int containing the largest result
+ */
+int CRandom::Range(const int iMin, const int iMax)
+{
+	if (iMax <= iMin)
+		return iMin;
+	return iMin + Next(iMax - iMin + 1);
+}
+
+/**
+ @brief Get a number in [0, 1)
+ */
+float CRandom::NextFloat(void)
+{
+	// Use 24 bits, which is all that a float can hold exactly
+	return (Next() >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ @brief Get the state of the generator, which is the same in runs which drew the same numbers
+ */
+unsigned long long CRandom::GetState(void) const
+{
+	return ullState;
+}
+
+/**
+ @brief Get the number of numbers drawn since the last Seed
+ */
+unsigned long long CRandom::GetNumDraws(void) const
+{
+	return ullNumDraws;
+}
+
+/**
+ @brief Constructor
+ */
+CRandomManager::CRandomManager(void)
+	: uiSeed(0)
+{
+	Seed(1);
+}
+
+/**
+ @brief Destructor
+ */
+CRandomManager::~CRandomManager(void)
+{
+}
+
+/**
+ @brief Seed all of the streams
+ @param uiSeed A const unsigned int containing the seed. 0 picks a seed from the time
+ */
+void CRandomManager::Seed(const unsigned int uiSeed)
+{
+	this->uiSeed = (uiSeed != 0) ? uiSeed : (unsigned int)time(0);
+	for (unsigned int i = 0; i < NUM_STREAMS; i++)
+		cStreams[i].Seed(this->uiSeed, i);
+}
+
+/**
+ @brief Get the seed of the streams, which can be used to run the same game again
+ */
+unsigned int CRandomManager::GetSeed(void) const
+{
+	return uiSeed;
+}
+
+/**
+ @brief Get the generator of a subsystem
+ @param eStream A const STREAM containing the subsystem
+ */
+CRandom& CRandomManager::Get(const STREAM eStream)
+{
+	return cStreams[eStream];
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CRandomManager::PrintSelf(void) const
+{
+	static const char* szStreamNames[NUM_STREAMS] = { "WORLD", "AI", "COMBAT" };
+
+	cout << "CRandomManager: seed " << uiSeed << endl;
+	for (unsigned int i = 0; i < NUM_STREAMS; i++)
+	{
+		cout << "\t" << szStreamNames[i] << ": " << cStreams[i].GetNumDraws() << " draws, state "
+			<< hex << setw(16) << setfill('0') << cStreams[i].GetState() << dec << setfill(' ') << endl;
+	}
+}
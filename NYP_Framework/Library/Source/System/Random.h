@@ -0,0 +1,87 @@
+/**
+ CRandom
+ @brief A class which generates pseudo-random numbers with PCG32. Unlike rand(), each generator has its own
+		state, so the same seed always gives the same numbers no matter what else draws numbers
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+class CRandom
+{
+public:
+	// Constructor
+	CRandom(void);
+
+	// Destructor
+	virtual ~CRandom(void);
+
+	// Start the sequence of a seed. Each stream of the same seed gives a different sequence
+	void Seed(const unsigned long long ullSeed, const unsigned long long ullStream = 0);
+
+	// Get a number in [0, 2^32)
+	unsigned int Next(void);
+
+	// Get a number in [0, iBound). This replaces rand() % iBound
+	int Next(const int iBound);
+
+	// Get a number in [iMin, iMax]
+	int Range(const int iMin, const int iMax);
+
+	// Get a number in [0, 1)
+	float NextFloat(void);
+
+	// Get the state of the generator, which is the same in runs which drew the same numbers
+	unsigned long long GetState(void) const;
+
+	// Get the number of numbers drawn since the last Seed
+	unsigned long long GetNumDraws(void) const;
+
+protected:
+	unsigned long long ullState;
+	unsigned long long ullIncrement;
+	unsigned long long ullNumDraws;
+};
+
+/**
+ CRandomManager
+ @brief A class which holds a CRandom for each subsystem, all seeded from one seed. Since each subsystem draws
+		from its own stream, a change in how often one subsystem draws does not change the numbers of the others.
+		The streams are not thread safe and are meant to be used by the main thread
+ */
+class CRandomManager : public CSingletonTemplate<CRandomManager>
+{
+	friend CSingletonTemplate<CRandomManager>;
+public:
+	// The subsystems which draw random numbers
+	enum STREAM
+	{
+		WORLD = 0,		// Generating the nebula, planets, levels and resources
+		AI,				// Decisions of the enemies
+		COMBAT,			// Ship combat encounters and attacks
+		NUM_STREAMS
+	};
+
+	// Seed all of the streams. A seed of 0 picks a seed from the time
+	void Seed(const unsigned int uiSeed);
+
+	// Get the seed of the streams, which can be used to run the same game again
+	unsigned int GetSeed(void) const;
+
+	// Get the generator of a subsystem
+	CRandom& Get(const STREAM eStream);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	CRandom cStreams[NUM_STREAMS];
+	unsigned int uiSeed;
+
+	// Constructor
+	CRandomManager(void);
+
+	// Destructor
+	virtual ~CRandomManager(void);
+};
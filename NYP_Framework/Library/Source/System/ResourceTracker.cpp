@@ -0,0 +1,571 @@
+/**
+ CResourceTracker
+ @brief A class which keeps the live CPU allocations and GL objects of the game, by the tag of the code which
+		created them, so that resources which are never freed can be found
+ */
+#include "ResourceTracker.h"
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+// Include ImGui, to draw the overlay
+#include "../GUI/imgui.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+using namespace std;
+
+// The growth in the bytes of the allocations of a tag which is taken as a leak, so that containers which
+// change their capacity a little between the entries to a game state are not reported
+static const long long LEAK_BYTES = 4096;
+
+// The names of the kinds of GL objects
+static const char* const szGLObjectNames[CResourceTracker::NUM_GL_OBJECTS] = {
+	"Textures", "Buffers", "Vertex arrays", "Programs"
+};
+
+// The tags and the live allocations of each tag. They are constant initialised, so they can be used by the
+// allocations made before main, and the counts are atomic, as the worker threads of the CJobSystem allocate too
+static char szTagNames[CResourceTracker::MAX_TAGS][CResourceTracker::MAX_TAG_NAME];
+static std::atomic<unsigned int> uiNumTags(1);
+static std::atomic<long long> llTagAllocations[CResourceTracker::MAX_TAGS];
+static std::atomic<long long> llTagBytes[CResourceTracker::MAX_TAGS];
+static std::mutex tagsMutex;
+// The tag which this thread gives to what it creates
+static thread_local unsigned int uiThisThreadTag = 0;
+
+// The GLEW entry points which were wrapped, which the wrappers call on to
+static PFNGLGENBUFFERSPROC pfnGenBuffers = NULL;
+static PFNGLDELETEBUFFERSPROC pfnDeleteBuffers = NULL;
+static PFNGLBINDBUFFERPROC pfnBindBuffer = NULL;
+static PFNGLBUFFERDATAPROC pfnBufferData = NULL;
+static PFNGLGENVERTEXARRAYSPROC pfnGenVertexArrays = NULL;
+static PFNGLDELETEVERTEXARRAYSPROC pfnDeleteVertexArrays = NULL;
+static PFNGLCREATEPROGRAMPROC pfnCreateProgram = NULL;
+static PFNGLDELETEPROGRAMPROC pfnDeleteProgram = NULL;
+
+// The buffers which are bound to the targets which the game uploads data to
+static GLuint uiArrayBuffer = 0;
+static GLuint uiElementArrayBuffer = 0;
+
+static void GLAPIENTRY TrackedGenBuffers(GLsizei n, GLuint* buffers)
+{
+	pfnGenBuffers(n, buffers);
+	for (GLsizei i = 0; i < n; i++)
+		CResourceTracker::GetInstance()->AddGLObject(CResourceTracker::BUFFERS, buffers[i]);
+}
+
+static void GLAPIENTRY TrackedDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+	for (GLsizei i = 0; i < n; i++)
+	{
+		CResourceTracker::GetInstance()->RemoveGLObject(CResourceTracker::BUFFERS, buffers[i]);
+		if (uiArrayBuffer == buffers[i])
+			uiArrayBuffer = 0;
+		if (uiElementArrayBuffer == buffers[i])
+			uiElementArrayBuffer = 0;
+	}
+	pfnDeleteBuffers(n, buffers);
+}
+
+static void GLAPIENTRY TrackedBindBuffer(GLenum target, GLuint buffer)
+{
+	if (target == GL_ARRAY_BUFFER)
+		uiArrayBuffer = buffer;
+	else if (target == GL_ELEMENT_ARRAY_BUFFER)
+		uiElementArrayBuffer = buffer;
+	pfnBindBuffer(target, buffer);
+}
+
+static void GLAPIENTRY TrackedBufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage)
+{
+	if (target == GL_ARRAY_BUFFER)
+		CResourceTracker::GetInstance()->SetBufferBytes(uiArrayBuffer, size);
+	else if (target == GL_ELEMENT_ARRAY_BUFFER)
+		CResourceTracker::GetInstance()->SetBufferBytes(uiElementArrayBuffer, size);
+	pfnBufferData(target, size, data, usage);
+}
+
+static void GLAPIENTRY TrackedGenVertexArrays(GLsizei n, GLuint* arrays)
+{
+	pfnGenVertexArrays(n, arrays);
+	for (GLsizei i = 0; i < n; i++)
+		CResourceTracker::GetInstance()->AddGLObject(CResourceTracker::VERTEX_ARRAYS, arrays[i]);
+}
+
+static void GLAPIENTRY TrackedDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+	for (GLsizei i = 0; i < n; i++)
+		CResourceTracker::GetInstance()->RemoveGLObject(CResourceTracker::VERTEX_ARRAYS, arrays[i]);
+	pfnDeleteVertexArrays(n, arrays);
+}
+
+static GLuint GLAPIENTRY TrackedCreateProgram(void)
+{
+	GLuint uiProgram = pfnCreateProgram();
+	CResourceTracker::GetInstance()->AddGLObject(CResourceTracker::PROGRAMS, uiProgram);
+	return uiProgram;
+}
+
+static void GLAPIENTRY TrackedDeleteProgram(GLuint program)
+{
+	CResourceTracker::GetInstance()->RemoveGLObject(CResourceTracker::PROGRAMS, program);
+	pfnDeleteProgram(program);
+}
+
+/**
+ @brief Wrap a GLEW entry point, if it was loaded
+ @param pfnEntryPoint A T& containing the GLEW entry point, which is set to the wrapper
+ @param pfnOriginal A T& which is set to the entry point which the wrapper calls on to
+ @param pfnWrapper A T containing the wrapper
+ */
+template <typename T>
+static void Wrap(T& pfnEntryPoint, T& pfnOriginal, T pfnWrapper)
+{
+	if (pfnEntryPoint == NULL)
+		return;
+	pfnOriginal = pfnEntryPoint;
+	pfnEntryPoint = pfnWrapper;
+}
+
+/**
+ @brief Get the name of a file without its folders
+ */
+static const char* GetFileName(const char* szFile)
+{
+	const char* szName = szFile;
+	for (const char* pChar = szFile; *pChar; pChar++)
+	{
+		if ((*pChar == '/') || (*pChar == '\\'))
+			szName = pChar + 1;
+	}
+	return szName;
+}
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CResourceTracker::CResourceTracker(void)
+	: uiNumLeaks(0)
+	, bInstalled(false)
+{
+	memset(llGLObjects, 0, sizeof(llGLObjects));
+	memset(llGLBytes, 0, sizeof(llGLBytes));
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CResourceTracker::~CResourceTracker(void)
+{
+}
+
+/**
+ @brief Get the tag of a subsystem and call site, and register it if it is new
+ @param szSubsystem A const char* containing the name of the subsystem
+ @param szFile A const char* containing the file of the call site, e.g. __FILE__
+ @param iLine A const int containing the line of the call site, e.g. __LINE__
+ @return The tag, or 0 if there is no space for more tags
+ */
+unsigned int CResourceTracker::RegisterTag(const char* szSubsystem, const char* szFile, const int iLine)
+{
+	char szName[MAX_TAG_NAME];
+	snprintf(szName, sizeof(szName), "%s (%s:%d)", szSubsystem, GetFileName(szFile), iLine);
+
+	std::lock_guard<std::mutex> lock(tagsMutex);
+	const unsigned int uiCount = uiNumTags.load();
+	for (unsigned int uiTag = 1; uiTag < uiCount; uiTag++)
+	{
+		if (strcmp(szTagNames[uiTag], szName) == 0)
+			return uiTag;
+	}
+	if (uiCount == MAX_TAGS)
+	{
+		cout << "CResourceTracker::RegisterTag: No space for the tag " << szName << endl;
+		return 0;
+	}
+	memcpy(szTagNames[uiCount], szName, sizeof(szName));
+	uiNumTags.store(uiCount + 1);
+	return uiCount;
+}
+
+/**
+ @brief Get the tag which this thread gives to what it creates
+ */
+unsigned int CResourceTracker::GetCurrentTag(void)
+{
+	return uiThisThreadTag;
+}
+
+/**
+ @brief Set the tag which this thread gives to what it creates
+ @param uiTag A const unsigned int containing the tag
+ @return The previous tag of this thread
+ */
+unsigned int CResourceTracker::SetCurrentTag(const unsigned int uiTag)
+{
+	const unsigned int uiPreviousTag = uiThisThreadTag;
+	uiThisThreadTag = uiTag;
+	return uiPreviousTag;
+}
+
+/**
+ @brief Get the name of a tag
+ @param uiTag A const unsigned int containing the tag
+ */
+const char* CResourceTracker::GetTagName(const unsigned int uiTag)
+{
+	return (uiTag == 0) ? "Untagged" : szTagNames[uiTag];
+}
+
+/**
+ @brief Get the number of tags which were registered, including the untagged resources
+ */
+unsigned int CResourceTracker::GetNumTags(void)
+{
+	return uiNumTags.load();
+}
+
+/**
+ @brief Add an allocation to the live resources of a tag
+ @param uiTag A const unsigned int containing the tag
+ @param ullBytes A const unsigned long long containing the size of the allocation in bytes
+ */
+void CResourceTracker::AddAllocation(const unsigned int uiTag, const unsigned long long ullBytes)
+{
+	llTagAllocations[uiTag].fetch_add(1, std::memory_order_relaxed);
+	llTagBytes[uiTag].fetch_add(ullBytes, std::memory_order_relaxed);
+}
+
+/**
+ @brief Remove an allocation from the live resources of a tag
+ @param uiTag A const unsigned int containing the tag which the allocation was added to
+ @param ullBytes A const unsigned long long containing the size of the allocation in bytes
+ */
+void CResourceTracker::RemoveAllocation(const unsigned int uiTag, const unsigned long long ullBytes)
+{
+	llTagAllocations[uiTag].fetch_sub(1, std::memory_order_relaxed);
+	llTagBytes[uiTag].fetch_sub(ullBytes, std::memory_order_relaxed);
+}
+
+/**
+ @brief Wrap the GLEW entry points which create and delete the buffers, vertex arrays and programs,
+		and bind and upload the buffers. The textures are created with OpenGL 1.1 functions, which GLEW
+		does not load, so CImageLoader adds them instead
+ */
+void CResourceTracker::Install(void)
+{
+#ifndef RESOURCE_TRACKER_DISABLED
+	if (bInstalled)
+		return;
+
+	Wrap(__glewGenBuffers, pfnGenBuffers, TrackedGenBuffers);
+	Wrap(__glewDeleteBuffers, pfnDeleteBuffers, TrackedDeleteBuffers);
+	Wrap(__glewBindBuffer, pfnBindBuffer, TrackedBindBuffer);
+	Wrap(__glewBufferData, pfnBufferData, TrackedBufferData);
+	Wrap(__glewGenVertexArrays, pfnGenVertexArrays, TrackedGenVertexArrays);
+	Wrap(__glewDeleteVertexArrays, pfnDeleteVertexArrays, TrackedDeleteVertexArrays);
+	Wrap(__glewCreateProgram, pfnCreateProgram, TrackedCreateProgram);
+	Wrap(__glewDeleteProgram, pfnDeleteProgram, TrackedDeleteProgram);
+	bInstalled = true;
+#endif
+}
+
+/**
+ @brief Add a texture which was created by the current tag
+ @param uiTexture A const unsigned int containing the name of the texture
+ @param ullBytes A const unsigned long long containing the bytes of its pixels
+ */
+void CResourceTracker::AddTexture(const unsigned int uiTexture, const unsigned long long ullBytes)
+{
+	AddGLObject(TEXTURES, uiTexture);
+	std::unordered_map<unsigned int, SGLObject>::iterator it = mapGLObjects[TEXTURES].find(uiTexture);
+	if (it == mapGLObjects[TEXTURES].end())
+		return;
+	it->second.ullBytes = ullBytes;
+	llGLBytes[it->second.uiTag] += ullBytes;
+}
+
+/**
+ @brief Remove a texture which was deleted
+ @param uiTexture A const unsigned int containing the name of the texture
+ */
+void CResourceTracker::RemoveTexture(const unsigned int uiTexture)
+{
+	RemoveGLObject(TEXTURES, uiTexture);
+}
+
+/**
+ @brief Add a GL object which was created by the current tag
+ @param eObject A const GL_OBJECT containing the kind of the object
+ @param uiName A const unsigned int containing the name of the object. 0 is not an object, and is not added
+ */
+void CResourceTracker::AddGLObject(const GL_OBJECT eObject, const unsigned int uiName)
+{
+	if (uiName == 0)
+		return;
+
+	const unsigned int uiTag = uiThisThreadTag;
+	SGLObject sObject;
+	sObject.uiTag = uiTag;
+	sObject.ullBytes = 0;
+	{
+		// The map is the tracker's own allocation, and is not counted as the tag's
+		CResourceTag cResourceTag(GetTrackerTag());
+		if (mapGLObjects[eObject].insert(std::make_pair(uiName, sObject)).second == false)
+			return;
+	}
+	llGLObjects[uiTag][eObject]++;
+}
+
+/**
+ @brief Remove a GL object which was deleted
+ @param eObject A const GL_OBJECT containing the kind of the object
+ @param uiName A const unsigned int containing the name of the object. Objects which were not added are ignored
+ */
+void CResourceTracker::RemoveGLObject(const GL_OBJECT eObject, const unsigned int uiName)
+{
+	std::unordered_map<unsigned int, SGLObject>::iterator it = mapGLObjects[eObject].find(uiName);
+	if (it == mapGLObjects[eObject].end())
+		return;
+
+	llGLObjects[it->second.uiTag][eObject]--;
+	llGLBytes[it->second.uiTag] -= it->second.ullBytes;
+	mapGLObjects[eObject].erase(it);
+}
+
+/**
+ @brief Set the bytes of a buffer which has data uploaded to it, in place of its previous data
+ @param uiName A const unsigned int containing the name of the buffer
+ @param ullBytes A const unsigned long long containing the size of the data in bytes
+ */
+void CResourceTracker::SetBufferBytes(const unsigned int uiName, const unsigned long long ullBytes)
+{
+	std::unordered_map<unsigned int, SGLObject>::iterator it = mapGLObjects[BUFFERS].find(uiName);
+	if (it == mapGLObjects[BUFFERS].end())
+		return;
+
+	llGLBytes[it->second.uiTag] += (long long)ullBytes - (long long)it->second.ullBytes;
+	it->second.ullBytes = ullBytes;
+}
+
+/**
+ @brief Get the live resources of a tag
+ @param uiTag A const unsigned int containing the tag
+ */
+CResourceTracker::SLiveResources CResourceTracker::GetLiveResources(const unsigned int uiTag) const
+{
+	SLiveResources sLive;
+	sLive.llAllocations = llTagAllocations[uiTag].load(std::memory_order_relaxed);
+	sLive.llBytes = llTagBytes[uiTag].load(std::memory_order_relaxed);
+	for (unsigned int i = 0; i < NUM_GL_OBJECTS; i++)
+		sLive.llGLObjects[i] = llGLObjects[uiTag][i];
+	sLive.llGLBytes = llGLBytes[uiTag];
+	return sLive;
+}
+
+/**
+ @brief Get the live resources of all of the tags
+ */
+CResourceTracker::SLiveResources CResourceTracker::GetTotalLiveResources(void) const
+{
+	SLiveResources sTotal;
+	memset(&sTotal, 0, sizeof(sTotal));
+	const unsigned int uiCount = GetNumTags();
+	for (unsigned int uiTag = 0; uiTag < uiCount; uiTag++)
+	{
+		SLiveResources sLive = GetLiveResources(uiTag);
+		sTotal.llAllocations += sLive.llAllocations;
+		sTotal.llBytes += sLive.llBytes;
+		for (unsigned int i = 0; i < NUM_GL_OBJECTS; i++)
+			sTotal.llGLObjects[i] += sLive.llGLObjects[i];
+		sTotal.llGLBytes += sLive.llGLBytes;
+	}
+	return sTotal;
+}
+
+/**
+ @brief Report the live resources as a game state is entered. Call this after the previous game state was
+		destroyed, and before the game state is initialised, so that the resources are what the other game
+		states left behind. A tag which grew between each of the last three entries to the game state is
+		reported as a leak, once for each game state, as its resources are not freed by the states which
+		created them. The tracker's own allocations grow with the leaks, so they are not reported
+ @param sState A const std::string& containing the name of the game state
+ */
+void CResourceTracker::EnterState(const std::string& sState)
+{
+#ifndef RESOURCE_TRACKER_DISABLED
+	CResourceTag cResourceTag(GetTrackerTag());
+
+	sCurrentState = sState;
+	SStateHistory& sHistory = mapStates[sState];
+	sHistory.uiNumEntries++;
+
+	const unsigned int uiCount = GetNumTags();
+	std::vector<SLiveResources> vNow(uiCount);
+	for (unsigned int uiTag = 0; uiTag < uiCount; uiTag++)
+		vNow[uiTag] = GetLiveResources(uiTag);
+
+	SLiveResources sTotal = GetTotalLiveResources();
+	cout << "CResourceTracker: Entering " << sState << " (" << sHistory.uiNumEntries << " times), "
+		<< sTotal.llAllocations << " allocations of " << sTotal.llBytes / 1024 << " KB, "
+		<< sTotal.llGLObjects[TEXTURES] << " textures, " << sTotal.llGLObjects[BUFFERS] << " buffers, "
+		<< sTotal.llGLObjects[VERTEX_ARRAYS] << " vertex arrays, " << sTotal.llGLObjects[PROGRAMS] << " programs, "
+		<< sTotal.llGLBytes / 1024 << " KB of GL data" << endl;
+
+	// The tags which were registered since the last entry had no resources then
+	SLiveResources sNone;
+	memset(&sNone, 0, sizeof(sNone));
+	sHistory.vLastEntry.resize(uiCount, sNone);
+	sHistory.vGrew.resize(uiCount, false);
+	sHistory.vReported.resize(uiCount, false);
+	for (unsigned int uiTag = 0; uiTag < uiCount; uiTag++)
+	{
+		const bool bGrew = (sHistory.uiNumEntries > 1) && HasGrown(sHistory.vLastEntry[uiTag], vNow[uiTag]);
+		if ((bGrew) && (sHistory.vGrew[uiTag]) && (sHistory.vReported[uiTag] == false) && (uiTag != GetTrackerTag()))
+		{
+			const SLiveResources& sFrom = sHistory.vLastEntry[uiTag];
+			const SLiveResources& sTo = vNow[uiTag];
+			cout << "CResourceTracker: Leak in " << GetTagName(uiTag) << ", which grew over the last entries to "
+				<< sState << " by " << sTo.llAllocations - sFrom.llAllocations << " allocations of "
+				<< sTo.llBytes - sFrom.llBytes << " bytes";
+			for (unsigned int i = 0; i < NUM_GL_OBJECTS; i++)
+			{
+				if (sTo.llGLObjects[i] != sFrom.llGLObjects[i])
+					cout << ", " << sTo.llGLObjects[i] - sFrom.llGLObjects[i] << " " << szGLObjectNames[i];
+			}
+			cout << ", " << sTo.llGLBytes - sFrom.llGLBytes << " bytes of GL data" << endl;
+			sHistory.vReported[uiTag] = true;
+			uiNumLeaks++;
+		}
+		sHistory.vGrew[uiTag] = bGrew;
+	}
+	sHistory.vLastEntry.swap(vNow);
+#endif
+}
+
+/**
+ @brief Get the number of leaks which were reported
+ */
+unsigned int CResourceTracker::GetNumLeaks(void) const
+{
+	return uiNumLeaks;
+}
+
+/**
+ @brief Draw the live resources of the tags in an ImGui window, as a table of the tags which have any.
+		This must be called inside the ImGui frame of the active game state
+ */
+void CResourceTracker::RenderOverlay(void)
+{
+#ifndef RESOURCE_TRACKER_DISABLED
+	ImGui::SetNextWindowPos(ImVec2(580.0f, 10.0f), ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowSize(ImVec2(680.0f, 300.0f), ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowBgAlpha(0.85f);
+	if (ImGui::Begin("Resources"))
+	{
+		ImGui::Text("%s, %u leaks reported", sCurrentState.c_str(), uiNumLeaks);
+		ImGui::Columns(NUM_GL_OBJECTS + 4, "Resources");
+		ImGui::Text("Tag");
+		ImGui::NextColumn();
+		ImGui::Text("Allocations");
+		ImGui::NextColumn();
+		ImGui::Text("KB");
+		ImGui::NextColumn();
+		for (unsigned int i = 0; i < NUM_GL_OBJECTS; i++)
+		{
+			ImGui::Text("%s", szGLObjectNames[i]);
+			ImGui::NextColumn();
+		}
+		ImGui::Text("GL KB");
+		ImGui::NextColumn();
+		ImGui::Separator();
+
+		const unsigned int uiCount = GetNumTags();
+		for (unsigned int uiTag = 0; uiTag < uiCount; uiTag++)
+		{
+			SLiveResources sLive = GetLiveResources(uiTag);
+			bool bEmpty = (sLive.llAllocations == 0) && (sLive.llGLBytes == 0);
+			for (unsigned int i = 0; i < NUM_GL_OBJECTS; i++)
+				bEmpty = bEmpty && (sLive.llGLObjects[i] == 0);
+			if (bEmpty)
+				continue;
+
+			ImGui::Text("%s", GetTagName(uiTag));
+			ImGui::NextColumn();
+			ImGui::Text("%lld", sLive.llAllocations);
+			ImGui::NextColumn();
+			ImGui::Text("%lld", sLive.llBytes / 1024);
+			ImGui::NextColumn();
+			for (unsigned int i = 0; i < NUM_GL_OBJECTS; i++)
+			{
+				ImGui::Text("%lld", sLive.llGLObjects[i]);
+				ImGui::NextColumn();
+			}
+			ImGui::Text("%lld", sLive.llGLBytes / 1024);
+			ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+	}
+	ImGui::End();
+#endif
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CResourceTracker::PrintSelf(void) const
+{
+	cout << "CResourceTracker: The live resources of each tag" << (bInstalled ? "" : ", without the GL objects")
+		<< ", " << uiNumLeaks << " leaks reported" << endl;
+	const unsigned int uiCount = GetNumTags();
+	for (unsigned int uiTag = 0; uiTag < uiCount; uiTag++)
+	{
+		SLiveResources sLive = GetLiveResources(uiTag);
+		cout << "\t" << GetTagName(uiTag) << ": " << sLive.llAllocations << " allocations of " << sLive.llBytes << " bytes";
+		for (unsigned int i = 0; i < NUM_GL_OBJECTS; i++)
+			cout << ", " << szGLObjectNames[i] << " " << sLive.llGLObjects[i];
+		cout << ", " << sLive.llGLBytes << " bytes of GL data" << endl;
+	}
+}
+
+/**
+ @brief Get the name of a kind of GL object
+ @param eObject A const GL_OBJECT containing the kind of the object
+ */
+const char* CResourceTracker::GetGLObjectName(const GL_OBJECT eObject)
+{
+	return szGLObjectNames[eObject];
+}
+
+/**
+ @brief Get the tag of the tracker's own allocations
+ */
+unsigned int CResourceTracker::GetTrackerTag(void)
+{
+	static const unsigned int uiTrackerTag = RegisterTag("CResourceTracker", __FILE__, __LINE__);
+	return uiTrackerTag;
+}
+
+/**
+ @brief Check if a tag grew. The bytes of its allocations must grow by more than LEAK_BYTES
+ @param sFrom A const SLiveResources& containing the earlier live resources of the tag
+ @param sTo A const SLiveResources& containing the later live resources of the tag
+ */
+bool CResourceTracker::HasGrown(const SLiveResources& sFrom, const SLiveResources& sTo)
+{
+	for (unsigned int i = 0; i < NUM_GL_OBJECTS; i++)
+	{
+		if (sTo.llGLObjects[i] > sFrom.llGLObjects[i])
+			return true;
+	}
+	if (sTo.llGLBytes > sFrom.llGLBytes)
+		return true;
+	return (sTo.llAllocations > sFrom.llAllocations) && (sTo.llBytes - sFrom.llBytes > LEAK_BYTES);
+}
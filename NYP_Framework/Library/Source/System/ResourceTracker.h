@@ -0,0 +1,189 @@
+/**
+ CResourceTracker
+ @brief A class which keeps the live CPU allocations and GL objects of the game, by the tag of the code which
+		created them, so that resources which are never freed can be found. A tag is a subsystem and the call
+		site which set it, and the innermost tag of a thread is given to what it creates.
+		The allocations through operator new are tracked by CAllocationCounter, the buffers, vertex arrays and
+		programs by wrapping their GLEW entry points, and the textures by CImageLoader.
+		The live resources are reported each time a game state is entered, and a tag which grew over the last
+		two times that the same game state was entered is reported as a leak.
+		Tag the code which follows in a scope with RESOURCE_TAG("Subsystem").
+		Define RESOURCE_TRACKER_DISABLED to compile the tracking out
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+
+class CResourceTracker : public CSingletonTemplate<CResourceTracker>
+{
+	friend CSingletonTemplate<CResourceTracker>;
+public:
+	// The kinds of GL objects which are tracked
+	enum GL_OBJECT
+	{
+		TEXTURES = 0,
+		BUFFERS,
+		VERTEX_ARRAYS,
+		PROGRAMS,
+		NUM_GL_OBJECTS
+	};
+
+	// The most tags which can be registered. The resources of the tags after these are kept as untagged
+	enum { MAX_TAGS = 128 };
+	// The longest name of a tag, including the call site
+	enum { MAX_TAG_NAME = 96 };
+
+	// The live resources of a tag
+	struct SLiveResources
+	{
+		long long llAllocations;
+		long long llBytes;
+		long long llGLObjects[NUM_GL_OBJECTS];
+		// The bytes of the textures and buffers
+		long long llGLBytes;
+	};
+
+	// Get the tag of a subsystem and call site, and register it if it is new. The tag 0 is the untagged resources
+	static unsigned int RegisterTag(const char* szSubsystem, const char* szFile, const int iLine);
+	// Get the tag which this thread gives to what it creates
+	static unsigned int GetCurrentTag(void);
+	// Set the tag which this thread gives to what it creates, and return the previous tag
+	static unsigned int SetCurrentTag(const unsigned int uiTag);
+	// Get the name of a tag
+	static const char* GetTagName(const unsigned int uiTag);
+	// Get the number of tags which were registered
+	static unsigned int GetNumTags(void);
+
+	// Add an allocation to the live resources of a tag. CAllocationCounter calls this from operator new
+	static void AddAllocation(const unsigned int uiTag, const unsigned long long ullBytes);
+	// Remove an allocation from the live resources of a tag. CAllocationCounter calls this from operator delete
+	static void RemoveAllocation(const unsigned int uiTag, const unsigned long long ullBytes);
+
+	// Wrap the GLEW entry points which create and delete the buffers, vertex arrays and programs.
+	// Call this after glewInit or CNullGLBackend::Install
+	void Install(void);
+
+	// Add a texture which was created, with the bytes of its pixels
+	void AddTexture(const unsigned int uiTexture, const unsigned long long ullBytes);
+	// Remove a texture which was deleted
+	void RemoveTexture(const unsigned int uiTexture);
+
+	// Add a GL object which was created by the current tag
+	void AddGLObject(const GL_OBJECT eObject, const unsigned int uiName);
+	// Remove a GL object which was deleted
+	void RemoveGLObject(const GL_OBJECT eObject, const unsigned int uiName);
+	// Set the bytes of a buffer which has data uploaded to it
+	void SetBufferBytes(const unsigned int uiName, const unsigned long long ullBytes);
+
+	// Get the live resources of a tag
+	SLiveResources GetLiveResources(const unsigned int uiTag) const;
+	// Get the live resources of all of the tags
+	SLiveResources GetTotalLiveResources(void) const;
+
+	// Report the live resources as a game state is entered, and the tags which grew over the last entries to it
+	void EnterState(const std::string& sState);
+
+	// Get the number of leaks which were reported
+	unsigned int GetNumLeaks(void) const;
+
+	// Draw the live resources of the tags in an ImGui window. The profiler overlay draws this
+	void RenderOverlay(void);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+	// Get the name of a kind of GL object
+	static const char* GetGLObjectName(const GL_OBJECT eObject);
+
+protected:
+	// A GL object, and the tag which created it
+	struct SGLObject
+	{
+		unsigned int uiTag;
+		unsigned long long ullBytes;
+	};
+
+	// The history of a game state
+	struct SStateHistory
+	{
+		unsigned int uiNumEntries;
+		// The live resources of each tag when the state was last entered
+		std::vector<SLiveResources> vLastEntry;
+		// True for a tag which grew between the last two entries
+		std::vector<bool> vGrew;
+		// True for a tag which was reported as a leak, so that it is only reported once for the state
+		std::vector<bool> vReported;
+	};
+
+	// The GL objects which are alive, by name
+	std::unordered_map<unsigned int, SGLObject> mapGLObjects[NUM_GL_OBJECTS];
+	// The live GL resources of each tag. The GL objects are only created on the main thread
+	long long llGLObjects[MAX_TAGS][NUM_GL_OBJECTS];
+	long long llGLBytes[MAX_TAGS];
+
+	// The history of each game state which was entered
+	std::map<std::string, SStateHistory> mapStates;
+	std::string sCurrentState;
+	unsigned int uiNumLeaks;
+
+	// True if the GLEW entry points were wrapped
+	bool bInstalled;
+
+	// Constructor
+	CResourceTracker(void);
+
+	// Destructor
+	virtual ~CResourceTracker(void);
+
+	// Check if a tag grew, ignoring small changes in the bytes of its allocations
+	static bool HasGrown(const SLiveResources& sFrom, const SLiveResources& sTo);
+
+	// Get the tag of the tracker's own allocations, which grow with the GL objects it tracks
+	static unsigned int GetTrackerTag(void);
+};
+
+/**
+ CResourceTag
+ @brief A class which sets the tag of this thread for the scope it is declared in.
+		Use RESOURCE_TAG instead of this class
+ */
+class CResourceTag
+{
+public:
+	// Constructor
+	explicit CResourceTag(const unsigned int uiTag)
+		: uiPreviousTag(CResourceTracker::SetCurrentTag(uiTag))
+	{
+	}
+
+	// Destructor
+	~CResourceTag(void)
+	{
+		CResourceTracker::SetCurrentTag(uiPreviousTag);
+	}
+
+protected:
+	unsigned int uiPreviousTag;
+
+private:
+	CResourceTag(const CResourceTag&);
+	CResourceTag& operator=(const CResourceTag&);
+};
+
+#define RESOURCE_TAG_CONCAT_INNER(a, b) a##b
+#define RESOURCE_TAG_CONCAT(a, b) RESOURCE_TAG_CONCAT_INNER(a, b)
+
+#ifndef RESOURCE_TRACKER_DISABLED
+	// Tag the resources which the rest of the scope creates with a subsystem and this call site
+	#define RESOURCE_TAG(szSubsystem) \
+		static const unsigned int RESOURCE_TAG_CONCAT(uiResourceTag, __LINE__) = CResourceTracker::RegisterTag(szSubsystem, __FILE__, __LINE__); \
+		CResourceTag RESOURCE_TAG_CONCAT(cResourceTag, __LINE__)(RESOURCE_TAG_CONCAT(uiResourceTag, __LINE__))
+#else
+	#define RESOURCE_TAG(szSubsystem)
+#endif
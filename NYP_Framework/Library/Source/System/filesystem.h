@@ -7,6 +7,7 @@
 
 #include <string>
 #include <cstdlib>
+#include <algorithm>
 #include "../GameControl/Settings.h"
 
 #ifdef __linux__ 
@@ -26,7 +27,14 @@ public:
 	static std::string getPath(const std::string& path)
 	{
 		static std::string(*pathBuilder)(std::string const &) = getPathBuilder();
+#ifdef _WIN32
 		return (*pathBuilder)(path);
+#else
+		// The paths in the game are separated with either slash, but only '/' separates directories outside Windows
+		std::string sPath(path);
+		std::replace(sPath.begin(), sPath.end(), '\\', '/');
+		return (*pathBuilder)(sPath);
+#endif
 	}
 
 private:
@@ -0,0 +1,269 @@
+/**
+ CFramePacer
+ @brief A class which ends each frame at the right time for the frame pacing mode, and measures how evenly
+		the frames are paced. It sleeps until just before the end of a frame, then spins for the rest,
+		so that it is accurate without keeping a core busy for the whole wait
+ */
+#include "FramePacer.h"
+
+// Include CProfiler, to show the time spent waiting in the frame times
+#include "Profiler.h"
+
+#include <thread>
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+#if defined(_WIN32)
+#include <windows.h>
+#pragma comment(lib, "winmm.lib")
+#elif defined(__linux__)
+#include <time.h>
+#include <errno.h>
+#endif
+
+/**
+ @brief Constructor
+ */
+CFramePacer::CFramePacer(void)
+	: eMode(CAPPED)
+	, dTargetFrameRate(60.0)
+	, dSpinWindow(0.002)
+	, uiHistoryIndex(0)
+	, uiHistorySize(0)
+{
+	vFrameTimes.resize(NUM_HISTORY, 0.0);
+	vOvershoots.resize(NUM_HISTORY, 0.0);
+
+#if defined(_WIN32)
+	// Make Sleep wake up within about 1 ms instead of the default 15.6 ms
+	timeBeginPeriod(1);
+#endif
+}
+
+/**
+ @brief Destructor
+ */
+CFramePacer::~CFramePacer(void)
+{
+#if defined(_WIN32)
+	timeEndPeriod(1);
+#endif
+}
+
+/**
+ @brief Start timing the first frame
+ @param eMode A const MODE containing the pacing mode
+ @param dTargetFrameRate A const double containing the frame rate used by the CAPPED mode
+ @param dSpinWindow A const double containing how many seconds before the end of a frame to stop sleeping and spin
+ */
+void CFramePacer::Init(const MODE eMode, const double dTargetFrameRate, const double dSpinWindow)
+{
+	SetMode(eMode);
+	SetTargetFrameRate(dTargetFrameRate);
+	SetSpinWindow(dSpinWindow);
+
+	previousFrameEnd = Clock::now();
+	nextDeadline = previousFrameEnd;
+	uiHistoryIndex = 0;
+	uiHistorySize = 0;
+}
+
+/**
+ @brief Set the pacing mode
+ @param eMode A const MODE containing the pacing mode
+ */
+void CFramePacer::SetMode(const MODE eMode)
+{
+	if ((eMode < VSYNC) || (eMode >= NUM_MODES))
+	{
+		cout << "CFramePacer::SetMode: Invalid mode " << eMode << endl;
+		return;
+	}
+
+	// Start the CAPPED schedule from now, instead of catching up on the frames of the previous mode
+	if ((eMode == CAPPED) && (this->eMode != CAPPED))
+		nextDeadline = Clock::now();
+	this->eMode = eMode;
+}
+
+/**
+ @brief Get the pacing mode
+ */
+CFramePacer::MODE CFramePacer::GetMode(void) const
+{
+	return eMode;
+}
+
+/**
+ @brief Set the frame rate used by the CAPPED mode
+ @param dTargetFrameRate A const double containing the frames per second
+ */
+void CFramePacer::SetTargetFrameRate(const double dTargetFrameRate)
+{
+	if (dTargetFrameRate <= 0.0)
+	{
+		cout << "CFramePacer::SetTargetFrameRate: Invalid frame rate " << dTargetFrameRate << endl;
+		return;
+	}
+	this->dTargetFrameRate = dTargetFrameRate;
+}
+
+/**
+ @brief Get the frame rate used by the CAPPED mode
+ */
+double CFramePacer::GetTargetFrameRate(void) const
+{
+	return dTargetFrameRate;
+}
+
+/**
+ @brief Set how many seconds before the end of a frame to stop sleeping and spin. A longer window is more
+		accurate when the sleeps wake up late, but uses more CPU
+ @param dSpinWindow A const double containing the spin window in seconds
+ */
+void CFramePacer::SetSpinWindow(const double dSpinWindow)
+{
+	this->dSpinWindow = (dSpinWindow > 0.0) ? dSpinWindow : 0.0;
+}
+
+/**
+ @brief Get how many seconds before the end of a frame to stop sleeping and spin
+ */
+double CFramePacer::GetSpinWindow(void) const
+{
+	return dSpinWindow;
+}
+
+/**
+ @brief Get the swap interval which the window should use for the pacing mode
+ */
+int CFramePacer::GetSwapInterval(void) const
+{
+	return (eMode == VSYNC) ? 1 : 0;
+}
+
+/**
+ @brief Wait until the end of this frame
+ @return The time since the end of the previous frame in seconds
+ */
+double CFramePacer::EndFrame(void)
+{
+	PROFILE_SCOPE_CATEGORY("CFramePacer::EndFrame", "wait");
+
+	double dOvershoot = 0.0;
+	if (eMode == CAPPED)
+	{
+		const Clock::duration framePeriod = std::chrono::duration_cast<Clock::duration>(
+			std::chrono::duration<double>(1.0 / dTargetFrameRate));
+		nextDeadline += framePeriod;
+
+		Clock::time_point now = Clock::now();
+		if (now > nextDeadline + framePeriod)
+		{
+			// This frame was more than a frame late, so start a new schedule instead of rushing the next frames
+			nextDeadline = now;
+		}
+		else if (now < nextDeadline)
+		{
+			WaitUntil(nextDeadline);
+			dOvershoot = std::chrono::duration<double>(Clock::now() - nextDeadline).count();
+		}
+	}
+
+	Clock::time_point frameEnd = Clock::now();
+	double dFrameTime = std::chrono::duration<double>(frameEnd - previousFrameEnd).count();
+	previousFrameEnd = frameEnd;
+
+	vFrameTimes[uiHistoryIndex] = dFrameTime;
+	vOvershoots[uiHistoryIndex] = dOvershoot;
+	uiHistoryIndex = (uiHistoryIndex + 1) % NUM_HISTORY;
+	if (uiHistorySize < NUM_HISTORY)
+		uiHistorySize++;
+
+	return dFrameTime;
+}
+
+/**
+ @brief Get the frame time statistics of the recent frames
+ */
+CFramePacer::SStats CFramePacer::GetStats(void) const
+{
+	SStats sStats;
+	sStats.uiNumFrames = uiHistorySize;
+	sStats.dMean = sStats.dMin = sStats.dMax = sStats.dJitter = sStats.dMeanOvershoot = 0.0;
+	if (uiHistorySize == 0)
+		return sStats;
+
+	double dSum = 0.0, dOvershootSum = 0.0;
+	sStats.dMin = sStats.dMax = vFrameTimes[0];
+	for (unsigned int i = 0; i < uiHistorySize; i++)
+	{
+		dSum += vFrameTimes[i];
+		dOvershootSum += vOvershoots[i];
+		if (vFrameTimes[i] < sStats.dMin)
+			sStats.dMin = vFrameTimes[i];
+		if (vFrameTimes[i] > sStats.dMax)
+			sStats.dMax = vFrameTimes[i];
+	}
+	sStats.dMean = dSum / uiHistorySize;
+	sStats.dMeanOvershoot = dOvershootSum / uiHistorySize;
+
+	double dVariance = 0.0;
+	for (unsigned int i = 0; i < uiHistorySize; i++)
+		dVariance += (vFrameTimes[i] - sStats.dMean) * (vFrameTimes[i] - sStats.dMean);
+	sStats.dJitter = sqrt(dVariance / uiHistorySize);
+
+	return sStats;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CFramePacer::PrintSelf(void) const
+{
+	static const char* szModeNames[NUM_MODES] = { "vsync", "uncapped", "capped" };
+	SStats sStats = GetStats();
+
+	cout << "CFramePacer: " << szModeNames[eMode] << ", target " << dTargetFrameRate << " fps, spin window "
+		<< dSpinWindow * 1000.0 << " ms" << endl;
+	cout << "Last " << sStats.uiNumFrames << " frames: mean " << sStats.dMean * 1000.0 << " ms, min "
+		<< sStats.dMin * 1000.0 << " ms, max " << sStats.dMax * 1000.0 << " ms, jitter "
+		<< sStats.dJitter * 1000.0 << " ms, mean overshoot " << sStats.dMeanOvershoot * 1000.0 << " ms" << endl;
+}
+
+/**
+ @brief Sleep until the spin window before a time, then spin until the time
+ @param deadline A const Clock::time_point& containing the time to wait until
+ */
+void CFramePacer::WaitUntil(const Clock::time_point& deadline)
+{
+	const Clock::time_point wakeTime = deadline - std::chrono::duration_cast<Clock::duration>(
+		std::chrono::duration<double>(dSpinWindow));
+	if (Clock::now() < wakeTime)
+		SleepUntil(wakeTime);
+
+	while (Clock::now() < deadline)
+		std::this_thread::yield();
+}
+
+/**
+ @brief Sleep the thread until a time. The sleep may end a little late
+ @param wakeTime A const Clock::time_point& containing the time to wake up
+ */
+void CFramePacer::SleepUntil(const Clock::time_point& wakeTime)
+{
+#if defined(__linux__)
+	// steady_clock uses CLOCK_MONOTONIC on Linux, so the deadline can be passed to the kernel directly.
+	// An absolute deadline does not drift if the sleep is interrupted and restarted
+	const long long llNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(wakeTime.time_since_epoch()).count();
+	timespec sWakeTime;
+	sWakeTime.tv_sec = (time_t)(llNanoseconds / 1000000000LL);
+	sWakeTime.tv_nsec = (long)(llNanoseconds % 1000000000LL);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &sWakeTime, NULL) == EINTR)
+	{
+	}
+#else
+	std::this_thread::sleep_until(wakeTime);
+#endif
+}
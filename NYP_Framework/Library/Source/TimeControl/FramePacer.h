@@ -0,0 +1,99 @@
+/**
+ CFramePacer
+ @brief A class which ends each frame at the right time for the frame pacing mode, and measures how evenly
+		the frames are paced. It sleeps until just before the end of a frame, then spins for the rest,
+		so that it is accurate without keeping a core busy for the whole wait
+ */
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+class CFramePacer
+{
+public:
+	// How the frames are paced
+	enum MODE
+	{
+		VSYNC = 0,		// Swapping the buffers waits for the display's refresh
+		UNCAPPED,		// Frames end as soon as they are done
+		CAPPED,			// Frames end at the target frame rate
+		NUM_MODES
+	};
+
+	// The frame time statistics of the recent frames, in seconds
+	struct SStats
+	{
+		unsigned int uiNumFrames;
+		double dMean;
+		double dMin;
+		double dMax;
+		// The standard deviation of the frame times
+		double dJitter;
+		// The mean time by which the waits overshot the end of the frame
+		double dMeanOvershoot;
+	};
+
+	// Constructor
+	CFramePacer(void);
+
+	// Destructor
+	virtual ~CFramePacer(void);
+
+	// Start timing the first frame
+	void Init(const MODE eMode, const double dTargetFrameRate, const double dSpinWindow = 0.002);
+
+	// Set the pacing mode
+	void SetMode(const MODE eMode);
+
+	// Get the pacing mode
+	MODE GetMode(void) const;
+
+	// Set the frame rate used by the CAPPED mode
+	void SetTargetFrameRate(const double dTargetFrameRate);
+
+	// Get the frame rate used by the CAPPED mode
+	double GetTargetFrameRate(void) const;
+
+	// Set how many seconds before the end of a frame to stop sleeping and spin
+	void SetSpinWindow(const double dSpinWindow);
+
+	// Get how many seconds before the end of a frame to stop sleeping and spin
+	double GetSpinWindow(void) const;
+
+	// Get the swap interval which the window should use for the pacing mode
+	int GetSwapInterval(void) const;
+
+	// Wait until the end of this frame, and return the time since the end of the previous frame in seconds
+	double EndFrame(void);
+
+	// Get the frame time statistics of the recent frames
+	SStats GetStats(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	typedef std::chrono::steady_clock Clock;
+
+	MODE eMode;
+	double dTargetFrameRate;
+	double dSpinWindow;
+
+	// When the previous frame ended, and when the current frame should end in the CAPPED mode
+	Clock::time_point previousFrameEnd;
+	Clock::time_point nextDeadline;
+
+	// The frame times and wait overshoots of the recent frames, in a ring buffer
+	static const unsigned int NUM_HISTORY = 240;
+	std::vector<double> vFrameTimes;
+	std::vector<double> vOvershoots;
+	unsigned int uiHistoryIndex;
+	unsigned int uiHistorySize;
+
+	// Sleep until a time, then spin for the end of the spin window
+	void WaitUntil(const Clock::time_point& deadline);
+
+	// Sleep the thread until a time. The sleep may end a little late
+	static void SleepUntil(const Clock::time_point& wakeTime);
+};
@@ -0,0 +1,875 @@
+/**
+ CProfiler
+ @brief A class which times the scopes of each frame on the main thread, and builds a call tree of them.
+		It keeps the call trees of the recent frames, and draws them in an ImGui overlay
+ */
+#include "Profiler.h"
+
+// Include ImGui, to draw the overlay
+#include "../GUI/imgui.h"
+#include "../GUI/imgui_internal.h"
+// Include CRenderStats, which draws its counts beside the overlay
+#include "../RenderControl/RenderStats.h"
+// Include CGPUTimer, which draws the GPU times in the overlay
+#include "../RenderControl/GPUTimer.h"
+// Include CResourceTracker, which draws the live resources beside the overlay
+#include "../System/ResourceTracker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+// The number of slowest scopes which are listed
+static const unsigned int NUM_TOP_SCOPES = 12;
+// The number of recent frames which the slowest scopes are added up over
+static const unsigned int NUM_TOP_SCOPE_FRAMES = 60;
+// The shortest time in seconds between two traces which are saved for slow frames
+static const double TRACE_SPIKE_INTERVAL = 5.0;
+
+unsigned int CProfiler::uiLastGeneration = 0;
+thread_local CProfiler::SThreadTrace* CProfiler::pThisThreadTrace = NULL;
+thread_local unsigned int CProfiler::uiThisThreadGeneration = 0;
+
+/**
+ @brief Check if two scope names are the same. Names are usually string literals, so the pointers are compared first
+ */
+static bool IsSameName(const char* szName1, const char* szName2)
+{
+	return (szName1 == szName2) || (strcmp(szName1, szName2) == 0);
+}
+
+/**
+ @brief Print the children of a scope and their children, indented by depth
+ @param vScopes A const std::vector<CProfiler::SScope>& containing the scopes of a frame
+ @param iParent A const int containing the index of the scope, or -1 to print the whole frame
+ */
+static void PrintScopes(const std::vector<CProfiler::SScope>& vScopes, const int iParent)
+{
+	for (unsigned int i = iParent + 1; i < vScopes.size(); i++)
+	{
+		if (vScopes[i].iParent != iParent)
+			continue;
+		cout << "\t" << string(vScopes[i].uiDepth * 2, ' ') << vScopes[i].szName << ": " << vScopes[i].dTime * 1000.0
+			<< " ms, " << vScopes[i].uiNumCalls << " calls" << endl;
+		PrintScopes(vScopes, (int)i);
+	}
+}
+
+/**
+ @brief Constructor. The thread which creates the profiler is the thread which is timed
+ */
+CProfiler::CProfiler(void)
+	: bEnabled(true)
+	, bOverlayVisible(false)
+	, bPaused(false)
+	, dFrameBudget(1.0 / 30.0)
+	, mainThreadId(std::this_thread::get_id())
+	, iCurrentScope(-1)
+	, uiHistoryIndex(0)
+	, uiHistorySize(0)
+	, uiSelectedFrame(0)
+	, uiFramesSinceTopScopes(0)
+	, bTraceRecording(true)
+	, dTraceSpikeTime(0.0)
+	, sTraceFilePrefix("Trace")
+	, uiNumTracesSaved(0)
+	, pGPUTrace(NULL)
+	, uiNextCounter(0)
+	, uiNumCounters(0)
+	, uiGeneration(++uiLastGeneration)
+{
+	sCurrentFrame.dTime = 0.0;
+	vHistory.resize(NUM_HISTORY);
+	for (unsigned int i = 0; i < NUM_HISTORY; i++)
+		vHistory[i].dTime = 0.0;
+	frameStart = Clock::now();
+	traceStart = frameStart;
+	lastSpikeTrace = frameStart - std::chrono::seconds(60);
+}
+
+/**
+ @brief Destructor
+ */
+CProfiler::~CProfiler(void)
+{
+	std::lock_guard<std::mutex> lock(threadTracesMutex);
+	for (unsigned int i = 0; i < vThreadTraces.size(); i++)
+		delete vThreadTraces[i];
+	vThreadTraces.clear();
+}
+
+/**
+ @brief Set if the scopes are timed
+ @param bEnabled A const bool which is true to time the scopes
+ */
+void CProfiler::SetEnabled(const bool bEnabled)
+{
+	this->bEnabled = bEnabled;
+}
+
+/**
+ @brief Check if the scopes are timed
+ */
+bool CProfiler::IsEnabled(void) const
+{
+	return bEnabled;
+}
+
+/**
+ @brief Set if the overlay is drawn
+ @param bOverlayVisible A const bool which is true to draw the overlay
+ */
+void CProfiler::SetOverlayVisible(const bool bOverlayVisible)
+{
+	this->bOverlayVisible = bOverlayVisible;
+}
+
+/**
+ @brief Check if the overlay is drawn
+ */
+bool CProfiler::IsOverlayVisible(void) const
+{
+	return bOverlayVisible;
+}
+
+/**
+ @brief Set the frame time in seconds above which a frame is shown as a spike
+ @param dFrameBudget A const double containing the frame time in seconds
+ */
+void CProfiler::SetFrameBudget(const double dFrameBudget)
+{
+	if (dFrameBudget > 0.0)
+		this->dFrameBudget = dFrameBudget;
+}
+
+/**
+ @brief Get the frame time in seconds above which a frame is shown as a spike
+ */
+double CProfiler::GetFrameBudget(void) const
+{
+	return dFrameBudget;
+}
+
+/**
+ @brief Start timing a scope. A scope which is called again inside the same parent adds to the same node
+ @param szName A const char* containing the name of the scope, which must stay valid
+ @return false if the scope is not timed, because the profiler is disabled or this is not the main thread
+ */
+bool CProfiler::BeginScope(const char* szName)
+{
+	if ((bEnabled == false) || (std::this_thread::get_id() != mainThreadId))
+		return false;
+
+	// Find the node of an earlier call in the same parent. The children of a scope are after it
+	int iScope = -1;
+	for (int i = iCurrentScope + 1; i < (int)sCurrentFrame.vScopes.size(); i++)
+	{
+		if ((sCurrentFrame.vScopes[i].iParent == iCurrentScope) && (IsSameName(sCurrentFrame.vScopes[i].szName, szName)))
+		{
+			iScope = i;
+			break;
+		}
+	}
+
+	Clock::time_point now = Clock::now();
+	if (iScope < 0)
+	{
+		SScope sScope;
+		sScope.szName = szName;
+		sScope.iParent = iCurrentScope;
+		sScope.uiDepth = (unsigned int)vScopeStarts.size();
+		sScope.dStart = std::chrono::duration<double>(now - frameStart).count();
+		sScope.dTime = 0.0;
+		sScope.uiNumCalls = 0;
+		sCurrentFrame.vScopes.push_back(sScope);
+		iScope = (int)sCurrentFrame.vScopes.size() - 1;
+	}
+	sCurrentFrame.vScopes[iScope].uiNumCalls++;
+
+	iCurrentScope = iScope;
+	vScopeStarts.push_back(now);
+	return true;
+}
+
+/**
+ @brief Stop timing the latest scope which was started
+ */
+void CProfiler::EndScope(void)
+{
+	if ((iCurrentScope < 0) || (vScopeStarts.empty()))
+		return;
+
+	SScope& sScope = sCurrentFrame.vScopes[iCurrentScope];
+	sScope.dTime += std::chrono::duration<double>(Clock::now() - vScopeStarts.back()).count();
+	vScopeStarts.pop_back();
+	iCurrentScope = sScope.iParent;
+}
+
+/**
+ @brief End the frame and start the next one
+ */
+void CProfiler::EndFrame(void)
+{
+	Clock::time_point now = Clock::now();
+	if (vScopeStarts.empty() == false)
+	{
+		cout << "CProfiler::EndFrame: " << vScopeStarts.size() << " scopes have not ended" << endl;
+		vScopeStarts.clear();
+	}
+	iCurrentScope = -1;
+
+	sCurrentFrame.dTime = std::chrono::duration<double>(now - frameStart).count();
+	frameStart = now;
+
+	// Save a trace of a slow frame, such as a state change which loads its assets, while its scopes are still kept
+	if ((dTraceSpikeTime > 0.0) && (sCurrentFrame.dTime > dTraceSpikeTime) && (bTraceRecording)
+		&& (std::chrono::duration<double>(now - lastSpikeTrace).count() > TRACE_SPIKE_INTERVAL))
+	{
+		cout << "CProfiler: Frame took " << sCurrentFrame.dTime * 1000.0 << " ms, saving a trace" << endl;
+		SaveTrace();
+		lastSpikeTrace = Clock::now();
+	}
+
+	if (bPaused == false)
+	{
+		// Swap the frame into the history, so that the vector of the oldest frame is reused without allocating
+		SFrame& sOldestFrame = vHistory[uiHistoryIndex];
+		sOldestFrame.vScopes.swap(sCurrentFrame.vScopes);
+		sOldestFrame.dTime = sCurrentFrame.dTime;
+		uiHistoryIndex = (uiHistoryIndex + 1) % NUM_HISTORY;
+		if (uiHistorySize < NUM_HISTORY)
+			uiHistorySize++;
+	}
+	sCurrentFrame.vScopes.clear();
+}
+
+/**
+ @brief Get the number of frames which are kept
+ */
+unsigned int CProfiler::GetNumFrames(void) const
+{
+	return uiHistorySize;
+}
+
+/**
+ @brief Get a frame which ended
+ @param uiFramesAgo A const unsigned int containing the number of frames before the latest frame. It must be less than GetNumFrames
+ */
+const CProfiler::SFrame& CProfiler::GetFrame(const unsigned int uiFramesAgo) const
+{
+	return vHistory[(uiHistoryIndex + NUM_HISTORY - 1 - uiFramesAgo) % NUM_HISTORY];
+}
+
+/**
+ @brief Draw the overlay into the ImGui frame of the active game state. This must be called before ImGui::Render
+ */
+void CProfiler::RenderOverlay(void)
+{
+	if (bOverlayVisible == false)
+		return;
+
+	// Nothing can be drawn if the active game state did not start an ImGui frame
+	ImGuiContext* pImGuiContext = ImGui::GetCurrentContext();
+	if ((pImGuiContext == NULL) || (pImGuiContext->WithinFrameScope == false))
+		return;
+
+	if ((vTopScopes.empty()) || (++uiFramesSinceTopScopes >= 30))
+	{
+		UpdateTopScopes();
+		uiFramesSinceTopScopes = 0;
+	}
+
+	ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowSize(ImVec2(560.0f, 420.0f), ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowBgAlpha(0.85f);
+	if (ImGui::Begin("Profiler", &bOverlayVisible))
+	{
+		if (uiHistorySize > 0)
+		{
+			const SFrame& sLatestFrame = GetFrame(0);
+			ImGui::Text("Frame %.2f ms, budget %.2f ms", sLatestFrame.dTime * 1000.0, dFrameBudget * 1000.0);
+			ImGui::SameLine();
+			if (ImGui::Checkbox("Pause", &bPaused) && (bPaused == false))
+				uiSelectedFrame = 0;
+			if (bTraceRecording)
+			{
+				ImGui::SameLine();
+				if (ImGui::Button("Save trace"))
+					SaveTrace();
+			}
+			CGPUTimer::GetInstance()->RenderOverlay();
+
+			RenderFrameGraph();
+			RenderFlameGraph();
+			RenderTopScopes();
+		}
+		else
+		{
+			ImGui::Text("No frames yet");
+		}
+	}
+	ImGui::End();
+
+	// The GL calls of the same frames, and the live resources, are shown beside the profiler
+	CRenderStats::GetInstance()->RenderOverlay();
+	CResourceTracker::GetInstance()->RenderOverlay();
+}
+
+/**
+ @brief Add up the times of the scopes of the recent frames by name, from the slowest
+ */
+void CProfiler::UpdateTopScopes(void)
+{
+	vTopScopes.clear();
+	const unsigned int uiNumFrames = (uiHistorySize < NUM_TOP_SCOPE_FRAMES) ? uiHistorySize : NUM_TOP_SCOPE_FRAMES;
+	if (uiNumFrames == 0)
+		return;
+
+	for (unsigned int uiFrame = 0; uiFrame < uiNumFrames; uiFrame++)
+	{
+		const std::vector<SScope>& vScopes = GetFrame(uiFrame).vScopes;
+		for (unsigned int i = 0; i < vScopes.size(); i++)
+		{
+			// The self time of a scope does not include the time of its children
+			double dSelfTime = vScopes[i].dTime;
+			for (unsigned int j = i + 1; j < vScopes.size(); j++)
+			{
+				if (vScopes[j].iParent == (int)i)
+					dSelfTime -= vScopes[j].dTime;
+			}
+
+			unsigned int uiTotal = 0;
+			while ((uiTotal < vTopScopes.size()) && (IsSameName(vTopScopes[uiTotal].szName, vScopes[i].szName) == false))
+				uiTotal++;
+			if (uiTotal == vTopScopes.size())
+			{
+				SScopeTotal sTotal;
+				sTotal.szName = vScopes[i].szName;
+				sTotal.dSelfTime = sTotal.dTime = 0.0;
+				sTotal.dNumCalls = 0.0;
+				vTopScopes.push_back(sTotal);
+			}
+			vTopScopes[uiTotal].dSelfTime += dSelfTime;
+			vTopScopes[uiTotal].dTime += vScopes[i].dTime;
+			vTopScopes[uiTotal].dNumCalls += vScopes[i].uiNumCalls;
+		}
+	}
+
+	// Show the averages per frame
+	for (unsigned int i = 0; i < vTopScopes.size(); i++)
+	{
+		vTopScopes[i].dSelfTime /= uiNumFrames;
+		vTopScopes[i].dTime /= uiNumFrames;
+		vTopScopes[i].dNumCalls /= uiNumFrames;
+	}
+	sort(vTopScopes.begin(), vTopScopes.end(),
+		[](const SScopeTotal& a, const SScopeTotal& b) { return a.dSelfTime > b.dSelfTime; });
+	if (vTopScopes.size() > NUM_TOP_SCOPES)
+		vTopScopes.resize(NUM_TOP_SCOPES);
+}
+
+/**
+ @brief Draw the graph of the frame times, with the frames over the budget in red.
+		Clicking on a frame shows it in the flame graph
+ */
+void CProfiler::RenderFrameGraph(void)
+{
+	const float fWidth = ImGui::GetContentRegionAvail().x;
+	const float fHeight = 80.0f;
+	const ImVec2 vec2Min = ImGui::GetCursorScreenPos();
+	const ImVec2 vec2Max(vec2Min.x + fWidth, vec2Min.y + fHeight);
+	ImGui::InvisibleButton("FrameGraph", ImVec2(fWidth, fHeight));
+	ImDrawList* pDrawList = ImGui::GetWindowDrawList();
+	pDrawList->AddRectFilled(vec2Min, vec2Max, IM_COL32(20, 20, 20, 200));
+
+	// Scale the graph to fit twice the budget, or the slowest frame if it is slower
+	double dMaxTime = dFrameBudget * 2.0;
+	for (unsigned int i = 0; i < uiHistorySize; i++)
+	{
+		if (GetFrame(i).dTime > dMaxTime)
+			dMaxTime = GetFrame(i).dTime;
+	}
+
+	// The latest frame is on the right
+	const float fBarWidth = fWidth / NUM_HISTORY;
+	for (unsigned int i = 0; i < uiHistorySize; i++)
+	{
+		const double dTime = GetFrame(i).dTime;
+		const float fRight = vec2Max.x - i * fBarWidth;
+		const float fTop = vec2Max.y - (float)(dTime / dMaxTime) * fHeight;
+		ImU32 uiColour = (dTime > dFrameBudget) ? IM_COL32(230, 60, 60, 255) : IM_COL32(90, 200, 90, 255);
+		if (i == uiSelectedFrame)
+			uiColour = IM_COL32(255, 255, 255, 255);
+		pDrawList->AddRectFilled(ImVec2(fRight - fBarWidth, fTop), ImVec2(fRight, vec2Max.y), uiColour);
+	}
+
+	// The budget line
+	const float fBudgetY = vec2Max.y - (float)(dFrameBudget / dMaxTime) * fHeight;
+	pDrawList->AddLine(ImVec2(vec2Min.x, fBudgetY), ImVec2(vec2Max.x, fBudgetY), IM_COL32(255, 200, 0, 255));
+
+	if (ImGui::IsItemHovered())
+	{
+		unsigned int uiFrame = (unsigned int)((vec2Max.x - ImGui::GetIO().MousePos.x) / fBarWidth);
+		if (uiFrame < uiHistorySize)
+		{
+			ImGui::SetTooltip("%u frames ago: %.2f ms", uiFrame, GetFrame(uiFrame).dTime * 1000.0);
+			if (ImGui::IsMouseClicked(0))
+			{
+				// Keep the clicked frame in the history while it is looked at
+				uiSelectedFrame = uiFrame;
+				bPaused = true;
+			}
+		}
+	}
+	if ((bPaused == false) || (uiSelectedFrame >= uiHistorySize))
+		uiSelectedFrame = 0;
+}
+
+/**
+ @brief Draw the call tree of the selected frame as a flame graph. The width of a scope is its share of the
+		frame time, and the children of a scope are drawn below it, in the order they were first called
+ */
+void CProfiler::RenderFlameGraph(void)
+{
+	const SFrame& sFrame = GetFrame(uiSelectedFrame);
+	const std::vector<SScope>& vScopes = sFrame.vScopes;
+
+	unsigned int uiMaxDepth = 0;
+	for (unsigned int i = 0; i < vScopes.size(); i++)
+	{
+		if (vScopes[i].uiDepth > uiMaxDepth)
+			uiMaxDepth = vScopes[i].uiDepth;
+	}
+
+	const float fRowHeight = ImGui::GetTextLineHeight() + 4.0f;
+	const float fWidth = ImGui::GetContentRegionAvail().x;
+	const float fHeight = fRowHeight * (uiMaxDepth + 1);
+	const ImVec2 vec2Min = ImGui::GetCursorScreenPos();
+	ImGui::InvisibleButton("FlameGraph", ImVec2(fWidth, fHeight));
+	const bool bHovered = ImGui::IsItemHovered();
+	const ImVec2 vec2Mouse = ImGui::GetIO().MousePos;
+	ImDrawList* pDrawList = ImGui::GetWindowDrawList();
+
+	// The x position where the next child of each scope is drawn
+	std::vector<float> vNextChildX(vScopes.size());
+	float fNextRootX = vec2Min.x;
+	const double dFrameTime = (sFrame.dTime > 0.0) ? sFrame.dTime : 1.0;
+
+	for (unsigned int i = 0; i < vScopes.size(); i++)
+	{
+		const SScope& sScope = vScopes[i];
+		float& fX = (sScope.iParent < 0) ? fNextRootX : vNextChildX[sScope.iParent];
+		const float fScopeWidth = (float)(sScope.dTime / dFrameTime) * fWidth;
+		const ImVec2 vec2ScopeMin(fX, vec2Min.y + sScope.uiDepth * fRowHeight);
+		const ImVec2 vec2ScopeMax(fX + fScopeWidth, vec2ScopeMin.y + fRowHeight - 1.0f);
+		vNextChildX[i] = fX;
+		fX += fScopeWidth;
+
+		// Give each name its own colour, so that a scope can be followed between frames
+		unsigned int uiHash = 2166136261u;
+		for (const char* pChar = sScope.szName; *pChar; pChar++)
+			uiHash = (uiHash ^ (unsigned char)*pChar) * 16777619u;
+		const ImU32 uiColour = IM_COL32(120 + (uiHash & 0x7F), 80 + ((uiHash >> 8) & 0x7F), 40 + ((uiHash >> 16) & 0x3F), 255);
+		pDrawList->AddRectFilled(vec2ScopeMin, vec2ScopeMax, uiColour);
+
+		// Only write the name if it fits
+		if (ImGui::CalcTextSize(sScope.szName).x + 4.0f < fScopeWidth)
+			pDrawList->AddText(ImVec2(vec2ScopeMin.x + 2.0f, vec2ScopeMin.y + 2.0f), IM_COL32(0, 0, 0, 255), sScope.szName);
+
+		if ((bHovered) && (vec2Mouse.x >= vec2ScopeMin.x) && (vec2Mouse.x < vec2ScopeMax.x)
+			&& (vec2Mouse.y >= vec2ScopeMin.y) && (vec2Mouse.y < vec2ScopeMax.y))
+		{
+			ImGui::SetTooltip("%s\n%.3f ms (%.1f%%), %u calls", sScope.szName, sScope.dTime * 1000.0,
+				sScope.dTime * 100.0 / dFrameTime, sScope.uiNumCalls);
+		}
+	}
+}
+
+/**
+ @brief Draw the list of the scopes which took the most time of their own in the recent frames, as averages per frame
+ */
+void CProfiler::RenderTopScopes(void)
+{
+	ImGui::Separator();
+	ImGui::Columns(4, "TopScopes");
+	ImGui::Text("Scope");
+	ImGui::NextColumn();
+	ImGui::Text("Self ms");
+	ImGui::NextColumn();
+	ImGui::Text("Total ms");
+	ImGui::NextColumn();
+	ImGui::Text("Calls");
+	ImGui::NextColumn();
+	ImGui::Separator();
+	for (unsigned int i = 0; i < vTopScopes.size(); i++)
+	{
+		ImGui::Text("%s", vTopScopes[i].szName);
+		ImGui::NextColumn();
+		ImGui::Text("%.3f", vTopScopes[i].dSelfTime * 1000.0);
+		ImGui::NextColumn();
+		ImGui::Text("%.3f", vTopScopes[i].dTime * 1000.0);
+		ImGui::NextColumn();
+		ImGui::Text("%.1f", vTopScopes[i].dNumCalls);
+		ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+}
+
+/**
+ @brief Set if the recent scopes of every thread are kept for a trace
+ @param bTraceRecording A const bool which is true to keep the scopes
+ */
+void CProfiler::SetTraceRecording(const bool bTraceRecording)
+{
+	this->bTraceRecording = bTraceRecording;
+}
+
+/**
+ @brief Check if the recent scopes of every thread are kept for a trace
+ */
+bool CProfiler::IsTraceRecording(void) const
+{
+	return bTraceRecording;
+}
+
+/**
+ @brief Set the frame time in seconds above which a trace is saved
+ @param dTraceSpikeTime A const double containing the frame time in seconds. 0 never saves a trace for a slow frame
+ */
+void CProfiler::SetTraceSpikeTime(const double dTraceSpikeTime)
+{
+	this->dTraceSpikeTime = (dTraceSpikeTime > 0.0) ? dTraceSpikeTime : 0.0;
+}
+
+/**
+ @brief Set the start of the names of the trace files
+ @param sTraceFilePrefix A const std::string& containing the start of the names, which may include a folder
+ */
+void CProfiler::SetTraceFilePrefix(const std::string& sTraceFilePrefix)
+{
+	this->sTraceFilePrefix = sTraceFilePrefix;
+}
+
+/**
+ @brief Set the name of this thread in the traces
+ @param sName A const std::string& containing the name
+ */
+void CProfiler::SetThreadName(const std::string& sName)
+{
+	SThreadTrace* pTrace = GetThreadTrace();
+	std::lock_guard<std::mutex> lock(pTrace->eventsMutex);
+	pTrace->sName = sName;
+}
+
+/**
+ @brief Add a scope which has ended to the trace of this thread
+ @param szName A const char* containing the name of the scope, which must stay valid
+ @param szCategory A const char* containing the category of the scope, which must stay valid, or NULL
+ @param szDetail A const char* containing a detail such as a file name, which must stay valid, or NULL
+ @param start A const Clock::time_point& containing the time when the scope started
+ @param end A const Clock::time_point& containing the time when the scope ended
+ */
+void CProfiler::AddTraceScope(	const char* szName, const char* szCategory, const char* szDetail,
+								const Clock::time_point& start, const Clock::time_point& end)
+{
+	STraceEvent sEvent;
+	sEvent.szName = szName;
+	sEvent.szCategory = szCategory;
+	sEvent.szDetail = szDetail;
+	sEvent.llStart = std::chrono::duration_cast<std::chrono::nanoseconds>(start - traceStart).count();
+	sEvent.llDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+	PushTraceEvent(sEvent);
+}
+
+/**
+ @brief Add a pass which the GPU timed to the GPU track of the trace
+ @param szName A const char* containing the name of the pass, which must stay valid
+ @param start A const Clock::time_point& containing the time when the CPU started the pass
+ @param llDuration A const long long containing the time in nanoseconds which the GPU took
+ */
+void CProfiler::AddGPUTraceScope(const char* szName, const Clock::time_point& start, const long long llDuration)
+{
+	if (bTraceRecording == false)
+		return;
+
+	if (pGPUTrace == NULL)
+	{
+		pGPUTrace = CreateTrace();
+		pGPUTrace->sName = "GPU";
+	}
+
+	STraceEvent sEvent;
+	sEvent.szName = szName;
+	sEvent.szCategory = "gpu";
+	sEvent.szDetail = NULL;
+	sEvent.llStart = std::chrono::duration_cast<std::chrono::nanoseconds>(start - traceStart).count();
+	sEvent.llDuration = llDuration;
+	PushTraceEvent(pGPUTrace, sEvent);
+}
+
+/**
+ @brief Add an event without a duration to the trace of this thread
+ @param szName A const char* containing the name of the event, which must stay valid
+ @param szCategory A const char* containing the category of the event, which must stay valid, or NULL
+ @param sDetail A const std::string& containing a detail such as the name of a state, or an empty string
+ */
+void CProfiler::AddTraceEvent(const char* szName, const char* szCategory, const std::string& sDetail)
+{
+	if (bTraceRecording == false)
+		return;
+
+	STraceEvent sEvent;
+	sEvent.szName = szName;
+	sEvent.szCategory = szCategory;
+	sEvent.szDetail = sDetail.empty() ? NULL : Intern(sDetail);
+	sEvent.llStart = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - traceStart).count();
+	sEvent.llDuration = -1;
+	PushTraceEvent(sEvent);
+}
+
+/**
+ @brief Add a sample of a counter to the trace, over the oldest sample if the trace is full. Each series of
+		the counter is drawn stacked on the others in the trace viewer
+ @param szName A const char* containing the name of the counter, which must stay valid
+ @param pszSeriesNames A const char* const* containing the names of the series, which must stay valid
+ @param pdValues A const double* containing the value of each series
+ @param uiNumSeries A const unsigned int containing the number of series, up to MAX_COUNTER_SERIES
+ */
+void CProfiler::AddTraceCounter(const char* szName, const char* const* pszSeriesNames, const double* pdValues, const unsigned int uiNumSeries)
+{
+	if (bTraceRecording == false)
+		return;
+
+	std::lock_guard<std::mutex> lock(countersMutex);
+	if (vCounters.empty())
+		vCounters.resize(NUM_TRACE_COUNTERS);
+
+	STraceCounter& sCounter = vCounters[uiNextCounter];
+	sCounter.szName = szName;
+	sCounter.pszSeriesNames = pszSeriesNames;
+	sCounter.uiNumSeries = (uiNumSeries < (unsigned int)MAX_COUNTER_SERIES) ? uiNumSeries : (unsigned int)MAX_COUNTER_SERIES;
+	for (unsigned int i = 0; i < sCounter.uiNumSeries; i++)
+		sCounter.dValues[i] = pdValues[i];
+	sCounter.llTime = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - traceStart).count();
+
+	uiNextCounter = (uiNextCounter + 1) % NUM_TRACE_COUNTERS;
+	if (uiNumCounters < NUM_TRACE_COUNTERS)
+		uiNumCounters++;
+}
+
+/**
+ @brief Keep a copy of a string for as long as the profiler
+ @param sString A const std::string& containing the string
+ @return The copy, which is the same for strings which are the same
+ */
+const char* CProfiler::Intern(const std::string& sString)
+{
+	std::lock_guard<std::mutex> lock(internedStringsMutex);
+	return setInternedStrings.insert(sString).first->c_str();
+}
+
+/**
+ @brief Write a string as a JSON string, with its special characters escaped
+ */
+static void WriteJSONString(ostream& output, const char* szString)
+{
+	output << '"';
+	for (const char* pChar = szString; *pChar; pChar++)
+	{
+		if ((*pChar == '"') || (*pChar == '\\'))
+		{
+			output << '\\' << *pChar;
+		}
+		else if ((unsigned char)*pChar < 0x20)
+		{
+			char szEscaped[8];
+			snprintf(szEscaped, sizeof(szEscaped), "\\u%04x", (unsigned char)*pChar);
+			output << szEscaped;
+		}
+		else
+		{
+			output << *pChar;
+		}
+	}
+	output << '"';
+}
+
+/**
+ @brief Save the recent scopes of every thread to a file in the Chrome Trace Event format.
+		The file can be opened in chrome://tracing or ui.perfetto.dev
+ @param sFilename A const std::string& containing the name of the file
+ @return false if the file cannot be written
+ */
+bool CProfiler::SaveTrace(const std::string& sFilename)
+{
+	ofstream outputFile(sFilename.c_str());
+	if (outputFile.is_open() == false)
+	{
+		cout << "CProfiler::SaveTrace: Unable to open " << sFilename << endl;
+		return false;
+	}
+
+	// Copy the list of threads, as threads which start now may add to it
+	std::vector<SThreadTrace*> vTraces;
+	{
+		std::lock_guard<std::mutex> lock(threadTracesMutex);
+		vTraces = vThreadTraces;
+	}
+
+	outputFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << endl;
+	outputFile << fixed;
+	outputFile.precision(3);
+	unsigned int uiNumEvents = 0;
+	for (unsigned int i = 0; i < vTraces.size(); i++)
+	{
+		SThreadTrace* pTrace = vTraces[i];
+		std::lock_guard<std::mutex> lock(pTrace->eventsMutex);
+
+		outputFile << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << pTrace->uiThreadId << ",\"args\":{\"name\":";
+		WriteJSONString(outputFile, pTrace->sName.c_str());
+		outputFile << "}}";
+
+		// The oldest event is the next one to be overwritten
+		unsigned int uiFirstEvent = (pTrace->uiNextEvent + NUM_TRACE_EVENTS - pTrace->uiNumEvents) % NUM_TRACE_EVENTS;
+		for (unsigned int j = 0; j < pTrace->uiNumEvents; j++)
+		{
+			const STraceEvent& sEvent = pTrace->vEvents[(uiFirstEvent + j) % NUM_TRACE_EVENTS];
+			outputFile << "," << endl << "{\"name\":";
+			WriteJSONString(outputFile, sEvent.szName);
+			outputFile << ",\"cat\":";
+			WriteJSONString(outputFile, sEvent.szCategory ? sEvent.szCategory : "scope");
+			if (sEvent.llDuration >= 0)
+				outputFile << ",\"ph\":\"X\",\"dur\":" << sEvent.llDuration / 1000.0;
+			else
+				outputFile << ",\"ph\":\"i\",\"s\":\"t\"";
+			outputFile << ",\"ts\":" << sEvent.llStart / 1000.0 << ",\"pid\":1,\"tid\":" << pTrace->uiThreadId;
+			if (sEvent.szDetail)
+			{
+				outputFile << ",\"args\":{\"detail\":";
+				WriteJSONString(outputFile, sEvent.szDetail);
+				outputFile << "}";
+			}
+			outputFile << "}";
+		}
+		uiNumEvents += pTrace->uiNumEvents;
+		if (i + 1 < vTraces.size())
+			outputFile << "," << endl;
+	}
+
+	// The counter samples, from the oldest
+	unsigned int uiNumCountersSaved = 0;
+	{
+		std::lock_guard<std::mutex> lock(countersMutex);
+		unsigned int uiFirstCounter = (uiNextCounter + NUM_TRACE_COUNTERS - uiNumCounters) % NUM_TRACE_COUNTERS;
+		for (unsigned int j = 0; j < uiNumCounters; j++)
+		{
+			const STraceCounter& sCounter = vCounters[(uiFirstCounter + j) % NUM_TRACE_COUNTERS];
+			if ((vTraces.empty() == false) || (j > 0))
+				outputFile << "," << endl;
+			outputFile << "{\"name\":";
+			WriteJSONString(outputFile, sCounter.szName);
+			outputFile << ",\"ph\":\"C\",\"ts\":" << sCounter.llTime / 1000.0 << ",\"pid\":1,\"args\":{";
+			for (unsigned int k = 0; k < sCounter.uiNumSeries; k++)
+			{
+				if (k > 0)
+					outputFile << ",";
+				WriteJSONString(outputFile, sCounter.pszSeriesNames[k]);
+				outputFile << ":" << sCounter.dValues[k];
+			}
+			outputFile << "}}";
+		}
+		uiNumCountersSaved = uiNumCounters;
+	}
+	outputFile << endl << "]}" << endl;
+
+	if (outputFile.fail())
+	{
+		cout << "CProfiler::SaveTrace: Unable to write " << sFilename << endl;
+		return false;
+	}
+	cout << "CProfiler: Saved " << uiNumEvents << " events of " << vTraces.size() << " threads and "
+		<< uiNumCountersSaved << " counter samples to " << sFilename << endl;
+	return true;
+}
+
+/**
+ @brief Save the recent scopes of every thread to the next numbered trace file, e.g. Trace_001.json
+ @return false if the file cannot be written
+ */
+bool CProfiler::SaveTrace(void)
+{
+	char szNumber[16];
+	snprintf(szNumber, sizeof(szNumber), "_%03u.json", ++uiNumTracesSaved);
+	return SaveTrace(sTraceFilePrefix + szNumber);
+}
+
+/**
+ @brief Get the trace of this thread, and create it if this thread has not added events yet
+ */
+CProfiler::SThreadTrace* CProfiler::GetThreadTrace(void)
+{
+	if ((pThisThreadTrace) && (uiThisThreadGeneration == uiGeneration))
+		return pThisThreadTrace;
+
+	SThreadTrace* pTrace = CreateTrace();
+	pTrace->sName = (std::this_thread::get_id() == mainThreadId) ? "Main" : "Thread " + to_string(pTrace->uiThreadId);
+
+	pThisThreadTrace = pTrace;
+	uiThisThreadGeneration = uiGeneration;
+	return pTrace;
+}
+
+/**
+ @brief Create a trace and add it to the traces which are saved, with the next thread id
+ */
+CProfiler::SThreadTrace* CProfiler::CreateTrace(void)
+{
+	SThreadTrace* pTrace = new SThreadTrace();
+	pTrace->vEvents.resize(NUM_TRACE_EVENTS);
+	pTrace->uiNextEvent = 0;
+	pTrace->uiNumEvents = 0;
+	std::lock_guard<std::mutex> lock(threadTracesMutex);
+	vThreadTraces.push_back(pTrace);
+	pTrace->uiThreadId = (unsigned int)vThreadTraces.size();
+	return pTrace;
+}
+
+/**
+ @brief Add an event to the trace of this thread, over its oldest event if the trace is full
+ @param sEvent A const STraceEvent& containing the event
+ */
+void CProfiler::PushTraceEvent(const STraceEvent& sEvent)
+{
+	PushTraceEvent(GetThreadTrace(), sEvent);
+}
+
+/**
+ @brief Add an event to a trace, over its oldest event if the trace is full
+ @param pTrace A SThreadTrace* containing the trace
+ @param sEvent A const STraceEvent& containing the event
+ */
+void CProfiler::PushTraceEvent(SThreadTrace* pTrace, const STraceEvent& sEvent)
+{
+	std::lock_guard<std::mutex> lock(pTrace->eventsMutex);
+	pTrace->vEvents[pTrace->uiNextEvent] = sEvent;
+	pTrace->uiNextEvent = (pTrace->uiNextEvent + 1) % NUM_TRACE_EVENTS;
+	if (pTrace->uiNumEvents < NUM_TRACE_EVENTS)
+		pTrace->uiNumEvents++;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CProfiler::PrintSelf(void) const
+{
+	cout << "CProfiler: " << (bEnabled ? "enabled" : "disabled") << ", " << uiHistorySize << " frames kept" << endl;
+	if (uiHistorySize == 0)
+		return;
+
+	const SFrame& sFrame = GetFrame(0);
+	cout << "Latest frame: " << sFrame.dTime * 1000.0 << " ms" << endl;
+	PrintScopes(sFrame.vScopes, -1);
+}
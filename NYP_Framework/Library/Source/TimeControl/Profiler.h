@@ -0,0 +1,316 @@
+/**
+ CProfiler
+ @brief A class which times the scopes of each frame on the main thread, and builds a call tree of them.
+		It keeps the call trees of the recent frames, and draws them in an ImGui overlay as a flame graph,
+		a list of the slowest scopes and a graph of the frame times.
+		It also keeps the recent scopes of every thread, which can be saved as a trace in the Chrome Trace
+		Event format, to be opened in chrome://tracing or Perfetto, along with the recent samples of counters
+		such as the draw calls of each frame, and the times of the passes on the GPU.
+		Time a scope with PROFILE_SCOPE("Name"). Define PROFILER_DISABLED to compile the timers out
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <unordered_set>
+
+class CProfiler : public CSingletonTemplate<CProfiler>
+{
+	friend CSingletonTemplate<CProfiler>;
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	// A scope in the call tree of a frame. The calls of a scope with the same parent are added together
+	struct SScope
+	{
+		// The name given to PROFILE_SCOPE. It must stay valid, e.g. a string literal
+		const char* szName;
+		// The index of the parent scope in the frame, or -1 for a scope which is not inside another scope
+		int iParent;
+		unsigned int uiDepth;
+		// The time in seconds from the start of the frame to the first call
+		double dStart;
+		// The total time of the calls in seconds
+		double dTime;
+		unsigned int uiNumCalls;
+	};
+
+	// The call tree of a frame. The scopes are in the order they were first called, so a scope is after its parent
+	struct SFrame
+	{
+		std::vector<SScope> vScopes;
+		double dTime;
+	};
+
+	// The number of frames which are kept
+	enum { NUM_HISTORY = 240 };
+	// The number of trace events which are kept for each thread
+	enum { NUM_TRACE_EVENTS = 32768 };
+	// The number of counter samples which are kept for a trace
+	enum { NUM_TRACE_COUNTERS = 8192 };
+	// The most series which a counter sample can have
+	enum { MAX_COUNTER_SERIES = 8 };
+
+	// Set if the scopes are timed
+	void SetEnabled(const bool bEnabled);
+	// Check if the scopes are timed
+	bool IsEnabled(void) const;
+
+	// Set if the overlay is drawn
+	void SetOverlayVisible(const bool bOverlayVisible);
+	// Check if the overlay is drawn
+	bool IsOverlayVisible(void) const;
+
+	// Set the frame time in seconds above which a frame is shown as a spike
+	void SetFrameBudget(const double dFrameBudget);
+	// Get the frame time in seconds above which a frame is shown as a spike
+	double GetFrameBudget(void) const;
+
+	// Start timing a scope. Returns false if the scope is not timed, in which case EndScope must not be called
+	bool BeginScope(const char* szName);
+	// Stop timing the latest scope which was started
+	void EndScope(void);
+
+	// End the frame and start the next one. Every scope of the frame must have ended
+	void EndFrame(void);
+
+	// Get the number of frames which are kept
+	unsigned int GetNumFrames(void) const;
+	// Get a frame, where 0 is the latest frame which ended
+	const SFrame& GetFrame(const unsigned int uiFramesAgo) const;
+
+	// Draw the overlay into the ImGui frame of the active game state
+	void RenderOverlay(void);
+
+	// Set if the recent scopes of every thread are kept for a trace
+	void SetTraceRecording(const bool bTraceRecording);
+	// Check if the recent scopes of every thread are kept for a trace
+	bool IsTraceRecording(void) const;
+
+	// Set the frame time in seconds above which a trace is saved. 0 never saves a trace for a slow frame
+	void SetTraceSpikeTime(const double dTraceSpikeTime);
+	// Set the start of the names of the trace files
+	void SetTraceFilePrefix(const std::string& sTraceFilePrefix);
+
+	// Set the name of this thread in the traces
+	void SetThreadName(const std::string& sName);
+
+	// Add a scope which has ended to the trace of this thread
+	void AddTraceScope(	const char* szName, const char* szCategory, const char* szDetail,
+						const Clock::time_point& start, const Clock::time_point& end);
+	// Add a pass which the GPU timed to the GPU track of the trace, at the time the CPU started the pass
+	void AddGPUTraceScope(const char* szName, const Clock::time_point& start, const long long llDuration);
+	// Add an event without a duration, such as a state change, to the trace of this thread
+	void AddTraceEvent(const char* szName, const char* szCategory, const std::string& sDetail = "");
+	// Add a sample of a counter with one or more series, such as the draw calls of each pass, to the trace
+	void AddTraceCounter(const char* szName, const char* const* pszSeriesNames, const double* pdValues, const unsigned int uiNumSeries);
+
+	// Keep a copy of a string for as long as the profiler, for a detail which is not a string literal
+	const char* Intern(const std::string& sString);
+
+	// Save the recent scopes of every thread to a file in the Chrome Trace Event format
+	bool SaveTrace(const std::string& sFilename);
+	// Save the recent scopes of every thread to the next numbered trace file
+	bool SaveTrace(void);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// The times of the scopes with the same name, per frame, for the list of the slowest scopes
+	struct SScopeTotal
+	{
+		const char* szName;
+		// The time which is not in the children of the scope
+		double dSelfTime;
+		double dTime;
+		double dNumCalls;
+	};
+
+	bool bEnabled;
+	bool bOverlayVisible;
+	// If true, the overlay keeps showing the same frames
+	bool bPaused;
+	double dFrameBudget;
+
+	// Only the scopes of this thread are timed
+	std::thread::id mainThreadId;
+
+	// The frame which is being timed
+	SFrame sCurrentFrame;
+	Clock::time_point frameStart;
+	// The index of the innermost scope which has not ended, or -1 if there is none
+	int iCurrentScope;
+	// The start times of the scopes which have not ended
+	std::vector<Clock::time_point> vScopeStarts;
+
+	// The frames which ended, in a ring buffer
+	std::vector<SFrame> vHistory;
+	unsigned int uiHistoryIndex;
+	unsigned int uiHistorySize;
+
+	// The frame shown in the flame graph, as the number of frames before the latest frame
+	unsigned int uiSelectedFrame;
+
+	// The slowest scopes, which are only added up a few times a second
+	std::vector<SScopeTotal> vTopScopes;
+	unsigned int uiFramesSinceTopScopes;
+
+	// An event in a trace. An event without a duration has a llDuration of -1
+	struct STraceEvent
+	{
+		const char* szName;
+		const char* szCategory;
+		const char* szDetail;
+		// The times in nanoseconds since the profiler was created
+		long long llStart;
+		long long llDuration;
+	};
+
+	// The recent events of a thread, in a ring buffer. Only its thread adds events, but any thread may save them
+	struct SThreadTrace
+	{
+		std::mutex eventsMutex;
+		unsigned int uiThreadId;
+		std::string sName;
+		std::vector<STraceEvent> vEvents;
+		unsigned int uiNextEvent;
+		unsigned int uiNumEvents;
+	};
+
+	bool bTraceRecording;
+	double dTraceSpikeTime;
+	std::string sTraceFilePrefix;
+	unsigned int uiNumTracesSaved;
+	// The time of the last trace which was saved for a slow frame, so that a run of slow frames saves one trace
+	Clock::time_point lastSpikeTrace;
+	// The time which the trace times start from
+	Clock::time_point traceStart;
+
+	// The traces of the threads which added events
+	std::vector<SThreadTrace*> vThreadTraces;
+	std::mutex threadTracesMutex;
+	// The track of the passes which the GPU timed, which is created by the first pass
+	SThreadTrace* pGPUTrace;
+
+	// A sample of a counter. The names must stay valid, e.g. string literals
+	struct STraceCounter
+	{
+		const char* szName;
+		const char* const* pszSeriesNames;
+		double dValues[MAX_COUNTER_SERIES];
+		unsigned int uiNumSeries;
+		// The time in nanoseconds since the profiler was created
+		long long llTime;
+	};
+
+	// The recent counter samples of every thread, in a ring buffer which is created by the first sample
+	std::vector<STraceCounter> vCounters;
+	unsigned int uiNextCounter;
+	unsigned int uiNumCounters;
+	std::mutex countersMutex;
+
+	// Each profiler which is created gets the next generation, so that the threads do not use the traces of a profiler which was destroyed
+	static unsigned int uiLastGeneration;
+	unsigned int uiGeneration;
+	// The trace of this thread, and the generation of the profiler which it belongs to
+	static thread_local SThreadTrace* pThisThreadTrace;
+	static thread_local unsigned int uiThisThreadGeneration;
+
+	// The strings which were given to Intern
+	std::unordered_set<std::string> setInternedStrings;
+	std::mutex internedStringsMutex;
+
+	// Constructor
+	CProfiler(void);
+
+	// Destructor
+	virtual ~CProfiler(void);
+
+	// Add up the times of the scopes of the recent frames by name, from the slowest
+	void UpdateTopScopes(void);
+
+	// Draw the graph of the frame times
+	void RenderFrameGraph(void);
+	// Draw the call tree of the selected frame as a flame graph
+	void RenderFlameGraph(void);
+	// Draw the list of the slowest scopes
+	void RenderTopScopes(void);
+
+	// Get the trace of this thread, and create it if this thread has not added events yet
+	SThreadTrace* GetThreadTrace(void);
+	// Create a trace and add it to the traces which are saved
+	SThreadTrace* CreateTrace(void);
+	// Add an event to the trace of this thread
+	void PushTraceEvent(const STraceEvent& sEvent);
+	// Add an event to a trace
+	void PushTraceEvent(SThreadTrace* pTrace, const STraceEvent& sEvent);
+};
+
+/**
+ CProfileScope
+ @brief A class which times the scope it is declared in, for the call tree and the trace.
+		Use PROFILE_SCOPE instead of this class
+ */
+class CProfileScope
+{
+public:
+	// Constructor
+	explicit CProfileScope(const char* szName, const char* szCategory = NULL, const char* szDetail = NULL)
+		: szName(szName)
+		, szCategory(szCategory)
+		, szDetail(szDetail)
+		, bTimed(CProfiler::GetInstance()->BeginScope(szName))
+		, bTraced(CProfiler::GetInstance()->IsTraceRecording())
+	{
+		if (bTraced)
+			start = CProfiler::Clock::now();
+	}
+
+	// Destructor
+	~CProfileScope(void)
+	{
+		if (bTraced)
+			CProfiler::GetInstance()->AddTraceScope(szName, szCategory, szDetail, start, CProfiler::Clock::now());
+		if (bTimed)
+			CProfiler::GetInstance()->EndScope();
+	}
+
+protected:
+	const char* szName;
+	const char* szCategory;
+	const char* szDetail;
+	bool bTimed;
+	bool bTraced;
+	CProfiler::Clock::time_point start;
+
+private:
+	CProfileScope(const CProfileScope&);
+	CProfileScope& operator=(const CProfileScope&);
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifndef PROFILER_DISABLED
+	// Time the rest of the scope under a name
+	#define PROFILE_SCOPE(szName) CProfileScope PROFILE_CONCAT(cProfileScope, __LINE__)(szName)
+	// Time the rest of the scope under a name, with a category for the trace such as "asset" or "gpu"
+	#define PROFILE_SCOPE_CATEGORY(szName, szCategory) CProfileScope PROFILE_CONCAT(cProfileScope, __LINE__)(szName, szCategory)
+	// Time the rest of the scope under a name, with a category and a std::string detail such as a file name for the trace
+	#define PROFILE_SCOPE_DETAIL(szName, szCategory, sDetail) CProfileScope PROFILE_CONCAT(cProfileScope, __LINE__)(szName, szCategory, \
+		CProfiler::GetInstance()->IsTraceRecording() ? CProfiler::GetInstance()->Intern(sDetail) : NULL)
+	// Add an event without a duration to the trace
+	#define PROFILE_EVENT(szName, szCategory, sDetail) CProfiler::GetInstance()->AddTraceEvent(szName, szCategory, sDetail)
+#else
+	#define PROFILE_SCOPE(szName)
+	#define PROFILE_SCOPE_CATEGORY(szName, szCategory)
+	#define PROFILE_SCOPE_DETAIL(szName, szCategory, sDetail)
+	#define PROFILE_EVENT(szName, szCategory, sDetail)
+#endif
@@ -6,6 +6,8 @@
  */
 #include "StopWatch.h"
 
+#ifdef _WIN32
+
 #define TARGET_RESOLUTION 1         // 1-millisecond target resolution
 
 /**
@@ -98,3 +100,4 @@ double CStopWatch::LIToSecs(LARGE_INTEGER & L)
 {
 	return ((double)L.QuadPart / (double)frequency.QuadPart);
 }
+#endif
@@ -1,11 +1,13 @@
 /**
  CStopWatch
- @brief A class to calculate time duration
+ @brief A class to calculate time duration. It uses the Windows timers, so it is only built on Windows.
+		CFramePacer is the portable timer which the main loop uses
  By: Toh Da Jun
  Date: Mar 2020
  */
 #pragma once
 
+#ifdef _WIN32
 #include <windows.h>
 
 class CStopWatch
@@ -40,3 +42,4 @@ protected:
 	// Convert from Large Integer to seconds in double
 	double LIToSecs(LARGE_INTEGER & L);
 };
+#endif
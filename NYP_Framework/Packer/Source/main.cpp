@@ -0,0 +1,71 @@
+/**
+ main.cpp
+ @brief This file contains the main function of the Packer, which makes the archive of the assets which the game
+		reads instead of their files. See CAssetArchive.
+		Run it from the App folder, so that the Image, Sounds and Maps folders are found, and run it again
+		whenever an asset is changed, as the game reads the archive when it exists.
+		--output <file>		Save the archive to this file. The default is Assets.pak
+		--no-compression	Store every asset as it is, instead of compressing the assets which become smaller
+		--no-cook			Only store the images, instead of also cooking them into the textures which are uploaded
+							without decoding them
+		<folder>...			Pack these folders instead of Image, Sounds and Maps
+ */
+// Include CAssetArchive
+#include "System/AssetArchive.h"
+
+#include <iostream>
+#include <cstring>
+#include <string>
+#include <vector>
+using namespace std;
+
+/**
+ @brief This function is the main function which is called by the operating system when you run the executables
+ @param argc The number of command line arguments
+ @param argv The command line arguments
+ @return This function returns the error codes
+ */
+int main(int argc, char* argv[])
+{
+	string sOutput = "Assets.pak";
+	bool bCompress = true;
+	bool bCookTextures = true;
+	vector<string> vFolders;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+		{
+			sOutput = argv[++i];
+		}
+		else if (strcmp(argv[i], "--no-compression") == 0)
+		{
+			bCompress = false;
+		}
+		else if (strcmp(argv[i], "--no-cook") == 0)
+		{
+			bCookTextures = false;
+		}
+		else if (strncmp(argv[i], "--", 2) == 0)
+		{
+			cout << "Invalid option " << argv[i] << endl;
+			cout << "Options: --output <file>, --no-compression, --no-cook, <folder>..." << endl;
+			return 1;
+		}
+		else
+		{
+			vFolders.push_back(argv[i]);
+		}
+	}
+
+	if (vFolders.empty())
+	{
+		vFolders.push_back("Image");
+		vFolders.push_back("Sounds");
+		vFolders.push_back("Maps");
+	}
+
+	if (CAssetArchive::Pack(sOutput, vFolders, bCompress, bCookTextures) == false)
+		return 1;
+	return 0;
+}